@@ -42,6 +42,18 @@ __asm__(".include \"include/cri_macro.inc\"\n");
 
 #endif
 
+// Globals marked with SIM_STATE make up the simulation state that netplay rolls back. They are placed in their own
+// section, so that the whole state can be saved and loaded with a single copy (see netplay/game_state.c).
+#if defined(M2CTX)
+#define SIM_STATE
+#elif defined(__APPLE__)
+#define SIM_STATE __attribute__((section("__DATA,__sim_state")))
+#elif defined(_WIN32)
+#define SIM_STATE __attribute__((section(".simst$m")))
+#else
+#define SIM_STATE __attribute__((section("sim_state")))
+#endif
+
 #ifndef __dead2
 #define __dead2 __attribute__((__noreturn__))
 #endif
@@ -18,4 +18,8 @@ void SDLApp_BeginFrame();
 void SDLApp_EndFrame();
 void SDLApp_Exit();
 
+/// @brief Stretch or shrink the time each frame takes.
+/// @param scale Multiplier for the target frame time. `1` means regular speed.
+void SDLApp_SetFrameTimeScale(double scale);
+
 #endif
@@ -15,6 +15,12 @@ extern SDL_Mutex* soundLock;
 void SPU_Init(void (*cb)());
 void SPU_Upload(u32 dst, void* src, u32 size);
 void SPU_Tick(s16* output);
+
+/// Stop feeding the audio device. Samples are then only produced by `SPU_Render`.
+void SPU_BeginCapture();
+
+/// Produce interleaved stereo samples at 48 kHz. Only call after `SPU_BeginCapture`.
+void SPU_Render(s16* output, int samples_per_channel);
 void SPU_VoiceStart(int vnum, u32 start_addr);
 void SPU_VoiceGetConf(int vnum, struct SPUVConf* conf);
 void SPU_VoiceSetConf(int vnum, struct SPUVConf* conf);
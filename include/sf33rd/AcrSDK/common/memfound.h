@@ -6,6 +6,7 @@
 #include "types.h"
 
 extern MEM_BLOCK sysmemblock[4096];
+extern MEM_MGR sysmemmgr;
 
 void mflInit(void* mem_ptr, s32 memsize, s32 memalign);
 u32 mflGetSpace();
@@ -0,0 +1,20 @@
+#ifndef MEMSLAB_H
+#define MEMSLAB_H
+
+#include "types.h"
+
+#include <stdbool.h>
+
+/// Largest allocation that is served from slabs
+#define MEM_SLAB_SIZE_MAX 0x100000
+
+/// Set on handles returned by `plslabRegister` so that they can't be mistaken for `plmemRegister` handles
+#define MEM_SLAB_HANDLE_FLAG 0x80000000
+
+void plslabInit();
+u32 plslabRegister(s32 len);
+void* plslabRetrieve(u32 handle);
+s32 plslabRelease(u32 handle);
+bool plslabIsHandle(u32 handle);
+
+#endif
@@ -5,13 +5,23 @@
 #include "structs.h"
 #include "types.h"
 
+#include <stdbool.h>
+
 s32 plReport(s8* format, ...);
 void plMemset(void* dst, u32 pat, s32 size);
 void plMemmove(void* dst, void* src, s32 size);
+void plSwapBytes16(void* data, s32 count);
+void plSwapBytes32(void* data, s32 count);
+void plSwapNibbles(void* data, s32 count);
 void* plCalcAddress(s32 x, s32 y, plContext* lpcontext);
 s32 plDrawPixel(plContext* dst, Pixel* ptr);
 s32 plDrawPixel_3(plContext* dst, s32 x, s32 y, u32 color);
 u32 plGetColor(s32 x, s32 y, plContext* lpcontext);
 s32 plConvertContext(plContext* dst, plContext* src);
 
+/// Convert pseudo-random pixels between every pair of known formats at several sizes, including sources smaller than
+/// the destination, and make sure that plConvertContext produces what the generic path does
+/// @return Whether every conversion matched.
+bool plRunConversionTest(s32 seeds);
+
 #endif
@@ -4,17 +4,25 @@
 #include "structs.h"
 #include "types.h"
 
+#include <stdbool.h>
+
 s32 flFileRead(s8* filename, void* buf, s32 len);
 s32 flFileWrite(s8* filename, void* buf, s32 len);
 s32 flFileAppend(s8* filename, void* buf, ssize_t len);
 s32 flFileLength(s8* filename);
 void flMemset(void* dst, u32 pat, s32 size);
 void flMemcpy(void* dst, void* src, s32 size);
+
+/// Make sure that the memory helpers match the byte loops they replaced, then time both on copies the size of the
+/// largest textures and on the moves done by compaction, and print the results
+/// @return Whether the memory helpers match the byte loops.
+bool flRunMemoryBenchmark(s32 iterations);
+
 void* flAllocMemory(s32 size);
 s32 flGetFrame(FMS_FRAME* frame);
 s32 flGetSpace();
 void* flAllocMemoryS(s32 size);
-u32 flPS2GetSystemMemoryHandle(s32 len, s32 type);
+u32 flPS2GetSystemMemoryHandleAt(s32 len, s32 type, const char* site);
 void flPS2ReleaseSystemMemory(u32 handle);
 void* flPS2GetSystemBuffAdrs(u32 handle);
 void flPS2SystemTmpBuffInit();
@@ -22,4 +30,7 @@ void flPS2SystemTmpBuffFlush();
 uintptr_t flPS2GetSystemTmpBuff(s32 len, s32 align);
 u32 flCreateTextureFromFile(s8* file, u32 flag);
 
+/// Allocations are attributed to the calling function in memory stats
+#define flPS2GetSystemMemoryHandle(len, type) flPS2GetSystemMemoryHandleAt(len, type, __func__)
+
 #endif // FLPS2ETC_H
@@ -4,6 +4,8 @@
 #include "structs.h"
 #include "types.h"
 
+#include <stdbool.h>
+
 void mmSystemInitialize();
 void mmHeapInitialize(_MEMMAN_OBJ* mmobj, u8* adrs, s32 size, s32 unit, s8* format);
 uintptr_t mmRoundUp(s32 unit, uintptr_t num);
@@ -15,4 +17,7 @@ u8* mmAlloc(_MEMMAN_OBJ* mmobj, ssize_t size, s32 flag);
 struct _MEMMAN_CELL* mmAllocSub(_MEMMAN_OBJ* mmobj, ssize_t size, s32 flag);
 void mmFree(_MEMMAN_OBJ* mmobj, u8* adrs);
 
+/// Find gaps by walking every cell instead of through the gap index. Only meant for comparing the two.
+void mmUseLinearSearch(bool use);
+
 #endif
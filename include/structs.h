@@ -822,6 +822,15 @@ typedef struct _MEMMAN_CELL {
     ssize_t size;
 } _MEMMAN_CELL;
 
+// Lives in the free space that follows `owner`
+typedef struct _MEMMAN_GAP {
+    struct _MEMMAN_GAP* prev;
+    struct _MEMMAN_GAP* next;
+    struct _MEMMAN_CELL* owner;
+} _MEMMAN_GAP;
+
+#define MEMMAN_GAP_BINS 64
+
 typedef struct {
     u8* memHead;
     ssize_t memSize;
@@ -834,6 +843,8 @@ typedef struct {
     u8* oriHead;
     s32 oriSize;
     s32 debIndex;
+    struct _MEMMAN_GAP* gapBin[MEMMAN_GAP_BINS]; // Free gaps binned by size
+    u64 gapBinMap;                               // Bit n is set when gapBin[n] isn't empty
 } _MEMMAN_OBJ;
 
 typedef struct {
@@ -1,8 +1,11 @@
 #include "main.h"
 #include "common.h"
+#include "netplay/game_state.h"
 #include "netplay/netplay.h"
+#include "netplay/soak_test.h"
 #include "port/sdl/sdl_app.h"
 #include "sf33rd/AcrSDK/common/mlPAD.h"
+#include "sf33rd/AcrSDK/common/prilay.h"
 #include "sf33rd/AcrSDK/ps2/flps2debug.h"
 #include "sf33rd/AcrSDK/ps2/flps2etc.h"
 #include "sf33rd/AcrSDK/ps2/flps2render.h"
@@ -37,8 +40,17 @@
 #include "sf33rd/Source/Game/debug/debug_config.h"
 #endif
 
+#include "port/config.h"
+#include "port/hash_stream.h"
 #include "port/io/afs.h"
+#include "port/match_farm.h"
+#include "port/memman_trace.h"
+#include "port/paths.h"
+#include "port/replays.h"
 #include "port/resources.h"
+#include "port/startup_trace.h"
+#include "port/training_states.h"
+#include "port/video_export.h"
 
 #include <SDL3/SDL.h>
 
@@ -51,6 +63,7 @@
 
 #include <memory.h>
 #include <stdbool.h>
+#include <stdio.h>
 
 // sbss
 s32 system_init_level;
@@ -103,8 +116,17 @@ static bool run_resource_flow() {
 
 static void afs_init() {
     char* file_path = Resources_GetPath("SF33RD.AFS");
-    AFS_Init(file_path);
+    char* index_cache_path = NULL;
+
+    if (Config_GetBool(CFG_KEY_AFS_INDEX_CACHE)) {
+        SDL_asprintf(&index_cache_path, "%safs_index.bin", Paths_GetBasePath());
+    }
+
+    AFS_Init(file_path, Config_GetBool(CFG_KEY_AFS_MMAP), index_cache_path);
+    SDL_free(index_cache_path);
     SDL_free(file_path);
+    sndPreloadInitialData();
+    StartupTrace_Mark("AFS table of contents");
 }
 
 static void step_0() {
@@ -113,6 +135,7 @@ static void step_0() {
     }
 
     if (!is_game_initialized) {
+        StartupTrace_Mark("resources check");
         afs_init();
         game_init();
         is_game_initialized = true;
@@ -132,26 +155,175 @@ static void step_1() {
     game_step_1();
 }
 
-int main(int argc, char* argv[]) {
-    bool is_running = true;
+/// Parse a pair of comma separated numbers, like `3,11`
+static void parse_pair(const char* value, int pair[2]) {
+    char* end = NULL;
+    pair[0] = SDL_strtol(value, &end, 10);
+    pair[1] = (*end == ',') ? SDL_strtol(end + 1, NULL, 10) : pair[0];
+}
 
-    init_windows_console();
-    SDLApp_Init();
+/// Render to memory and play sound nowhere
+static void use_offscreen_drivers() {
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+    SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+}
 
-    if (argc >= 3) {
+/// Parse `[player ip] [--headless] [--soak frames] [--seed n] [--inputs path] [--report path] [--timings path]
+/// [--bench-state iterations] [--farm matches] [--farm-chars p1,p2] [--farm-arts p1,p2] [--farm-difficulty n]
+/// [--export replay] [--export-out path] [--export-scale n] [--hash-stream replay] [--hash-out path]
+/// [--memman-trace path] [--bench-memman trace] [--test-memman seeds] [--bench-memory iterations]
+/// [--test-pixel-formats seeds] [--play replay]`
+/// @param exit_code Set to `1` when a test or the check before a benchmark fails.
+/// @return Whether the game should start. It doesn't after running a benchmark or a test, or if an export, a hash
+/// stream or playing a replay can't be set up.
+static bool parse_args(int argc, char* argv[], int* exit_code) {
+    int first_option = 1;
+
+    if ((argc >= 3) && (argv[1][0] != '-')) {
         const int player = SDL_atoi(argv[1]);
         const char* ip = argv[2];
         Netplay_SetParams(player, ip);
+        first_option = 3;
     }
 
+    SoakTestParams soak_params = { .report_path = "soak_report.json" };
+    bool run_soak_test = false;
+    MatchFarmParams farm_params = { .report_path = "farm_report.jsonl", .difficulty = -1 };
+    bool run_match_farm = false;
+    VideoExportParams export_params = { .output_path = "export.mp4", .scale = 3 };
+    bool run_export = false;
+    HashStreamParams hash_params = { .output_path = "hashes.3sxh" };
+    bool run_hash_stream = false;
+    const char* play_path = NULL;
+
+    for (int i = first_option; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (SDL_strcmp(arg, "--headless") == 0) {
+            use_offscreen_drivers();
+            continue;
+        }
+
+        if (value == NULL) {
+            printf("⚠️ missing value for %s\n", arg);
+            break;
+        }
+
+        if (SDL_strcmp(arg, "--soak") == 0) {
+            soak_params.frames = SDL_atoi(value);
+            run_soak_test = true;
+        } else if (SDL_strcmp(arg, "--seed") == 0) {
+            soak_params.seed = SDL_strtoul(value, NULL, 10);
+            farm_params.seed = soak_params.seed;
+            hash_params.seed = soak_params.seed;
+        } else if (SDL_strcmp(arg, "--inputs") == 0) {
+            soak_params.input_path = value;
+            farm_params.input_path = value;
+        } else if (SDL_strcmp(arg, "--report") == 0) {
+            soak_params.report_path = value;
+            farm_params.report_path = value;
+        } else if (SDL_strcmp(arg, "--timings") == 0) {
+            soak_params.timings_path = value;
+        } else if (SDL_strcmp(arg, "--bench-state") == 0) {
+            GameState_RunBenchmark(SDL_atoi(value));
+            return false;
+        } else if (SDL_strcmp(arg, "--memman-trace") == 0) {
+            MemManTrace_Start(value);
+        } else if (SDL_strcmp(arg, "--bench-memman") == 0) {
+            MemManTrace_RunBenchmark(value);
+            return false;
+        } else if (SDL_strcmp(arg, "--test-memman") == 0) {
+            *exit_code = MemManTrace_RunRandomTest(SDL_atoi(value)) ? 0 : 1;
+            return false;
+        } else if (SDL_strcmp(arg, "--bench-memory") == 0) {
+            *exit_code = flRunMemoryBenchmark(SDL_atoi(value)) ? 0 : 1;
+            return false;
+        } else if (SDL_strcmp(arg, "--test-pixel-formats") == 0) {
+            *exit_code = plRunConversionTest(SDL_atoi(value)) ? 0 : 1;
+            return false;
+        } else if (SDL_strcmp(arg, "--farm") == 0) {
+            farm_params.matches = SDL_atoi(value);
+            run_match_farm = true;
+        } else if (SDL_strcmp(arg, "--farm-chars") == 0) {
+            parse_pair(value, farm_params.characters);
+        } else if (SDL_strcmp(arg, "--farm-arts") == 0) {
+            parse_pair(value, farm_params.super_arts);
+        } else if (SDL_strcmp(arg, "--farm-difficulty") == 0) {
+            farm_params.difficulty = SDL_atoi(value);
+        } else if (SDL_strcmp(arg, "--export") == 0) {
+            export_params.replay_path = value;
+            run_export = true;
+        } else if (SDL_strcmp(arg, "--export-out") == 0) {
+            export_params.output_path = value;
+        } else if (SDL_strcmp(arg, "--export-scale") == 0) {
+            export_params.scale = SDL_atoi(value);
+        } else if (SDL_strcmp(arg, "--hash-stream") == 0) {
+            hash_params.replay_path = value;
+            run_hash_stream = true;
+        } else if (SDL_strcmp(arg, "--hash-out") == 0) {
+            hash_params.output_path = value;
+        } else if (SDL_strcmp(arg, "--play") == 0) {
+            play_path = value;
+        } else {
+            printf("⚠️ unknown option %s\n", arg);
+            continue;
+        }
+
+        i += 1;
+    }
+
+    if (run_export) {
+        use_offscreen_drivers();
+        return VideoExport_Init(&export_params);
+    }
+
+    if (run_hash_stream) {
+        use_offscreen_drivers();
+        return HashStream_Init(&hash_params);
+    }
+
+    if (play_path != NULL) {
+        return Replays_Play(play_path);
+    }
+
+    if (run_soak_test) {
+        SoakTest_Init(&soak_params);
+    } else if (run_match_farm) {
+        MatchFarm_Init(&farm_params);
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    bool is_running = true;
+    int exit_code = 0;
+
+    StartupTrace_Begin();
+    init_windows_console();
+
+    if (!parse_args(argc, argv, &exit_code)) {
+        return exit_code;
+    }
+
+    SDLApp_Init();
+
     while (is_running) {
         SDLApp_BeginFrame();
         step_0();
         SDLApp_EndFrame();
+
+        if (is_game_initialized) {
+            StartupTrace_Finish();
+        }
+
         is_running = SDLApp_PollEvents();
         step_1();
     }
 
+    Replays_Quit();
+    MemManTrace_Stop();
     AFS_Finish();
     SDLApp_Quit();
     return 0;
@@ -176,6 +348,7 @@ static void game_init() {
 #endif
 
     flInitialize();
+    StartupTrace_Mark("flInitialize");
     flSetRenderState(FLRENDER_BACKCOLOR, 0);
     system_init_level = 0;
     ppgWorkInitializeApprication();
@@ -186,6 +359,7 @@ static void game_init() {
     ppgMakeConvTableTexDC();
     appSetupBasePriority();
     MemcardInit();
+    StartupTrace_Mark("game init");
 }
 
 static void game_step_0() {
@@ -196,10 +370,30 @@ static void game_step_0() {
     }
 
     appSetupTempPriority();
+    TrainingStates_Update();
+    Replays_Update();
 
     flPADGetALL();
     keyConvert();
 
+    if (SoakTest_IsActive()) {
+        SoakTest_InjectInputs();
+    }
+
+    if (MatchFarm_IsActive()) {
+        MatchFarm_InjectInputs();
+    }
+
+    if (VideoExport_IsActive()) {
+        VideoExport_InjectInputs();
+    }
+
+    if (HashStream_IsActive()) {
+        HashStream_InjectInputs();
+    }
+
+    Replays_InjectInputs();
+
 #if defined(DEBUG)
     if (!test_flag) {
         if (mpp_w.sysStop) {
@@ -250,24 +444,7 @@ static void game_step_0() {
     }
 #endif
 
-    if ((Play_Mode != 3 && Play_Mode != 1) || (Game_pause != 0x81)) {
-        p1sw_1 = p1sw_0;
-        p2sw_1 = p2sw_0;
-        p3sw_1 = p3sw_0;
-        p4sw_1 = p4sw_0;
-        p1sw_0 = p1sw_buff;
-        p2sw_0 = p2sw_buff;
-        p3sw_0 = p3sw_buff;
-        p4sw_0 = p4sw_buff;
-
-        if ((task[TASK_MENU].condition == 1) && (Mode_Type == MODE_PARRY_TRAINING) && (Play_Mode == 1)) {
-            const u16 sw_buff = p2sw_0;
-            p2sw_0 = p1sw_0;
-            p1sw_0 = sw_buff;
-        }
-    }
-
-    appCopyKeyData();
+    appLatchKeyData();
 
     mpp_w.inGame = false;
 
@@ -283,6 +460,22 @@ static void game_step_0() {
     KnjFlush();
     disp_effect_work();
     flFlip(0);
+
+    if (SoakTest_IsActive()) {
+        SoakTest_Update();
+    }
+
+    if (MatchFarm_IsActive()) {
+        MatchFarm_Update();
+    }
+
+    if (VideoExport_IsActive()) {
+        VideoExport_Update();
+    }
+
+    if (HashStream_IsActive()) {
+        HashStream_Update();
+    }
 }
 
 static void game_step_1() {
@@ -324,6 +517,27 @@ s32 mppGetFavoritePlayerNumber() {
     return num;
 }
 
+void appLatchKeyData() {
+    if ((Play_Mode != 3 && Play_Mode != 1) || (Game_pause != 0x81)) {
+        p1sw_1 = p1sw_0;
+        p2sw_1 = p2sw_0;
+        p3sw_1 = p3sw_0;
+        p4sw_1 = p4sw_0;
+        p1sw_0 = p1sw_buff;
+        p2sw_0 = p2sw_buff;
+        p3sw_0 = p3sw_buff;
+        p4sw_0 = p4sw_buff;
+
+        if ((task[TASK_MENU].condition == 1) && (Mode_Type == MODE_PARRY_TRAINING) && (Play_Mode == 1)) {
+            const u16 sw_buff = p2sw_0;
+            p2sw_0 = p1sw_0;
+            p1sw_0 = sw_buff;
+        }
+    }
+
+    appCopyKeyData();
+}
+
 void appCopyKeyData() {
     // FIXME: Should PLsw be saved/restored too?
     PLsw[0][1] = PLsw[0][0];
@@ -352,6 +566,7 @@ void njUserInit() {
     size = flGetSpace();
     mpp_w.ramcntBuff = mppMalloc(size);
     Init_ram_control_work(mpp_w.ramcntBuff, size);
+    StartupTrace_Mark("heaps");
 
     for (i = 0; i < 0x14; i++) {
         mpp_w.useChar[i] = 0;
@@ -368,7 +583,9 @@ void njUserInit() {
 
     Init_sound_system();
     Init_bgm_work();
+    StartupTrace_Mark("sound system");
     sndInitialLoad();
+    StartupTrace_Mark("SE bank");
     cpInitTask();
     cpReadyTask(TASK_INIT, Init_Task);
 }
@@ -24,4 +24,7 @@ void cpExitTask(TaskID num);
 s32 mppGetFavoritePlayerNumber();
 void njUserMain();
 
+/// Move this frame's pad state from `p1sw_buff`-`p4sw_buff` into the switches the game reads
+void appLatchKeyData();
+
 #endif
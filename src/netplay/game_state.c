@@ -1,1267 +1,1230 @@
 #include "netplay/game_state.h"
+#include "common.h"
+#include "sf33rd/AcrSDK/ps2/foundaps2.h"
 #include "sf33rd/Source/Game/animation/appear.h"
 #include "sf33rd/Source/Game/animation/win_pl.h"
 #include "sf33rd/Source/Game/effect/eff56.h"
 #include "sf33rd/Source/Game/effect/effb2.h"
 #include "sf33rd/Source/Game/effect/effb8.h"
 #include "sf33rd/Source/Game/engine/charset.h"
+#include "sf33rd/Source/Game/engine/cmb_win.h"
+#include "sf33rd/Source/Game/engine/cmd_data.h"
+#include "sf33rd/Source/Game/engine/grade.h"
 #include "sf33rd/Source/Game/engine/plcnt.h"
 #include "sf33rd/Source/Game/engine/slowf.h"
 #include "sf33rd/Source/Game/engine/spgauge.h"
+#include "sf33rd/Source/Game/engine/stun.h"
+#include "sf33rd/Source/Game/engine/vital.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 #include "sf33rd/Source/Game/select_timer.h"
+#include "sf33rd/Source/Game/stage/bg.h"
 #include "sf33rd/Source/Game/stage/bg_data.h"
 #include "sf33rd/Source/Game/stage/ta_sub.h"
+#include "sf33rd/Source/Game/system/ramcnt.h"
 #include "sf33rd/Source/Game/system/work_sys.h"
 #include "sf33rd/Source/Game/ui/count.h"
 #include "sf33rd/Source/Game/ui/sc_sub.h"
+#include "sf33rd/utils/djb2_hash.h"
+#include "structs.h"
 
 #include <SDL3/SDL.h>
 
-#define GS_SAVE(member) SDL_memcpy(&dst->member, &member, sizeof(member))
-
-void GameState_Save(GameState* dst) {
-    GS_SAVE(Scene_Cut);
-    GS_SAVE(Time_Over);
-    GS_SAVE(round_timer);
-    GS_SAVE(flash_timer);
-    GS_SAVE(flash_r_num);
-    GS_SAVE(flash_col);
-    GS_SAVE(math_counter_hi);
-    GS_SAVE(math_counter_low);
-    GS_SAVE(counter_color);
-    GS_SAVE(mugen_flag);
-    GS_SAVE(hoji_counter);
-    GS_SAVE(select_timer_state);
-    GS_SAVE(Order);
-    GS_SAVE(Order_Timer);
-    GS_SAVE(Order_Dir);
-    GS_SAVE(Score);
-    GS_SAVE(Complete_Bonus);
-    GS_SAVE(Stock_Score);
-    GS_SAVE(Vital_Bonus);
-    GS_SAVE(Time_Bonus);
-    GS_SAVE(Stage_Stock_Score);
-    GS_SAVE(Bonus_Score);
-    GS_SAVE(Final_Bonus_Score);
-    GS_SAVE(WGJ_Score);
-    GS_SAVE(Bonus_Score_Plus);
-    GS_SAVE(Perfect_Bonus);
-    GS_SAVE(Keep_Score);
-    GS_SAVE(Disp_Score_Buff);
-    GS_SAVE(Winner_id);
-    GS_SAVE(Loser_id);
-    GS_SAVE(Break_Into);
-    GS_SAVE(My_char);
-    GS_SAVE(Allow_a_battle_f);
-    GS_SAVE(Round_num);
-    GS_SAVE(Complete_Judgement);
-    GS_SAVE(Fade_Flag);
-    GS_SAVE(Super_Arts);
-    GS_SAVE(Forbid_Break);
-    GS_SAVE(Request_Break);
-    GS_SAVE(Continue_Count);
-    GS_SAVE(Counter_hi);
-    GS_SAVE(Counter_low);
-    GS_SAVE(Unit_Of_Timer);
-    GS_SAVE(Select_Timer);
-    GS_SAVE(Cursor_X);
-    GS_SAVE(Cursor_Y);
-    GS_SAVE(Cursor_Y_Pos);
-    GS_SAVE(Cursor_Timer);
-    GS_SAVE(Time_Stop);
-    GS_SAVE(Suicide);
-    GS_SAVE(Complete_Face);
-    GS_SAVE(Play_Type);
-    GS_SAVE(Sel_PL_Complete);
-    GS_SAVE(New_Challenger);
-    GS_SAVE(S_No);
-    GS_SAVE(Select_Start);
-    GS_SAVE(request_message);
-    GS_SAVE(judge_flag);
-    GS_SAVE(WINNER);
-    GS_SAVE(LOSER);
-    GS_SAVE(Champion);
-    GS_SAVE(Fade_Half_Flag);
-    GS_SAVE(Reserve_Cut);
-    GS_SAVE(Perfect_Flag);
-    GS_SAVE(Next_Step);
-    GS_SAVE(Switch_Type);
-    GS_SAVE(Cover_Timer);
-    GS_SAVE(Personal_Timer);
-    GS_SAVE(Request_E_No);
-    GS_SAVE(Request_G_No);
-    GS_SAVE(Present_Rank);
-    GS_SAVE(Best_Grade);
-    GS_SAVE(Demo_Type);
-    GS_SAVE(Rank_Type);
-    GS_SAVE(Flash_Sign);
-    GS_SAVE(Flash_Rank_Time);
-    GS_SAVE(Flash_Rank_Interval);
-    GS_SAVE(Ranking_X);
-    GS_SAVE(Rank);
-    GS_SAVE(Rank_X);
-    GS_SAVE(E_07_Flag);
-    GS_SAVE(Complete_Victory);
-    GS_SAVE(Demo_Flag);
-    GS_SAVE(Next_Demo);
-    GS_SAVE(Demo_PL_Index);
-    GS_SAVE(Demo_Stage_Index);
-    GS_SAVE(Face_MV_Request);
-    GS_SAVE(Face_Move);
-    GS_SAVE(Player_id);
-    GS_SAVE(Last_Player_id);
-    GS_SAVE(Player_Number);
-    GS_SAVE(DENJIN_Term);
-    GS_SAVE(Rapid_No);
-    GS_SAVE(COM_id);
-    GS_SAVE(EM_id);
-    GS_SAVE(Select_Status);
-    GS_SAVE(Select_Demo_Index);
-    GS_SAVE(Country);
-    GS_SAVE(Demo_Time_Stop);
-    GS_SAVE(Combo_Speed);
-    GS_SAVE(Exec_Wipe);
-    GS_SAVE(Passive_Mode);
-    GS_SAVE(Passive_Flag);
-    GS_SAVE(Flip_Flag);
-    GS_SAVE(Lie_Flag);
-    GS_SAVE(Counter_Attack);
-    GS_SAVE(Attack_Flag);
-    GS_SAVE(Limited_Flag);
-    GS_SAVE(Shell_Ignore_Timer);
-    GS_SAVE(Event_Judge_Gals);
-    GS_SAVE(EJG_index);
-    GS_SAVE(Guard_Flag);
-    GS_SAVE(Pierce_Menu);
-    GS_SAVE(Face_MV_Time);
-    GS_SAVE(Before_Jump);
-    GS_SAVE(Stop_Combo);
-    GS_SAVE(Stock_Hit_Flag);
-    GS_SAVE(Rolling_Flag);
-    GS_SAVE(Continue_Coin);
-    GS_SAVE(Ignore_Entry);
-    GS_SAVE(Slide_Type);
-    GS_SAVE(Moving_Plate);
-    GS_SAVE(Naming_Cut);
-    GS_SAVE(Moving_Plate_Counter);
-    GS_SAVE(Player_Color);
-    GS_SAVE(PP_Priority);
-    GS_SAVE(OK_Priority);
-    GS_SAVE(Stock_My_char);
-    GS_SAVE(Stock_Player_Color);
-    GS_SAVE(Music_Fade);
-    GS_SAVE(Stop_SG);
-    GS_SAVE(Operator_Status);
-    GS_SAVE(Round_Operator);
-    GS_SAVE(another_bg);
-    GS_SAVE(Last_Super_Arts);
-    GS_SAVE(Last_My_char);
-    GS_SAVE(Continue_Menu);
-    GS_SAVE(Timer_Freeze);
-    GS_SAVE(Type_of_Attack);
-    GS_SAVE(Standing_Timer);
-    GS_SAVE(Before_Look);
-    GS_SAVE(Attack_Count_No0);
-    GS_SAVE(Standing_Master_Timer);
-    GS_SAVE(PB_Music_Off);
-    GS_SAVE(No_Death);
-    GS_SAVE(Flash_MT);
-    GS_SAVE(Squat_Timer);
-    GS_SAVE(Squat_Master_Timer);
-    GS_SAVE(Turn_Over);
-    GS_SAVE(Turn_Over_Timer);
-    GS_SAVE(Jump_Pass_Timer);
-    GS_SAVE(sa_gauge_flash);
-    GS_SAVE(Receive_Flag);
-    GS_SAVE(Disposal_Again);
-    GS_SAVE(BGM_Vol);
-    GS_SAVE(Used_char);
-    GS_SAVE(Break_Com);
-    GS_SAVE(aiuchi_flag);
-    GS_SAVE(paring_counter);
-    GS_SAVE(paring_bonus_r);
-    GS_SAVE(paring_ctr_vs);
-    GS_SAVE(paring_ctr_ori);
-    GS_SAVE(Attack_Count_Buff);
-    GS_SAVE(Attack_Count_Index);
-    GS_SAVE(CC_Value);
-    GS_SAVE(Continue_Coin2);
-    GS_SAVE(Weak_PL);
-    GS_SAVE(Bullet_No);
-    GS_SAVE(Bullet_Counter);
-    GS_SAVE(Final_Result_id);
-    GS_SAVE(Disp_Win_Name);
-    GS_SAVE(Perfect_Counter);
-    GS_SAVE(Straight_Counter);
-    GS_SAVE(Appear_Q);
-    GS_SAVE(Cut_Scroll);
-    GS_SAVE(Break_Into_CPU);
-    GS_SAVE(ID_of_Face);
-    GS_SAVE(Cursor_Move);
-    GS_SAVE(Auto_Cursor);
-    GS_SAVE(Auto_No);
-    GS_SAVE(Auto_Index);
-    GS_SAVE(Auto_Timer);
-    GS_SAVE(Explosion);
-    GS_SAVE(Introduce_Break_Into);
-    GS_SAVE(gouki_wins);
-    GS_SAVE(EM_Rank);
-    GS_SAVE(Disp_PERFECT);
-    GS_SAVE(Escape_SS);
-    GS_SAVE(Deley_Shot_No);
-    GS_SAVE(Deley_Shot_Timer);
-    GS_SAVE(Lost_Round);
-    GS_SAVE(Super_Arts_Finish);
-    GS_SAVE(Stage_SA_Finish);
-    GS_SAVE(Perfect_Finish);
-    GS_SAVE(Cheap_Finish);
-    GS_SAVE(Last_My_char2);
-    GS_SAVE(gouki_app);
-    GS_SAVE(Bonus_Game_Complete);
-    GS_SAVE(Get_Demo_Index);
-    GS_SAVE(Combo_Demo_Flag);
-    GS_SAVE(Stage_Continue);
-    GS_SAVE(Pause_Hit_Marks);
-    GS_SAVE(Extra_Break);
-    GS_SAVE(Shin_Gouki_BGM);
-    GS_SAVE(Stage_Lost_Round);
-    GS_SAVE(Stage_Perfect_Finish);
-    GS_SAVE(Stage_Cheap_Finish);
-    GS_SAVE(EXE_obroll);
-    GS_SAVE(End_PL);
-    GS_SAVE(Stock_Com_Arts);
-    GS_SAVE(PB_Status);
-    GS_SAVE(Flip_Counter);
-    GS_SAVE(Stage_Time_Finish);
-    GS_SAVE(Bonus_Type);
-    GS_SAVE(Completion_Bonus);
-    GS_SAVE(ichikannkei);
-    GS_SAVE(Plate_Disposal_No);
-    GS_SAVE(SO_No);
-    GS_SAVE(Disp_Command_Name);
-    GS_SAVE(SC_No);
-    GS_SAVE(BGM_No);
-    GS_SAVE(BGM_Timer);
-    GS_SAVE(EM_List);
-    GS_SAVE(Sel_EM_Complete);
-    GS_SAVE(Temporary_EM);
-    GS_SAVE(OK_Moving_SA_Plate);
-    GS_SAVE(Battle_Q);
-    GS_SAVE(EM_History);
-    GS_SAVE(GO_No);
-    GS_SAVE(Aborigine);
-    GS_SAVE(Continue_Count_Down);
-    GS_SAVE(WGJ_Target);
-    GS_SAVE(EM_Candidate);
-    GS_SAVE(Last_Selected_EM);
-    GS_SAVE(Q_Country);
-    GS_SAVE(Continue_Cut);
-    GS_SAVE(Introduce_Boss);
-    GS_SAVE(Final_Play_Type);
-    GS_SAVE(Rank_In);
-    GS_SAVE(Request_Disp_Rank);
-    GS_SAVE(Reset_Timer);
-    GS_SAVE(bbbs_type);
-    GS_SAVE(Straight_Flag);
-    GS_SAVE(kakushi_ix);
-    GS_SAVE(kakushi_op);
-    GS_SAVE(RO_backup);
-    GS_SAVE(PT_backup);
-    GS_SAVE(E_Number);
-    GS_SAVE(E_No);
-    GS_SAVE(C_No);
-    GS_SAVE(G_No);
-    GS_SAVE(D_No);
-    GS_SAVE(M_No);
-    GS_SAVE(Exit_No);
-    GS_SAVE(SP_No);
-    GS_SAVE(Face_No);
-    GS_SAVE(Stop_Cursor);
-    GS_SAVE(Training_Index);
-    GS_SAVE(Connect_Status);
-    GS_SAVE(Menu_Suicide);
-    GS_SAVE(Game_pause);
-    GS_SAVE(Game_difficulty);
-    GS_SAVE(Pause);
-    GS_SAVE(Pause_ID);
-    GS_SAVE(Exit_Menu);
-    GS_SAVE(Conclusion_Flag);
-    GS_SAVE(CP_No);
-    GS_SAVE(CP_Index);
-    GS_SAVE(Gap_Timer);
-    GS_SAVE(Message_Suicide);
-    GS_SAVE(Disp_Cockpit);
-    GS_SAVE(Select_Arts);
-    GS_SAVE(Lamp_No);
-    GS_SAVE(Lamp_Index);
-    GS_SAVE(Lamp_Color);
-    GS_SAVE(Stop_Update_Score);
-    GS_SAVE(test_flag);
-    GS_SAVE(ixbfw_cut);
-    GS_SAVE(Cont_No);
-    GS_SAVE(PL_Wins);
-    GS_SAVE(Fade_R_No0);
-    GS_SAVE(Fade_R_No1);
-    GS_SAVE(Conclusion_Type);
-    GS_SAVE(win_type);
-    GS_SAVE(message_index);
-    GS_SAVE(F_No0);
-    GS_SAVE(F_No1);
-    GS_SAVE(F_No2);
-    GS_SAVE(F_No3);
-    GS_SAVE(keep_condition);
-    GS_SAVE(Check_Buff);
-    GS_SAVE(Convert_Buff);
-    GS_SAVE(Unsubstantial_BG);
-    GS_SAVE(Menu_Cursor_X);
-    GS_SAVE(Menu_Cursor_Y);
-    GS_SAVE(Replay_Status);
-    GS_SAVE(Disappear_LOGO);
-    GS_SAVE(count_end);
-    GS_SAVE(Play_Game);
-    GS_SAVE(Menu_Cursor_Move);
-    GS_SAVE(flash_win_type);
-    GS_SAVE(sync_win_type);
-    GS_SAVE(Mode_Type);
-    GS_SAVE(Menu_Page);
-    GS_SAVE(Menu_Max);
-    GS_SAVE(reset_NG_flag);
-    GS_SAVE(VS_Stage);
-    GS_SAVE(Present_Mode);
-    GS_SAVE(Play_Mode);
-    GS_SAVE(Page_Max);
-    GS_SAVE(Direction_Working);
-    GS_SAVE(Vital_Handicap);
-    GS_SAVE(Cursor_Limit);
-    GS_SAVE(Synchro_No);
-    GS_SAVE(SA_shadow_on);
-    GS_SAVE(Pause_Down);
-    GS_SAVE(Training_ID);
-    GS_SAVE(Disp_Attack_Data);
-    GS_SAVE(Record_Data_Tr);
-    GS_SAVE(End_Training);
-    GS_SAVE(Menu_Page_Buff);
-    GS_SAVE(Reset_Bootrom);
-    GS_SAVE(Decide_ID);
-    GS_SAVE(Training_Cursor);
-    GS_SAVE(Lag_Timer);
-    GS_SAVE(CPU_Time_Lag);
-    GS_SAVE(Forbid_Reset);
-    GS_SAVE(CPU_Rec);
-    GS_SAVE(Pause_Type);
-    GS_SAVE(Game_timer);
-    GS_SAVE(Control_Time);
-    GS_SAVE(Time_in_Time);
-    GS_SAVE(Round_Level);
-    GS_SAVE(Round_Result);
-    GS_SAVE(Fade_Number);
-    GS_SAVE(G_Timer);
-    GS_SAVE(D_Timer);
-    GS_SAVE(Rank_Pos_X);
-    GS_SAVE(Rank_Pos_Y);
-    GS_SAVE(E_Timer);
-    GS_SAVE(F_Timer);
-    GS_SAVE(ENTRY_X);
-    GS_SAVE(C_Timer);
-    GS_SAVE(S_Timer);
-    GS_SAVE(Flash_Complete);
-    GS_SAVE(Sel_Arts_Complete);
-    GS_SAVE(Arts_Y);
-    GS_SAVE(Move_Super_Arts);
-    GS_SAVE(Battle_Country);
-    GS_SAVE(Face_Status);
-    GS_SAVE(ID);
-    GS_SAVE(ID2);
-    GS_SAVE(mes_already);
-    GS_SAVE(Timer_00);
-    GS_SAVE(Timer_01);
-    GS_SAVE(PL_Distance);
-    GS_SAVE(Area_Number);
-    GS_SAVE(Lever_Buff);
-    GS_SAVE(Lever_Pool);
-    GS_SAVE(Tech_Index);
-    GS_SAVE(Random_ix16);
-    GS_SAVE(Random_ix32);
-    GS_SAVE(M_Timer);
-    GS_SAVE(VS_Tech);
-    GS_SAVE(Guard_Type);
-    GS_SAVE(Separate_Area);
-    GS_SAVE(Free_Lever);
-    GS_SAVE(Term_No);
-    GS_SAVE(Com_Width_Data);
-    GS_SAVE(Lever_Squat);
-    GS_SAVE(M_Lv);
-    GS_SAVE(Insert_Y);
-    GS_SAVE(scr_req_x);
-    GS_SAVE(scr_req_y);
-    GS_SAVE(zoom_req_flag_old);
-    GS_SAVE(zoom_request_flag);
-    GS_SAVE(zoom_request_level);
-    GS_SAVE(Last_Selected_ID);
-    GS_SAVE(Last_Called_SE);
-    GS_SAVE(VS_Index);
-    GS_SAVE(Rapid_Index);
-    GS_SAVE(Shell_Separate_Area);
-    GS_SAVE(Attack_Counter);
-    GS_SAVE(Last_Attack_Counter);
-    GS_SAVE(Pattern_Index);
-    GS_SAVE(Com_Color_Shot);
-    GS_SAVE(Resume_Lever);
-    GS_SAVE(players_timer);
-    GS_SAVE(Lever_Store);
-    GS_SAVE(Return_CP_No);
-    GS_SAVE(Return_CP_Index);
-    GS_SAVE(Return_Pattern_Index);
-    GS_SAVE(Lever_LR);
-    GS_SAVE(Last_Eftype);
-    GS_SAVE(DENJIN_No);
-    GS_SAVE(SC_Personal_Time);
-    GS_SAVE(Guard_Counter);
-    GS_SAVE(Limit_Time);
-    GS_SAVE(Last_Pattern_Index);
-    GS_SAVE(Random_ix16_ex);
-    GS_SAVE(Random_ix32_ex);
-    GS_SAVE(DE_X);
-    GS_SAVE(Exit_Timer);
-    GS_SAVE(Max_vitality);
-    GS_SAVE(Bonus_Game_Flag);
-    GS_SAVE(Bonus_Game_Work);
-    GS_SAVE(Bonus_Game_result);
-    GS_SAVE(Stock_Bonus_Game_Result);
-    GS_SAVE(bs_scrrrl);
-    GS_SAVE(Bonus_Stage_RNO);
-    GS_SAVE(Bonus_Stage_Level);
-    GS_SAVE(Bonus_Stage_Tix);
-    GS_SAVE(Bonus_Game_ex_result);
-    GS_SAVE(Stock_Com_Color);
-    GS_SAVE(bs2_floor);
-    GS_SAVE(bs2_hosei);
-    GS_SAVE(bs2_current_damage);
-    GS_SAVE(Win_Record);
-    GS_SAVE(Stock_Win_Record);
-    GS_SAVE(WGJ_Win);
-    GS_SAVE(Target_BG_X);
-    GS_SAVE(Offset_BG_X);
-    GS_SAVE(Result_Timer);
-    GS_SAVE(scrl);
-    GS_SAVE(scrr);
-    GS_SAVE(vital_stop_flag);
-    GS_SAVE(gauge_stop_flag);
-    GS_SAVE(Lamp_Timer);
-    GS_SAVE(Cont_Timer);
-    GS_SAVE(Plate_X);
-    GS_SAVE(Plate_Y);
-    // GS_SAVE(Demo_Timer);
-    // GS_SAVE(Condense_Buff);
-    GS_SAVE(Keep_Grade);
-    GS_SAVE(IO_Result);
-    GS_SAVE(VS_Win_Record);
-    GS_SAVE(PLsw);
-    GS_SAVE(plsw_00);
-    GS_SAVE(plsw_01);
-    GS_SAVE(Flash_Synchro);
-    GS_SAVE(Synchro_Level);
-    GS_SAVE(Random_ix16_com);
-    GS_SAVE(Random_ix32_com);
-    GS_SAVE(Random_ix16_ex_com);
-    GS_SAVE(Random_ix32_ex_com);
-    GS_SAVE(Random_ix16_bg);
-    GS_SAVE(Opening_Now);
-    GS_SAVE(task);
+#include <stdio.h>
+
+// The simulation state globals are all marked with SIM_STATE, which puts them in one section. Saving and loading the
+// state copies that section as a whole.
+
+#if defined(__APPLE__)
+extern u8 sim_state_start[] __asm("section$start$__DATA$__sim_state");
+extern u8 sim_state_end[] __asm("section$end$__DATA$__sim_state");
+#elif defined(_WIN32)
+// The linker sorts sections with the same name before the $ by what comes after it
+__attribute__((section(".simst$a"), used)) static u8 sim_state_start[1];
+__attribute__((section(".simst$z"), used)) static u8 sim_state_end[1];
+#else
+extern u8 __start_sim_state[];
+extern u8 __stop_sim_state[];
+#define sim_state_start __start_sim_state
+#define sim_state_end __stop_sim_state
+#endif
+
+typedef struct GameStateVariable {
+    const char* name;
+    const void* address;
+    size_t size;
+} GameStateVariable;
+
+#define GS_VARIABLE(variable) { #variable, &variable, sizeof(variable) }
+
+/// Every global that's part of the simulation state. Used to check that all of them made it into the section, to
+/// describe the layout of saved states and to benchmark copying them one by one.
+static const GameStateVariable variables[] = {
+    GS_VARIABLE(Scene_Cut),
+    GS_VARIABLE(Time_Over),
+    GS_VARIABLE(round_timer),
+    GS_VARIABLE(flash_timer),
+    GS_VARIABLE(flash_r_num),
+    GS_VARIABLE(flash_col),
+    GS_VARIABLE(math_counter_hi),
+    GS_VARIABLE(math_counter_low),
+    GS_VARIABLE(counter_color),
+    GS_VARIABLE(mugen_flag),
+    GS_VARIABLE(hoji_counter),
+    GS_VARIABLE(select_timer_state),
+    GS_VARIABLE(Order),
+    GS_VARIABLE(Order_Timer),
+    GS_VARIABLE(Order_Dir),
+    GS_VARIABLE(Score),
+    GS_VARIABLE(Complete_Bonus),
+    GS_VARIABLE(Stock_Score),
+    GS_VARIABLE(Vital_Bonus),
+    GS_VARIABLE(Time_Bonus),
+    GS_VARIABLE(Stage_Stock_Score),
+    GS_VARIABLE(Bonus_Score),
+    GS_VARIABLE(Final_Bonus_Score),
+    GS_VARIABLE(WGJ_Score),
+    GS_VARIABLE(Bonus_Score_Plus),
+    GS_VARIABLE(Perfect_Bonus),
+    GS_VARIABLE(Keep_Score),
+    GS_VARIABLE(Disp_Score_Buff),
+    GS_VARIABLE(Winner_id),
+    GS_VARIABLE(Loser_id),
+    GS_VARIABLE(Break_Into),
+    GS_VARIABLE(My_char),
+    GS_VARIABLE(Allow_a_battle_f),
+    GS_VARIABLE(Round_num),
+    GS_VARIABLE(Complete_Judgement),
+    GS_VARIABLE(Fade_Flag),
+    GS_VARIABLE(Super_Arts),
+    GS_VARIABLE(Forbid_Break),
+    GS_VARIABLE(Request_Break),
+    GS_VARIABLE(Continue_Count),
+    GS_VARIABLE(Counter_hi),
+    GS_VARIABLE(Counter_low),
+    GS_VARIABLE(Unit_Of_Timer),
+    GS_VARIABLE(Select_Timer),
+    GS_VARIABLE(Cursor_X),
+    GS_VARIABLE(Cursor_Y),
+    GS_VARIABLE(Cursor_Y_Pos),
+    GS_VARIABLE(Cursor_Timer),
+    GS_VARIABLE(Time_Stop),
+    GS_VARIABLE(Suicide),
+    GS_VARIABLE(Complete_Face),
+    GS_VARIABLE(Play_Type),
+    GS_VARIABLE(Sel_PL_Complete),
+    GS_VARIABLE(New_Challenger),
+    GS_VARIABLE(S_No),
+    GS_VARIABLE(Select_Start),
+    GS_VARIABLE(request_message),
+    GS_VARIABLE(judge_flag),
+    GS_VARIABLE(WINNER),
+    GS_VARIABLE(LOSER),
+    GS_VARIABLE(Champion),
+    GS_VARIABLE(Fade_Half_Flag),
+    GS_VARIABLE(Reserve_Cut),
+    GS_VARIABLE(Perfect_Flag),
+    GS_VARIABLE(Next_Step),
+    GS_VARIABLE(Switch_Type),
+    GS_VARIABLE(Cover_Timer),
+    GS_VARIABLE(Personal_Timer),
+    GS_VARIABLE(Request_E_No),
+    GS_VARIABLE(Request_G_No),
+    GS_VARIABLE(Present_Rank),
+    GS_VARIABLE(Best_Grade),
+    GS_VARIABLE(Demo_Type),
+    GS_VARIABLE(Rank_Type),
+    GS_VARIABLE(Flash_Sign),
+    GS_VARIABLE(Flash_Rank_Time),
+    GS_VARIABLE(Flash_Rank_Interval),
+    GS_VARIABLE(Ranking_X),
+    GS_VARIABLE(Rank),
+    GS_VARIABLE(Rank_X),
+    GS_VARIABLE(E_07_Flag),
+    GS_VARIABLE(Complete_Victory),
+    GS_VARIABLE(Demo_Flag),
+    GS_VARIABLE(Next_Demo),
+    GS_VARIABLE(Demo_PL_Index),
+    GS_VARIABLE(Demo_Stage_Index),
+    GS_VARIABLE(Face_MV_Request),
+    GS_VARIABLE(Face_Move),
+    GS_VARIABLE(Player_id),
+    GS_VARIABLE(Last_Player_id),
+    GS_VARIABLE(Player_Number),
+    GS_VARIABLE(DENJIN_Term),
+    GS_VARIABLE(Rapid_No),
+    GS_VARIABLE(COM_id),
+    GS_VARIABLE(EM_id),
+    GS_VARIABLE(Select_Status),
+    GS_VARIABLE(Select_Demo_Index),
+    GS_VARIABLE(Country),
+    GS_VARIABLE(Demo_Time_Stop),
+    GS_VARIABLE(Combo_Speed),
+    GS_VARIABLE(Exec_Wipe),
+    GS_VARIABLE(Passive_Mode),
+    GS_VARIABLE(Passive_Flag),
+    GS_VARIABLE(Flip_Flag),
+    GS_VARIABLE(Lie_Flag),
+    GS_VARIABLE(Counter_Attack),
+    GS_VARIABLE(Attack_Flag),
+    GS_VARIABLE(Limited_Flag),
+    GS_VARIABLE(Shell_Ignore_Timer),
+    GS_VARIABLE(Event_Judge_Gals),
+    GS_VARIABLE(EJG_index),
+    GS_VARIABLE(Guard_Flag),
+    GS_VARIABLE(Pierce_Menu),
+    GS_VARIABLE(Face_MV_Time),
+    GS_VARIABLE(Before_Jump),
+    GS_VARIABLE(Stop_Combo),
+    GS_VARIABLE(Stock_Hit_Flag),
+    GS_VARIABLE(Rolling_Flag),
+    GS_VARIABLE(Continue_Coin),
+    GS_VARIABLE(Ignore_Entry),
+    GS_VARIABLE(Slide_Type),
+    GS_VARIABLE(Moving_Plate),
+    GS_VARIABLE(Naming_Cut),
+    GS_VARIABLE(Moving_Plate_Counter),
+    GS_VARIABLE(Player_Color),
+    GS_VARIABLE(PP_Priority),
+    GS_VARIABLE(OK_Priority),
+    GS_VARIABLE(Stock_My_char),
+    GS_VARIABLE(Stock_Player_Color),
+    GS_VARIABLE(Music_Fade),
+    GS_VARIABLE(Stop_SG),
+    GS_VARIABLE(Operator_Status),
+    GS_VARIABLE(Round_Operator),
+    GS_VARIABLE(another_bg),
+    GS_VARIABLE(Last_Super_Arts),
+    GS_VARIABLE(Last_My_char),
+    GS_VARIABLE(Continue_Menu),
+    GS_VARIABLE(Timer_Freeze),
+    GS_VARIABLE(Type_of_Attack),
+    GS_VARIABLE(Standing_Timer),
+    GS_VARIABLE(Before_Look),
+    GS_VARIABLE(Attack_Count_No0),
+    GS_VARIABLE(Standing_Master_Timer),
+    GS_VARIABLE(PB_Music_Off),
+    GS_VARIABLE(No_Death),
+    GS_VARIABLE(Flash_MT),
+    GS_VARIABLE(Squat_Timer),
+    GS_VARIABLE(Squat_Master_Timer),
+    GS_VARIABLE(Turn_Over),
+    GS_VARIABLE(Turn_Over_Timer),
+    GS_VARIABLE(Jump_Pass_Timer),
+    GS_VARIABLE(sa_gauge_flash),
+    GS_VARIABLE(Receive_Flag),
+    GS_VARIABLE(Disposal_Again),
+    GS_VARIABLE(BGM_Vol),
+    GS_VARIABLE(Used_char),
+    GS_VARIABLE(Break_Com),
+    GS_VARIABLE(aiuchi_flag),
+    GS_VARIABLE(paring_counter),
+    GS_VARIABLE(paring_bonus_r),
+    GS_VARIABLE(paring_ctr_vs),
+    GS_VARIABLE(paring_ctr_ori),
+    GS_VARIABLE(Attack_Count_Buff),
+    GS_VARIABLE(Attack_Count_Index),
+    GS_VARIABLE(CC_Value),
+    GS_VARIABLE(Continue_Coin2),
+    GS_VARIABLE(Weak_PL),
+    GS_VARIABLE(Bullet_No),
+    GS_VARIABLE(Bullet_Counter),
+    GS_VARIABLE(Final_Result_id),
+    GS_VARIABLE(Disp_Win_Name),
+    GS_VARIABLE(Perfect_Counter),
+    GS_VARIABLE(Straight_Counter),
+    GS_VARIABLE(Appear_Q),
+    GS_VARIABLE(Cut_Scroll),
+    GS_VARIABLE(Break_Into_CPU),
+    GS_VARIABLE(ID_of_Face),
+    GS_VARIABLE(Cursor_Move),
+    GS_VARIABLE(Auto_Cursor),
+    GS_VARIABLE(Auto_No),
+    GS_VARIABLE(Auto_Index),
+    GS_VARIABLE(Auto_Timer),
+    GS_VARIABLE(Explosion),
+    GS_VARIABLE(Introduce_Break_Into),
+    GS_VARIABLE(gouki_wins),
+    GS_VARIABLE(EM_Rank),
+    GS_VARIABLE(Disp_PERFECT),
+    GS_VARIABLE(Escape_SS),
+    GS_VARIABLE(Deley_Shot_No),
+    GS_VARIABLE(Deley_Shot_Timer),
+    GS_VARIABLE(Lost_Round),
+    GS_VARIABLE(Super_Arts_Finish),
+    GS_VARIABLE(Stage_SA_Finish),
+    GS_VARIABLE(Perfect_Finish),
+    GS_VARIABLE(Cheap_Finish),
+    GS_VARIABLE(Last_My_char2),
+    GS_VARIABLE(gouki_app),
+    GS_VARIABLE(Bonus_Game_Complete),
+    GS_VARIABLE(Get_Demo_Index),
+    GS_VARIABLE(Combo_Demo_Flag),
+    GS_VARIABLE(Stage_Continue),
+    GS_VARIABLE(Pause_Hit_Marks),
+    GS_VARIABLE(Extra_Break),
+    GS_VARIABLE(Shin_Gouki_BGM),
+    GS_VARIABLE(Stage_Lost_Round),
+    GS_VARIABLE(Stage_Perfect_Finish),
+    GS_VARIABLE(Stage_Cheap_Finish),
+    GS_VARIABLE(EXE_obroll),
+    GS_VARIABLE(End_PL),
+    GS_VARIABLE(Stock_Com_Arts),
+    GS_VARIABLE(PB_Status),
+    GS_VARIABLE(Flip_Counter),
+    GS_VARIABLE(Stage_Time_Finish),
+    GS_VARIABLE(Bonus_Type),
+    GS_VARIABLE(Completion_Bonus),
+    GS_VARIABLE(ichikannkei),
+    GS_VARIABLE(Plate_Disposal_No),
+    GS_VARIABLE(SO_No),
+    GS_VARIABLE(Disp_Command_Name),
+    GS_VARIABLE(SC_No),
+    GS_VARIABLE(BGM_No),
+    GS_VARIABLE(BGM_Timer),
+    GS_VARIABLE(EM_List),
+    GS_VARIABLE(Sel_EM_Complete),
+    GS_VARIABLE(Temporary_EM),
+    GS_VARIABLE(OK_Moving_SA_Plate),
+    GS_VARIABLE(Battle_Q),
+    GS_VARIABLE(EM_History),
+    GS_VARIABLE(GO_No),
+    GS_VARIABLE(Aborigine),
+    GS_VARIABLE(Continue_Count_Down),
+    GS_VARIABLE(WGJ_Target),
+    GS_VARIABLE(EM_Candidate),
+    GS_VARIABLE(Last_Selected_EM),
+    GS_VARIABLE(Q_Country),
+    GS_VARIABLE(Continue_Cut),
+    GS_VARIABLE(Introduce_Boss),
+    GS_VARIABLE(Final_Play_Type),
+    GS_VARIABLE(Rank_In),
+    GS_VARIABLE(Request_Disp_Rank),
+    GS_VARIABLE(Reset_Timer),
+    GS_VARIABLE(bbbs_type),
+    GS_VARIABLE(Straight_Flag),
+    GS_VARIABLE(kakushi_ix),
+    GS_VARIABLE(kakushi_op),
+    GS_VARIABLE(RO_backup),
+    GS_VARIABLE(PT_backup),
+    GS_VARIABLE(E_Number),
+    GS_VARIABLE(E_No),
+    GS_VARIABLE(C_No),
+    GS_VARIABLE(G_No),
+    GS_VARIABLE(D_No),
+    GS_VARIABLE(M_No),
+    GS_VARIABLE(Exit_No),
+    GS_VARIABLE(SP_No),
+    GS_VARIABLE(Face_No),
+    GS_VARIABLE(Stop_Cursor),
+    GS_VARIABLE(Training_Index),
+    GS_VARIABLE(Connect_Status),
+    GS_VARIABLE(Menu_Suicide),
+    GS_VARIABLE(Game_pause),
+    GS_VARIABLE(Game_difficulty),
+    GS_VARIABLE(Pause),
+    GS_VARIABLE(Pause_ID),
+    GS_VARIABLE(Exit_Menu),
+    GS_VARIABLE(Conclusion_Flag),
+    GS_VARIABLE(CP_No),
+    GS_VARIABLE(CP_Index),
+    GS_VARIABLE(Gap_Timer),
+    GS_VARIABLE(Message_Suicide),
+    GS_VARIABLE(Disp_Cockpit),
+    GS_VARIABLE(Select_Arts),
+    GS_VARIABLE(Lamp_No),
+    GS_VARIABLE(Lamp_Index),
+    GS_VARIABLE(Lamp_Color),
+    GS_VARIABLE(Stop_Update_Score),
+    GS_VARIABLE(test_flag),
+    GS_VARIABLE(ixbfw_cut),
+    GS_VARIABLE(Cont_No),
+    GS_VARIABLE(PL_Wins),
+    GS_VARIABLE(Fade_R_No0),
+    GS_VARIABLE(Fade_R_No1),
+    GS_VARIABLE(Conclusion_Type),
+    GS_VARIABLE(win_type),
+    GS_VARIABLE(message_index),
+    GS_VARIABLE(F_No0),
+    GS_VARIABLE(F_No1),
+    GS_VARIABLE(F_No2),
+    GS_VARIABLE(F_No3),
+    GS_VARIABLE(keep_condition),
+    GS_VARIABLE(Check_Buff),
+    GS_VARIABLE(Convert_Buff),
+    GS_VARIABLE(Unsubstantial_BG),
+    GS_VARIABLE(Menu_Cursor_X),
+    GS_VARIABLE(Menu_Cursor_Y),
+    GS_VARIABLE(Replay_Status),
+    GS_VARIABLE(Disappear_LOGO),
+    GS_VARIABLE(count_end),
+    GS_VARIABLE(Play_Game),
+    GS_VARIABLE(Menu_Cursor_Move),
+    GS_VARIABLE(flash_win_type),
+    GS_VARIABLE(sync_win_type),
+    GS_VARIABLE(Mode_Type),
+    GS_VARIABLE(Menu_Page),
+    GS_VARIABLE(Menu_Max),
+    GS_VARIABLE(reset_NG_flag),
+    GS_VARIABLE(VS_Stage),
+    GS_VARIABLE(Present_Mode),
+    GS_VARIABLE(Play_Mode),
+    GS_VARIABLE(Page_Max),
+    GS_VARIABLE(Direction_Working),
+    GS_VARIABLE(Vital_Handicap),
+    GS_VARIABLE(Cursor_Limit),
+    GS_VARIABLE(Synchro_No),
+    GS_VARIABLE(SA_shadow_on),
+    GS_VARIABLE(Pause_Down),
+    GS_VARIABLE(Training_ID),
+    GS_VARIABLE(Disp_Attack_Data),
+    GS_VARIABLE(Record_Data_Tr),
+    GS_VARIABLE(End_Training),
+    GS_VARIABLE(Menu_Page_Buff),
+    GS_VARIABLE(Reset_Bootrom),
+    GS_VARIABLE(Decide_ID),
+    GS_VARIABLE(Training_Cursor),
+    GS_VARIABLE(Lag_Timer),
+    GS_VARIABLE(CPU_Time_Lag),
+    GS_VARIABLE(Forbid_Reset),
+    GS_VARIABLE(CPU_Rec),
+    GS_VARIABLE(Pause_Type),
+    GS_VARIABLE(Game_timer),
+    GS_VARIABLE(Control_Time),
+    GS_VARIABLE(Time_in_Time),
+    GS_VARIABLE(Round_Level),
+    GS_VARIABLE(Round_Result),
+    GS_VARIABLE(Fade_Number),
+    GS_VARIABLE(G_Timer),
+    GS_VARIABLE(D_Timer),
+    GS_VARIABLE(Rank_Pos_X),
+    GS_VARIABLE(Rank_Pos_Y),
+    GS_VARIABLE(E_Timer),
+    GS_VARIABLE(F_Timer),
+    GS_VARIABLE(ENTRY_X),
+    GS_VARIABLE(C_Timer),
+    GS_VARIABLE(S_Timer),
+    GS_VARIABLE(Flash_Complete),
+    GS_VARIABLE(Sel_Arts_Complete),
+    GS_VARIABLE(Arts_Y),
+    GS_VARIABLE(Move_Super_Arts),
+    GS_VARIABLE(Battle_Country),
+    GS_VARIABLE(Face_Status),
+    GS_VARIABLE(ID),
+    GS_VARIABLE(ID2),
+    GS_VARIABLE(mes_already),
+    GS_VARIABLE(Timer_00),
+    GS_VARIABLE(Timer_01),
+    GS_VARIABLE(PL_Distance),
+    GS_VARIABLE(Area_Number),
+    GS_VARIABLE(Lever_Buff),
+    GS_VARIABLE(Lever_Pool),
+    GS_VARIABLE(Tech_Index),
+    GS_VARIABLE(Random_ix16),
+    GS_VARIABLE(Random_ix32),
+    GS_VARIABLE(M_Timer),
+    GS_VARIABLE(VS_Tech),
+    GS_VARIABLE(Guard_Type),
+    GS_VARIABLE(Separate_Area),
+    GS_VARIABLE(Free_Lever),
+    GS_VARIABLE(Term_No),
+    GS_VARIABLE(Com_Width_Data),
+    GS_VARIABLE(Lever_Squat),
+    GS_VARIABLE(M_Lv),
+    GS_VARIABLE(Insert_Y),
+    GS_VARIABLE(scr_req_x),
+    GS_VARIABLE(scr_req_y),
+    GS_VARIABLE(zoom_req_flag_old),
+    GS_VARIABLE(zoom_request_flag),
+    GS_VARIABLE(zoom_request_level),
+    GS_VARIABLE(Last_Selected_ID),
+    GS_VARIABLE(Last_Called_SE),
+    GS_VARIABLE(VS_Index),
+    GS_VARIABLE(Rapid_Index),
+    GS_VARIABLE(Shell_Separate_Area),
+    GS_VARIABLE(Attack_Counter),
+    GS_VARIABLE(Last_Attack_Counter),
+    GS_VARIABLE(Pattern_Index),
+    GS_VARIABLE(Com_Color_Shot),
+    GS_VARIABLE(Resume_Lever),
+    GS_VARIABLE(players_timer),
+    GS_VARIABLE(Lever_Store),
+    GS_VARIABLE(Return_CP_No),
+    GS_VARIABLE(Return_CP_Index),
+    GS_VARIABLE(Return_Pattern_Index),
+    GS_VARIABLE(Lever_LR),
+    GS_VARIABLE(Last_Eftype),
+    GS_VARIABLE(DENJIN_No),
+    GS_VARIABLE(SC_Personal_Time),
+    GS_VARIABLE(Guard_Counter),
+    GS_VARIABLE(Limit_Time),
+    GS_VARIABLE(Last_Pattern_Index),
+    GS_VARIABLE(Random_ix16_ex),
+    GS_VARIABLE(Random_ix32_ex),
+    GS_VARIABLE(DE_X),
+    GS_VARIABLE(Exit_Timer),
+    GS_VARIABLE(Max_vitality),
+    GS_VARIABLE(Bonus_Game_Flag),
+    GS_VARIABLE(Bonus_Game_Work),
+    GS_VARIABLE(Bonus_Game_result),
+    GS_VARIABLE(Stock_Bonus_Game_Result),
+    GS_VARIABLE(bs_scrrrl),
+    GS_VARIABLE(Bonus_Stage_RNO),
+    GS_VARIABLE(Bonus_Stage_Level),
+    GS_VARIABLE(Bonus_Stage_Tix),
+    GS_VARIABLE(Bonus_Game_ex_result),
+    GS_VARIABLE(Stock_Com_Color),
+    GS_VARIABLE(bs2_floor),
+    GS_VARIABLE(bs2_hosei),
+    GS_VARIABLE(bs2_current_damage),
+    GS_VARIABLE(Win_Record),
+    GS_VARIABLE(Stock_Win_Record),
+    GS_VARIABLE(WGJ_Win),
+    GS_VARIABLE(Target_BG_X),
+    GS_VARIABLE(Offset_BG_X),
+    GS_VARIABLE(Result_Timer),
+    GS_VARIABLE(scrl),
+    GS_VARIABLE(scrr),
+    GS_VARIABLE(vital_stop_flag),
+    GS_VARIABLE(gauge_stop_flag),
+    GS_VARIABLE(Lamp_Timer),
+    GS_VARIABLE(Cont_Timer),
+    GS_VARIABLE(Plate_X),
+    GS_VARIABLE(Plate_Y),
+    // GS_VARIABLE(Demo_Timer),
+    // GS_VARIABLE(Condense_Buff),
+    GS_VARIABLE(Keep_Grade),
+    GS_VARIABLE(IO_Result),
+    GS_VARIABLE(VS_Win_Record),
+    GS_VARIABLE(PLsw),
+    GS_VARIABLE(plsw_00),
+    GS_VARIABLE(plsw_01),
+    GS_VARIABLE(Flash_Synchro),
+    GS_VARIABLE(Synchro_Level),
+    GS_VARIABLE(Random_ix16_com),
+    GS_VARIABLE(Random_ix32_com),
+    GS_VARIABLE(Random_ix16_ex_com),
+    GS_VARIABLE(Random_ix32_ex_com),
+    GS_VARIABLE(Random_ix16_bg),
+    GS_VARIABLE(Opening_Now),
+    GS_VARIABLE(task),
 
     // plcnt
 
-    GS_SAVE(plw);
-    GS_SAVE(zanzou_table);
-    GS_SAVE(super_arts);
-    GS_SAVE(piyori_type);
-    GS_SAVE(appear_type);
-    GS_SAVE(pcon_rno);
-    GS_SAVE(round_slow_flag);
-    GS_SAVE(pcon_dp_flag);
-    GS_SAVE(win_sp_flag);
-    GS_SAVE(dead_voice_flag);
-    GS_SAVE(rambod);
-    GS_SAVE(ramhan);
-    GS_SAVE(vital_inc_timer);
-    GS_SAVE(vital_dec_timer);
-    GS_SAVE(sag_inc_timer);
+    GS_VARIABLE(plw),
+    GS_VARIABLE(zanzou_table),
+    GS_VARIABLE(super_arts),
+    GS_VARIABLE(piyori_type),
+    GS_VARIABLE(appear_type),
+    GS_VARIABLE(pcon_rno),
+    GS_VARIABLE(round_slow_flag),
+    GS_VARIABLE(pcon_dp_flag),
+    GS_VARIABLE(win_sp_flag),
+    GS_VARIABLE(dead_voice_flag),
+    GS_VARIABLE(rambod),
+    GS_VARIABLE(ramhan),
+    GS_VARIABLE(vital_inc_timer),
+    GS_VARIABLE(vital_dec_timer),
+    GS_VARIABLE(sag_inc_timer),
 
     // cmd_data
 
-    GS_SAVE(wcp);
-    GS_SAVE(t_pl_lvr);
-    GS_SAVE(waza_work);
+    GS_VARIABLE(wcp),
+    GS_VARIABLE(t_pl_lvr),
+    GS_VARIABLE(waza_work),
 
     // cmb_win
 
-    GS_SAVE(cmst_buff);
-    GS_SAVE(old_cmb_flag);
-    GS_SAVE(cmb_stock);
-    GS_SAVE(first_attack);
-    GS_SAVE(rever_attack);
-    GS_SAVE(paring_attack);
-    GS_SAVE(bonus_pts);
-    GS_SAVE(hit_num);
-    GS_SAVE(sa_kind);
-    GS_SAVE(end_flag);
-    GS_SAVE(calc_hit);
-    GS_SAVE(score_calc);
-    GS_SAVE(cmb_all_stock);
-    GS_SAVE(sarts_finish_flag);
-    GS_SAVE(last_hit_time);
-    GS_SAVE(cmb_calc_now);
-    GS_SAVE(cst_read);
-    GS_SAVE(cst_write);
+    GS_VARIABLE(cmst_buff),
+    GS_VARIABLE(old_cmb_flag),
+    GS_VARIABLE(cmb_stock),
+    GS_VARIABLE(first_attack),
+    GS_VARIABLE(rever_attack),
+    GS_VARIABLE(paring_attack),
+    GS_VARIABLE(bonus_pts),
+    GS_VARIABLE(hit_num),
+    GS_VARIABLE(sa_kind),
+    GS_VARIABLE(end_flag),
+    GS_VARIABLE(calc_hit),
+    GS_VARIABLE(score_calc),
+    GS_VARIABLE(cmb_all_stock),
+    GS_VARIABLE(sarts_finish_flag),
+    GS_VARIABLE(last_hit_time),
+    GS_VARIABLE(cmb_calc_now),
+    GS_VARIABLE(cst_read),
+    GS_VARIABLE(cst_write),
 
     // bg
 
-    GS_SAVE(bg_w);
+    GS_VARIABLE(bg_w),
 
     // charset
 
-    GS_SAVE(att_req);
+    GS_VARIABLE(att_req),
 
     // slowf
 
-    GS_SAVE(SLOW_timer);
-    GS_SAVE(SLOW_flag);
-    GS_SAVE(EXE_flag);
+    GS_VARIABLE(SLOW_timer),
+    GS_VARIABLE(SLOW_flag),
+    GS_VARIABLE(EXE_flag),
 
     // grade
 
-    GS_SAVE(judge_gals);
-    GS_SAVE(judge_com);
-    GS_SAVE(last_judge_dada);
-    GS_SAVE(judge_final);
-    GS_SAVE(judge_item);
-    GS_SAVE(ji_sat);
+    GS_VARIABLE(judge_gals),
+    GS_VARIABLE(judge_com),
+    GS_VARIABLE(last_judge_dada),
+    GS_VARIABLE(judge_final),
+    GS_VARIABLE(judge_item),
+    GS_VARIABLE(ji_sat),
 
     // spgauge
 
-    GS_SAVE(Old_Stop_SG);
-    GS_SAVE(Exec_Wipe_F);
-    GS_SAVE(time_clear);
-    GS_SAVE(spg_number);
-    GS_SAVE(spg_work);
-    GS_SAVE(spg_offset);
-    GS_SAVE(time_num);
-    GS_SAVE(time_timer);
-    GS_SAVE(time_flag);
-    GS_SAVE(col);
-    GS_SAVE(time_operate);
-    GS_SAVE(sast_now);
-    GS_SAVE(max2);
-    GS_SAVE(max_rno2);
-    GS_SAVE(spg_dat);
+    GS_VARIABLE(Old_Stop_SG),
+    GS_VARIABLE(Exec_Wipe_F),
+    GS_VARIABLE(time_clear),
+    GS_VARIABLE(spg_number),
+    GS_VARIABLE(spg_work),
+    GS_VARIABLE(spg_offset),
+    GS_VARIABLE(time_num),
+    GS_VARIABLE(time_timer),
+    GS_VARIABLE(time_flag),
+    GS_VARIABLE(col),
+    GS_VARIABLE(time_operate),
+    GS_VARIABLE(sast_now),
+    GS_VARIABLE(max2),
+    GS_VARIABLE(max_rno2),
+    GS_VARIABLE(spg_dat),
 
     // stun
 
-    GS_SAVE(sdat);
+    GS_VARIABLE(sdat),
 
     // vital
 
-    GS_SAVE(vit);
+    GS_VARIABLE(vit),
 
     // win_pl
 
-    GS_SAVE(win_free);
-    GS_SAVE(win_rno);
-    GS_SAVE(poison_flag);
+    GS_VARIABLE(win_free),
+    GS_VARIABLE(win_rno),
+    GS_VARIABLE(poison_flag),
 
     // ta_sub
 
-    GS_SAVE(eff_hit_flag);
+    GS_VARIABLE(eff_hit_flag),
 
     // sc_sub
 
-    GS_SAVE(FadeLimit);
-    GS_SAVE(WipeLimit);
+    GS_VARIABLE(FadeLimit),
+    GS_VARIABLE(WipeLimit),
 
     // appear
 
-    GS_SAVE(Appear_car_stop);
-    GS_SAVE(Appear_hv);
-    GS_SAVE(Appear_free);
-    GS_SAVE(Appear_flag);
-    GS_SAVE(app_counter);
-    GS_SAVE(appear_work);
-    GS_SAVE(Appear_end);
+    GS_VARIABLE(Appear_car_stop),
+    GS_VARIABLE(Appear_hv),
+    GS_VARIABLE(Appear_free),
+    GS_VARIABLE(Appear_flag),
+    GS_VARIABLE(app_counter),
+    GS_VARIABLE(appear_work),
+    GS_VARIABLE(Appear_end),
 
     // bg_data
 
-    GS_SAVE(y_sitei_pos);
-    GS_SAVE(y_sitei_flag);
-    GS_SAVE(c_number);
-    GS_SAVE(c_kakikae);
-    GS_SAVE(g_number);
-    GS_SAVE(g_kakikae);
-    GS_SAVE(nosekae);
-    GS_SAVE(scrn_adgjust_y);
-    GS_SAVE(scrn_adgjust_x);
-    GS_SAVE(zoom_add);
-    GS_SAVE(ls_cnt1);
-    GS_SAVE(bg_app);
-    GS_SAVE(sa_pa_flag);
-    GS_SAVE(aku_flag);
-    GS_SAVE(seraph_flag);
-    GS_SAVE(akebono_flag);
-    GS_SAVE(bg_mvxy);
-    GS_SAVE(chase_time_y);
-    GS_SAVE(chase_time_x);
-    GS_SAVE(chase_y);
-    GS_SAVE(chase_x);
-    GS_SAVE(demo_car_flag);
-    GS_SAVE(ideal_w);
-    GS_SAVE(bg_app_stop);
-    GS_SAVE(bg_stop);
-    GS_SAVE(base_y_pos);
-    GS_SAVE(etcBgPalCnvTable);
-    GS_SAVE(etcBgGixCnvTable);
+    GS_VARIABLE(y_sitei_pos),
+    GS_VARIABLE(y_sitei_flag),
+    GS_VARIABLE(c_number),
+    GS_VARIABLE(c_kakikae),
+    GS_VARIABLE(g_number),
+    GS_VARIABLE(g_kakikae),
+    GS_VARIABLE(nosekae),
+    GS_VARIABLE(scrn_adgjust_y),
+    GS_VARIABLE(scrn_adgjust_x),
+    GS_VARIABLE(zoom_add),
+    GS_VARIABLE(ls_cnt1),
+    GS_VARIABLE(bg_app),
+    GS_VARIABLE(sa_pa_flag),
+    GS_VARIABLE(aku_flag),
+    GS_VARIABLE(seraph_flag),
+    GS_VARIABLE(akebono_flag),
+    GS_VARIABLE(bg_mvxy),
+    GS_VARIABLE(chase_time_y),
+    GS_VARIABLE(chase_time_x),
+    GS_VARIABLE(chase_y),
+    GS_VARIABLE(chase_x),
+    GS_VARIABLE(demo_car_flag),
+    GS_VARIABLE(ideal_w),
+    GS_VARIABLE(bg_app_stop),
+    GS_VARIABLE(bg_stop),
+    GS_VARIABLE(base_y_pos),
+    GS_VARIABLE(etcBgPalCnvTable),
+    GS_VARIABLE(etcBgGixCnvTable),
 
     // eff56
 
-    GS_SAVE(ci_pointer);
-    GS_SAVE(ci_col);
-    GS_SAVE(ci_timer);
+    GS_VARIABLE(ci_pointer),
+    GS_VARIABLE(ci_col),
+    GS_VARIABLE(ci_timer),
 
     // effb2
 
-    GS_SAVE(rf_b2_flag);
-    GS_SAVE(b2_curr_no);
+    GS_VARIABLE(rf_b2_flag),
+    GS_VARIABLE(b2_curr_no),
 
     // effb8
 
-    GS_SAVE(test_pl_no);
-    GS_SAVE(test_mes_no);
-    GS_SAVE(test_in);
-    GS_SAVE(old_mes_no2);
-    GS_SAVE(old_mes_no3);
-    GS_SAVE(old_mes_no_pl);
-    GS_SAVE(mes_timer);
+    GS_VARIABLE(test_pl_no),
+    GS_VARIABLE(test_mes_no),
+    GS_VARIABLE(test_in),
+    GS_VARIABLE(old_mes_no2),
+    GS_VARIABLE(old_mes_no3),
+    GS_VARIABLE(old_mes_no_pl),
+    GS_VARIABLE(mes_timer),
+};
+
+static bool is_layout_checked = false;
+
+static size_t get_offset(const void* address) {
+    return (const u8*)address - sim_state_start;
 }
 
-#define GS_LOAD(member) SDL_memcpy(&member, &src->member, sizeof(member))
+/// Make sure that every variable is inside the section and that nothing else is
+static void check_layout() {
+    if (is_layout_checked) {
+        return;
+    }
+
+    const size_t size = GameState_GetSize();
+    size_t variables_size = 0;
+
+    for (int i = 0; i < SDL_arraysize(variables); i++) {
+        const GameStateVariable* variable = &variables[i];
+
+        if (((const u8*)variable->address < sim_state_start) ||
+            ((const u8*)variable->address + variable->size > sim_state_end)) {
+            fatal_error("%s is missing SIM_STATE", variable->name);
+        }
+
+        variables_size += variable->size;
+    }
+
+    // Allow for padding between variables
+    if (size > variables_size + SDL_arraysize(variables) * 16) {
+        fatal_error("The simulation state has %zu bytes that aren't covered by known variables", size - variables_size);
+    }
+
+    is_layout_checked = true;
+}
+
+// Pointers
+//
+// Portable states don't contain any addresses. Every pointer in them is replaced with a token that holds the region it
+// points into and the offset inside that region, which is the same in every process running the same build. This
+// makes states comparable and hashable as they are, and lets them be written to disk. Loading a state turns the tokens
+// back into pointers. Rollback only ever loads states in the process that saved them, so it copies them as they are
+// and doesn't pay for converting.
+
+#define POINTER_REGION_SHIFT 56
+#define POINTER_OFFSET_MASK ((1ULL << POINTER_REGION_SHIFT) - 1)
+
+typedef enum PointerRegion {
+    POINTER_REGION_NULL,
+    POINTER_REGION_SIM_STATE, // Globals marked with SIM_STATE
+    POINTER_REGION_EFFECTS,   // Effect work
+    POINTER_REGION_HEAP,      // Loaded character, stage and effect data
+    POINTER_REGION_IMAGE,     // Tables and functions. The image moves as a whole, so they're relative to the section
+} PointerRegion;
+
+typedef uintptr_t (*PointerConversion)(uintptr_t value);
+
+static bool is_inside(uintptr_t value, const void* start, const void* end) {
+    return (value >= (uintptr_t)start) && (value < (uintptr_t)end);
+}
+
+static uintptr_t make_token(PointerRegion region, uintptr_t offset) {
+    return ((uintptr_t)region << POINTER_REGION_SHIFT) | (offset & POINTER_OFFSET_MASK);
+}
+
+/// Offsets into the image are negative when the target comes before the section
+static uintptr_t sign_extend(uintptr_t offset) {
+    const int unused_bits = sizeof(uintptr_t) * 8 - POINTER_REGION_SHIFT;
+    return (uintptr_t)((intptr_t)(offset << unused_bits) >> unused_bits);
+}
+
+static uintptr_t encode_pointer(uintptr_t value) {
+    if (value == 0) {
+        return make_token(POINTER_REGION_NULL, 0);
+    }
+
+    if (is_inside(value, sim_state_start, sim_state_end)) {
+        return make_token(POINTER_REGION_SIM_STATE, value - (uintptr_t)sim_state_start);
+    }
+
+    if (is_inside(value, frw, (const u8*)frw + sizeof(frw))) {
+        return make_token(POINTER_REGION_EFFECTS, value - (uintptr_t)frw);
+    }
+
+    if (is_inside(value, flFMS.baseandcap[0], flFMS.baseandcap[1])) {
+        return make_token(POINTER_REGION_HEAP, value - (uintptr_t)flFMS.baseandcap[0]);
+    }
+
+    // Anything else can be reached from the start of the section. User space addresses are less than 56 bits wide
+    const uintptr_t offset = value - (uintptr_t)sim_state_start;
+
+#if defined(DEBUG)
+    if (sign_extend(offset & POINTER_OFFSET_MASK) != offset) {
+        fatal_error("%p can't be stored in a saved state", (void*)value);
+    }
+#endif
+
+    return make_token(POINTER_REGION_IMAGE, offset);
+}
+
+static uintptr_t decode_pointer(uintptr_t token) {
+    const PointerRegion region = (PointerRegion)(token >> POINTER_REGION_SHIFT);
+    const uintptr_t offset = token & POINTER_OFFSET_MASK;
+
+    switch (region) {
+    case POINTER_REGION_NULL:
+        return 0;
+
+    case POINTER_REGION_SIM_STATE:
+        return (uintptr_t)sim_state_start + offset;
+
+    case POINTER_REGION_EFFECTS:
+        return (uintptr_t)frw + offset;
+
+    case POINTER_REGION_HEAP:
+        return (uintptr_t)flFMS.baseandcap[0] + offset;
+
+    case POINTER_REGION_IMAGE:
+        return (uintptr_t)sim_state_start + sign_extend(offset);
+    }
+
+    return 0;
+}
+
+static void convert_slot(void* slot, PointerConversion conversion) {
+    uintptr_t value;
+    SDL_memcpy(&value, slot, sizeof(value));
+    value = conversion(value);
+    SDL_memcpy(slot, &value, sizeof(value));
+}
+
+static void convert_work_pointers(WORK* work, PointerConversion conversion) {
+    convert_slot(&work->target_adrs, conversion);
+    convert_slot(&work->hit_adrs, conversion);
+    convert_slot(&work->dmg_adrs, conversion);
+    convert_slot(&work->suzi_offset, conversion);
+
+    for (int i = 0; i < SDL_arraysize(work->char_table); i++) {
+        convert_slot(&work->char_table[i], conversion);
+    }
+
+    convert_slot(&work->se_random_table, conversion);
+    convert_slot(&work->step_xy_table, conversion);
+    convert_slot(&work->move_xy_table, conversion);
+    convert_slot(&work->overlap_char_tbl, conversion);
+    convert_slot(&work->olc_ix_table, conversion);
+    convert_slot(&work->rival_catch_tbl, conversion);
+    convert_slot(&work->curr_rca, conversion);
+    convert_slot(&work->set_char_ad, conversion);
+    convert_slot(&work->hit_ix_table, conversion);
+    convert_slot(&work->body_adrs, conversion);
+    convert_slot(&work->h_bod, conversion);
+    convert_slot(&work->hand_adrs, conversion);
+    convert_slot(&work->h_han, conversion);
+    convert_slot(&work->dumm_adrs, conversion);
+    convert_slot(&work->h_dumm, conversion);
+    convert_slot(&work->catch_adrs, conversion);
+    convert_slot(&work->h_cat, conversion);
+    convert_slot(&work->caught_adrs, conversion);
+    convert_slot(&work->h_cau, conversion);
+    convert_slot(&work->attack_adrs, conversion);
+    convert_slot(&work->h_att, conversion);
+    convert_slot(&work->h_eat, conversion);
+    convert_slot(&work->hosei_adrs, conversion);
+    convert_slot(&work->h_hos, conversion);
+    convert_slot(&work->att_ix_table, conversion);
+    convert_slot(&work->my_effadrs, conversion);
+}
+
+/// Convert the pointers of a saved state, or of the live globals when `state` is the start of the section
+static void convert_game_state_pointers(u8* state, PointerConversion conversion) {
+    PLW* state_plw = (PLW*)(state + get_offset(plw));
+    WAZA_WORK(*state_waza_work)[56] = (void*)(state + get_offset(waza_work));
+    SPG_DAT* state_spg_dat = (SPG_DAT*)(state + get_offset(spg_dat));
+    BG* state_bg_w = (BG*)(state + get_offset(&bg_w));
+    struct _TASK* state_task = (struct _TASK*)(state + get_offset(task));
+
+    for (int i = 0; i < 2; i++) {
+        convert_work_pointers(&state_plw[i].wu, conversion);
+        convert_slot(&state_plw[i].cp, conversion);
+        convert_slot(&state_plw[i].dm_step_tbl, conversion);
+        convert_slot(&state_plw[i].as, conversion);
+        convert_slot(&state_plw[i].sa, conversion);
+        convert_slot(&state_plw[i].py, conversion);
+
+        for (int j = 0; j < 56; j++) {
+            convert_slot(&state_waza_work[i][j].w_ptr, conversion);
+        }
+
+        convert_slot(&state_spg_dat[i].spgtbl_ptr, conversion);
+        convert_slot(&state_spg_dat[i].spgptbl_ptr, conversion);
+    }
+
+    for (int i = 0; i < SDL_arraysize(bg_w.bgw); i++) {
+        convert_slot(&state_bg_w->bgw[i].bg_address, conversion);
+        convert_slot(&state_bg_w->bgw[i].suzi_adrs, conversion);
+        convert_slot(&state_bg_w->bgw[i].start_suzi, conversion);
+        convert_slot(&state_bg_w->bgw[i].suzi_adrs2, conversion);
+        convert_slot(&state_bg_w->bgw[i].start_suzi2, conversion);
+        convert_slot(&state_bg_w->bgw[i].deff_rl, conversion);
+        convert_slot(&state_bg_w->bgw[i].deff_plus, conversion);
+        convert_slot(&state_bg_w->bgw[i].deff_minus, conversion);
+    }
+
+    convert_slot(state + get_offset(&ci_pointer), conversion);
+
+    for (int i = 0; i < SDL_arraysize(task); i++) {
+        convert_slot(&state_task[i].func_adrs, conversion);
+    }
+}
+
+static void convert_effect_pointers(uintptr_t (*effects)[448], PointerConversion conversion) {
+    for (int i = 0; i < EFFECT_MAX; i++) {
+        convert_work_pointers((WORK*)effects[i], conversion);
+        convert_slot(&((WORK_Other*)effects[i])->my_master, conversion);
+    }
+}
+
+// Saving and loading
+
+size_t GameState_GetSize() {
+    return sim_state_end - sim_state_start;
+}
+
+void GameState_Save(GameState* dst) {
+#if defined(DEBUG)
+    check_layout();
+#endif
+
+    SDL_memcpy(dst, sim_state_start, GameState_GetSize());
+}
 
 void GameState_Load(const GameState* src) {
-    GS_LOAD(Scene_Cut);
-    GS_LOAD(Time_Over);
-    GS_LOAD(round_timer);
-    GS_LOAD(flash_timer);
-    GS_LOAD(flash_r_num);
-    GS_LOAD(flash_col);
-    GS_LOAD(math_counter_hi);
-    GS_LOAD(math_counter_low);
-    GS_LOAD(counter_color);
-    GS_LOAD(mugen_flag);
-    GS_LOAD(hoji_counter);
-    GS_LOAD(select_timer_state);
-    GS_LOAD(Order);
-    GS_LOAD(Order_Timer);
-    GS_LOAD(Order_Dir);
-    GS_LOAD(Score);
-    GS_LOAD(Complete_Bonus);
-    GS_LOAD(Stock_Score);
-    GS_LOAD(Vital_Bonus);
-    GS_LOAD(Time_Bonus);
-    GS_LOAD(Stage_Stock_Score);
-    GS_LOAD(Bonus_Score);
-    GS_LOAD(Final_Bonus_Score);
-    GS_LOAD(WGJ_Score);
-    GS_LOAD(Bonus_Score_Plus);
-    GS_LOAD(Perfect_Bonus);
-    GS_LOAD(Keep_Score);
-    GS_LOAD(Disp_Score_Buff);
-    GS_LOAD(Winner_id);
-    GS_LOAD(Loser_id);
-    GS_LOAD(Break_Into);
-    GS_LOAD(My_char);
-    GS_LOAD(Allow_a_battle_f);
-    GS_LOAD(Round_num);
-    GS_LOAD(Complete_Judgement);
-    GS_LOAD(Fade_Flag);
-    GS_LOAD(Super_Arts);
-    GS_LOAD(Forbid_Break);
-    GS_LOAD(Request_Break);
-    GS_LOAD(Continue_Count);
-    GS_LOAD(Counter_hi);
-    GS_LOAD(Counter_low);
-    GS_LOAD(Unit_Of_Timer);
-    GS_LOAD(Select_Timer);
-    GS_LOAD(Cursor_X);
-    GS_LOAD(Cursor_Y);
-    GS_LOAD(Cursor_Y_Pos);
-    GS_LOAD(Cursor_Timer);
-    GS_LOAD(Time_Stop);
-    GS_LOAD(Suicide);
-    GS_LOAD(Complete_Face);
-    GS_LOAD(Play_Type);
-    GS_LOAD(Sel_PL_Complete);
-    GS_LOAD(New_Challenger);
-    GS_LOAD(S_No);
-    GS_LOAD(Select_Start);
-    GS_LOAD(request_message);
-    GS_LOAD(judge_flag);
-    GS_LOAD(WINNER);
-    GS_LOAD(LOSER);
-    GS_LOAD(Champion);
-    GS_LOAD(Fade_Half_Flag);
-    GS_LOAD(Reserve_Cut);
-    GS_LOAD(Perfect_Flag);
-    GS_LOAD(Next_Step);
-    GS_LOAD(Switch_Type);
-    GS_LOAD(Cover_Timer);
-    GS_LOAD(Personal_Timer);
-    GS_LOAD(Request_E_No);
-    GS_LOAD(Request_G_No);
-    GS_LOAD(Present_Rank);
-    GS_LOAD(Best_Grade);
-    GS_LOAD(Demo_Type);
-    GS_LOAD(Rank_Type);
-    GS_LOAD(Flash_Sign);
-    GS_LOAD(Flash_Rank_Time);
-    GS_LOAD(Flash_Rank_Interval);
-    GS_LOAD(Ranking_X);
-    GS_LOAD(Rank);
-    GS_LOAD(Rank_X);
-    GS_LOAD(E_07_Flag);
-    GS_LOAD(Complete_Victory);
-    GS_LOAD(Demo_Flag);
-    GS_LOAD(Next_Demo);
-    GS_LOAD(Demo_PL_Index);
-    GS_LOAD(Demo_Stage_Index);
-    GS_LOAD(Face_MV_Request);
-    GS_LOAD(Face_Move);
-    GS_LOAD(Player_id);
-    GS_LOAD(Last_Player_id);
-    GS_LOAD(Player_Number);
-    GS_LOAD(DENJIN_Term);
-    GS_LOAD(Rapid_No);
-    GS_LOAD(COM_id);
-    GS_LOAD(EM_id);
-    GS_LOAD(Select_Status);
-    GS_LOAD(Select_Demo_Index);
-    GS_LOAD(Country);
-    GS_LOAD(Demo_Time_Stop);
-    GS_LOAD(Combo_Speed);
-    GS_LOAD(Exec_Wipe);
-    GS_LOAD(Passive_Mode);
-    GS_LOAD(Passive_Flag);
-    GS_LOAD(Flip_Flag);
-    GS_LOAD(Lie_Flag);
-    GS_LOAD(Counter_Attack);
-    GS_LOAD(Attack_Flag);
-    GS_LOAD(Limited_Flag);
-    GS_LOAD(Shell_Ignore_Timer);
-    GS_LOAD(Event_Judge_Gals);
-    GS_LOAD(EJG_index);
-    GS_LOAD(Guard_Flag);
-    GS_LOAD(Pierce_Menu);
-    GS_LOAD(Face_MV_Time);
-    GS_LOAD(Before_Jump);
-    GS_LOAD(Stop_Combo);
-    GS_LOAD(Stock_Hit_Flag);
-    GS_LOAD(Rolling_Flag);
-    GS_LOAD(Continue_Coin);
-    GS_LOAD(Ignore_Entry);
-    GS_LOAD(Slide_Type);
-    GS_LOAD(Moving_Plate);
-    GS_LOAD(Naming_Cut);
-    GS_LOAD(Moving_Plate_Counter);
-    GS_LOAD(Player_Color);
-    GS_LOAD(PP_Priority);
-    GS_LOAD(OK_Priority);
-    GS_LOAD(Stock_My_char);
-    GS_LOAD(Stock_Player_Color);
-    GS_LOAD(Music_Fade);
-    GS_LOAD(Stop_SG);
-    GS_LOAD(Operator_Status);
-    GS_LOAD(Round_Operator);
-    GS_LOAD(another_bg);
-    GS_LOAD(Last_Super_Arts);
-    GS_LOAD(Last_My_char);
-    GS_LOAD(Continue_Menu);
-    GS_LOAD(Timer_Freeze);
-    GS_LOAD(Type_of_Attack);
-    GS_LOAD(Standing_Timer);
-    GS_LOAD(Before_Look);
-    GS_LOAD(Attack_Count_No0);
-    GS_LOAD(Standing_Master_Timer);
-    GS_LOAD(PB_Music_Off);
-    GS_LOAD(No_Death);
-    GS_LOAD(Flash_MT);
-    GS_LOAD(Squat_Timer);
-    GS_LOAD(Squat_Master_Timer);
-    GS_LOAD(Turn_Over);
-    GS_LOAD(Turn_Over_Timer);
-    GS_LOAD(Jump_Pass_Timer);
-    GS_LOAD(sa_gauge_flash);
-    GS_LOAD(Receive_Flag);
-    GS_LOAD(Disposal_Again);
-    GS_LOAD(BGM_Vol);
-    GS_LOAD(Used_char);
-    GS_LOAD(Break_Com);
-    GS_LOAD(aiuchi_flag);
-    GS_LOAD(paring_counter);
-    GS_LOAD(paring_bonus_r);
-    GS_LOAD(paring_ctr_vs);
-    GS_LOAD(paring_ctr_ori);
-    GS_LOAD(Attack_Count_Buff);
-    GS_LOAD(Attack_Count_Index);
-    GS_LOAD(CC_Value);
-    GS_LOAD(Continue_Coin2);
-    GS_LOAD(Weak_PL);
-    GS_LOAD(Bullet_No);
-    GS_LOAD(Bullet_Counter);
-    GS_LOAD(Final_Result_id);
-    GS_LOAD(Disp_Win_Name);
-    GS_LOAD(Perfect_Counter);
-    GS_LOAD(Straight_Counter);
-    GS_LOAD(Appear_Q);
-    GS_LOAD(Cut_Scroll);
-    GS_LOAD(Break_Into_CPU);
-    GS_LOAD(ID_of_Face);
-    GS_LOAD(Cursor_Move);
-    GS_LOAD(Auto_Cursor);
-    GS_LOAD(Auto_No);
-    GS_LOAD(Auto_Index);
-    GS_LOAD(Auto_Timer);
-    GS_LOAD(Explosion);
-    GS_LOAD(Introduce_Break_Into);
-    GS_LOAD(gouki_wins);
-    GS_LOAD(EM_Rank);
-    GS_LOAD(Disp_PERFECT);
-    GS_LOAD(Escape_SS);
-    GS_LOAD(Deley_Shot_No);
-    GS_LOAD(Deley_Shot_Timer);
-    GS_LOAD(Lost_Round);
-    GS_LOAD(Super_Arts_Finish);
-    GS_LOAD(Stage_SA_Finish);
-    GS_LOAD(Perfect_Finish);
-    GS_LOAD(Cheap_Finish);
-    GS_LOAD(Last_My_char2);
-    GS_LOAD(gouki_app);
-    GS_LOAD(Bonus_Game_Complete);
-    GS_LOAD(Get_Demo_Index);
-    GS_LOAD(Combo_Demo_Flag);
-    GS_LOAD(Stage_Continue);
-    GS_LOAD(Pause_Hit_Marks);
-    GS_LOAD(Extra_Break);
-    GS_LOAD(Shin_Gouki_BGM);
-    GS_LOAD(Stage_Lost_Round);
-    GS_LOAD(Stage_Perfect_Finish);
-    GS_LOAD(Stage_Cheap_Finish);
-    GS_LOAD(EXE_obroll);
-    GS_LOAD(End_PL);
-    GS_LOAD(Stock_Com_Arts);
-    GS_LOAD(PB_Status);
-    GS_LOAD(Flip_Counter);
-    GS_LOAD(Stage_Time_Finish);
-    GS_LOAD(Bonus_Type);
-    GS_LOAD(Completion_Bonus);
-    GS_LOAD(ichikannkei);
-    GS_LOAD(Plate_Disposal_No);
-    GS_LOAD(SO_No);
-    GS_LOAD(Disp_Command_Name);
-    GS_LOAD(SC_No);
-    GS_LOAD(BGM_No);
-    GS_LOAD(BGM_Timer);
-    GS_LOAD(EM_List);
-    GS_LOAD(Sel_EM_Complete);
-    GS_LOAD(Temporary_EM);
-    GS_LOAD(OK_Moving_SA_Plate);
-    GS_LOAD(Battle_Q);
-    GS_LOAD(EM_History);
-    GS_LOAD(GO_No);
-    GS_LOAD(Aborigine);
-    GS_LOAD(Continue_Count_Down);
-    GS_LOAD(WGJ_Target);
-    GS_LOAD(EM_Candidate);
-    GS_LOAD(Last_Selected_EM);
-    GS_LOAD(Q_Country);
-    GS_LOAD(Continue_Cut);
-    GS_LOAD(Introduce_Boss);
-    GS_LOAD(Final_Play_Type);
-    GS_LOAD(Rank_In);
-    GS_LOAD(Request_Disp_Rank);
-    GS_LOAD(Reset_Timer);
-    GS_LOAD(bbbs_type);
-    GS_LOAD(Straight_Flag);
-    GS_LOAD(kakushi_ix);
-    GS_LOAD(kakushi_op);
-    GS_LOAD(RO_backup);
-    GS_LOAD(PT_backup);
-    GS_LOAD(E_Number);
-    GS_LOAD(E_No);
-    GS_LOAD(C_No);
-    GS_LOAD(G_No);
-    GS_LOAD(D_No);
-    GS_LOAD(M_No);
-    GS_LOAD(Exit_No);
-    GS_LOAD(SP_No);
-    GS_LOAD(Face_No);
-    GS_LOAD(Stop_Cursor);
-    GS_LOAD(Training_Index);
-    GS_LOAD(Connect_Status);
-    GS_LOAD(Menu_Suicide);
-    GS_LOAD(Game_pause);
-    GS_LOAD(Game_difficulty);
-    GS_LOAD(Pause);
-    GS_LOAD(Pause_ID);
-    GS_LOAD(Exit_Menu);
-    GS_LOAD(Conclusion_Flag);
-    GS_LOAD(CP_No);
-    GS_LOAD(CP_Index);
-    GS_LOAD(Gap_Timer);
-    GS_LOAD(Message_Suicide);
-    GS_LOAD(Disp_Cockpit);
-    GS_LOAD(Select_Arts);
-    GS_LOAD(Lamp_No);
-    GS_LOAD(Lamp_Index);
-    GS_LOAD(Lamp_Color);
-    GS_LOAD(Stop_Update_Score);
-    GS_LOAD(test_flag);
-    GS_LOAD(ixbfw_cut);
-    GS_LOAD(Cont_No);
-    GS_LOAD(PL_Wins);
-    GS_LOAD(Fade_R_No0);
-    GS_LOAD(Fade_R_No1);
-    GS_LOAD(Conclusion_Type);
-    GS_LOAD(win_type);
-    GS_LOAD(message_index);
-    GS_LOAD(F_No0);
-    GS_LOAD(F_No1);
-    GS_LOAD(F_No2);
-    GS_LOAD(F_No3);
-    GS_LOAD(keep_condition);
-    GS_LOAD(Check_Buff);
-    GS_LOAD(Convert_Buff);
-    GS_LOAD(Unsubstantial_BG);
-    GS_LOAD(Menu_Cursor_X);
-    GS_LOAD(Menu_Cursor_Y);
-    GS_LOAD(Replay_Status);
-    GS_LOAD(Disappear_LOGO);
-    GS_LOAD(count_end);
-    GS_LOAD(Play_Game);
-    GS_LOAD(Menu_Cursor_Move);
-    GS_LOAD(flash_win_type);
-    GS_LOAD(sync_win_type);
-    GS_LOAD(Mode_Type);
-    GS_LOAD(Menu_Page);
-    GS_LOAD(Menu_Max);
-    GS_LOAD(reset_NG_flag);
-    GS_LOAD(VS_Stage);
-    GS_LOAD(Present_Mode);
-    GS_LOAD(Play_Mode);
-    GS_LOAD(Page_Max);
-    GS_LOAD(Direction_Working);
-    GS_LOAD(Vital_Handicap);
-    GS_LOAD(Cursor_Limit);
-    GS_LOAD(Synchro_No);
-    GS_LOAD(SA_shadow_on);
-    GS_LOAD(Pause_Down);
-    GS_LOAD(Training_ID);
-    GS_LOAD(Disp_Attack_Data);
-    GS_LOAD(Record_Data_Tr);
-    GS_LOAD(End_Training);
-    GS_LOAD(Menu_Page_Buff);
-    GS_LOAD(Reset_Bootrom);
-    GS_LOAD(Decide_ID);
-    GS_LOAD(Training_Cursor);
-    GS_LOAD(Lag_Timer);
-    GS_LOAD(CPU_Time_Lag);
-    GS_LOAD(Forbid_Reset);
-    GS_LOAD(CPU_Rec);
-    GS_LOAD(Pause_Type);
-    GS_LOAD(Game_timer);
-    GS_LOAD(Control_Time);
-    GS_LOAD(Time_in_Time);
-    GS_LOAD(Round_Level);
-    GS_LOAD(Round_Result);
-    GS_LOAD(Fade_Number);
-    GS_LOAD(G_Timer);
-    GS_LOAD(D_Timer);
-    GS_LOAD(Rank_Pos_X);
-    GS_LOAD(Rank_Pos_Y);
-    GS_LOAD(E_Timer);
-    GS_LOAD(F_Timer);
-    GS_LOAD(ENTRY_X);
-    GS_LOAD(C_Timer);
-    GS_LOAD(S_Timer);
-    GS_LOAD(Flash_Complete);
-    GS_LOAD(Sel_Arts_Complete);
-    GS_LOAD(Arts_Y);
-    GS_LOAD(Move_Super_Arts);
-    GS_LOAD(Battle_Country);
-    GS_LOAD(Face_Status);
-    GS_LOAD(ID);
-    GS_LOAD(ID2);
-    GS_LOAD(mes_already);
-    GS_LOAD(Timer_00);
-    GS_LOAD(Timer_01);
-    GS_LOAD(PL_Distance);
-    GS_LOAD(Area_Number);
-    GS_LOAD(Lever_Buff);
-    GS_LOAD(Lever_Pool);
-    GS_LOAD(Tech_Index);
-    GS_LOAD(Random_ix16);
-    GS_LOAD(Random_ix32);
-    GS_LOAD(M_Timer);
-    GS_LOAD(VS_Tech);
-    GS_LOAD(Guard_Type);
-    GS_LOAD(Separate_Area);
-    GS_LOAD(Free_Lever);
-    GS_LOAD(Term_No);
-    GS_LOAD(Com_Width_Data);
-    GS_LOAD(Lever_Squat);
-    GS_LOAD(M_Lv);
-    GS_LOAD(Insert_Y);
-    GS_LOAD(scr_req_x);
-    GS_LOAD(scr_req_y);
-    GS_LOAD(zoom_req_flag_old);
-    GS_LOAD(zoom_request_flag);
-    GS_LOAD(zoom_request_level);
-    GS_LOAD(Last_Selected_ID);
-    GS_LOAD(Last_Called_SE);
-    GS_LOAD(VS_Index);
-    GS_LOAD(Rapid_Index);
-    GS_LOAD(Shell_Separate_Area);
-    GS_LOAD(Attack_Counter);
-    GS_LOAD(Last_Attack_Counter);
-    GS_LOAD(Pattern_Index);
-    GS_LOAD(Com_Color_Shot);
-    GS_LOAD(Resume_Lever);
-    GS_LOAD(players_timer);
-    GS_LOAD(Lever_Store);
-    GS_LOAD(Return_CP_No);
-    GS_LOAD(Return_CP_Index);
-    GS_LOAD(Return_Pattern_Index);
-    GS_LOAD(Lever_LR);
-    GS_LOAD(Last_Eftype);
-    GS_LOAD(DENJIN_No);
-    GS_LOAD(SC_Personal_Time);
-    GS_LOAD(Guard_Counter);
-    GS_LOAD(Limit_Time);
-    GS_LOAD(Last_Pattern_Index);
-    GS_LOAD(Random_ix16_ex);
-    GS_LOAD(Random_ix32_ex);
-    GS_LOAD(DE_X);
-    GS_LOAD(Exit_Timer);
-    GS_LOAD(Max_vitality);
-    GS_LOAD(Bonus_Game_Flag);
-    GS_LOAD(Bonus_Game_Work);
-    GS_LOAD(Bonus_Game_result);
-    GS_LOAD(Stock_Bonus_Game_Result);
-    GS_LOAD(bs_scrrrl);
-    GS_LOAD(Bonus_Stage_RNO);
-    GS_LOAD(Bonus_Stage_Level);
-    GS_LOAD(Bonus_Stage_Tix);
-    GS_LOAD(Bonus_Game_ex_result);
-    GS_LOAD(Stock_Com_Color);
-    GS_LOAD(bs2_floor);
-    GS_LOAD(bs2_hosei);
-    GS_LOAD(bs2_current_damage);
-    GS_LOAD(Win_Record);
-    GS_LOAD(Stock_Win_Record);
-    GS_LOAD(WGJ_Win);
-    GS_LOAD(Target_BG_X);
-    GS_LOAD(Offset_BG_X);
-    GS_LOAD(Result_Timer);
-    GS_LOAD(scrl);
-    GS_LOAD(scrr);
-    GS_LOAD(vital_stop_flag);
-    GS_LOAD(gauge_stop_flag);
-    GS_LOAD(Lamp_Timer);
-    GS_LOAD(Cont_Timer);
-    GS_LOAD(Plate_X);
-    GS_LOAD(Plate_Y);
-    // GS_LOAD(Demo_Timer);
-    // GS_LOAD(Condense_Buff);
-    GS_LOAD(Keep_Grade);
-    GS_LOAD(IO_Result);
-    GS_LOAD(VS_Win_Record);
-    GS_LOAD(PLsw);
-    GS_LOAD(plsw_00);
-    GS_LOAD(plsw_01);
-    GS_LOAD(Flash_Synchro);
-    GS_LOAD(Synchro_Level);
-    GS_LOAD(Random_ix16_com);
-    GS_LOAD(Random_ix32_com);
-    GS_LOAD(Random_ix16_ex_com);
-    GS_LOAD(Random_ix32_ex_com);
-    GS_LOAD(Random_ix16_bg);
-    GS_LOAD(Opening_Now);
-    GS_LOAD(task);
+    SDL_memcpy(sim_state_start, src, GameState_GetSize());
+}
 
-    // plcnt
+void GameState_SavePortable(GameState* dst) {
+    GameState_Save(dst);
+    convert_game_state_pointers((u8*)dst, encode_pointer);
+}
 
-    GS_LOAD(plw);
-    GS_LOAD(zanzou_table);
-    GS_LOAD(super_arts);
-    GS_LOAD(piyori_type);
-    GS_LOAD(appear_type);
-    GS_LOAD(pcon_rno);
-    GS_LOAD(round_slow_flag);
-    GS_LOAD(pcon_dp_flag);
-    GS_LOAD(win_sp_flag);
-    GS_LOAD(dead_voice_flag);
-    GS_LOAD(rambod);
-    GS_LOAD(ramhan);
-    GS_LOAD(vital_inc_timer);
-    GS_LOAD(vital_dec_timer);
-    GS_LOAD(sag_inc_timer);
+void GameState_LoadPortable(const GameState* src) {
+    GameState_Load(src);
+    convert_game_state_pointers(sim_state_start, decode_pointer);
+}
 
-    // cmd_data
+size_t GameState_GetOffset(const void* variable) {
+    return get_offset(variable);
+}
 
-    GS_LOAD(wcp);
-    GS_LOAD(t_pl_lvr);
-    GS_LOAD(waza_work);
+u32 GameState_GetLayoutFingerprint() {
+    // Tokens of tables and functions are relative to the section, so where one of each lies from it changes whenever
+    // code or data is added, removed or compiled differently
+    const intptr_t image_offsets[2] = { (intptr_t)variables - (intptr_t)sim_state_start,
+                                        (intptr_t)GameState_Save - (intptr_t)sim_state_start };
+    const size_t sizes[2] = { GameState_GetSize(), sizeof(EffectState) };
+    u32 hash = djb2_init();
 
-    // cmb_win
+    hash = djb2_update_mem(hash, (const u8*)image_offsets, sizeof(image_offsets));
+    hash = djb2_update_mem(hash, (const u8*)sizes, sizeof(sizes));
 
-    GS_LOAD(cmst_buff);
-    GS_LOAD(old_cmb_flag);
-    GS_LOAD(cmb_stock);
-    GS_LOAD(first_attack);
-    GS_LOAD(rever_attack);
-    GS_LOAD(paring_attack);
-    GS_LOAD(bonus_pts);
-    GS_LOAD(hit_num);
-    GS_LOAD(sa_kind);
-    GS_LOAD(end_flag);
-    GS_LOAD(calc_hit);
-    GS_LOAD(score_calc);
-    GS_LOAD(cmb_all_stock);
-    GS_LOAD(sarts_finish_flag);
-    GS_LOAD(last_hit_time);
-    GS_LOAD(cmb_calc_now);
-    GS_LOAD(cst_read);
-    GS_LOAD(cst_write);
+    for (int i = 0; i < SDL_arraysize(variables); i++) {
+        const size_t layout[2] = { get_offset(variables[i].address), variables[i].size };
+        hash = djb2_update_mem(hash, (const u8*)layout, sizeof(layout));
+    }
 
-    // bg
+    return hash;
+}
 
-    GS_LOAD(bg_w);
+SDL_COMPILE_TIME_ASSERT(heap_map_size, GAME_STATE_HEAP_FILES_MAX >= RCKEY_WORK_MAX);
 
-    // charset
+void GameState_MapHeap(GameStateHeapMap* map) {
+    SDL_zerop(map);
 
-    GS_LOAD(att_req);
+    for (int i = 0; i < RCKEY_WORK_MAX; i++) {
+        const RCKeyWork* key = &rckey_work[i];
 
-    // slowf
+        if (!key->use) {
+            continue;
+        }
 
-    GS_LOAD(SLOW_timer);
-    GS_LOAD(SLOW_flag);
-    GS_LOAD(EXE_flag);
+        GameStateHeapFile* heap_file = &map->files[map->count];
+        heap_file->offset = key->adr - (uintptr_t)flFMS.baseandcap[0];
+        heap_file->size = key->size;
+        heap_file->type = key->type;
+        map->count += 1;
+    }
+}
 
-    // grade
+static const GameStateHeapMap* relocation_source = NULL;
+static GameStateHeapMap relocation_target = { 0 };
+static bool has_unloaded_target = false;
 
-    GS_LOAD(judge_gals);
-    GS_LOAD(judge_com);
-    GS_LOAD(last_judge_dada);
-    GS_LOAD(judge_final);
-    GS_LOAD(judge_item);
-    GS_LOAD(ji_sat);
+static bool is_same_file(const GameStateHeapFile* a, const GameStateHeapFile* b) {
+    return (a->size == b->size) && (a->type == b->type);
+}
 
-    // spgauge
+/// Move a heap token from where a file was loaded when the state was saved to where the same file is loaded now.
+/// Files of the same kind and size are told apart by the order they're in.
+static uintptr_t relocate_heap_token(uintptr_t token) {
+    const PointerRegion region = (PointerRegion)(token >> POINTER_REGION_SHIFT);
+    const uintptr_t offset = token & POINTER_OFFSET_MASK;
 
-    GS_LOAD(Old_Stop_SG);
-    GS_LOAD(Exec_Wipe_F);
-    GS_LOAD(time_clear);
-    GS_LOAD(spg_number);
-    GS_LOAD(spg_work);
-    GS_LOAD(spg_offset);
-    GS_LOAD(time_num);
-    GS_LOAD(time_timer);
-    GS_LOAD(time_flag);
-    GS_LOAD(col);
-    GS_LOAD(time_operate);
-    GS_LOAD(sast_now);
-    GS_LOAD(max2);
-    GS_LOAD(max_rno2);
-    GS_LOAD(spg_dat);
+    if (region != POINTER_REGION_HEAP) {
+        return token;
+    }
 
-    // stun
+    for (int i = 0; i < relocation_source->count; i++) {
+        const GameStateHeapFile* source = &relocation_source->files[i];
 
-    GS_LOAD(sdat);
+        if ((offset < source->offset) || (offset >= source->offset + source->size)) {
+            continue;
+        }
 
-    // vital
+        int rank = 0;
 
-    GS_LOAD(vit);
+        for (int j = 0; j < i; j++) {
+            rank += is_same_file(&relocation_source->files[j], source);
+        }
 
-    // win_pl
+        for (int j = 0; j < relocation_target.count; j++) {
+            const GameStateHeapFile* target = &relocation_target.files[j];
 
-    GS_LOAD(win_free);
-    GS_LOAD(win_rno);
-    GS_LOAD(poison_flag);
+            if (is_same_file(target, source) && (rank-- == 0)) {
+                return make_token(POINTER_REGION_HEAP, target->offset + (offset - source->offset));
+            }
+        }
 
-    // ta_sub
+        has_unloaded_target = true;
+        return token;
+    }
 
-    GS_LOAD(eff_hit_flag);
+    // Whatever isn't in a loaded file was allocated while booting, which happens the same way every time
+    return token;
+}
 
-    // sc_sub
+bool GameState_RelocateHeap(GameState* state, EffectState* effects, const GameStateHeapMap* map) {
+    relocation_source = map;
+    GameState_MapHeap(&relocation_target);
+    has_unloaded_target = false;
+    convert_game_state_pointers((u8*)state, relocate_heap_token);
+    convert_effect_pointers(effects->frw, relocate_heap_token);
+    relocation_source = NULL;
+    return !has_unloaded_target;
+}
 
-    GS_LOAD(FadeLimit);
-    GS_LOAD(WipeLimit);
+void GameState_WriteLayout(SDL_IOStream* io) {
+    for (int i = 0; i < SDL_arraysize(variables); i++) {
+        const GameStateVariable* variable = &variables[i];
+        SDL_IOprintf(io, "%s %zu %zu\n", variable->name, get_offset(variable->address), variable->size);
+    }
+}
 
-    // appear
+void GameState_RunBenchmark(int iterations) {
+    const size_t size = GameState_GetSize();
+    u8* state = SDL_malloc(size);
+
+    if (state == NULL) {
+        return;
+    }
+
+    check_layout();
+    GameState_Save((GameState*)state);
+
+    // Copying every variable on its own is how states were saved and loaded before they were put in one section
+    const Uint64 separate_start = SDL_GetTicksNS();
+
+    for (int i = 0; i < iterations; i++) {
+        for (int j = 0; j < SDL_arraysize(variables); j++) {
+            const GameStateVariable* variable = &variables[j];
+            SDL_memcpy(state + get_offset(variable->address), variable->address, variable->size);
+        }
+
+        for (int j = 0; j < SDL_arraysize(variables); j++) {
+            const GameStateVariable* variable = &variables[j];
+            SDL_memcpy((void*)variable->address, state + get_offset(variable->address), variable->size);
+        }
+    }
+
+    const Uint64 separate_ns = SDL_GetTicksNS() - separate_start;
+    const Uint64 contiguous_start = SDL_GetTicksNS();
+
+    for (int i = 0; i < iterations; i++) {
+        GameState_Save((GameState*)state);
+        GameState_Load((const GameState*)state);
+    }
+
+    const Uint64 contiguous_ns = SDL_GetTicksNS() - contiguous_start;
+    const Uint64 portable_start = SDL_GetTicksNS();
+
+    for (int i = 0; i < iterations; i++) {
+        GameState_SavePortable((GameState*)state);
+        GameState_LoadPortable((const GameState*)state);
+    }
+
+    const Uint64 portable_ns = SDL_GetTicksNS() - portable_start;
+    SDL_free(state);
+
+    printf("⏱️ game state: %zu bytes in %d variables, %d iterations of save + load\n",
+           size,
+           (int)SDL_arraysize(variables),
+           iterations);
+    printf("⏱️   one copy per variable: %.2f us per frame\n", separate_ns / 1000.0 / iterations);
+    printf("⏱️   one copy of the section: %.2f us per frame\n", contiguous_ns / 1000.0 / iterations);
+    printf("⏱️   one copy of the section with pointers converted: %.2f us per frame\n",
+           portable_ns / 1000.0 / iterations);
+}
 
-    GS_LOAD(Appear_car_stop);
-    GS_LOAD(Appear_hv);
-    GS_LOAD(Appear_free);
-    GS_LOAD(Appear_flag);
-    GS_LOAD(app_counter);
-    GS_LOAD(appear_work);
-    GS_LOAD(Appear_end);
+#define SDL_copya(dst, src) SDL_memcpy(dst, src, sizeof(src))
+void EffectState_Save(EffectState* dst) {
+    SDL_copya(dst->frw, frw);
+    SDL_copya(dst->exec_tm, exec_tm);
+    SDL_copya(dst->frwque, frwque);
+    SDL_copya(dst->head_ix, head_ix);
+    SDL_copya(dst->tail_ix, tail_ix);
+    dst->frwctr = frwctr;
+    dst->frwctr_min = frwctr_min;
+}
 
-    // bg_data
+void EffectState_Load(const EffectState* src) {
+    SDL_copya(frw, src->frw);
+    SDL_copya(exec_tm, src->exec_tm);
+    SDL_copya(frwque, src->frwque);
+    SDL_copya(head_ix, src->head_ix);
+    SDL_copya(tail_ix, src->tail_ix);
+    frwctr = src->frwctr;
+    frwctr_min = src->frwctr_min;
+}
 
-    GS_LOAD(y_sitei_pos);
-    GS_LOAD(y_sitei_flag);
-    GS_LOAD(c_number);
-    GS_LOAD(c_kakikae);
-    GS_LOAD(g_number);
-    GS_LOAD(g_kakikae);
-    GS_LOAD(nosekae);
-    GS_LOAD(scrn_adgjust_y);
-    GS_LOAD(scrn_adgjust_x);
-    GS_LOAD(zoom_add);
-    GS_LOAD(ls_cnt1);
-    GS_LOAD(bg_app);
-    GS_LOAD(sa_pa_flag);
-    GS_LOAD(aku_flag);
-    GS_LOAD(seraph_flag);
-    GS_LOAD(akebono_flag);
-    GS_LOAD(bg_mvxy);
-    GS_LOAD(chase_time_y);
-    GS_LOAD(chase_time_x);
-    GS_LOAD(chase_y);
-    GS_LOAD(chase_x);
-    GS_LOAD(demo_car_flag);
-    GS_LOAD(ideal_w);
-    GS_LOAD(bg_app_stop);
-    GS_LOAD(bg_stop);
-    GS_LOAD(base_y_pos);
-    GS_LOAD(etcBgPalCnvTable);
-    GS_LOAD(etcBgGixCnvTable);
+void EffectState_SavePortable(EffectState* dst) {
+    EffectState_Save(dst);
+    convert_effect_pointers(dst->frw, encode_pointer);
+}
 
-    // eff56
+void EffectState_LoadPortable(const EffectState* src) {
+    EffectState_Load(src);
+    convert_effect_pointers(frw, decode_pointer);
+}
 
-    GS_LOAD(ci_pointer);
-    GS_LOAD(ci_col);
-    GS_LOAD(ci_timer);
+// Hashing
+//
+// Tokens in saved states depend on where the build put globals and code, so states of different builds can't be
+// compared byte for byte. For hashing, pointers to globals are replaced with the index of the global and the offset
+// inside it, and pointers to tables and functions only keep their region. Every global and every effect slot is then
+// hashed on its own, so a mismatch can be narrowed down to where it is.
 
-    // effb2
+#define EFFECT_LISTS_REGION (SDL_arraysize(variables) + EFFECT_MAX)
 
-    GS_LOAD(rf_b2_flag);
-    GS_LOAD(b2_curr_no);
+static u8* hash_state = NULL;
+static EffectState* hash_effects = NULL;
 
-    // effb8
+static int find_variable(size_t offset) {
+    for (int i = 0; i < SDL_arraysize(variables); i++) {
+        const size_t start = get_offset(variables[i].address);
+
+        if ((offset >= start) && (offset < start + variables[i].size)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static uintptr_t make_portable_token(uintptr_t token) {
+    const PointerRegion region = (PointerRegion)(token >> POINTER_REGION_SHIFT);
+    const uintptr_t offset = token & POINTER_OFFSET_MASK;
+
+    switch (region) {
+    case POINTER_REGION_SIM_STATE:
+        const int index = find_variable(offset);
+
+        if (index < 0) {
+            return make_token(region, 0);
+        }
+
+        return make_token(region, ((uintptr_t)index << 32) | (offset - get_offset(variables[index].address)));
+
+    case POINTER_REGION_IMAGE:
+        return make_token(region, 0);
+
+    case POINTER_REGION_NULL:
+    case POINTER_REGION_EFFECTS:
+    case POINTER_REGION_HEAP:
+        break;
+    }
+
+    return token;
+}
+
+/// Colors are only written while rendering, which builds are free to skip
+static void clear_work_colors(WORK* work) {
+    work->current_colcd = 0;
+    work->colcd = 0;
+    work->extra_col = 0;
+    work->extra_col_2 = 0;
+}
+
+int GameState_GetRegionCount() {
+    return EFFECT_LISTS_REGION + 1;
+}
+
+void GameState_GetRegionName(int index, char* name, size_t size) {
+    if (index < SDL_arraysize(variables)) {
+        SDL_strlcpy(name, variables[index].name, size);
+    } else if (index < EFFECT_LISTS_REGION) {
+        SDL_snprintf(name, size, "frw[%d]", index - (int)SDL_arraysize(variables));
+    } else {
+        SDL_strlcpy(name, "effect lists", size);
+    }
+}
 
-    GS_LOAD(test_pl_no);
-    GS_LOAD(test_mes_no);
-    GS_LOAD(test_in);
-    GS_LOAD(old_mes_no2);
-    GS_LOAD(old_mes_no3);
-    GS_LOAD(old_mes_no_pl);
-    GS_LOAD(mes_timer);
+bool GameState_HashRegions(u32* hashes) {
+    if (hash_state == NULL) {
+        hash_state = SDL_malloc(GameState_GetSize());
+        hash_effects = SDL_calloc(1, sizeof(EffectState));
+    }
+
+    if ((hash_state == NULL) || (hash_effects == NULL)) {
+        return false;
+    }
+
+    GameState_SavePortable((GameState*)hash_state);
+    convert_game_state_pointers(hash_state, make_portable_token);
+
+    for (int i = 0; i < 2; i++) {
+        clear_work_colors((WORK*)(hash_state + get_offset(&plw[i].wu)));
+    }
+
+    for (int i = 0; i < SDL_arraysize(variables); i++) {
+        const u8* data = hash_state + get_offset(variables[i].address);
+        hashes[i] = djb2_update_mem(djb2_init(), data, variables[i].size);
+    }
+
+    EffectState_SavePortable(hash_effects);
+    convert_effect_pointers(hash_effects->frw, make_portable_token);
+
+    for (int i = 0; i < EFFECT_MAX; i++) {
+        clear_work_colors((WORK*)hash_effects->frw[i]);
+        hashes[SDL_arraysize(variables) + i] =
+            djb2_update_mem(djb2_init(), (const u8*)hash_effects->frw[i], sizeof(hash_effects->frw[i]));
+    }
+
+    // Everything around the slots. Padding stays zeroed, because saving only writes fields
+    const size_t slots_start = offsetof(EffectState, frw);
+    const size_t slots_end = slots_start + sizeof(hash_effects->frw);
+    u32 lists_hash = djb2_update_mem(djb2_init(), (const u8*)hash_effects, slots_start);
+    lists_hash = djb2_update_mem(lists_hash, (const u8*)hash_effects + slots_end, sizeof(EffectState) - slots_end);
+    hashes[EFFECT_LISTS_REGION] = lists_hash;
+    return true;
 }
@@ -0,0 +1,437 @@
+#include "netplay/net_emulator.h"
+#include "port/config.h"
+
+#include <SDL3/SDL.h>
+
+#include <stdio.h>
+
+#define OUTBOUND_QUEUE_MAX 512
+#define INBOUND_QUEUE_MAX 512
+#define ADDRESS_MAX 100
+#define REORDER_DELAY_MS 20 // Extra delay that lets following packets overtake a reordered one
+#define DEFAULT_SEED 0x3535u
+
+typedef enum NetEmulatorDirection {
+    NETEM_DIRECTION_SEND = 1 << 0,
+    NETEM_DIRECTION_RECEIVE = 1 << 1,
+    NETEM_DIRECTION_BOTH = NETEM_DIRECTION_SEND | NETEM_DIRECTION_RECEIVE,
+} NetEmulatorDirection;
+
+/// Characteristics of one direction of a link.
+typedef struct NetEmulatorProfile {
+    const char* name;
+    int latency_ms;
+    int jitter_ms; // Standard deviation of latency
+
+    float loss;        // Chance to lose a packet outside of a burst
+    float burst_start; // Chance to enter a loss burst, during which every packet is lost
+    float burst_end;   // Chance to leave a loss burst
+
+    float reorder;
+    float duplicate;
+} NetEmulatorProfile;
+
+typedef struct OutboundPacket {
+    Uint64 due_time;
+    char address[ADDRESS_MAX];
+    GekkoNetAddress addr;
+    char* data;
+    int length;
+} OutboundPacket;
+
+typedef struct InboundPacket {
+    Uint64 due_time;
+    GekkoNetResult* result;
+} InboundPacket;
+
+static const NetEmulatorProfile profiles[] = {
+    { .name = "none" },
+    { .name = "lan", .latency_ms = 1, .jitter_ms = 1 },
+    { .name = "wifi",
+      .latency_ms = 10,
+      .jitter_ms = 8,
+      .loss = 0.005f,
+      .burst_start = 0.01f,
+      .burst_end = 0.5f,
+      .reorder = 0.005f },
+    { .name = "cross-region", .latency_ms = 70, .jitter_ms = 6, .loss = 0.002f, .reorder = 0.002f },
+    { .name = "bad-wifi",
+      .latency_ms = 30,
+      .jitter_ms = 25,
+      .loss = 0.02f,
+      .burst_start = 0.03f,
+      .burst_end = 0.25f,
+      .reorder = 0.03f,
+      .duplicate = 0.01f },
+    { .name = "lossy", .loss = 0.25f },
+};
+
+static const NetEmulatorProfile* profile = &profiles[0];
+static NetEmulatorDirection direction = NETEM_DIRECTION_SEND;
+static Uint64 rng_state = DEFAULT_SEED;
+static bool in_burst = false;
+
+static GekkoNetAdapter* base_adapter = NULL;
+static GekkoNetAdapter emulated_adapter = { 0 };
+
+static OutboundPacket outbound[OUTBOUND_QUEUE_MAX] = { 0 };
+static int outbound_count = 0;
+static Uint64 last_outbound_due_time = 0;
+
+static InboundPacket inbound[INBOUND_QUEUE_MAX] = { 0 };
+static int inbound_count = 0;
+static Uint64 last_inbound_due_time = 0;
+static GekkoNetResult* ready_results[INBOUND_QUEUE_MAX] = { 0 };
+
+static NetEmulatorStats stats = { 0 };
+static Uint64 total_added_latency_ns = 0;
+static int delayed_packet_count = 0;
+
+// Random numbers
+
+static void seed_random(Uint64 seed) {
+    // splitmix64 to spread small seeds over the whole state
+    seed += 0x9E3779B97F4A7C15ull;
+    seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ull;
+    seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBull;
+    rng_state = seed ^ (seed >> 31);
+
+    if (rng_state == 0) {
+        rng_state = DEFAULT_SEED;
+    }
+}
+
+static Uint64 random_u64() {
+    // xorshift64*
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+static float random_float() {
+    return (float)(random_u64() >> 40) / (float)(1 << 24);
+}
+
+static bool random_chance(float probability) {
+    return (probability > 0) && (random_float() < probability);
+}
+
+/// Approximately normally distributed value with mean 0 and standard deviation 1.
+static float random_normal() {
+    float sum = 0;
+
+    for (int i = 0; i < 12; i++) {
+        sum += random_float();
+    }
+
+    return sum - 6;
+}
+
+// Impairments
+
+static Uint64 sample_latency_ns(float share) {
+    const float jitter = random_normal() * profile->jitter_ms * SDL_sqrtf(share);
+    const float latency = SDL_max(profile->latency_ms * share + jitter, 0);
+    return (Uint64)(latency * 1e6);
+}
+
+/// Split latency and jitter evenly when both directions are emulated, so that
+/// the profile still describes the whole link.
+static float direction_share() {
+    return (direction == NETEM_DIRECTION_BOTH) ? 0.5f : 1;
+}
+
+static bool should_drop() {
+    if (in_burst) {
+        in_burst = !random_chance(profile->burst_end);
+    } else {
+        in_burst = random_chance(profile->burst_start);
+    }
+
+    return in_burst || random_chance(profile->loss);
+}
+
+/// Pick a delivery time. Packets keep their order unless they're picked for
+/// reordering, in which case they're held long enough for later ones to pass.
+static Uint64 schedule(Uint64 now, Uint64* last_due_time) {
+    const Uint64 added_latency = sample_latency_ns(direction_share());
+    Uint64 due_time = now + added_latency;
+
+    if (random_chance(profile->reorder)) {
+        stats.packets_reordered += 1;
+        due_time += SDL_MS_TO_NS(REORDER_DELAY_MS);
+    } else {
+        due_time = SDL_max(due_time, *last_due_time);
+        *last_due_time = due_time;
+    }
+
+    total_added_latency_ns += due_time - now;
+    delayed_packet_count += 1;
+    return due_time;
+}
+
+// Outbound
+
+static void enqueue_outbound(GekkoNetAddress* addr, const char* data, int length, Uint64 now) {
+    if ((outbound_count == OUTBOUND_QUEUE_MAX) || (addr->size > ADDRESS_MAX)) {
+        // A saturated link loses packets too
+        stats.packets_dropped += 1;
+        return;
+    }
+
+    OutboundPacket* packet = &outbound[outbound_count];
+    packet->due_time = schedule(now, &last_outbound_due_time);
+    SDL_memcpy(packet->address, addr->data, addr->size);
+    packet->addr.size = addr->size;
+    packet->data = SDL_malloc(length);
+    SDL_memcpy(packet->data, data, length);
+    packet->length = length;
+    outbound_count += 1;
+}
+
+static int compare_outbound(const void* a, const void* b) {
+    const OutboundPacket* lhs = a;
+    const OutboundPacket* rhs = b;
+
+    if (lhs->due_time == rhs->due_time) {
+        return 0;
+    }
+
+    return (lhs->due_time < rhs->due_time) ? -1 : 1;
+}
+
+static void flush_outbound(Uint64 now) {
+    SDL_qsort(outbound, outbound_count, sizeof(OutboundPacket), compare_outbound);
+
+    int sent_count = 0;
+
+    while ((sent_count < outbound_count) && (outbound[sent_count].due_time <= now)) {
+        OutboundPacket* packet = &outbound[sent_count];
+        packet->addr.data = packet->address;
+        base_adapter->send_data(&packet->addr, packet->data, packet->length);
+        SDL_free(packet->data);
+        sent_count += 1;
+    }
+
+    outbound_count -= sent_count;
+    SDL_memmove(outbound, &outbound[sent_count], outbound_count * sizeof(OutboundPacket));
+}
+
+static void EmulatedAdapter_SendData(GekkoNetAddress* addr, const char* data, int length) {
+    const Uint64 now = SDL_GetTicksNS();
+    stats.packets_sent += 1;
+
+    if (!(direction & NETEM_DIRECTION_SEND)) {
+        base_adapter->send_data(addr, data, length);
+        return;
+    }
+
+    if (should_drop()) {
+        stats.packets_dropped += 1;
+        return;
+    }
+
+    enqueue_outbound(addr, data, length, now);
+
+    if (random_chance(profile->duplicate)) {
+        stats.packets_duplicated += 1;
+        enqueue_outbound(addr, data, length, now);
+    }
+
+    flush_outbound(now);
+}
+
+// Inbound
+//
+// GekkoNet frees received results itself, so inbound packets are held and
+// handed over as-is. That's enough for latency, jitter and reordering, but
+// loss and duplication are only emulated on the sending side.
+
+/// @return `false` if the result couldn't be held and has to be delivered right away.
+static bool hold_inbound(GekkoNetResult* result, Uint64 now) {
+    if (inbound_count == INBOUND_QUEUE_MAX) {
+        // We can't drop a result we don't own
+        return false;
+    }
+
+    inbound[inbound_count].due_time = schedule(now, &last_inbound_due_time);
+    inbound[inbound_count].result = result;
+    inbound_count += 1;
+    return true;
+}
+
+static int compare_inbound(const void* a, const void* b) {
+    const InboundPacket* lhs = a;
+    const InboundPacket* rhs = b;
+
+    if (lhs->due_time == rhs->due_time) {
+        return 0;
+    }
+
+    return (lhs->due_time < rhs->due_time) ? -1 : 1;
+}
+
+static int collect_inbound(Uint64 now, int ready_count) {
+    SDL_qsort(inbound, inbound_count, sizeof(InboundPacket), compare_inbound);
+
+    int due_count = 0;
+
+    while ((due_count < inbound_count) && (inbound[due_count].due_time <= now) &&
+           (ready_count < INBOUND_QUEUE_MAX)) {
+        ready_results[ready_count] = inbound[due_count].result;
+        ready_count += 1;
+        due_count += 1;
+    }
+
+    inbound_count -= due_count;
+    SDL_memmove(inbound, &inbound[due_count], inbound_count * sizeof(InboundPacket));
+    return ready_count;
+}
+
+static GekkoNetResult** EmulatedAdapter_ReceiveData(int* length) {
+    const Uint64 now = SDL_GetTicksNS();
+    flush_outbound(now);
+
+    int received_count = 0;
+    GekkoNetResult** received = base_adapter->receive_data(&received_count);
+    int ready_count = 0;
+
+    stats.packets_received += received_count;
+
+    for (int i = 0; i < received_count; i++) {
+        const bool held = (direction & NETEM_DIRECTION_RECEIVE) && hold_inbound(received[i], now);
+
+        if (!held) {
+            ready_results[ready_count] = received[i];
+            ready_count += 1;
+        }
+    }
+
+    *length = collect_inbound(now, ready_count);
+    return ready_results;
+}
+
+static void EmulatedAdapter_FreeData(void* data_ptr) {
+    base_adapter->free_data(data_ptr);
+}
+
+// Public API
+
+static const NetEmulatorProfile* find_profile(const char* name) {
+    for (int i = 0; i < SDL_arraysize(profiles); i++) {
+        if (SDL_strcmp(profiles[i].name, name) == 0) {
+            return &profiles[i];
+        }
+    }
+
+    return NULL;
+}
+
+static NetEmulatorDirection parse_direction(const char* raw_direction) {
+    if (raw_direction == NULL) {
+        return NETEM_DIRECTION_SEND;
+    }
+
+    if (SDL_strcmp(raw_direction, "receive") == 0) {
+        return NETEM_DIRECTION_RECEIVE;
+    } else if (SDL_strcmp(raw_direction, "both") == 0) {
+        return NETEM_DIRECTION_BOTH;
+    }
+
+    return NETEM_DIRECTION_SEND;
+}
+
+bool NetEmulator_Init() {
+    const char* profile_name = Config_GetString(CFG_KEY_NETEM_PROFILE);
+    profile = &profiles[0];
+
+    if (profile_name != NULL) {
+        const NetEmulatorProfile* found_profile = find_profile(profile_name);
+
+        if (found_profile != NULL) {
+            profile = found_profile;
+        } else {
+            printf("⚠️ unknown network emulation profile \"%s\", disabling emulation\n", profile_name);
+        }
+    }
+
+    direction = parse_direction(Config_GetString(CFG_KEY_NETEM_DIRECTION));
+    NetEmulator_Reset();
+
+    if (NetEmulator_IsActive()) {
+        printf("🌐 emulating \"%s\" network (%d±%d ms, %.1f%% loss)\n",
+               profile->name,
+               profile->latency_ms,
+               profile->jitter_ms,
+               profile->loss * 100);
+    }
+
+    return NetEmulator_IsActive();
+}
+
+GekkoNetAdapter* NetEmulator_Wrap(GekkoNetAdapter* base) {
+    if (!NetEmulator_IsActive()) {
+        return base;
+    }
+
+    base_adapter = base;
+    emulated_adapter.send_data = EmulatedAdapter_SendData;
+    emulated_adapter.receive_data = EmulatedAdapter_ReceiveData;
+    emulated_adapter.free_data = EmulatedAdapter_FreeData;
+    return &emulated_adapter;
+}
+
+void NetEmulator_Reset() {
+    if (stats.packets_sent > 0) {
+        NetEmulatorStats final_stats;
+        NetEmulator_GetStats(&final_stats);
+
+        printf("🌐 network emulation: %d sent, %d dropped, %d duplicated, %d reordered, %d received, +%.1f ms avg\n",
+               final_stats.packets_sent,
+               final_stats.packets_dropped,
+               final_stats.packets_duplicated,
+               final_stats.packets_reordered,
+               final_stats.packets_received,
+               final_stats.avg_added_latency_ms);
+    }
+
+    for (int i = 0; i < outbound_count; i++) {
+        SDL_free(outbound[i].data);
+    }
+
+    // Held results never reach GekkoNet, so they're released the way its adapter allocated them
+    for (int i = 0; i < inbound_count; i++) {
+        base_adapter->free_data(inbound[i].result->addr.data);
+        base_adapter->free_data(inbound[i].result->data);
+        base_adapter->free_data(inbound[i].result);
+    }
+
+    outbound_count = 0;
+    inbound_count = 0;
+    last_outbound_due_time = 0;
+    last_inbound_due_time = 0;
+    in_burst = false;
+    SDL_zero(stats);
+    total_added_latency_ns = 0;
+    delayed_packet_count = 0;
+
+    const int seed = Config_GetInt(CFG_KEY_NETEM_SEED);
+    seed_random((seed != 0) ? seed : DEFAULT_SEED);
+}
+
+bool NetEmulator_IsActive() {
+    return profile != &profiles[0];
+}
+
+const char* NetEmulator_GetProfileName() {
+    return profile->name;
+}
+
+void NetEmulator_GetStats(NetEmulatorStats* dst) {
+    SDL_copyp(dst, &stats);
+
+    if (delayed_packet_count > 0) {
+        dst->avg_added_latency_ms = (double)total_added_latency_ns / delayed_packet_count / 1e6;
+    }
+}
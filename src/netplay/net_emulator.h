@@ -0,0 +1,32 @@
+#ifndef NETPLAY_NET_EMULATOR_H
+#define NETPLAY_NET_EMULATOR_H
+
+#include "gekkonet.h"
+
+#include <stdbool.h>
+
+typedef struct NetEmulatorStats {
+    int packets_sent;
+    int packets_dropped;
+    int packets_duplicated;
+    int packets_reordered;
+    int packets_received;
+    float avg_added_latency_ms;
+} NetEmulatorStats;
+
+/// Configure network emulation from the `netem-*` config entries.
+/// @return `true` if a profile other than `none` was selected.
+bool NetEmulator_Init();
+
+/// Wrap an adapter so that all traffic passing through it is subjected to the selected profile.
+/// @return The wrapping adapter, or `base` itself if emulation is disabled.
+GekkoNetAdapter* NetEmulator_Wrap(GekkoNetAdapter* base);
+
+/// Drop all packets that are still in flight and print what the emulator did during the session.
+void NetEmulator_Reset();
+
+bool NetEmulator_IsActive();
+const char* NetEmulator_GetProfileName();
+void NetEmulator_GetStats(NetEmulatorStats* stats);
+
+#endif
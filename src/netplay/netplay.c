@@ -1,10 +1,16 @@
 #include "netplay/netplay.h"
+#include "common.h"
 #include "main.h"
 #include "netplay/game_state.h"
+#include "netplay/net_emulator.h"
+#include "port/config.h"
+#include "port/paths.h"
 #include "port/sdl/sdl_app.h"
+#include "sf33rd/Source/Game/effect/eff56.h"
 #include "sf33rd/Source/Game/effect/effect.h"
 #include "sf33rd/Source/Game/engine/grade.h"
 #include "sf33rd/Source/Game/engine/plcnt.h"
+#include "sf33rd/Source/Game/engine/spgauge.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 #include "sf33rd/Source/Game/game.h"
 #include "sf33rd/Source/Game/io/gd3rd.h"
@@ -14,6 +20,7 @@
 #include "sf33rd/Source/Game/rendering/dc_ghost.h"
 #include "sf33rd/Source/Game/rendering/mtrans.h"
 #include "sf33rd/Source/Game/rendering/texcash.h"
+#include "sf33rd/Source/Game/stage/bg.h"
 #include "sf33rd/Source/Game/system/sys_sub.h"
 #include "sf33rd/Source/Game/system/work_sys.h"
 #include "sf33rd/utils/djb2_hash.h"
@@ -24,31 +31,29 @@
 #include "gekkonet.h"
 #include <SDL3/SDL.h>
 
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 
 #define INPUT_HISTORY_MAX 120
 #define FRAME_SKIP_TIMER_MAX 60 // Allow skipping a frame roughly every second
 #define STATS_UPDATE_TIMER_MAX 60
-#define DELAY_FRAMES 1
 #define PLAYER_COUNT 2
 
-// Uncomment to enable packet drops
-// #define LOSSY_ADAPTER
+#define DELAY_FRAMES_MIN 1
+#define DELAY_FRAMES_MAX 4
+#define DELAY_SAMPLES_TO_CHANGE 3 // Consecutive stats readings that must agree before delay changes
 
-typedef struct EffectState {
-    s16 frwctr;
-    s16 frwctr_min;
-    s16 head_ix[8];
-    s16 tail_ix[8];
-    s16 exec_tm[8];
-    uintptr_t frw[EFFECT_MAX][448];
-    s16 frwque[EFFECT_MAX];
-} EffectState;
+#define TIME_SYNC_DEADZONE 0.25f   // Frame advantage we don't bother correcting
+#define TIME_SYNC_GAIN 0.02f       // Frame time stretch per frame of advantage
+#define TIME_SYNC_MAX_STRETCH 0.05 // Never stretch frame time by more than 5%
+#define CATCH_UP_THRESHOLD 3       // Run an extra frame only when stretching can't keep up
 
+/// Effects come first, because the size of the game state is only known at runtime
 typedef struct State {
-    GameState gs;
     EffectState es;
+    u8 gs[] ATTR_ALIGNED(16);
 } State;
 
 static GekkoSession* session = NULL;
@@ -63,36 +68,30 @@ static float frames_behind = 0;
 static int frame_skip_timer = 0;
 static int transition_ready_frames = 0;
 
+static int local_delay = DELAY_FRAMES_MIN;
+static int pending_delay = DELAY_FRAMES_MIN;
+static int delay_candidate = DELAY_FRAMES_MIN;
+static int delay_candidate_samples = 0;
+
 static int stats_update_timer = 0;
 static int frame_max_rollback = 0;
 static NetworkStats network_stats = { 0 };
+static NetplaySessionStats session_stats = { 0 };
+static NetplaySessionStats last_second_stats = { 0 };
+static SDL_IOStream* stats_log = NULL;
+static Uint64 session_start_time = 0;
 
 #if defined(DEBUG)
 #define STATE_BUFFER_MAX 20
 
-static State state_buffer[STATE_BUFFER_MAX] = { 0 };
+static u8* state_buffer = NULL;
 #endif
 
-#if defined(LOSSY_ADAPTER)
-static GekkoNetAdapter* base_adapter = NULL;
-static GekkoNetAdapter lossy_adapter = { 0 };
-
-static float random_float() {
-    return (float)rand() / RAND_MAX;
+static size_t get_state_size() {
+    // Rounded up so that the states in the debug buffer stay aligned
+    return ALIGN_UP(sizeof(State) + GameState_GetSize(), 16);
 }
 
-static void LossyAdapter_SendData(GekkoNetAddress* addr, const char* data, int length) {
-    const float number = random_float();
-
-    // Adjust this number to change drop probability
-    if (number <= 0.25) {
-        return;
-    }
-
-    base_adapter->send_data(addr, data, length);
-}
-#endif
-
 static void clean_input_buffers() {
     p1sw_0 = 0;
     p2sw_0 = 0;
@@ -139,14 +138,39 @@ static void setup_vs_mode() {
     clean_input_buffers();
 }
 
-#if defined(LOSSY_ADAPTER)
-static void configure_lossy_adapter() {
-    base_adapter = gekko_default_adapter(local_port);
-    lossy_adapter.send_data = LossyAdapter_SendData;
-    lossy_adapter.receive_data = base_adapter->receive_data;
-    lossy_adapter.free_data = base_adapter->free_data;
+static void open_stats_log() {
+    if (!Config_GetBool(CFG_KEY_NETPLAY_STATS_LOG)) {
+        return;
+    }
+
+    char timestamp[32];
+    const time_t now = time(NULL);
+    strftime(timestamp, sizeof(timestamp), "%Y%m%d_%H%M%S", localtime(&now));
+
+    char* path;
+    SDL_asprintf(&path, "%snetstats_%s_p%d.csv", Paths_GetBasePath(), timestamp, player_number + 1);
+    stats_log = SDL_IOFromFile(path, "w");
+
+    if (stats_log == NULL) {
+        printf("⚠️ couldn't open netplay stats log at %s: %s\n", path, SDL_GetError());
+    } else {
+        printf("🔴 logging netplay stats to %s\n", path);
+        SDL_IOprintf(stats_log,
+                     "time_s,frame,ping,jitter,delay,frame_advantage,max_rollback,rolled_back_frames,"
+                     "catch_up_frames,save_us,load_us,resimulate_us,lost_packets\n");
+    }
+
+    SDL_free(path);
+}
+
+static void close_stats_log() {
+    if (stats_log == NULL) {
+        return;
+    }
+
+    SDL_CloseIO(stats_log);
+    stats_log = NULL;
 }
-#endif
 
 static void configure_gekko() {
     GekkoConfig config;
@@ -154,7 +178,7 @@ static void configure_gekko() {
 
     config.num_players = PLAYER_COUNT;
     config.input_size = sizeof(u16);
-    config.state_size = sizeof(State);
+    config.state_size = get_state_size();
     config.max_spectators = 0;
     config.input_prediction_window = 10;
 
@@ -168,14 +192,12 @@ static void configure_gekko() {
         printf("Session is already running! probably incorrect.\n");
     }
 
-#if defined(LOSSY_ADAPTER)
-    configure_lossy_adapter();
-    gekko_net_adapter_set(session, &lossy_adapter);
-#else
-    gekko_net_adapter_set(session, gekko_default_adapter(local_port));
-#endif
+    NetEmulator_Init();
+    gekko_net_adapter_set(session, NetEmulator_Wrap(gekko_default_adapter(local_port)));
 
     printf("starting a session for player %d at port %hu\n", player_number, local_port);
+    session_start_time = SDL_GetTicksNS();
+    open_stats_log();
 
     char remote_address_str[100];
     SDL_snprintf(remote_address_str, sizeof(remote_address_str), "%s:%hu", remote_ip, remote_port);
@@ -186,7 +208,7 @@ static void configure_gekko() {
 
         if (is_local_player) {
             player_handle = gekko_add_actor(session, GekkoLocalPlayer, NULL);
-            gekko_set_local_delay(session, player_handle, DELAY_FRAMES);
+            gekko_set_local_delay(session, player_handle, local_delay);
         } else {
             gekko_add_actor(session, GekkoRemotePlayer, &remote_address);
         }
@@ -219,173 +241,156 @@ static u16 recall_input(int player, int frame) {
 }
 
 #if defined(DEBUG)
-static uint32_t calculate_checksum(const State* state) {
-    uint32_t hash = djb2_init();
-    hash = djb2_updatep(hash, state);
-    return hash;
-}
-
-/// Zero out all pointers in WORK for dumping
-static void clean_work_pointers(WORK* work) {
-    work->target_adrs = NULL;
-    work->hit_adrs = NULL;
-    work->dmg_adrs = NULL;
-    work->suzi_offset = NULL;
-    SDL_zeroa(work->char_table);
-    work->se_random_table = NULL;
-    work->step_xy_table = NULL;
-    work->move_xy_table = NULL;
-    work->overlap_char_tbl = NULL;
-    work->olc_ix_table = NULL;
-    work->rival_catch_tbl = NULL;
-    work->curr_rca = NULL;
-    work->set_char_ad = NULL;
-    work->hit_ix_table = NULL;
-    work->body_adrs = NULL;
-    work->h_bod = NULL;
-    work->hand_adrs = NULL;
-    work->h_han = NULL;
-    work->dumm_adrs = NULL;
-    work->h_dumm = NULL;
-    work->catch_adrs = NULL;
-    work->h_cat = NULL;
-    work->caught_adrs = NULL;
-    work->h_cau = NULL;
-    work->attack_adrs = NULL;
-    work->h_att = NULL;
-    work->h_eat = NULL;
-    work->hosei_adrs = NULL;
-    work->h_hos = NULL;
-    work->att_ix_table = NULL;
-    work->my_effadrs = NULL;
-
-    work->current_colcd = 0;
-    work->colcd = 0;
-    work->extra_col = 0;
-    work->extra_col_2 = 0;
-}
-
-static void clean_plw_pointers(PLW* plw) {
-    clean_work_pointers(&plw->wu);
-    plw->cp = NULL;
-    plw->dm_step_tbl = NULL;
-    plw->as = NULL;
-    plw->sa = NULL;
-    plw->py = NULL;
-}
-
-static void clean_state_pointers(State* state) {
-    for (int i = 0; i < 2; i++) {
-        clean_plw_pointers(&state->gs.plw[i]);
+/// Offsets of the color fields of every WORK in a state. They are only written while rendering, which is skipped while
+/// resimulating, so they are hashed as zeros. Sorted by offset.
+static size_t color_offsets[(EFFECT_MAX + 2) * 4] = { 0 };
+static int color_offset_count = 0;
 
-        for (int j = 0; j < 56; j++) {
-            state->gs.waza_work[i][j].w_ptr = NULL;
-        }
+static void add_work_color_offsets(size_t work_offset) {
+    color_offsets[color_offset_count++] = work_offset + offsetof(WORK, current_colcd);
+    color_offsets[color_offset_count++] = work_offset + offsetof(WORK, colcd);
+    color_offsets[color_offset_count++] = work_offset + offsetof(WORK, extra_col);
+    color_offsets[color_offset_count++] = work_offset + offsetof(WORK, extra_col_2);
+}
 
-        state->gs.spg_dat[i].spgtbl_ptr = NULL;
-        state->gs.spg_dat[i].spgptbl_ptr = NULL;
+static void init_color_offsets() {
+    if (color_offset_count > 0) {
+        return;
     }
 
     for (int i = 0; i < EFFECT_MAX; i++) {
-        WORK* work = (WORK*)state->es.frw[i];
-        clean_work_pointers(work);
-
-        WORK_Other* work_big = (WORK_Other*)state->es.frw[i];
-        work_big->my_master = NULL;
+        add_work_color_offsets(offsetof(State, es.frw) + sizeof(frw[0]) * i);
     }
 
-    for (int i = 0; i < SDL_arraysize(state->gs.bg_w.bgw); i++) {
-        state->gs.bg_w.bgw[i].bg_address = NULL;
-        state->gs.bg_w.bgw[i].suzi_adrs = NULL;
-        state->gs.bg_w.bgw[i].start_suzi = NULL;
-        state->gs.bg_w.bgw[i].suzi_adrs2 = NULL;
-        state->gs.bg_w.bgw[i].start_suzi2 = NULL;
-        state->gs.bg_w.bgw[i].deff_rl = NULL;
-        state->gs.bg_w.bgw[i].deff_plus = NULL;
-        state->gs.bg_w.bgw[i].deff_minus = NULL;
+    for (int i = 0; i < 2; i++) {
+        add_work_color_offsets(offsetof(State, gs) + GameState_GetOffset(&plw[i].wu));
     }
+}
 
-    state->gs.ci_pointer = NULL;
+/// Saved states don't contain addresses, so they can be hashed right where GekkoNet keeps them
+static uint32_t calculate_checksum(const State* state) {
+    const u8* bytes = (const u8*)state;
+    const u8 zeros[sizeof(s16)] = { 0 };
+    uint32_t hash = djb2_init();
+    size_t position = 0;
+
+    init_color_offsets();
 
-    for (int i = 0; i < SDL_arraysize(state->gs.task); i++) {
-        state->gs.task[i].func_adrs = NULL;
+    for (int i = 0; i < color_offset_count; i++) {
+        hash = djb2_update_mem(hash, bytes + position, color_offsets[i] - position);
+        hash = djb2_updatea(hash, zeros);
+        position = color_offsets[i] + sizeof(s16);
     }
+
+    hash = djb2_update_mem(hash, bytes + position, get_state_size() - position);
+    return hash;
 }
 
-/// Save state in state buffer.
-/// @return Pointer to state as it has been saved.
-static const State* note_state(const State* state, int frame) {
+static State* get_buffered_state(int frame) {
+    return (State*)(state_buffer + (frame % STATE_BUFFER_MAX) * get_state_size());
+}
+
+/// Keep a copy of a saved state around so that it can be dumped if the frame turns out to be desynced
+static void note_state(const State* state, int frame) {
     if (frame < 0) {
         frame += STATE_BUFFER_MAX;
     }
 
-    State* dst = &state_buffer[frame % STATE_BUFFER_MAX];
-    SDL_memcpy(dst, state, sizeof(State));
-    clean_state_pointers(dst);
-    return dst;
+    if (state_buffer == NULL) {
+        state_buffer = SDL_malloc(STATE_BUFFER_MAX * get_state_size());
+
+        if (state_buffer == NULL) {
+            return;
+        }
+    }
+
+    SDL_memcpy(get_buffered_state(frame), state, get_state_size());
 }
 
 static void dump_state(const State* src, const char* filename) {
     SDL_IOStream* io = SDL_IOFromFile(filename, "w");
-    SDL_WriteIO(io, src, sizeof(State));
+    SDL_WriteIO(io, src, get_state_size());
+    SDL_CloseIO(io);
+}
+
+/// Write where each global is stored in dumped states, so that tools/compare_states.py can name the ones that differ
+static void dump_layout() {
+    SDL_IOStream* io = SDL_IOFromFile("states/layout", "w");
+
+    if (io == NULL) {
+        return;
+    }
+
+    SDL_IOprintf(io, "game_state %zu\n", offsetof(State, gs));
+    GameState_WriteLayout(io);
     SDL_CloseIO(io);
 }
 
 static void dump_saved_state(int frame) {
-    const State* src = &state_buffer[frame % STATE_BUFFER_MAX];
+    if (state_buffer == NULL) {
+        return;
+    }
+
+    const State* src = get_buffered_state(frame);
 
     char filename[100];
     SDL_snprintf(filename, sizeof(filename), "states/%d_%d", player_handle, frame);
 
     dump_state(src, filename);
+    dump_layout();
 }
 #endif
 
-#define SDL_copya(dst, src) SDL_memcpy(dst, src, sizeof(src))
-
 static void gather_state(State* dst) {
-    // GameState
-    GameState* gs = &dst->gs;
-    GameState_Save(gs);
+#if defined(DEBUG)
+    // Checksums and dumps get compared with the other player's, so they can't contain addresses
+    EffectState_SavePortable(&dst->es);
+    GameState_SavePortable((GameState*)dst->gs);
+#else
+    EffectState_Save(&dst->es);
+    GameState_Save((GameState*)dst->gs);
+#endif
+}
+
+static void note_timing(NetplayTiming* timing, uint64_t* frame_total, Uint64 start) {
+    const Uint64 elapsed = SDL_GetTicksNS() - start;
+    timing->count += 1;
+    timing->total_ns += elapsed;
+    timing->max_ns = SDL_max(timing->max_ns, elapsed);
+    *frame_total += elapsed;
+}
+
+static void note_rollback(int depth) {
+    if (depth == 0) {
+        return;
+    }
 
-    // EffectState
-    EffectState* es = &dst->es;
-    SDL_copya(es->frw, frw);
-    SDL_copya(es->exec_tm, exec_tm);
-    SDL_copya(es->frwque, frwque);
-    SDL_copya(es->head_ix, head_ix);
-    SDL_copya(es->tail_ix, tail_ix);
-    es->frwctr = frwctr;
-    es->frwctr_min = frwctr_min;
+    session_stats.rollbacks += 1;
+    session_stats.rolled_back_frames += depth;
+    session_stats.rollback_depths[SDL_min(depth, NETPLAY_ROLLBACK_DEPTH_MAX)] += 1;
 }
 
 static void save_state(GekkoGameEvent* event) {
-    *event->data.save.state_len = sizeof(State);
+    *event->data.save.state_len = get_state_size();
     State* dst = (State*)event->data.save.state;
 
     gather_state(dst);
 
 #if defined(DEBUG)
     const int frame = event->data.save.frame;
-    const State* saved_state = note_state(dst, frame);
-    *event->data.save.checksum = calculate_checksum(saved_state);
+    note_state(dst, frame);
+    *event->data.save.checksum = calculate_checksum(dst);
 #endif
 }
 
 static void load_state(const State* src) {
-    // GameState
-    const GameState* gs = &src->gs;
-    GameState_Load(gs);
-
-    // EffectState
-    const EffectState* es = &src->es;
-    SDL_copya(frw, es->frw);
-    SDL_copya(exec_tm, es->exec_tm);
-    SDL_copya(frwque, es->frwque);
-    SDL_copya(head_ix, es->head_ix);
-    SDL_copya(tail_ix, es->tail_ix);
-    frwctr = es->frwctr;
-    frwctr_min = es->frwctr_min;
+#if defined(DEBUG)
+    EffectState_LoadPortable(&src->es);
+    GameState_LoadPortable((const GameState*)src->gs);
+#else
+    EffectState_Load(&src->es);
+    GameState_Load((const GameState*)src->gs);
+#endif
 }
 
 static void load_state_from_event(GekkoGameEvent* event) {
@@ -398,7 +403,7 @@ static bool game_ready_to_run_character_select() {
 }
 
 static bool need_to_catch_up() {
-    return frames_behind >= 1;
+    return frames_behind >= CATCH_UP_THRESHOLD;
 }
 
 static void step_game(bool render) {
@@ -473,6 +478,12 @@ static void process_session() {
             const int frame = event->data.desynced.frame;
             printf("⚠️ desync detected at frame %d\n", frame);
 
+            if (session_stats.desyncs == 0) {
+                session_stats.first_desync_frame = frame;
+            }
+
+            session_stats.desyncs += 1;
+
 #if defined(DEBUG)
             dump_saved_state(frame);
 #endif
@@ -491,23 +502,35 @@ static void process_events(bool drawing_allowed) {
     int game_event_count = 0;
     GekkoGameEvent** game_events = gekko_update_session(session, &game_event_count);
     int frames_rolled_back = 0;
+    NetplayFrameStats* frame_stats = &session_stats.last_frame;
 
     for (int i = 0; i < game_event_count; i++) {
         const GekkoGameEvent* event = game_events[i];
+        const Uint64 start = SDL_GetTicksNS();
 
         switch (event->type) {
         case GekkoLoadEvent:
             load_state_from_event(event);
+            note_timing(&session_stats.load, &frame_stats->load_ns, start);
             break;
 
         case GekkoAdvanceEvent:
             const bool rolling_back = event->data.adv.rolling_back;
             advance_game(event, drawing_allowed && !rolling_back);
             frames_rolled_back += rolling_back ? 1 : 0;
+
+            if (rolling_back) {
+                note_timing(&session_stats.resimulate, &frame_stats->resimulate_ns, start);
+            } else {
+                session_stats.frames += 1;
+                note_timing(&session_stats.advance, &frame_stats->advance_ns, start);
+            }
+
             break;
 
         case GekkoSaveEvent:
             save_state(event);
+            note_timing(&session_stats.save, &frame_stats->save_ns, start);
             break;
 
         case GekkoEmptyGameEvent:
@@ -516,6 +539,8 @@ static void process_events(bool drawing_allowed) {
         }
     }
 
+    note_rollback(frames_rolled_back);
+    frame_stats->rollback_depth = SDL_max(frame_stats->rollback_depth, frames_rolled_back);
     frame_max_rollback = SDL_max(frame_max_rollback, frames_rolled_back);
 }
 
@@ -524,13 +549,110 @@ static void step_logic(bool drawing_allowed) {
     process_events(drawing_allowed);
 }
 
+/// Pick the local delay that hides the one-way latency plus jitter, so that
+/// rollbacks only have to cover what's left over.
+static int calculate_target_delay(const GekkoNetworkStats* net_stats) {
+    const float frame_time_ms = 1000 / TARGET_FPS;
+    const float latency_ms = net_stats->avg_ping / 2 + net_stats->jitter;
+    const int delay = (int)SDL_roundf(latency_ms / frame_time_ms);
+    return SDL_clamp(delay, DELAY_FRAMES_MIN, DELAY_FRAMES_MAX);
+}
+
+static void update_target_delay(const GekkoNetworkStats* net_stats) {
+    const int target_delay = calculate_target_delay(net_stats);
+
+    if (target_delay == local_delay) {
+        delay_candidate_samples = 0;
+        pending_delay = local_delay;
+        return;
+    }
+
+    if (target_delay == delay_candidate) {
+        delay_candidate_samples += 1;
+    } else {
+        delay_candidate = target_delay;
+        delay_candidate_samples = 1;
+    }
+
+    if (delay_candidate_samples >= DELAY_SAMPLES_TO_CHANGE) {
+        // Move one frame at a time so that a single bad reading can't swing delay wildly
+        pending_delay = local_delay + ((delay_candidate > local_delay) ? 1 : -1);
+    }
+}
+
+/// Changing delay drops or repeats a frame of local input, so only do it
+/// while neither player has control of their character.
+static bool is_safe_to_change_delay() {
+    return (G_No[1] == 2) && !Allow_a_battle_f;
+}
+
+static void apply_pending_delay() {
+    if ((pending_delay == local_delay) || !is_safe_to_change_delay()) {
+        return;
+    }
+
+    printf("🔴 changing local delay %d -> %d\n", local_delay, pending_delay);
+    local_delay = pending_delay;
+    delay_candidate_samples = 0;
+    gekko_set_local_delay(session, player_handle, local_delay);
+}
+
+static void log_network_stats() {
+    if (stats_log == NULL) {
+        return;
+    }
+
+    SDL_IOprintf(stats_log,
+                 "%.1f,%d,%d,%d,%d,%.2f,%d,%d,%d,%d,%d,%d,%d\n",
+                 (SDL_GetTicksNS() - session_start_time) / 1e9,
+                 session_stats.frames,
+                 network_stats.ping,
+                 network_stats.jitter,
+                 network_stats.delay,
+                 network_stats.frame_advantage,
+                 network_stats.rollback,
+                 network_stats.rolled_back_frames,
+                 network_stats.catch_up_frames,
+                 network_stats.save_us,
+                 network_stats.load_us,
+                 network_stats.resimulate_us,
+                 network_stats.lost_packets);
+}
+
+static int elapsed_us(const NetplayTiming* now, const NetplayTiming* before) {
+    return (now->total_ns - before->total_ns) / 1000;
+}
+
+static void update_per_second_stats() {
+    network_stats.frame_advantage = -frames_behind;
+    network_stats.rolled_back_frames = session_stats.rolled_back_frames - last_second_stats.rolled_back_frames;
+    network_stats.catch_up_frames = session_stats.catch_up_frames;
+    network_stats.save_us = elapsed_us(&session_stats.save, &last_second_stats.save);
+    network_stats.load_us = elapsed_us(&session_stats.load, &last_second_stats.load);
+    network_stats.resimulate_us = elapsed_us(&session_stats.resimulate, &last_second_stats.resimulate);
+    network_stats.lost_packets = -1;
+
+    if (NetEmulator_IsActive()) {
+        NetEmulatorStats emulator_stats;
+        NetEmulator_GetStats(&emulator_stats);
+        network_stats.lost_packets = emulator_stats.packets_dropped;
+    }
+
+    SDL_copyp(&last_second_stats, &session_stats);
+}
+
 static void update_network_stats() {
     if (stats_update_timer == 0) {
         GekkoNetworkStats net_stats;
         gekko_network_stats(session, player_handle ^ 1, &net_stats);
 
         network_stats.ping = net_stats.avg_ping;
-        network_stats.delay = DELAY_FRAMES;
+        network_stats.jitter = net_stats.jitter;
+        network_stats.delay = local_delay;
+
+        if (session_state == NETPLAY_SESSION_RUNNING) {
+            update_target_delay(&net_stats);
+        }
 
         if (frame_max_rollback < network_stats.rollback) {
             // Don't decrease the reading by more than a frame to account for
@@ -540,6 +662,12 @@ static void update_network_stats() {
             network_stats.rollback = frame_max_rollback;
         }
 
+        update_per_second_stats();
+
+        if (session_state == NETPLAY_SESSION_RUNNING) {
+            log_network_stats();
+        }
+
         frame_max_rollback = 0;
         stats_update_timer = STATS_UPDATE_TIMER_MAX;
     }
@@ -548,7 +676,23 @@ static void update_network_stats() {
     stats_update_timer = SDL_max(stats_update_timer, 0);
 }
 
+/// Spread time sync corrections over many frames by running slightly slower
+/// when we're ahead of the remote peer and slightly faster when we're behind.
+static void update_frame_pacing() {
+    const float frames_ahead = -frames_behind;
+    double stretch = 0;
+
+    if (SDL_fabsf(frames_ahead) > TIME_SYNC_DEADZONE) {
+        stretch = frames_ahead * TIME_SYNC_GAIN;
+        stretch = SDL_clamp(stretch, -TIME_SYNC_MAX_STRETCH, TIME_SYNC_MAX_STRETCH);
+    }
+
+    SDLApp_SetFrameTimeScale(1 + stretch);
+}
+
 static void run_netplay() {
+    SDL_zero(session_stats.last_frame);
+
     // Step
 
     const bool catch_up = need_to_catch_up() && (frame_skip_timer == 0);
@@ -557,11 +701,15 @@ static void run_netplay() {
     if (catch_up) {
         step_logic(true);
         frame_skip_timer = FRAME_SKIP_TIMER_MAX;
+        session_stats.catch_up_frames += 1;
     }
 
     frame_skip_timer -= 1;
     frame_skip_timer = SDL_max(frame_skip_timer, 0);
 
+    update_frame_pacing();
+    apply_pending_delay();
+
     // Update stats
 
     update_network_stats();
@@ -598,6 +746,14 @@ void Netplay_Begin() {
     frame_skip_timer = 0;
     transition_ready_frames = 0;
 
+    SDL_zero(session_stats);
+    SDL_zero(last_second_stats);
+    SDL_zero(network_stats);
+    local_delay = DELAY_FRAMES_MIN;
+    pending_delay = DELAY_FRAMES_MIN;
+    delay_candidate = DELAY_FRAMES_MIN;
+    delay_candidate_samples = 0;
+
     session_state = NETPLAY_SESSION_TRANSITIONING;
 }
 
@@ -632,12 +788,14 @@ void Netplay_Run() {
             // cleanup session and then return to idle
             gekko_destroy(&session);
 
-#ifndef LOSSY_ADAPTER
+            NetEmulator_Reset();
+            close_stats_log();
+
             // also cleanup default socket.
             gekko_default_adapter_destroy();
-#endif
         }
 
+        SDLApp_SetFrameTimeScale(1);
         session_state = NETPLAY_SESSION_IDLE;
         break;
 
@@ -668,3 +826,7 @@ void Netplay_HandleMenuExit() {
 void Netplay_GetNetworkStats(NetworkStats* stats) {
     SDL_copyp(stats, &network_stats);
 }
+
+void Netplay_GetSessionStats(NetplaySessionStats* stats) {
+    SDL_copyp(stats, &session_stats);
+}
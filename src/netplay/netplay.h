@@ -2,13 +2,56 @@
 #define NETPLAY_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
+#define NETPLAY_ROLLBACK_DEPTH_MAX 16
+
+/// Readings refreshed once per second.
 typedef struct NetworkStats {
     int delay;
     int ping;
     int rollback;
+    int jitter;
+    float frame_advantage;  // Positive when we're ahead of the remote peer
+    int rolled_back_frames; // Frames resimulated during the last second
+    int catch_up_frames;    // Extra frames run during the session to catch up
+    int save_us;            // Time spent saving state during the last second
+    int load_us;            // Time spent loading state during the last second
+    int resimulate_us;      // Time spent resimulating frames during the last second
+    int lost_packets;       // Only known when network emulation is active, -1 otherwise
 } NetworkStats;
 
+typedef struct NetplayTiming {
+    int count;
+    uint64_t total_ns;
+    uint64_t max_ns;
+} NetplayTiming;
+
+/// Work done during the most recent call to `Netplay_Run`.
+typedef struct NetplayFrameStats {
+    int rollback_depth;
+    uint64_t save_ns;
+    uint64_t load_ns;
+    uint64_t advance_ns;
+    uint64_t resimulate_ns;
+} NetplayFrameStats;
+
+/// Totals accumulated since the session started.
+typedef struct NetplaySessionStats {
+    int frames;
+    int rollbacks;
+    int rolled_back_frames;
+    int rollback_depths[NETPLAY_ROLLBACK_DEPTH_MAX + 1]; // The last bucket also counts deeper rollbacks
+    int catch_up_frames;
+    int desyncs;
+    int first_desync_frame;
+    NetplayTiming save;
+    NetplayTiming load;
+    NetplayTiming advance;
+    NetplayTiming resimulate;
+    NetplayFrameStats last_frame;
+} NetplaySessionStats;
+
 typedef enum NetplaySessionState {
     NETPLAY_SESSION_IDLE,
     NETPLAY_SESSION_TRANSITIONING,
@@ -23,5 +66,6 @@ void Netplay_Run();
 NetplaySessionState Netplay_GetSessionState();
 void Netplay_HandleMenuExit();
 void Netplay_GetNetworkStats(NetworkStats* stats);
+void Netplay_GetSessionStats(NetplaySessionStats* stats);
 
 #endif
@@ -0,0 +1,281 @@
+#include "netplay/soak_test.h"
+#include "main.h"
+#include "netplay/netplay.h"
+#include "port/autostart.h"
+#include "port/sdl/sdl_app.h"
+#include "sf33rd/AcrSDK/common/pad.h"
+#include "sf33rd/Source/Game/system/work_sys.h"
+
+#include <SDL3/SDL.h>
+
+#include <stdio.h>
+
+#define INPUTS_MAX 65536
+#define HOLD_FRAMES_MAX 12
+#define BOOT_TIMEOUT_FRAMES (60 * 60) // Give up if the session hasn't started after a minute
+
+typedef enum SoakTestState {
+    SOAK_TEST_INACTIVE,
+    SOAK_TEST_BOOTING,
+    SOAK_TEST_RUNNING,
+    SOAK_TEST_FINISHED,
+} SoakTestState;
+
+static const u16 directions[] = {
+    0,
+    SWK_UP,
+    SWK_DOWN,
+    SWK_LEFT,
+    SWK_RIGHT,
+    SWK_UP | SWK_LEFT,
+    SWK_UP | SWK_RIGHT,
+    SWK_DOWN | SWK_LEFT,
+    SWK_DOWN | SWK_RIGHT,
+};
+
+static const u16 attacks[] = { SWK_WEST, SWK_NORTH, SWK_RIGHT_SHOULDER, SWK_SOUTH, SWK_EAST, SWK_RIGHT_TRIGGER };
+
+static SoakTestState state = SOAK_TEST_INACTIVE;
+static SoakTestParams params = { 0 };
+static Uint32 rng_state = 1;
+
+static u16* scripted_inputs = NULL;
+static int scripted_input_count = 0;
+static int scripted_input_index = 0;
+
+static u16 current_input = 0;
+static int hold_frames = 0;
+static int frame = 0;
+static int session_start_frame = -1;
+static Uint64 start_time = 0;
+
+static SDL_IOStream* timings_io = NULL;
+
+static Uint32 random_u32() {
+    // xorshift32
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void load_scripted_inputs(const char* path) {
+    FILE* f = fopen(path, "r");
+
+    if (f == NULL) {
+        printf("⚠️ couldn't open soak test inputs at %s, using random inputs\n", path);
+        return;
+    }
+
+    scripted_inputs = SDL_malloc(INPUTS_MAX * sizeof(u16));
+    char line[32];
+
+    while ((scripted_input_count < INPUTS_MAX) && fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+
+        scripted_inputs[scripted_input_count] = SDL_strtoul(line, NULL, 16);
+        scripted_input_count += 1;
+    }
+
+    fclose(f);
+}
+
+/// Mash-like random input: hold a random direction, sometimes with an attack, for a few frames.
+static u16 next_random_input() {
+    if (hold_frames > 0) {
+        hold_frames -= 1;
+        return current_input;
+    }
+
+    current_input = directions[random_u32() % SDL_arraysize(directions)];
+
+    if ((random_u32() % 3) == 0) {
+        current_input |= attacks[random_u32() % SDL_arraysize(attacks)];
+    }
+
+    hold_frames = random_u32() % HOLD_FRAMES_MAX;
+    return current_input;
+}
+
+static u16 next_input() {
+    if (scripted_input_count == 0) {
+        return next_random_input();
+    }
+
+    const u16 input = scripted_inputs[scripted_input_index];
+    scripted_input_index = (scripted_input_index + 1) % scripted_input_count;
+    return input;
+}
+
+static void write_timing_json(SDL_IOStream* io, const char* name, const NetplayTiming* timing, bool last) {
+    const double avg_us = (timing->count > 0) ? (double)timing->total_ns / timing->count / 1e3 : 0;
+
+    SDL_IOprintf(io,
+                 "  \"%s\": { \"count\": %d, \"avg_us\": %.2f, \"max_us\": %.2f }%s\n",
+                 name,
+                 timing->count,
+                 avg_us,
+                 timing->max_ns / 1e3,
+                 last ? "" : ",");
+}
+
+static void write_report(bool completed) {
+    NetplaySessionStats stats;
+    Netplay_GetSessionStats(&stats);
+
+    SDL_IOStream* io = SDL_IOFromFile(params.report_path, "w");
+
+    if (io == NULL) {
+        printf("⚠️ couldn't write soak test report to %s: %s\n", params.report_path, SDL_GetError());
+        return;
+    }
+
+    SDL_IOprintf(io, "{\n");
+    SDL_IOprintf(io, "  \"completed\": %s,\n", completed ? "true" : "false");
+    SDL_IOprintf(io, "  \"seed\": %u,\n", params.seed);
+    SDL_IOprintf(io, "  \"frames\": %d,\n", stats.frames);
+    SDL_IOprintf(io, "  \"wall_time_s\": %.2f,\n", (SDL_GetTicksNS() - start_time) / 1e9);
+    SDL_IOprintf(io, "  \"desyncs\": %d,\n", stats.desyncs);
+    SDL_IOprintf(io, "  \"first_desync_frame\": %d,\n", (stats.desyncs > 0) ? stats.first_desync_frame : -1);
+    SDL_IOprintf(io, "  \"rollbacks\": %d,\n", stats.rollbacks);
+    SDL_IOprintf(io, "  \"rolled_back_frames\": %d,\n", stats.rolled_back_frames);
+    SDL_IOprintf(io, "  \"catch_up_frames\": %d,\n", stats.catch_up_frames);
+    SDL_IOprintf(io, "  \"rollback_depths\": [");
+
+    for (int i = 0; i <= NETPLAY_ROLLBACK_DEPTH_MAX; i++) {
+        SDL_IOprintf(io, "%d%s", stats.rollback_depths[i], (i < NETPLAY_ROLLBACK_DEPTH_MAX) ? ", " : "");
+    }
+
+    SDL_IOprintf(io, "],\n");
+    write_timing_json(io, "save", &stats.save, false);
+    write_timing_json(io, "load", &stats.load, false);
+    write_timing_json(io, "advance", &stats.advance, false);
+    write_timing_json(io, "resimulate", &stats.resimulate, true);
+    SDL_IOprintf(io, "}\n");
+    SDL_CloseIO(io);
+}
+
+static void note_frame_timings() {
+    if (timings_io == NULL) {
+        return;
+    }
+
+    NetplaySessionStats stats;
+    Netplay_GetSessionStats(&stats);
+    const NetplayFrameStats* last = &stats.last_frame;
+
+    SDL_IOprintf(timings_io,
+                 "%d,%d,%" SDL_PRIu64 ",%" SDL_PRIu64 ",%" SDL_PRIu64 ",%" SDL_PRIu64 "\n",
+                 stats.frames,
+                 last->rollback_depth,
+                 last->save_ns,
+                 last->load_ns,
+                 last->advance_ns,
+                 last->resimulate_ns);
+}
+
+static void finish(bool completed) {
+    printf("🧪 soak test %s after %d frames\n", completed ? "completed" : "failed", frame);
+    write_report(completed);
+
+    if (timings_io != NULL) {
+        SDL_CloseIO(timings_io);
+        timings_io = NULL;
+    }
+
+    SDL_free(scripted_inputs);
+    scripted_inputs = NULL;
+    state = SOAK_TEST_FINISHED;
+    SDLApp_Exit();
+}
+
+void SoakTest_Init(const SoakTestParams* init_params) {
+    SDL_copyp(&params, init_params);
+    rng_state = (params.seed != 0) ? params.seed : 1;
+
+    if (params.input_path != NULL) {
+        load_scripted_inputs(params.input_path);
+    }
+
+    if (params.timings_path != NULL) {
+        timings_io = SDL_IOFromFile(params.timings_path, "w");
+
+        if (timings_io != NULL) {
+            SDL_IOprintf(timings_io, "frame,rollback_depth,save_ns,load_ns,advance_ns,resimulate_ns\n");
+        }
+    }
+
+    start_time = SDL_GetTicksNS();
+    state = SOAK_TEST_BOOTING;
+}
+
+bool SoakTest_IsActive() {
+    return state == SOAK_TEST_BOOTING || state == SOAK_TEST_RUNNING;
+}
+
+void SoakTest_InjectInputs() {
+    p1sw_buff = 0;
+    p2sw_buff = 0;
+
+    switch (state) {
+    case SOAK_TEST_BOOTING:
+        // Skip through logos and the title screen until the menu shows up
+        Autostart_InjectInputs(AUTOSTART_BOOTING, frame, NULL);
+        break;
+
+    case SOAK_TEST_RUNNING:
+        p1sw_buff = next_input();
+        break;
+
+    case SOAK_TEST_INACTIVE:
+    case SOAK_TEST_FINISHED:
+        break;
+    }
+}
+
+void SoakTest_Update() {
+    frame += 1;
+
+    switch (state) {
+    case SOAK_TEST_BOOTING:
+        if (Autostart_IsMainMenuReady()) {
+            Netplay_Begin();
+            state = SOAK_TEST_RUNNING;
+        } else if (frame > BOOT_TIMEOUT_FRAMES) {
+            finish(false);
+        }
+
+        break;
+
+    case SOAK_TEST_RUNNING:
+        const NetplaySessionState session_state = Netplay_GetSessionState();
+
+        if (session_state == NETPLAY_SESSION_RUNNING) {
+            if (session_start_frame < 0) {
+                session_start_frame = frame;
+            }
+
+            note_frame_timings();
+
+            NetplaySessionStats stats;
+            Netplay_GetSessionStats(&stats);
+
+            if (stats.frames >= params.frames) {
+                finish(true);
+            }
+        } else if ((session_state == NETPLAY_SESSION_IDLE) || (session_state == NETPLAY_SESSION_EXITING)) {
+            // The peer disconnected
+            finish(false);
+        } else if ((session_start_frame < 0) && (frame > BOOT_TIMEOUT_FRAMES * 2)) {
+            finish(false);
+        }
+
+        break;
+
+    case SOAK_TEST_INACTIVE:
+    case SOAK_TEST_FINISHED:
+        break;
+    }
+}
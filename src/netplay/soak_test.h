@@ -0,0 +1,26 @@
+#ifndef NETPLAY_SOAK_TEST_H
+#define NETPLAY_SOAK_TEST_H
+
+#include <stdbool.h>
+
+typedef struct SoakTestParams {
+    int frames;               // Netplay frames to run before finishing
+    unsigned int seed;        // Seed for randomized inputs
+    const char* input_path;   // Optional file with one hex input per line, played in a loop instead of random inputs
+    const char* report_path;  // Where to write the JSON report
+    const char* timings_path; // Optional CSV with save/load/advance timings for every frame
+} SoakTestParams;
+
+/// Drive the game from boot into a netplay session on its own and run it for a fixed number of frames.
+/// Netplay params must be set up with `Netplay_SetParams` separately.
+void SoakTest_Init(const SoakTestParams* params);
+
+bool SoakTest_IsActive();
+
+/// Replace local controller inputs with the scripted or random ones. Call after inputs have been read.
+void SoakTest_InjectInputs();
+
+/// Collect stats for the frame that just ran and finish the test when it's done.
+void SoakTest_Update();
+
+#endif
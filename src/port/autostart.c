@@ -0,0 +1,102 @@
+#include "port/autostart.h"
+#include "main.h"
+#include "sf33rd/AcrSDK/common/pad.h"
+#include "sf33rd/Source/Game/debug/debug_config.h"
+#include "sf33rd/Source/Game/engine/workuser.h"
+#include "sf33rd/Source/Game/menu/menu.h"
+#include "sf33rd/Source/Game/system/work_sys.h"
+
+#include <stdio.h>
+
+// Drives the game from boot into a versus match without anyone at the controls, for the modes that play matches on
+// their own: saved replay playback, video export, hash streams and the match farm. Each of them goes through the same
+// phases and only differs in what it does once the match starts.
+
+#define PULSE_INTERVAL 16
+#define BOOT_TIMEOUT_FRAMES (60 * 60)       // The main menu shows up within seconds of booting
+#define SELECT_TIMEOUT_FRAMES (60 * 60 * 2) // Long enough for the screens between two matches
+
+bool Autostart_IsMainMenuReady() {
+    const struct _TASK* menu_task = &task[TASK_MENU];
+    return (menu_task->condition == 1) && (menu_task->r_no[0] == 0) && (menu_task->r_no[1] == 1) &&
+           (menu_task->r_no[2] == 3);
+}
+
+void Autostart_StartVersus(const AutostartSetup* setup) {
+    Debug_w[DEBUG_MY_CHAR_PL1] = setup->characters[0] + 1;
+    Debug_w[DEBUG_MY_CHAR_PL2] = setup->characters[1] + 1;
+    Debug_w[DEBUG_STAGE_SELECT] = setup->stage + 1;
+
+    Setup_VS_Mode(&task[TASK_MENU]);
+    G_No[1] = 12;
+    G_No[2] = 1;
+    Mode_Type = MODE_VERSUS;
+    cpExitTask(TASK_MENU);
+}
+
+void Autostart_InjectInputs(AutostartPhase phase, int frames_in_phase, const AutostartSetup* setup) {
+    const bool is_pulse = (frames_in_phase % PULSE_INTERVAL) == 0;
+
+    p1sw_buff = 0;
+    p2sw_buff = 0;
+
+    switch (phase) {
+    case AUTOSTART_BOOTING:
+        // The menu task only runs once the title screen has been left
+        if ((task[TASK_MENU].condition == 0) && is_pulse) {
+            p1sw_buff = SWK_START;
+        }
+
+        break;
+
+    case AUTOSTART_SELECTING:
+        // Characters are forced, so whatever is under the cursor gets picked
+        if (is_pulse) {
+            p1sw_buff = SWK_WEST;
+            p2sw_buff = SWK_WEST;
+        }
+
+        if (setup == NULL) {
+            break;
+        }
+
+        for (int i = 0; i < 2; i++) {
+            Super_Arts[i] = setup->super_arts[i];
+
+            if (setup->colors[i] >= 0) {
+                Player_Color[i] = setup->colors[i];
+            }
+        }
+
+        break;
+    }
+}
+
+bool Autostart_HasTimedOut(AutostartPhase phase, int frames_in_phase) {
+    switch (phase) {
+    case AUTOSTART_BOOTING:
+        if (frames_in_phase > BOOT_TIMEOUT_FRAMES) {
+            printf("⚠️ the main menu didn't show up\n");
+            return true;
+        }
+
+        break;
+
+    case AUTOSTART_SELECTING:
+        if (frames_in_phase > SELECT_TIMEOUT_FRAMES) {
+            printf("⚠️ the match didn't start\n");
+            return true;
+        }
+
+        break;
+    }
+
+    return false;
+}
+
+void Autostart_SeedRandom(unsigned int seed) {
+    Random_ix16 = seed & 0x3F;
+    Random_ix32 = (seed >> 6) & 0x7F;
+    Random_ix16_ex = (seed >> 13) & 0x3F;
+    Random_ix32_ex = (seed >> 19) & 0x7F;
+}
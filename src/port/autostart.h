@@ -0,0 +1,39 @@
+#ifndef PORT_AUTOSTART_H
+#define PORT_AUTOSTART_H
+
+#include <stdbool.h>
+
+typedef enum AutostartPhase {
+    AUTOSTART_BOOTING,   // Waiting for the main menu
+    AUTOSTART_SELECTING, // Going through character select, or through the screens after a match
+} AutostartPhase;
+
+/// What to force on the way into a versus match
+typedef struct AutostartSetup {
+    int characters[2]; // Character ids, as in `My_char`
+    int stage;         // `-1` lets the game pick one
+    int super_arts[2];
+    int colors[2]; // `-1` keeps what character select picks
+} AutostartSetup;
+
+/// @return Whether the main menu is waiting for a mode to be picked.
+bool Autostart_IsMainMenuReady();
+
+/// Leave the main menu for versus character select, the same as picking versus does. Characters are forced through the
+/// debug options that override character select, so picking anyone there starts the match with them.
+void Autostart_StartVersus(const AutostartSetup* setup);
+
+/// Replace the inputs of both players with what gets through a phase: START until the main menu is up, then the
+/// confirm button on character select and every screen around a match. Buttons are pressed every few frames, so that
+/// each press is seen as a new one.
+/// @param frames_in_phase Frames since the phase began.
+/// @param setup Super arts and colors to force while selecting, or `NULL` to only press buttons.
+void Autostart_InjectInputs(AutostartPhase phase, int frames_in_phase, const AutostartSetup* setup);
+
+/// @return Whether a phase has gone on for so long that the game is stuck in it. Prints which phase it was.
+bool Autostart_HasTimedOut(AutostartPhase phase, int frames_in_phase);
+
+/// Set the positions of the random number tables, which otherwise depend on everything that ran since boot
+void Autostart_SeedRandom(unsigned int seed);
+
+#endif
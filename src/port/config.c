@@ -31,6 +31,16 @@ static const ConfigEntry default_entries[] = {
     { .key = CFG_KEY_WINDOW_WIDTH, .type = CFG_INT, .value.i = 640 },
     { .key = CFG_KEY_WINDOW_HEIGHT, .type = CFG_INT, .value.i = 480 },
     { .key = CFG_KEY_SCALEMODE, .type = CFG_STRING, .value.s = "soft-linear" },
+    { .key = CFG_KEY_NETEM_PROFILE, .type = CFG_STRING, .value.s = "none" },
+    { .key = CFG_KEY_NETEM_DIRECTION, .type = CFG_STRING, .value.s = "send" },
+    { .key = CFG_KEY_NETEM_SEED, .type = CFG_INT, .value.i = 0 },
+    { .key = CFG_KEY_NETPLAY_STATS_LOG, .type = CFG_BOOL, .value.b = false },
+    { .key = CFG_KEY_AFS_MMAP, .type = CFG_BOOL, .value.b = true },
+    { .key = CFG_KEY_AFS_INDEX_CACHE, .type = CFG_BOOL, .value.b = true },
+    { .key = CFG_KEY_EFFECT_PROFILE, .type = CFG_BOOL, .value.b = false },
+    { .key = CFG_KEY_EFFECT_CLUSTER, .type = CFG_BOOL, .value.b = false },
+    { .key = CFG_KEY_RECORD_REPLAYS, .type = CFG_BOOL, .value.b = false },
+    { .key = CFG_KEY_REPLAY_KEYFRAME_INTERVAL, .type = CFG_INT, .value.i = 10 },
 };
 
 static ConfigEntry entries[CONFIG_ENTRIES_MAX] = { 0 };
@@ -7,6 +7,16 @@
 #define CFG_KEY_WINDOW_WIDTH "window-width"
 #define CFG_KEY_WINDOW_HEIGHT "window-height"
 #define CFG_KEY_SCALEMODE "scale-mode"
+#define CFG_KEY_NETEM_PROFILE "netem-profile"
+#define CFG_KEY_NETEM_DIRECTION "netem-direction"
+#define CFG_KEY_NETEM_SEED "netem-seed"
+#define CFG_KEY_NETPLAY_STATS_LOG "netplay-stats-log"
+#define CFG_KEY_AFS_MMAP "afs-mmap"
+#define CFG_KEY_AFS_INDEX_CACHE "afs-index-cache"
+#define CFG_KEY_EFFECT_PROFILE "effect-profile"
+#define CFG_KEY_EFFECT_CLUSTER "effect-cluster"
+#define CFG_KEY_RECORD_REPLAYS "record-replays"
+#define CFG_KEY_REPLAY_KEYFRAME_INTERVAL "replay-keyframe-interval"
 
 /// Initialize config system
 void Config_Init();
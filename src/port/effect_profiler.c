@@ -0,0 +1,187 @@
+#include "port/effect_profiler.h"
+#include "netplay/netplay.h"
+#include "port/config.h"
+#include "port/hash_stream.h"
+#include "port/match_farm.h"
+#include "port/paths.h"
+#include "port/replays.h"
+#include "port/video_export.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define EFFECT_IDS_MAX 256
+
+typedef struct EffectTimes {
+    int id;
+    Uint64 calls;
+    Uint64 ticks;
+    Uint64 peak_frame_ticks; // Most time spent on this id within a single frame
+    Uint64 frames;           // Frames in which this id was called at least once
+} EffectTimes;
+
+static bool is_enabled = false;
+static bool is_clustering_enabled = false;
+static SDL_IOStream* trace = NULL;
+static Uint64 frame = 0;
+static Uint64 frame_calls[EFFECT_IDS_MAX] = { 0 };
+static Uint64 frame_ticks[EFFECT_IDS_MAX] = { 0 };
+static EffectTimes totals[EFFECT_IDS_MAX] = { 0 };
+
+static void make_path(char** path, const char* extension) {
+    char timestamp[32];
+    const time_t now = time(NULL);
+    strftime(timestamp, sizeof(timestamp), "%Y%m%d_%H%M%S", localtime(&now));
+    SDL_asprintf(path, "%seffprof_%s.%s", Paths_GetBasePath(), timestamp, extension);
+}
+
+static double ticks_to_us(Uint64 ticks) {
+    return (double)ticks * 1000000.0 / SDL_GetPerformanceFrequency();
+}
+
+void EffectProfiler_Init() {
+    is_enabled = Config_GetBool(CFG_KEY_EFFECT_PROFILE);
+    is_clustering_enabled = Config_GetBool(CFG_KEY_EFFECT_CLUSTER);
+
+    for (int i = 0; i < EFFECT_IDS_MAX; i++) {
+        totals[i].id = i;
+    }
+
+    if (!is_enabled) {
+        return;
+    }
+
+    char* path;
+    make_path(&path, "csv");
+    trace = SDL_IOFromFile(path, "w");
+
+    if (trace == NULL) {
+        printf("⚠️ couldn't open effect trace at %s: %s\n", path, SDL_GetError());
+    } else {
+        printf("⏱️ tracing effect updates to %s\n", path);
+        SDL_IOprintf(trace, "frame,id,calls,us\n");
+    }
+
+    SDL_free(path);
+}
+
+void EffectProfiler_Quit() {
+    if (!is_enabled) {
+        return;
+    }
+
+    EffectProfiler_Dump("on exit");
+
+    if (trace != NULL) {
+        SDL_CloseIO(trace);
+        trace = NULL;
+    }
+}
+
+bool EffectProfiler_IsEnabled() {
+    return is_enabled;
+}
+
+bool EffectProfiler_IsClusteringEnabled() {
+    // Recorded and replayed matches have to be updated in the order every other build updates them in
+    const bool is_order_fixed = (Netplay_GetSessionState() != NETPLAY_SESSION_IDLE) || Replays_IsActive() ||
+                                MatchFarm_IsActive() || VideoExport_IsActive() || HashStream_IsActive();
+
+    return is_clustering_enabled && !is_order_fixed;
+}
+
+void EffectProfiler_Record(int id, Uint64 ticks) {
+    if ((id < 0) || (id >= EFFECT_IDS_MAX)) {
+        return;
+    }
+
+    frame_calls[id] += 1;
+    frame_ticks[id] += ticks;
+}
+
+void EffectProfiler_EndFrame() {
+    if (!is_enabled) {
+        return;
+    }
+
+    for (int id = 0; id < EFFECT_IDS_MAX; id++) {
+        if (frame_calls[id] == 0) {
+            continue;
+        }
+
+        EffectTimes* times = &totals[id];
+        times->calls += frame_calls[id];
+        times->ticks += frame_ticks[id];
+        times->peak_frame_ticks = SDL_max(times->peak_frame_ticks, frame_ticks[id]);
+        times->frames += 1;
+
+        if (trace != NULL) {
+            SDL_IOprintf(trace,
+                         "%" SDL_PRIu64 ",%d,%" SDL_PRIu64 ",%.2f\n",
+                         frame,
+                         id,
+                         frame_calls[id],
+                         ticks_to_us(frame_ticks[id]));
+        }
+    }
+
+    SDL_zeroa(frame_calls);
+    SDL_zeroa(frame_ticks);
+    frame += 1;
+}
+
+static int compare_times(const void* a, const void* b) {
+    const EffectTimes* times_a = a;
+    const EffectTimes* times_b = b;
+
+    if (times_a->ticks != times_b->ticks) {
+        return (times_a->ticks < times_b->ticks) ? 1 : -1;
+    }
+
+    return times_a->id - times_b->id;
+}
+
+void EffectProfiler_Dump(const char* reason) {
+    if (!is_enabled) {
+        printf("⚠️ effect profiling is disabled, set effect-profile to true in the config\n");
+        return;
+    }
+
+    EffectTimes sorted[EFFECT_IDS_MAX];
+    SDL_memcpy(sorted, totals, sizeof(sorted));
+    SDL_qsort(sorted, EFFECT_IDS_MAX, sizeof(EffectTimes), compare_times);
+
+    char* path;
+    make_path(&path, "txt");
+    SDL_IOStream* io = SDL_IOFromFile(path, "w");
+
+    if (io == NULL) {
+        printf("⚠️ couldn't write effect profile to %s: %s\n", path, SDL_GetError());
+        SDL_free(path);
+        return;
+    }
+
+    SDL_IOprintf(io, "Effect profile (%s), %" SDL_PRIu64 " frames\n\n", reason, frame);
+    SDL_IOprintf(io, "%4s %10s %12s %10s %14s %8s\n", "id", "calls", "total ms", "avg us", "peak frame us", "frames");
+
+    for (int i = 0; i < EFFECT_IDS_MAX; i++) {
+        const EffectTimes* times = &sorted[i];
+
+        if (times->calls == 0) {
+            break;
+        }
+
+        SDL_IOprintf(io,
+                     "%4d %10" SDL_PRIu64 " %12.3f %10.2f %14.2f %8" SDL_PRIu64 "\n",
+                     times->id,
+                     times->calls,
+                     ticks_to_us(times->ticks) / 1000.0,
+                     ticks_to_us(times->ticks) / times->calls,
+                     ticks_to_us(times->peak_frame_ticks),
+                     times->frames);
+    }
+
+    SDL_CloseIO(io);
+    printf("⏱️ wrote effect profile to %s (%s)\n", path, reason);
+    SDL_free(path);
+}
@@ -0,0 +1,31 @@
+#ifndef PORT_EFFECT_PROFILER_H
+#define PORT_EFFECT_PROFILER_H
+
+#include <SDL3/SDL.h>
+
+#include <stdbool.h>
+
+/// Read the `effect-profile` and `effect-cluster` options and open the trace file if profiling is enabled
+void EffectProfiler_Init();
+
+/// Write the final table and close the trace file
+void EffectProfiler_Quit();
+
+/// @return Whether effect handler calls should be timed and passed to `EffectProfiler_Record`.
+bool EffectProfiler_IsEnabled();
+
+/// @return Whether effects of the same id should be updated back-to-back. Always `false` during netplay, while a
+/// replay is recorded or played, and while the match farm, video export or a hash stream run, because it changes the
+/// order in which effects are updated.
+bool EffectProfiler_IsClusteringEnabled();
+
+/// Record a call to the move handler of effect `id` that took `ticks` performance counter ticks
+void EffectProfiler_Record(int id, Uint64 ticks);
+
+/// Write the calls recorded since the previous call to the trace file and add them to the totals
+void EffectProfiler_EndFrame();
+
+/// Write per-id totals sorted by time spent to `effprof_<date>_<time>.txt` next to the config
+void EffectProfiler_Dump(const char* reason);
+
+#endif
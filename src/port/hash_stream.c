@@ -0,0 +1,249 @@
+#include "port/hash_stream.h"
+#include "main.h"
+#include "netplay/game_state.h"
+#include "port/autostart.h"
+#include "port/replay_file.h"
+#include "port/replays.h"
+#include "port/sdl/sdl_app.h"
+#include "sf33rd/Source/Game/engine/workuser.h"
+#include "sf33rd/Source/Game/system/work_sys.h"
+#include "sf33rd/utils/djb2_hash.h"
+
+#include <SDL3/SDL.h>
+
+#include <stdio.h>
+
+// Boots into a versus match with the characters and stage of a replay and feeds it the recorded inputs, hashing the
+// simulation after every frame. Keyframes only fit the build that wrote them, so the match isn't restored from one.
+// It starts the way booting and going through the menus leaves it, with the random number tables seeded, which is the
+// same on every build that simulates the same way. The run doesn't have to match the recorded one for that.
+//
+// Only regions whose hash changed are written for a frame, see docs/determinism.md for the format.
+
+#define HASH_STREAM_MAGIC "3SXH"
+#define HASH_STREAM_VERSION 1
+#define NAME_LENGTH_MAX 64
+
+typedef enum HashStreamState {
+    HASH_STREAM_INACTIVE,
+    HASH_STREAM_BOOTING,
+    HASH_STREAM_SELECTING, // Going through character select
+    HASH_STREAM_PLAYING,
+    HASH_STREAM_FINISHED,
+} HashStreamState;
+
+static HashStreamState state = HASH_STREAM_INACTIVE;
+static HashStreamParams params = { 0 };
+static ReplayFile* file = NULL;
+static AutostartSetup autostart_setup = { 0 };
+static SDL_IOStream* io = NULL;
+
+static int frame = 0;
+static int state_frame = 0; // Frame the current state was entered on
+static int played_frames = 0;
+static Uint64 playback_start_time = 0;
+
+static int region_count = 0;
+static u32* hashes = NULL;
+static u32* prev_hashes = NULL;
+static u8* record = NULL;
+
+static void enter_state(HashStreamState new_state) {
+    state = new_state;
+    state_frame = frame;
+}
+
+static void finish(bool completed) {
+    const bool is_written = (io != NULL) && SDL_CloseIO(io) && completed;
+    const double seconds = (SDL_GetTicksNS() - playback_start_time) / 1e9;
+
+    if (is_written) {
+        printf("🧮 hashed %d frames to %s in %.1f s\n", played_frames, params.output_path, seconds);
+    } else {
+        printf("⚠️ hashing failed after %d frames\n", played_frames);
+    }
+
+    ReplayFile_Close(file);
+    SDL_free(hashes);
+    SDL_free(prev_hashes);
+    SDL_free(record);
+    file = NULL;
+    io = NULL;
+    hashes = NULL;
+    prev_hashes = NULL;
+    record = NULL;
+    enter_state(HASH_STREAM_FINISHED);
+    SDLApp_Exit();
+}
+
+static bool write_header() {
+    const int frame_count = ReplayFile_GetFrameCount(file);
+    bool is_written = (SDL_WriteIO(io, HASH_STREAM_MAGIC, 4) == 4) && SDL_WriteU32LE(io, HASH_STREAM_VERSION) &&
+                      SDL_WriteU32LE(io, region_count) && SDL_WriteU32LE(io, frame_count);
+
+    for (int i = 0; (i < region_count) && is_written; i++) {
+        char name[NAME_LENGTH_MAX];
+        GameState_GetRegionName(i, name, sizeof(name));
+        const size_t length = SDL_strlen(name) + 1;
+        is_written = SDL_WriteIO(io, name, length) == length;
+    }
+
+    return is_written;
+}
+
+bool HashStream_Init(const HashStreamParams* init_params) {
+    ReplaySetup setup;
+
+    SDL_copyp(&params, init_params);
+    file = ReplayFile_Open(
+        params.replay_path, &setup, Replays_GetSnapshotSize(), GameState_GetLayoutFingerprint());
+
+    if ((file == NULL) || (ReplayFile_GetFrameCount(file) == 0)) {
+        const char* reason = (file == NULL) ? SDL_GetError() : "it has no inputs";
+        printf("⚠️ couldn't read replay %s: %s\n", params.replay_path, reason);
+        ReplayFile_Close(file);
+        return false;
+    }
+
+    region_count = GameState_GetRegionCount();
+    hashes = SDL_malloc(region_count * sizeof(u32));
+    prev_hashes = SDL_calloc(region_count, sizeof(u32));
+    record = SDL_malloc(10 + region_count * 6);
+    io = SDL_IOFromFile(params.output_path, "wb");
+
+    if ((hashes == NULL) || (prev_hashes == NULL) || (record == NULL) || (io == NULL) || !write_header()) {
+        printf("⚠️ couldn't write hashes to %s: %s\n", params.output_path, SDL_GetError());
+
+        if (io != NULL) {
+            SDL_CloseIO(io);
+        }
+
+        ReplayFile_Close(file);
+        SDL_free(hashes);
+        SDL_free(prev_hashes);
+        SDL_free(record);
+        return false;
+    }
+
+    autostart_setup = Replays_GetAutostartSetup(&setup);
+    SDLApp_SetFrameTimeScale(0);
+    enter_state(HASH_STREAM_BOOTING);
+    return true;
+}
+
+bool HashStream_IsActive() {
+    return (state != HASH_STREAM_INACTIVE) && (state != HASH_STREAM_FINISHED);
+}
+
+void HashStream_InjectInputs() {
+    const int frames_in_state = frame - state_frame;
+
+    p1sw_buff = 0;
+    p2sw_buff = 0;
+
+    // Nothing gets drawn, so skip building sprites
+    No_Trans = 1;
+
+    switch (state) {
+    case HASH_STREAM_BOOTING:
+        Autostart_InjectInputs(AUTOSTART_BOOTING, frames_in_state, &autostart_setup);
+        break;
+
+    case HASH_STREAM_SELECTING:
+        Autostart_InjectInputs(AUTOSTART_SELECTING, frames_in_state, &autostart_setup);
+        break;
+
+    case HASH_STREAM_PLAYING:
+        const ReplayInputs inputs = ReplayFile_GetInputs(file, played_frames);
+        p1sw_buff = inputs.sw[0];
+        p2sw_buff = inputs.sw[1];
+        played_frames += 1;
+        break;
+
+    case HASH_STREAM_INACTIVE:
+    case HASH_STREAM_FINISHED:
+        break;
+    }
+}
+
+static void put_u16(u8** cursor, u16 value) {
+    (*cursor)[0] = value & 0xFF;
+    (*cursor)[1] = value >> 8;
+    *cursor += 2;
+}
+
+static void put_u32(u8** cursor, u32 value) {
+    put_u16(cursor, value & 0xFFFF);
+    put_u16(cursor, value >> 16);
+}
+
+/// Write the hash of the whole state and the hashes of the regions that changed since the previous frame
+static bool write_frame_hashes() {
+    if (!GameState_HashRegions(hashes)) {
+        return false;
+    }
+
+    u8* cursor = record;
+    int changed_count = 0;
+
+    put_u32(&cursor, played_frames - 1);
+    put_u32(&cursor, djb2_update_mem(djb2_init(), (const u8*)hashes, region_count * sizeof(u32)));
+    u8* changed_count_slot = cursor;
+    cursor += 2;
+
+    for (int i = 0; i < region_count; i++) {
+        if ((hashes[i] != prev_hashes[i]) || (played_frames == 1)) {
+            put_u16(&cursor, i);
+            put_u32(&cursor, hashes[i]);
+            changed_count += 1;
+        }
+    }
+
+    put_u16(&changed_count_slot, changed_count);
+    SDL_memcpy(prev_hashes, hashes, region_count * sizeof(u32));
+
+    const size_t size = cursor - record;
+    return SDL_WriteIO(io, record, size) == size;
+}
+
+void HashStream_Update() {
+    frame += 1;
+    const int frames_in_state = frame - state_frame;
+
+    switch (state) {
+    case HASH_STREAM_BOOTING:
+        if (Autostart_IsMainMenuReady()) {
+            Autostart_StartVersus(&autostart_setup);
+            enter_state(HASH_STREAM_SELECTING);
+        } else if (Autostart_HasTimedOut(AUTOSTART_BOOTING, frames_in_state)) {
+            finish(false);
+        }
+
+        break;
+
+    case HASH_STREAM_SELECTING:
+        if (G_No[1] == 2) {
+            Autostart_SeedRandom(params.seed);
+            playback_start_time = SDL_GetTicksNS();
+            enter_state(HASH_STREAM_PLAYING);
+        } else if (Autostart_HasTimedOut(AUTOSTART_SELECTING, frames_in_state)) {
+            finish(false);
+        }
+
+        break;
+
+    case HASH_STREAM_PLAYING:
+        if (!write_frame_hashes()) {
+            printf("⚠️ couldn't write hashes to %s: %s\n", params.output_path, SDL_GetError());
+            finish(false);
+        } else if (played_frames == ReplayFile_GetFrameCount(file)) {
+            finish(true);
+        }
+
+        break;
+
+    case HASH_STREAM_INACTIVE:
+    case HASH_STREAM_FINISHED:
+        break;
+    }
+}
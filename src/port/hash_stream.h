@@ -0,0 +1,27 @@
+#ifndef PORT_HASH_STREAM_H
+#define PORT_HASH_STREAM_H
+
+#include <stdbool.h>
+
+typedef struct HashStreamParams {
+    const char* replay_path; // Replay whose setup and inputs get played
+    const char* output_path; // Where to write the hashes
+    unsigned int seed;       // Seed of the random number tables when the match starts
+} HashStreamParams;
+
+/// Play the inputs of a replay in a match set up the same way and write hashes of the simulation state after every
+/// frame of it, then exit. Streams of the same replay written by different builds can be compared with
+/// tools/diff_hash_streams.py.
+/// @return Whether the replay and the output file could be opened.
+bool HashStream_Init(const HashStreamParams* params);
+
+bool HashStream_IsActive();
+
+/// Replace controller inputs with the ones that move through menus, or with recorded ones during the match. Call after
+/// inputs have been read.
+void HashStream_InjectInputs();
+
+/// Start the match once it's been set up, and hash the frame that just ran. Call after the frame has run.
+void HashStream_Update();
+
+#endif
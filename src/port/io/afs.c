@@ -3,6 +3,13 @@
 #include <SDL3/SDL.h>
 #include <stdio.h>
 
+#if !defined(_WIN32)
+#define AFS_MMAP_SUPPORTED
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 // Inspired by https://github.com/MaikelChan/AFSLib
 
 #define AFS_MAGIC 0x41465300
@@ -11,6 +18,8 @@
 #define AFS_MAX_NAME_LENGTH 32
 
 #define AFS_MAX_READ_REQUESTS 100
+#define AFS_MAX_PRELOADS 16
+#define AFS_SECTOR_SIZE 2048
 
 // Uncomment this to enable debug prints
 // #define AFS_DEBUG
@@ -25,6 +34,15 @@ typedef struct AFS {
     char* file_path;
     unsigned int entry_count;
     AFSEntry* entries;
+
+    // File names are only needed for debugging, so they are read the first time one is asked for
+    bool has_attributes;
+    bool are_names_loaded;
+    Uint32 attributes_offset;
+
+    // Read-only mapping of the whole archive, NULL when reads go through SDL_AsyncIO
+    Uint8* mapped_data;
+    size_t mapped_size;
 } AFS;
 
 typedef struct ReadRequest {
@@ -36,9 +54,30 @@ typedef struct ReadRequest {
     SDL_AsyncIO* asyncio;
 } ReadRequest;
 
+typedef enum PreloadState {
+    PRELOAD_STATE_FREE,
+    PRELOAD_STATE_READING,
+    PRELOAD_STATE_FINISHED,
+} PreloadState;
+
+/// A whole file being read into a staging buffer ahead of the `AFS_Read` that needs it
+typedef struct Preload {
+    PreloadState state;
+    int file_num;
+    int sectors;
+    Uint8* data;
+    bool discarded; // Free the buffer as soon as the read completes
+
+    // Request that's waiting for the preload to finish, along with its destination buffer
+    ReadRequest* waiting_request;
+    void* waiting_buf;
+} Preload;
+
 static AFS afs = { 0 };
 static SDL_AsyncIOQueue* asyncio_queue = NULL;
 static ReadRequest requests[AFS_MAX_READ_REQUESTS] = { { 0 } };
+static SDL_AsyncIOQueue* preload_queue = NULL;
+static Preload preloads[AFS_MAX_PRELOADS] = { { 0 } };
 
 static bool is_valid_attribute_data(Uint32 attributes_offset, Uint32 attributes_size, Sint64 file_size,
                                     Uint32 entries_end_offset, Uint32 entry_count) {
@@ -65,17 +104,66 @@ static bool is_valid_attribute_data(Uint32 attributes_offset, Uint32 attributes_
     return true;
 }
 
-static void read_string(SDL_IOStream* src, char* dst) {
-    char c;
+static void parse_names(const Uint8* attributes) {
+    for (int i = 0; i < afs.entry_count; i++) {
+        AFSEntry* entry = &afs.entries[i];
+
+        if (entry->offset == 0) {
+            continue;
+        }
+
+        // Names that fill the whole field aren't null-terminated
+        const char* name = (const char*)&attributes[i * AFS_ATTRIBUTE_ENTRY_SIZE];
+        const size_t length = SDL_strnlen(name, AFS_MAX_NAME_LENGTH - 1);
+        SDL_memcpy(entry->name, name, length);
+        entry->name[length] = '\0';
+    }
+}
+
+static void load_names() {
+    afs.are_names_loaded = true;
+
+    if (!afs.has_attributes) {
+        return;
+    }
+
+    const size_t size = (size_t)afs.entry_count * AFS_ATTRIBUTE_ENTRY_SIZE;
+
+    if ((afs.mapped_data != NULL) && (afs.attributes_offset + size <= afs.mapped_size)) {
+        parse_names(afs.mapped_data + afs.attributes_offset);
+        return;
+    }
+
+    SDL_IOStream* io = SDL_IOFromFile(afs.file_path, "rb");
+    Uint8* attributes = SDL_malloc(size);
+
+    if ((io != NULL) && (attributes != NULL) && (SDL_SeekIO(io, afs.attributes_offset, SDL_IO_SEEK_SET) >= 0) &&
+        (SDL_ReadIO(io, attributes, size) == size)) {
+        parse_names(attributes);
+    }
+
+    SDL_free(attributes);
 
-    do {
-        SDL_ReadIO(src, &c, 1);
-        *dst++ = c;
-    } while (c != '\0');
+    if (io != NULL) {
+        SDL_CloseIO(io);
+    }
 }
 
+static bool read_attribute_header(SDL_IOStream* io, Sint64 offset, Uint32* attributes_offset,
+                                  Uint32* attributes_size) {
+    Uint32 header[2];
+
+    if ((SDL_SeekIO(io, offset, SDL_IO_SEEK_SET) < 0) || (SDL_ReadIO(io, header, sizeof(header)) != sizeof(header))) {
+        return false;
+    }
+
+    *attributes_offset = SDL_Swap32LE(header[0]);
+    *attributes_size = SDL_Swap32LE(header[1]);
+    return true;
+}
+
+/// Read the table of contents with one read and parse it from memory
 static bool init_afs(const char* file_path) {
-    afs.file_path = SDL_strdup(file_path);
     SDL_IOStream* io = SDL_IOFromFile(file_path, "rb");
 
     if (io == NULL) {
@@ -84,26 +172,38 @@ static bool init_afs(const char* file_path) {
 
     // Check magic
 
-    Uint32 magic = 0;
-    SDL_ReadU32BE(io, &magic);
+    Uint32 header[2];
 
-    if (magic != AFS_MAGIC) {
+    if ((SDL_ReadIO(io, header, sizeof(header)) != sizeof(header)) || (SDL_Swap32BE(header[0]) != AFS_MAGIC)) {
         SDL_CloseIO(io);
         return false;
     }
 
-    // Read entries
+    // Read entries, followed by the location of the attributes
+
+    const Sint64 file_size = SDL_GetIOSize(io);
+    const Uint32 entry_count = SDL_Swap32LE(header[1]);
+    const size_t toc_size = ((size_t)entry_count + 1) * 2 * sizeof(Uint32);
+    Uint32* toc = ((Sint64)toc_size <= file_size) ? SDL_malloc(toc_size) : NULL;
+    afs.entries = SDL_calloc(entry_count, sizeof(AFSEntry));
 
-    SDL_ReadU32LE(io, &afs.entry_count);
-    afs.entries = SDL_malloc(sizeof(AFSEntry) * afs.entry_count);
+    if ((toc == NULL) || (afs.entries == NULL) || (SDL_ReadIO(io, toc, toc_size) != toc_size)) {
+        SDL_free(toc);
+        SDL_free(afs.entries);
+        afs.entries = NULL;
+        SDL_CloseIO(io);
+        return false;
+    }
+
+    afs.entry_count = entry_count;
 
     Uint32 entries_start_offset = 0;
     Uint32 entries_end_offset = 0;
 
     for (int i = 0; i < afs.entry_count; i++) {
         AFSEntry* entry = &afs.entries[i];
-        SDL_ReadU32LE(io, &entry->offset);
-        SDL_ReadU32LE(io, &entry->size);
+        entry->offset = SDL_Swap32LE(toc[i * 2]);
+        entry->size = SDL_Swap32LE(toc[i * 2 + 1]);
 
         if (entry->offset != 0) {
             if (entries_start_offset == 0) {
@@ -116,61 +216,203 @@ static bool init_afs(const char* file_path) {
 
     // Locate attributes
 
+    Uint32 attributes_offset = SDL_Swap32LE(toc[entry_count * 2]);
+    Uint32 attributes_size = SDL_Swap32LE(toc[entry_count * 2 + 1]);
+    SDL_free(toc);
+
+    if (is_valid_attribute_data(attributes_offset, attributes_size, file_size, entries_end_offset, afs.entry_count)) {
+        afs.has_attributes = true;
+    } else if (read_attribute_header(
+                   io, entries_start_offset - AFS_ATTRIBUTE_HEADER_SIZE, &attributes_offset, &attributes_size) &&
+               is_valid_attribute_data(
+                   attributes_offset, attributes_size, file_size, entries_end_offset, afs.entry_count)) {
+        afs.has_attributes = true;
+    }
+
+    afs.attributes_offset = attributes_offset;
+    SDL_CloseIO(io);
+    return true;
+}
+
+// Index cache
+//
+// The parsed table of contents, names included, is stored next to the config and reused as long as the archive's
+// size and modification time don't change.
+
+#define AFS_INDEX_MAGIC 0x33584149 // "IAX3"
+#define AFS_INDEX_VERSION 1
+
+typedef struct AFSIndexHeader {
+    Uint32 magic;
+    Uint32 version;
+    Uint64 archive_size;
+    SDL_Time archive_mtime;
+    Uint32 entry_count;
     Uint32 attributes_offset;
-    Uint32 attributes_size;
-    bool has_attributes = false;
+    Uint32 has_attributes;
+    Uint32 entry_size;
+} AFSIndexHeader;
 
-    SDL_ReadU32LE(io, &attributes_offset);
-    SDL_ReadU32LE(io, &attributes_size);
+static bool get_archive_info(const char* file_path, SDL_PathInfo* info) {
+    return SDL_GetPathInfo(file_path, info) && (info->type == SDL_PATHTYPE_FILE);
+}
 
-    if (is_valid_attribute_data(
-            attributes_offset, attributes_size, SDL_GetIOSize(io), entries_end_offset, afs.entry_count)) {
-        has_attributes = true;
-    } else {
-        SDL_SeekIO(io, entries_start_offset - AFS_ATTRIBUTE_HEADER_SIZE, SDL_IO_SEEK_SET);
+static bool load_index_cache(const char* cache_path, const char* file_path) {
+    SDL_PathInfo info;
 
-        SDL_ReadU32LE(io, &attributes_offset);
-        SDL_ReadU32LE(io, &attributes_size);
+    if (!get_archive_info(file_path, &info)) {
+        return false;
+    }
 
-        if (is_valid_attribute_data(
-                attributes_offset, attributes_size, SDL_GetIOSize(io), entries_end_offset, afs.entry_count)) {
-            has_attributes = true;
-        }
+    size_t size = 0;
+    Uint8* data = SDL_LoadFile(cache_path, &size);
+
+    if (data == NULL) {
+        return false;
     }
 
-    for (int i = 0; i < afs.entry_count; i++) {
-        AFSEntry* entry = &afs.entries[i];
+    AFSIndexHeader header;
+    bool is_valid = size >= sizeof(header);
 
-        if ((entry->offset != 0) && has_attributes) {
-            SDL_SeekIO(io, attributes_offset + i * AFS_ATTRIBUTE_ENTRY_SIZE, SDL_IO_SEEK_SET);
-            read_string(io, &entry->name);
-        } else {
-            SDL_memset(&entry->name, 0, sizeof(entry->name));
-        }
+    if (is_valid) {
+        SDL_memcpy(&header, data, sizeof(header));
+        is_valid = (header.magic == AFS_INDEX_MAGIC) && (header.version == AFS_INDEX_VERSION) &&
+                   (header.archive_size == info.size) && (header.archive_mtime == info.modify_time) &&
+                   (header.entry_size == sizeof(AFSEntry)) &&
+                   (size == sizeof(header) + (size_t)header.entry_count * sizeof(AFSEntry));
     }
 
+    if (is_valid) {
+        afs.entries = SDL_malloc((size_t)header.entry_count * sizeof(AFSEntry));
+        is_valid = (afs.entries != NULL) || (header.entry_count == 0);
+    }
+
+    if (is_valid) {
+        SDL_memcpy(afs.entries, data + sizeof(header), (size_t)header.entry_count * sizeof(AFSEntry));
+        afs.entry_count = header.entry_count;
+        afs.attributes_offset = header.attributes_offset;
+        afs.has_attributes = header.has_attributes != 0;
+        afs.are_names_loaded = true;
+    }
+
+    SDL_free(data);
+    return is_valid;
+}
+
+static void save_index_cache(const char* cache_path, const char* file_path) {
+    SDL_PathInfo info;
+
+    if (!get_archive_info(file_path, &info)) {
+        return;
+    }
+
+    if (!afs.are_names_loaded) {
+        load_names();
+    }
+
+    const AFSIndexHeader header = { .magic = AFS_INDEX_MAGIC,
+                                    .version = AFS_INDEX_VERSION,
+                                    .archive_size = info.size,
+                                    .archive_mtime = info.modify_time,
+                                    .entry_count = afs.entry_count,
+                                    .attributes_offset = afs.attributes_offset,
+                                    .has_attributes = afs.has_attributes,
+                                    .entry_size = sizeof(AFSEntry) };
+
+    SDL_IOStream* io = SDL_IOFromFile(cache_path, "wb");
+
+    if (io == NULL) {
+        return;
+    }
+
+    const size_t entries_size = (size_t)afs.entry_count * sizeof(AFSEntry);
+    const bool is_written = (SDL_WriteIO(io, &header, sizeof(header)) == sizeof(header)) &&
+                            (SDL_WriteIO(io, afs.entries, entries_size) == entries_size);
+
     SDL_CloseIO(io);
-    return true;
+
+    if (!is_written) {
+        // Don't leave a truncated cache behind
+        SDL_RemovePath(cache_path);
+    }
 }
 
 static bool init_asyncio(const char* file_path) {
     asyncio_queue = SDL_CreateAsyncIOQueue();
-    return asyncio_queue != NULL;
+    preload_queue = SDL_CreateAsyncIOQueue();
+    return (asyncio_queue != NULL) && (preload_queue != NULL);
+}
+
+static void init_mapping(const char* file_path) {
+#if defined(AFS_MMAP_SUPPORTED)
+    const int fd = open(file_path, O_RDONLY);
+
+    if (fd < 0) {
+        printf("⚠️ couldn't open %s for mapping, falling back to regular reads\n", file_path);
+        return;
+    }
+
+    const off_t file_size = lseek(fd, 0, SEEK_END);
+    void* data = (file_size > 0) ? mmap(NULL, file_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+
+    if (data == MAP_FAILED) {
+        printf("⚠️ couldn't map %s, falling back to regular reads\n", file_path);
+        return;
+    }
+
+    // Files are read in bursts scattered across the archive, so speculative readahead past them is mostly wasted
+    posix_madvise(data, file_size, POSIX_MADV_RANDOM);
+
+    afs.mapped_data = data;
+    afs.mapped_size = file_size;
+#endif
+}
+
+static void destroy_mapping() {
+#if defined(AFS_MMAP_SUPPORTED)
+    if (afs.mapped_data != NULL) {
+        munmap(afs.mapped_data, afs.mapped_size);
+    }
+#endif
 }
 
-bool AFS_Init(const char* file_path) {
-    if (!init_afs(file_path)) {
+bool AFS_Init(const char* file_path, bool use_mapping, const char* index_cache_path) {
+    afs.file_path = SDL_strdup(file_path);
+
+    const bool is_index_cached = (index_cache_path != NULL) && load_index_cache(index_cache_path, file_path);
+
+    if (!is_index_cached && !init_afs(file_path)) {
         return false;
     }
 
+    if (use_mapping) {
+        init_mapping(file_path);
+    }
+
+    if ((index_cache_path != NULL) && !is_index_cached) {
+        save_index_cache(index_cache_path, file_path);
+    }
+
     return init_asyncio(file_path);
 }
 
 void AFS_Finish() {
+    // Destroying the queue waits for pending preloads, so their buffers can be freed afterwards
+    SDL_DestroyAsyncIOQueue(preload_queue);
+
+    for (int i = 0; i < SDL_arraysize(preloads); i++) {
+        SDL_free(preloads[i].data);
+    }
+
+    destroy_mapping();
     SDL_free(afs.file_path);
     SDL_free(afs.entries);
     SDL_zero(afs);
     SDL_zeroa(requests);
+    SDL_zeroa(preloads);
     SDL_DestroyAsyncIOQueue(asyncio_queue);
 }
 
@@ -186,6 +428,225 @@ unsigned int AFS_GetSize(int file_num) {
     return afs.entries[file_num].size;
 }
 
+const char* AFS_GetName(int file_num) {
+    if ((file_num < 0) || (file_num >= afs.entry_count)) {
+        return "";
+    }
+
+    if (!afs.are_names_loaded) {
+        load_names();
+    }
+
+    return afs.entries[file_num].name;
+}
+
+static bool is_file_mapped(int file_num) {
+    if ((afs.mapped_data == NULL) || (file_num < 0) || (file_num >= afs.entry_count)) {
+        return false;
+    }
+
+    const AFSEntry* entry = &afs.entries[file_num];
+    return ((Uint64)entry->offset + entry->size) <= afs.mapped_size;
+}
+
+const void* AFS_GetData(int file_num) {
+    if (!is_file_mapped(file_num)) {
+        return NULL;
+    }
+
+    return afs.mapped_data + afs.entries[file_num].offset;
+}
+
+void AFS_Prefetch(int file_num) {
+#if defined(AFS_MMAP_SUPPORTED)
+    if (!is_file_mapped(file_num)) {
+        return;
+    }
+
+    const AFSEntry* entry = &afs.entries[file_num];
+    const uintptr_t page_mask = (uintptr_t)sysconf(_SC_PAGESIZE) - 1;
+    const uintptr_t start = (uintptr_t)(afs.mapped_data + entry->offset) & ~page_mask;
+    const uintptr_t end = (uintptr_t)(afs.mapped_data + entry->offset + entry->size);
+
+    posix_madvise((void*)start, end - start, POSIX_MADV_WILLNEED);
+#endif
+}
+
+// Preloading
+
+static int get_sector_count(int file_num) {
+    return (afs.entries[file_num].size + AFS_SECTOR_SIZE - 1) / AFS_SECTOR_SIZE;
+}
+
+static Preload* find_preload(int file_num) {
+    for (int i = 0; i < SDL_arraysize(preloads); i++) {
+        Preload* preload = &preloads[i];
+
+        if ((preload->state != PRELOAD_STATE_FREE) && !preload->discarded && (preload->file_num == file_num)) {
+            return preload;
+        }
+    }
+
+    return NULL;
+}
+
+static void free_preload(Preload* preload) {
+    SDL_free(preload->data);
+    SDL_zerop(preload);
+}
+
+void AFS_Preload(int file_num) {
+    if ((file_num < 0) || (file_num >= afs.entry_count) || (afs.entries[file_num].size == 0)) {
+        return;
+    }
+
+    if (is_file_mapped(file_num)) {
+        AFS_Prefetch(file_num);
+        return;
+    }
+
+    if (find_preload(file_num) != NULL) {
+        return;
+    }
+
+    Preload* preload = NULL;
+
+    for (int i = 0; i < SDL_arraysize(preloads); i++) {
+        if (preloads[i].state == PRELOAD_STATE_FREE) {
+            preload = &preloads[i];
+            break;
+        }
+    }
+
+    if (preload == NULL) {
+        return;
+    }
+
+    const int sectors = get_sector_count(file_num);
+    Uint8* data = SDL_malloc((size_t)sectors * AFS_SECTOR_SIZE);
+    SDL_AsyncIO* asyncio = (data != NULL) ? SDL_AsyncIOFromFile(afs.file_path, "r") : NULL;
+
+    if (asyncio == NULL) {
+        SDL_free(data);
+        return;
+    }
+
+    preload->state = PRELOAD_STATE_READING;
+    preload->file_num = file_num;
+    preload->sectors = sectors;
+    preload->data = data;
+
+    if (!SDL_ReadAsyncIO(asyncio,
+                         data,
+                         afs.entries[file_num].offset,
+                         (Uint64)sectors * AFS_SECTOR_SIZE,
+                         preload_queue,
+                         preload)) {
+        SDL_CloseAsyncIO(asyncio, false, preload_queue, NULL);
+        free_preload(preload);
+        return;
+    }
+
+    // The handle can be closed right away, the read finishes first
+    SDL_CloseAsyncIO(asyncio, false, preload_queue, NULL);
+
+#if defined(AFS_DEBUG)
+    printf("📂 preload %d (sectors = %d)\n", file_num, sectors);
+#endif
+}
+
+void AFS_DiscardPreloads() {
+    for (int i = 0; i < SDL_arraysize(preloads); i++) {
+        Preload* preload = &preloads[i];
+
+        switch (preload->state) {
+        case PRELOAD_STATE_FREE:
+            break;
+
+        case PRELOAD_STATE_READING:
+            if (preload->waiting_request == NULL) {
+                preload->discarded = true;
+            }
+
+            break;
+
+        case PRELOAD_STATE_FINISHED:
+            free_preload(preload);
+            break;
+        }
+    }
+}
+
+static void finish_read_from_preload(ReadRequest* request, Preload* preload, void* buf) {
+    SDL_memcpy(buf, preload->data, (size_t)preload->sectors * AFS_SECTOR_SIZE);
+    request->state = AFS_READ_STATE_FINISHED;
+}
+
+static void process_preload_outcome(const SDL_AsyncIOOutcome* outcome) {
+    Preload* preload = (Preload*)outcome->userdata;
+
+    // Outcomes of closing the handles don't carry a preload
+    if ((preload == NULL) || (outcome->type != SDL_ASYNCIO_TASK_READ)) {
+        return;
+    }
+
+    const bool success = (outcome->result == SDL_ASYNCIO_COMPLETE);
+    ReadRequest* request = preload->waiting_request;
+
+    if (request != NULL) {
+        if (success) {
+            finish_read_from_preload(request, preload, preload->waiting_buf);
+        } else {
+            request->state = AFS_READ_STATE_ERROR;
+        }
+
+        free_preload(preload);
+    } else if (!success || preload->discarded) {
+        free_preload(preload);
+    } else {
+        preload->state = PRELOAD_STATE_FINISHED;
+    }
+}
+
+/// Serve a read from a preload of the same file.
+/// @return Whether the read was taken over by the preload.
+static bool read_from_preload(ReadRequest* request, int sectors, void* buf) {
+    Preload* preload = find_preload(request->file_num);
+
+    if ((preload == NULL) || (request->sector != 0) || (sectors != preload->sectors)) {
+        return false;
+    }
+
+    switch (preload->state) {
+    case PRELOAD_STATE_FREE:
+        return false;
+
+    case PRELOAD_STATE_READING:
+        request->state = AFS_READ_STATE_READING;
+        preload->waiting_request = request;
+        preload->waiting_buf = buf;
+        break;
+
+    case PRELOAD_STATE_FINISHED:
+        finish_read_from_preload(request, preload, buf);
+        free_preload(preload);
+        break;
+    }
+
+    request->sector += sectors;
+    return true;
+}
+
+static Preload* find_waiting_preload(const ReadRequest* request) {
+    for (int i = 0; i < SDL_arraysize(preloads); i++) {
+        if ((preloads[i].state == PRELOAD_STATE_READING) && (preloads[i].waiting_request == request)) {
+            return &preloads[i];
+        }
+    }
+
+    return NULL;
+}
+
 // AFS reading
 
 static void process_asyncio_outcome(const SDL_AsyncIOOutcome* outcome) {
@@ -242,6 +703,10 @@ void AFS_RunServer() {
     while (SDL_GetAsyncIOResult(asyncio_queue, &outcome)) {
         process_asyncio_outcome(&outcome);
     }
+
+    while (SDL_GetAsyncIOResult(preload_queue, &outcome)) {
+        process_preload_outcome(&outcome);
+    }
 }
 
 AFSHandle AFS_Open(int file_num) {
@@ -264,19 +729,45 @@ AFSHandle AFS_Open(int file_num) {
     }
 
 #if defined(AFS_DEBUG)
-    printf("📂 %d: open (file_num = %d, filename = %s)\n", retval, file_num, afs.entries[file_num].name);
+    printf("📂 %d: open (file_num = %d, filename = %s)\n", retval, file_num, AFS_GetName(file_num));
 #endif
 
     return retval;
 }
 
+/// Serve a read straight from the mapping. Completes immediately, so the request never enters the reading state.
+static void read_from_mapping(ReadRequest* request, int sectors, void* buf) {
+    const AFSEntry* entry = &afs.entries[request->file_num];
+    const Uint64 offset = entry->offset + (Uint64)request->sector * AFS_SECTOR_SIZE;
+    const size_t requested = (size_t)sectors * AFS_SECTOR_SIZE;
+    const size_t available = (offset < afs.mapped_size) ? SDL_min(requested, afs.mapped_size - offset) : 0;
+
+    SDL_memcpy(buf, afs.mapped_data + offset, available);
+
+    // Reads past the end of the archive come back zeroed, like the tail of a short sector read
+    SDL_memset((Uint8*)buf + available, 0, requested - available);
+
+    request->state = AFS_READ_STATE_FINISHED;
+    request->sector += sectors;
+}
+
 void AFS_Read(AFSHandle handle, int sectors, void* buf) {
 #if defined(AFS_DEBUG)
-    printf("📂 %d: read (sectors = %d, bytes = 0x%X)\n", handle, sectors, sectors * 2048);
+    printf("📂 %d: read (sectors = %d, bytes = 0x%X)\n", handle, sectors, sectors * AFS_SECTOR_SIZE);
 #endif
 
     ReadRequest* request = &requests[handle];
-    const Uint64 offset = afs.entries[request->file_num].offset + request->sector * 2048;
+
+    if (is_file_mapped(request->file_num)) {
+        read_from_mapping(request, sectors, buf);
+        return;
+    }
+
+    if (read_from_preload(request, sectors, buf)) {
+        return;
+    }
+
+    const Uint64 offset = afs.entries[request->file_num].offset + request->sector * AFS_SECTOR_SIZE;
 
     request->state = AFS_READ_STATE_READING;
     request->asyncio = SDL_AsyncIOFromFile(afs.file_path, "r");
@@ -287,7 +778,8 @@ void AFS_Read(AFSHandle handle, int sectors, void* buf) {
         return;
     }
 
-    const bool success = SDL_ReadAsyncIO(request->asyncio, buf, offset, sectors * 2048, asyncio_queue, request);
+    const bool success =
+        SDL_ReadAsyncIO(request->asyncio, buf, offset, sectors * AFS_SECTOR_SIZE, asyncio_queue, request);
 
     if (!success) {
         printf("SDL_ReadAsyncIO error: %s\n", SDL_GetError());
@@ -305,8 +797,22 @@ void AFS_ReadSync(AFSHandle handle, int sectors, void* buf) {
 
     AFS_Read(handle, sectors, buf);
 
+    if (requests[handle].state != AFS_READ_STATE_READING) {
+        // Served from the mapping or a preload, or failed to start
+        return;
+    }
+
     SDL_AsyncIOOutcome outcome;
 
+    if (find_waiting_preload(&requests[handle]) != NULL) {
+        while ((requests[handle].state == AFS_READ_STATE_READING) &&
+               SDL_WaitAsyncIOResult(preload_queue, &outcome, -1)) {
+            process_preload_outcome(&outcome);
+        }
+
+        return;
+    }
+
     while (SDL_WaitAsyncIOResult(asyncio_queue, &outcome, -1)) {
         process_asyncio_outcome(&outcome);
 
@@ -329,6 +835,16 @@ void AFS_Stop(AFSHandle handle) {
         SDL_CloseAsyncIO(request->asyncio, false, asyncio_queue, request);
         request->asyncio = NULL;
     }
+
+    Preload* preload = find_waiting_preload(request);
+
+    // The preload reads into a buffer of its own, so once it's detached nothing gets written to the request's buffer
+    if (preload != NULL) {
+        preload->waiting_request = NULL;
+        preload->waiting_buf = NULL;
+        preload->discarded = true;
+        request->state = AFS_READ_STATE_IDLE;
+    }
 }
 
 void AFS_Close(AFSHandle handle) {
@@ -354,5 +870,5 @@ AFSReadState AFS_GetState(AFSHandle handle) {
 unsigned int AFS_GetSectorCount(AFSHandle handle) {
     ReadRequest* request = &requests[handle];
     const unsigned int size = afs.entries[request->file_num].size;
-    return (size + 2048 - 1) / 2048;
+    return (size + AFS_SECTOR_SIZE - 1) / AFS_SECTOR_SIZE;
 }
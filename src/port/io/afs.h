@@ -14,11 +14,33 @@ typedef int AFSHandle;
 
 #define AFS_NONE -1
 
-bool AFS_Init(const char* file_path);
+/// @param use_mapping Map the whole archive into memory instead of reading files with async IO.
+/// Falls back to async IO if mapping isn't supported on this platform or fails.
+/// @param index_cache_path File to store the parsed table of contents in, so that later launches don't have to parse
+/// it again. `NULL` to always parse it.
+bool AFS_Init(const char* file_path, bool use_mapping, const char* index_cache_path);
 void AFS_Finish();
 unsigned int AFS_GetFileCount();
 unsigned int AFS_GetSize(int file_num);
 
+/// @return Name of a file in the archive, or an empty string if the archive doesn't store names. Names are read from
+/// the archive on the first call.
+const char* AFS_GetName(int file_num);
+
+/// @brief Get a read-only pointer to a file's contents without copying them.
+/// @return Pointer into the mapped archive, or `NULL` if the archive isn't mapped.
+const void* AFS_GetData(int file_num);
+
+/// Hint that a file is about to be read so that its pages get loaded in the background. No-op without a mapping.
+void AFS_Prefetch(int file_num);
+
+/// Start reading a whole file in the background. A later `AFS_Read` of the whole file is served from the preloaded
+/// data, or waits for the preload to finish if it's still running. Preloads of several files run concurrently.
+void AFS_Preload(int file_num);
+
+/// Free preloads that no read asked for
+void AFS_DiscardPreloads();
+
 void AFS_RunServer();
 AFSHandle AFS_Open(int file_num);
 void AFS_Read(AFSHandle handle, int sectors, void* buf);
@@ -0,0 +1,369 @@
+#include "port/match_farm.h"
+#include "main.h"
+#include "netplay/game_state.h"
+#include "port/autostart.h"
+#include "port/sdl/sdl_app.h"
+#include "sf33rd/Source/Game/engine/plcnt.h"
+#include "sf33rd/Source/Game/engine/workuser.h"
+#include "sf33rd/Source/Game/system/work_sys.h"
+#include "sf33rd/utils/djb2_hash.h"
+
+#include <SDL3/SDL.h>
+
+#include <stdio.h>
+
+// Plays versus matches between CPU players without anyone at the controls. Characters are forced through the same
+// debug options that override character select, and both players are handed to the CPU once the match starts. The
+// engine keeps its state in globals, so running matches in parallel means running one process per core. See
+// tools/match_farm.py.
+
+#define INPUTS_MAX 65536
+#define ROUNDS_MAX 16
+#define MATCH_TIMEOUT_FRAMES (60 * 60 * 20) // Give up on a match that hasn't been decided after 20 minutes
+
+typedef enum MatchFarmState {
+    MATCH_FARM_INACTIVE,
+    MATCH_FARM_BOOTING,
+    MATCH_FARM_SELECTING, // Going through character select
+    MATCH_FARM_FIGHTING,
+    MATCH_FARM_LEAVING,   // Waiting for the screens after a match to finish
+    MATCH_FARM_FINISHED,
+} MatchFarmState;
+
+typedef struct MatchFarmRound {
+    int winner; // -1 for a draw
+    int frames;
+    int damage[2]; // Damage dealt by each player
+} MatchFarmRound;
+
+static MatchFarmState state = MATCH_FARM_INACTIVE;
+static MatchFarmParams params = { 0 };
+static AutostartSetup autostart_setup = { 0 };
+
+static u16* scripted_inputs = NULL;
+static int scripted_input_count = 0;
+static int scripted_input_index = 0;
+
+static int frame = 0;
+static int state_frame = 0; // Frame the current state was entered on
+static int matches_played = 0;
+static unsigned int match_seed = 0;
+static Uint64 start_time = 0;
+
+static MatchFarmRound rounds[ROUNDS_MAX];
+static int round_count = 0;
+static int round_frames = 0;
+static int round_damage[2] = { 0 };
+static int last_vitality[2] = { 0 };
+static u8 last_wins[2] = { 0 };
+
+static GameState* snapshot = NULL;
+
+static void load_scripted_inputs(const char* path) {
+    FILE* f = fopen(path, "r");
+
+    if (f == NULL) {
+        printf("⚠️ couldn't open match farm inputs at %s, player 1 is played by the CPU\n", path);
+        return;
+    }
+
+    scripted_inputs = SDL_malloc(INPUTS_MAX * sizeof(u16));
+    char line[32];
+
+    while ((scripted_input_count < INPUTS_MAX) && fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+
+        scripted_inputs[scripted_input_count] = SDL_strtoul(line, NULL, 16);
+        scripted_input_count += 1;
+    }
+
+    fclose(f);
+}
+
+static bool is_scripted() {
+    return scripted_input_count > 0;
+}
+
+static void enter_state(MatchFarmState new_state) {
+    state = new_state;
+    state_frame = frame;
+}
+
+static void start_versus() {
+    if (params.difficulty >= 0) {
+        save_w[Present_Mode].Difficulty = params.difficulty;
+    }
+
+    Autostart_StartVersus(&autostart_setup);
+}
+
+static void set_operators(bool is_cpu) {
+    for (int i = 0; i < 2; i++) {
+        // A scripted player 1 stays at the controls
+        const bool is_player_cpu = is_cpu && !((i == 0) && is_scripted());
+
+        plw[i].wu.operator = !is_player_cpu;
+        Operator_Status[i] = !is_player_cpu;
+    }
+}
+
+static void begin_match() {
+    match_seed = params.seed + matches_played;
+
+    Autostart_SeedRandom(match_seed);
+
+    set_operators(true);
+    scripted_input_index = 0;
+
+    round_count = 0;
+    round_frames = 0;
+    SDL_zeroa(round_damage);
+    SDL_zeroa(last_vitality);
+    SDL_zeroa(last_wins);
+}
+
+static bool is_match_decided() {
+    const int wins_needed = save_w[Present_Mode].Battle_Number[Play_Type] + 1;
+    return (PL_Wins[0] >= wins_needed) || (PL_Wins[1] >= wins_needed);
+}
+
+static u32 hash_game_state() {
+    if (snapshot == NULL) {
+        snapshot = SDL_malloc(GameState_GetSize());
+
+        if (snapshot == NULL) {
+            return 0;
+        }
+    }
+
+    GameState_SavePortable(snapshot);
+    return djb2_update_mem(djb2_init(), (const u8*)snapshot, GameState_GetSize());
+}
+
+static void write_result() {
+    SDL_IOStream* io = SDL_IOFromFile(params.report_path, "a");
+
+    if (io == NULL) {
+        printf("⚠️ couldn't write match farm report to %s: %s\n", params.report_path, SDL_GetError());
+        return;
+    }
+
+    const int winner = (PL_Wins[0] > PL_Wins[1]) ? 0 : ((PL_Wins[1] > PL_Wins[0]) ? 1 : -1);
+    int total_frames = 0;
+    int total_damage[2] = { 0 };
+
+    for (int i = 0; i < round_count; i++) {
+        total_frames += rounds[i].frames;
+        total_damage[0] += rounds[i].damage[0];
+        total_damage[1] += rounds[i].damage[1];
+    }
+
+    SDL_IOprintf(io,
+                 "{\"seed\": %u, \"characters\": [%d, %d], \"super_arts\": [%d, %d], \"scripted\": %s, ",
+                 match_seed,
+                 params.characters[0],
+                 params.characters[1],
+                 params.super_arts[0],
+                 params.super_arts[1],
+                 is_scripted() ? "true" : "false");
+    SDL_IOprintf(io,
+                 "\"winner\": %d, \"wins\": [%d, %d], \"frames\": %d, \"damage\": [%d, %d], \"rounds\": [",
+                 winner,
+                 PL_Wins[0],
+                 PL_Wins[1],
+                 total_frames,
+                 total_damage[0],
+                 total_damage[1]);
+
+    for (int i = 0; i < round_count; i++) {
+        SDL_IOprintf(io,
+                     "{\"winner\": %d, \"frames\": %d, \"damage\": [%d, %d]}%s",
+                     rounds[i].winner,
+                     rounds[i].frames,
+                     rounds[i].damage[0],
+                     rounds[i].damage[1],
+                     (i < round_count - 1) ? ", " : "");
+    }
+
+    SDL_IOprintf(io, "], \"state_hash\": \"%08x\"}\n", hash_game_state());
+    SDL_CloseIO(io);
+}
+
+static void finish(bool completed) {
+    printf("🤖 match farm %s after %d matches in %.1f s\n",
+           completed ? "completed" : "failed",
+           matches_played,
+           (SDL_GetTicksNS() - start_time) / 1e9);
+
+    SDL_free(scripted_inputs);
+    SDL_free(snapshot);
+    scripted_inputs = NULL;
+    snapshot = NULL;
+    enter_state(MATCH_FARM_FINISHED);
+    SDLApp_Exit();
+}
+
+void MatchFarm_Init(const MatchFarmParams* init_params) {
+    SDL_copyp(&params, init_params);
+    autostart_setup = (AutostartSetup) { .characters = { params.characters[0], params.characters[1] },
+                                         .stage = -1,
+                                         .super_arts = { params.super_arts[0], params.super_arts[1] },
+                                         .colors = { -1, -1 } };
+
+    if (params.input_path != NULL) {
+        load_scripted_inputs(params.input_path);
+    }
+
+    // Truncate results of a previous run
+    SDL_IOStream* io = SDL_IOFromFile(params.report_path, "w");
+
+    if (io != NULL) {
+        SDL_CloseIO(io);
+    }
+
+    SDLApp_SetFrameTimeScale(0);
+    start_time = SDL_GetTicksNS();
+    enter_state(MATCH_FARM_BOOTING);
+}
+
+bool MatchFarm_IsActive() {
+    return (state != MATCH_FARM_INACTIVE) && (state != MATCH_FARM_FINISHED);
+}
+
+void MatchFarm_InjectInputs() {
+    const int frames_in_state = frame - state_frame;
+
+    p1sw_buff = 0;
+    p2sw_buff = 0;
+
+    // Nothing gets drawn, so skip building sprites
+    No_Trans = 1;
+
+    switch (state) {
+    case MATCH_FARM_BOOTING:
+        Autostart_InjectInputs(AUTOSTART_BOOTING, frames_in_state, &autostart_setup);
+        break;
+
+    case MATCH_FARM_SELECTING:
+        Autostart_InjectInputs(AUTOSTART_SELECTING, frames_in_state, &autostart_setup);
+        break;
+
+    case MATCH_FARM_LEAVING:
+        // Skip through the screens after the match without touching the setup of the one that was played
+        Autostart_InjectInputs(AUTOSTART_SELECTING, frames_in_state, NULL);
+        break;
+
+    case MATCH_FARM_FIGHTING:
+        if (is_scripted() && Allow_a_battle_f) {
+            p1sw_buff = scripted_inputs[scripted_input_index];
+            scripted_input_index = (scripted_input_index + 1) % scripted_input_count;
+        }
+
+        break;
+
+    case MATCH_FARM_INACTIVE:
+    case MATCH_FARM_FINISHED:
+        break;
+    }
+}
+
+static void note_round_frame() {
+    if (Allow_a_battle_f) {
+        round_frames += 1;
+    }
+
+    for (int i = 0; i < 2; i++) {
+        const int vitality = plw[i].wu.vitality;
+
+        // Refills between rounds raise vitality, only count drops
+        if (vitality < last_vitality[i]) {
+            round_damage[i ^ 1] += last_vitality[i] - vitality;
+        }
+
+        last_vitality[i] = vitality;
+    }
+
+    if ((PL_Wins[0] == last_wins[0]) && (PL_Wins[1] == last_wins[1])) {
+        return;
+    }
+
+    const bool p1_won = PL_Wins[0] > last_wins[0];
+    const bool p2_won = PL_Wins[1] > last_wins[1];
+
+    if (round_count < ROUNDS_MAX) {
+        MatchFarmRound* round = &rounds[round_count];
+        round->winner = (p1_won == p2_won) ? -1 : (p2_won ? 1 : 0);
+        round->frames = round_frames;
+        round->damage[0] = round_damage[0];
+        round->damage[1] = round_damage[1];
+        round_count += 1;
+    }
+
+    round_frames = 0;
+    SDL_zeroa(round_damage);
+    last_wins[0] = PL_Wins[0];
+    last_wins[1] = PL_Wins[1];
+}
+
+void MatchFarm_Update() {
+    frame += 1;
+    const int frames_in_state = frame - state_frame;
+
+    switch (state) {
+    case MATCH_FARM_BOOTING:
+        if (Autostart_IsMainMenuReady()) {
+            start_versus();
+            enter_state(MATCH_FARM_SELECTING);
+        } else if (Autostart_HasTimedOut(AUTOSTART_BOOTING, frames_in_state)) {
+            finish(false);
+        }
+
+        break;
+
+    case MATCH_FARM_SELECTING:
+        if (G_No[1] == 2) {
+            begin_match();
+            enter_state(MATCH_FARM_FIGHTING);
+        } else if (Autostart_HasTimedOut(AUTOSTART_SELECTING, frames_in_state)) {
+            finish(false);
+        }
+
+        break;
+
+    case MATCH_FARM_FIGHTING:
+        note_round_frame();
+
+        if (is_match_decided()) {
+            write_result();
+            matches_played += 1;
+
+            // Hand the controls back so that versus mode goes on to character select as usual
+            set_operators(false);
+
+            if (matches_played >= params.matches) {
+                finish(true);
+            } else {
+                enter_state(MATCH_FARM_LEAVING);
+            }
+        } else if (frames_in_state > MATCH_TIMEOUT_FRAMES) {
+            finish(false);
+        }
+
+        break;
+
+    case MATCH_FARM_LEAVING:
+        if (G_No[1] != 2) {
+            enter_state(MATCH_FARM_SELECTING);
+        } else if (Autostart_HasTimedOut(AUTOSTART_SELECTING, frames_in_state)) {
+            finish(false);
+        }
+
+        break;
+
+    case MATCH_FARM_INACTIVE:
+    case MATCH_FARM_FINISHED:
+        break;
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef PORT_MATCH_FARM_H
+#define PORT_MATCH_FARM_H
+
+#include <stdbool.h>
+
+typedef struct MatchFarmParams {
+    int matches;             // Matches to play before exiting
+    int characters[2];       // Character ids, as in `My_char`
+    int super_arts[2];       // 0-2
+    int difficulty;          // CPU difficulty 0-7, or -1 to keep the saved setting
+    unsigned int seed;       // Seed of the first match. Later matches use the following seeds
+    const char* input_path;  // Optional file with one hex input per line that player 1 plays in a loop
+    const char* report_path; // Where to append one line of JSON per match
+} MatchFarmParams;
+
+/// Drive the game from boot into versus matches between CPU players on its own, and exit after playing a fixed
+/// number of them.
+void MatchFarm_Init(const MatchFarmParams* params);
+
+bool MatchFarm_IsActive();
+
+/// Replace controller inputs with the ones that move through menus, or with scripted ones during a match. Call after
+/// inputs have been read.
+void MatchFarm_InjectInputs();
+
+/// Collect stats for the frame that just ran and write the result of a match once it's decided.
+void MatchFarm_Update();
+
+#endif
@@ -0,0 +1,394 @@
+#include "port/mem_stats.h"
+#include "port/paths.h"
+#include "sf33rd/AcrSDK/common/memmgr.h"
+#include "structs.h"
+
+#include <SDL3/SDL.h>
+
+#include <stdio.h>
+#include <time.h>
+
+#define HEAPS_MAX 8
+#define SITES_MAX 128
+#define RANGES_MAX 4100 // Enough for every block of the system heap
+#define MAP_COLUMNS 64
+#define MAP_ROWS 16
+#define MAP_CELLS (MAP_COLUMNS * MAP_ROWS)
+
+typedef struct MemStatsSite {
+    const void* allocator;
+    const char* name;
+    int tag;
+    int allocs;
+    int frees;
+    size_t live_bytes;
+    size_t peak_live_bytes;
+    size_t total_bytes;
+    size_t largest;
+} MemStatsSite;
+
+typedef struct MemStatsRange {
+    uintptr_t start;
+    size_t size;
+} MemStatsRange;
+
+static MemStatsHeap heaps[HEAPS_MAX] = { 0 };
+static int heap_count = 0;
+static MemStatsSite sites[SITES_MAX] = { 0 };
+static int site_count = 0;
+
+// Scratch space for the fragmentation map
+static MemStatsRange ranges[RANGES_MAX];
+static size_t map_cells[MAP_CELLS];
+
+static MemStatsHeap* find_heap(const void* allocator) {
+    for (int i = 0; i < heap_count; i++) {
+        if (heaps[i].allocator == allocator) {
+            return &heaps[i];
+        }
+    }
+
+    return NULL;
+}
+
+void MemStats_RegisterHeap(const void* allocator, MemStatsHeapKind kind, const char* name, size_t capacity) {
+    MemStatsHeap* heap = find_heap(allocator);
+
+    if (heap == NULL) {
+        if (heap_count >= HEAPS_MAX) {
+            return;
+        }
+
+        heap = &heaps[heap_count];
+        heap_count += 1;
+        SDL_zerop(heap);
+        heap->allocator = allocator;
+    }
+
+    heap->kind = kind;
+    heap->name = name;
+    heap->capacity = capacity;
+    heap->used = 0;
+    heap->live_blocks = 0;
+}
+
+void MemStats_SetCapacity(const void* allocator, size_t capacity) {
+    MemStatsHeap* heap = find_heap(allocator);
+
+    if (heap == NULL) {
+        return;
+    }
+
+    heap->capacity = capacity;
+}
+
+void MemStats_NoteAlloc(const void* allocator, size_t size) {
+    MemStatsHeap* heap = find_heap(allocator);
+
+    if (heap == NULL) {
+        return;
+    }
+
+    heap->allocs += 1;
+    heap->live_blocks += 1;
+    heap->used += size;
+    heap->peak_used = SDL_max(heap->peak_used, heap->used);
+}
+
+void MemStats_NoteFailure(const void* allocator, size_t size) {
+    MemStatsHeap* heap = find_heap(allocator);
+
+    if (heap == NULL) {
+        return;
+    }
+
+    heap->failures += 1;
+}
+
+void MemStats_NoteFree(const void* allocator, size_t size) {
+    MemStatsHeap* heap = find_heap(allocator);
+
+    if (heap == NULL) {
+        return;
+    }
+
+    heap->frees += 1;
+    heap->live_blocks -= 1;
+    heap->used -= SDL_min(size, heap->used);
+}
+
+void MemStats_NoteCompaction(const void* allocator, size_t bytes_moved) {
+    MemStatsHeap* heap = find_heap(allocator);
+
+    if (heap == NULL) {
+        return;
+    }
+
+    heap->compactions += 1;
+    heap->compacted_bytes += bytes_moved;
+}
+
+int MemStats_NoteSiteAlloc(const void* allocator, const char* site, int tag, size_t size) {
+    int index = 0;
+
+    while ((index < site_count) &&
+           ((sites[index].allocator != allocator) || (sites[index].name != site) || (sites[index].tag != tag))) {
+        index += 1;
+    }
+
+    if (index == site_count) {
+        if (site_count >= SITES_MAX) {
+            return -1;
+        }
+
+        site_count += 1;
+        SDL_zero(sites[index]);
+        sites[index].allocator = allocator;
+        sites[index].name = site;
+        sites[index].tag = tag;
+    }
+
+    MemStatsSite* entry = &sites[index];
+    entry->allocs += 1;
+    entry->live_bytes += size;
+    entry->total_bytes += size;
+    entry->peak_live_bytes = SDL_max(entry->peak_live_bytes, entry->live_bytes);
+    entry->largest = SDL_max(entry->largest, size);
+    return index;
+}
+
+void MemStats_NoteSiteFree(int site, size_t size) {
+    if ((site < 0) || (site >= site_count)) {
+        return;
+    }
+
+    MemStatsSite* entry = &sites[site];
+    entry->frees += 1;
+    entry->live_bytes -= SDL_min(size, entry->live_bytes);
+}
+
+const MemStatsHeap* MemStats_GetHeap(const void* allocator) {
+    return find_heap(allocator);
+}
+
+// Fragmentation map
+
+static int add_range(int count, const void* start, size_t size) {
+    if ((count >= RANGES_MAX) || (size == 0)) {
+        return count;
+    }
+
+    ranges[count].start = (uintptr_t)start;
+    ranges[count].size = size;
+    return count + 1;
+}
+
+/// Collect used ranges of a heap.
+/// @return Number of ranges written to `ranges`.
+static int collect_ranges(const MemStatsHeap* heap, uintptr_t* base) {
+    int count = 0;
+
+    switch (heap->kind) {
+    case MEM_STATS_HEAP_FMS:
+        const FL_FMS* fms = heap->allocator;
+        *base = (uintptr_t)fms->baseandcap[0];
+        count = add_range(count, fms->baseandcap[0], fms->frame[0] - fms->baseandcap[0]);
+        count = add_range(count, fms->frame[1], fms->baseandcap[1] - fms->frame[1]);
+        break;
+
+    case MEM_STATS_HEAP_MEMMGR:
+        const MEM_MGR* memmgr = heap->allocator;
+        *base = (uintptr_t)((memmgr->direction != 0) ? memmgr->memptr : memmgr->memptr - memmgr->memsize);
+
+        for (u32 han = memmgr->blocklist; han != MEM_NULL_HANDLE; han = memmgr->block[han].next) {
+            count = add_range(count, memmgr->block[han].ptr, memmgr->block[han].len);
+        }
+
+        break;
+
+    case MEM_STATS_HEAP_MEMMAN:
+        const _MEMMAN_OBJ* memman = heap->allocator;
+        *base = (uintptr_t)memman->memHead;
+
+        for (const _MEMMAN_CELL* cell = memman->cell_1st; cell != NULL; cell = cell->next) {
+            count = add_range(count, cell, cell->size);
+        }
+
+        break;
+
+    case MEM_STATS_HEAP_SLAB:
+        // Pages aren't contiguous, so there's nothing to map
+        *base = 0;
+        break;
+    }
+
+    return count;
+}
+
+static int compare_ranges(const void* a, const void* b) {
+    const MemStatsRange* range_a = a;
+    const MemStatsRange* range_b = b;
+    return (range_a->start > range_b->start) - (range_a->start < range_b->start);
+}
+
+static void write_fragmentation_map(SDL_IOStream* io, const MemStatsHeap* heap) {
+    uintptr_t base = 0;
+    const int count = collect_ranges(heap, &base);
+    const uintptr_t end = base + heap->capacity;
+    const size_t cell_size = SDL_max((heap->capacity + MAP_CELLS - 1) / MAP_CELLS, 1);
+
+    SDL_qsort(ranges, count, sizeof(MemStatsRange), compare_ranges);
+    SDL_zeroa(map_cells);
+
+    size_t free_total = 0;
+    size_t largest_free = 0;
+    int gap_count = 0;
+    uintptr_t cursor = base;
+
+    for (int i = 0; i <= count; i++) {
+        const uintptr_t range_start = (i < count) ? SDL_clamp(ranges[i].start, base, end) : end;
+        const uintptr_t range_end = (i < count) ? SDL_clamp(ranges[i].start + ranges[i].size, base, end) : end;
+
+        if (range_start > cursor) {
+            const size_t gap = range_start - cursor;
+            free_total += gap;
+            largest_free = SDL_max(largest_free, gap);
+            gap_count += 1;
+        }
+
+        for (uintptr_t p = range_start; p < range_end;) {
+            const size_t cell = (p - base) / cell_size;
+            const uintptr_t cell_end = SDL_min(base + (cell + 1) * cell_size, range_end);
+            map_cells[cell] += cell_end - p;
+            p = cell_end;
+        }
+
+        cursor = SDL_max(cursor, range_end);
+    }
+
+    const double fragmentation = (free_total > 0) ? 100.0 * (1.0 - (double)largest_free / free_total) : 0;
+
+    SDL_IOprintf(io, "\n%s\n", heap->name);
+    SDL_IOprintf(io,
+                 "  %zu bytes free in %d gaps, largest gap %zu bytes, fragmentation %.1f%%\n",
+                 free_total,
+                 gap_count,
+                 largest_free,
+                 fragmentation);
+    SDL_IOprintf(io, "  each character is %zu bytes: '#' used, '+' partially used, '.' free\n", cell_size);
+
+    for (int row = 0; row < MAP_ROWS; row++) {
+        char line[MAP_COLUMNS + 1];
+
+        for (int column = 0; column < MAP_COLUMNS; column++) {
+            const size_t cell = row * MAP_COLUMNS + column;
+            const uintptr_t cell_start = base + cell * cell_size;
+            const size_t span = (cell_start < end) ? SDL_min(cell_size, end - cell_start) : 0;
+
+            if (span == 0) {
+                line[column] = ' ';
+            } else if (map_cells[cell] == 0) {
+                line[column] = '.';
+            } else if (map_cells[cell] >= span) {
+                line[column] = '#';
+            } else {
+                line[column] = '+';
+            }
+        }
+
+        line[MAP_COLUMNS] = '\0';
+        SDL_IOprintf(io, "  %s\n", line);
+    }
+}
+
+// Report
+
+static const char* heap_name(const void* allocator) {
+    const MemStatsHeap* heap = find_heap(allocator);
+    return (heap != NULL) ? heap->name : "?";
+}
+
+static void write_report(SDL_IOStream* io, const char* reason) {
+    SDL_IOprintf(io, "Memory stats (%s)\n\n", reason);
+    SDL_IOprintf(io,
+                 "%-20s %10s %10s %10s %7s %8s %8s %6s %11s %12s\n",
+                 "heap",
+                 "capacity",
+                 "used",
+                 "peak",
+                 "blocks",
+                 "allocs",
+                 "frees",
+                 "fails",
+                 "compactions",
+                 "moved");
+
+    for (int i = 0; i < heap_count; i++) {
+        const MemStatsHeap* heap = &heaps[i];
+        SDL_IOprintf(io,
+                     "%-20s %10zu %10zu %10zu %7d %8d %8d %6d %11d %12zu\n",
+                     heap->name,
+                     heap->capacity,
+                     heap->used,
+                     heap->peak_used,
+                     heap->live_blocks,
+                     heap->allocs,
+                     heap->frees,
+                     heap->failures,
+                     heap->compactions,
+                     heap->compacted_bytes);
+    }
+
+    SDL_IOprintf(io,
+                 "\n%-20s %-32s %4s %7s %7s %10s %10s %12s %10s\n",
+                 "heap",
+                 "site",
+                 "tag",
+                 "allocs",
+                 "frees",
+                 "live",
+                 "peak live",
+                 "total",
+                 "largest");
+
+    for (int i = 0; i < site_count; i++) {
+        const MemStatsSite* site = &sites[i];
+        SDL_IOprintf(io,
+                     "%-20s %-32s %4d %7d %7d %10zu %10zu %12zu %10zu\n",
+                     heap_name(site->allocator),
+                     site->name,
+                     site->tag,
+                     site->allocs,
+                     site->frees,
+                     site->live_bytes,
+                     site->peak_live_bytes,
+                     site->total_bytes,
+                     site->largest);
+    }
+
+    for (int i = 0; i < heap_count; i++) {
+        if (heaps[i].kind != MEM_STATS_HEAP_SLAB) {
+            write_fragmentation_map(io, &heaps[i]);
+        }
+    }
+}
+
+void MemStats_Dump(const char* reason) {
+    char timestamp[32];
+    const time_t now = time(NULL);
+    strftime(timestamp, sizeof(timestamp), "%Y%m%d_%H%M%S", localtime(&now));
+
+    char* path;
+    SDL_asprintf(&path, "%smemstats_%s.txt", Paths_GetBasePath(), timestamp);
+    SDL_IOStream* io = SDL_IOFromFile(path, "w");
+
+    if (io == NULL) {
+        printf("⚠️ couldn't write memory stats to %s: %s\n", path, SDL_GetError());
+    } else {
+        write_report(io, reason);
+        SDL_CloseIO(io);
+        printf("🧠 wrote memory stats to %s (%s)\n", path, reason);
+    }
+
+    SDL_free(path);
+}
@@ -0,0 +1,51 @@
+#ifndef PORT_MEM_STATS_H
+#define PORT_MEM_STATS_H
+
+#include <stddef.h>
+
+typedef enum MemStatsHeapKind {
+    MEM_STATS_HEAP_FMS,    // FL_FMS frame allocator
+    MEM_STATS_HEAP_MEMMGR, // MEM_MGR handle-based allocator
+    MEM_STATS_HEAP_MEMMAN, // _MEMMAN_OBJ best-fit allocator
+    MEM_STATS_HEAP_SLAB,   // Size-class pools, capacity grows with the number of pages
+} MemStatsHeapKind;
+
+typedef struct MemStatsHeap {
+    const char* name;
+    MemStatsHeapKind kind;
+    const void* allocator;
+    size_t capacity;
+    size_t used;
+    size_t peak_used;
+    int live_blocks;
+    int allocs;
+    int frees;
+    int failures; // Includes failures that were recovered from by compacting
+    int compactions;
+    size_t compacted_bytes; // Bytes moved by compaction
+} MemStatsHeap;
+
+/// Start tracking a heap. Registering the same allocator again (e.g. when it gets reinitialized) resets its usage,
+/// but keeps counters and the high-water mark.
+void MemStats_RegisterHeap(const void* allocator, MemStatsHeapKind kind, const char* name, size_t capacity);
+
+void MemStats_SetCapacity(const void* allocator, size_t capacity);
+void MemStats_NoteAlloc(const void* allocator, size_t size);
+void MemStats_NoteFailure(const void* allocator, size_t size);
+void MemStats_NoteFree(const void* allocator, size_t size);
+void MemStats_NoteCompaction(const void* allocator, size_t bytes_moved);
+
+/// @brief Attribute an allocation to a call site and a key type, e.g. a ramcnt `kokey`.
+/// @return Site index to pass to `MemStats_NoteSiteFree` once the allocation gets freed, or -1 if the site table is
+/// full.
+int MemStats_NoteSiteAlloc(const void* allocator, const char* site, int tag, size_t size);
+void MemStats_NoteSiteFree(int site, size_t size);
+
+/// @return Stats for the heap managed by `allocator`, or `NULL` if it isn't tracked.
+const MemStatsHeap* MemStats_GetHeap(const void* allocator);
+
+/// Write heap stats, per-site stats and a fragmentation map of every heap to `memstats_<date>_<time>.txt` next to
+/// the config.
+void MemStats_Dump(const char* reason);
+
+#endif
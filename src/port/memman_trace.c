@@ -0,0 +1,420 @@
+#include "port/memman_trace.h"
+#include "sf33rd/Source/Common/MemMan.h"
+
+#include <SDL3/SDL.h>
+
+#include <stdio.h>
+
+// A trace starts with "3SXM" and a u32 version, followed by 12 byte records in little endian byte order: u8 op, u8
+// heap, u8 flag, u8 unused, u32 size, u32 value.
+// - Init: `size` is the size of the heap and `value` its unit
+// - Alloc: `size` is the requested size and `value` the offset of the block from the start of the heap, or
+//   `TRACE_FAILED` if the allocation failed
+// - Free: `value` is the offset of the freed block
+//
+// Heaps are numbered in the order they were first initialized.
+
+#define TRACE_MAGIC "3SXM"
+#define TRACE_VERSION 1
+#define TRACE_RECORD_SIZE 12
+#define TRACE_BUFFER_RECORDS 4096
+#define TRACE_FAILED 0xFFFFFFFF
+#define TRACE_HEAPS_MAX 8
+#define BENCH_ITERATIONS 10
+
+#define RANDOM_HEAP_SIZE (512 * 1024)
+#define RANDOM_HEAP_UNIT 64
+#define RANDOM_OPS 20000
+#define RANDOM_LIVE_MAX 256
+
+typedef enum TraceOp {
+    TRACE_OP_INIT,
+    TRACE_OP_ALLOC,
+    TRACE_OP_FREE,
+} TraceOp;
+
+typedef struct TraceRecord {
+    u8 op;
+    u8 heap;
+    u8 flag;
+    u32 size;
+    u32 value;
+} TraceRecord;
+
+typedef struct ReplayHeap {
+    _MEMMAN_OBJ mmobj;
+    u8* buffer;
+    u32 size;
+    u32 unit;
+} ReplayHeap;
+
+static SDL_IOStream* io = NULL;
+static const _MEMMAN_OBJ* traced_heaps[TRACE_HEAPS_MAX] = { NULL };
+static int traced_heap_count = 0;
+static u8 buffer[TRACE_BUFFER_RECORDS * TRACE_RECORD_SIZE];
+static int buffered_records = 0;
+static int record_count = 0;
+
+// Recording
+
+static void flush() {
+    if (buffered_records == 0) {
+        return;
+    }
+
+    const size_t size = buffered_records * TRACE_RECORD_SIZE;
+
+    if (SDL_WriteIO(io, buffer, size) != size) {
+        printf("⚠️ couldn't write MemMan trace: %s\n", SDL_GetError());
+        SDL_CloseIO(io);
+        io = NULL;
+    }
+
+    buffered_records = 0;
+}
+
+static void write_record(TraceOp op, int heap, s32 flag, u32 size, u32 value) {
+    u8* record = &buffer[buffered_records * TRACE_RECORD_SIZE];
+
+    record[0] = op;
+    record[1] = heap;
+    record[2] = flag;
+    record[3] = 0;
+
+    for (int i = 0; i < 4; i++) {
+        record[4 + i] = (size >> (i * 8)) & 0xFF;
+        record[8 + i] = (value >> (i * 8)) & 0xFF;
+    }
+
+    buffered_records += 1;
+    record_count += 1;
+
+    if (buffered_records == TRACE_BUFFER_RECORDS) {
+        flush();
+    }
+}
+
+/// @return Number of the heap in the trace, or -1 if there are too many heaps to trace.
+static int find_heap(const _MEMMAN_OBJ* mmobj) {
+    for (int i = 0; i < traced_heap_count; i++) {
+        if (traced_heaps[i] == mmobj) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+bool MemManTrace_Start(const char* path) {
+    io = SDL_IOFromFile(path, "wb");
+
+    if ((io == NULL) || (SDL_WriteIO(io, TRACE_MAGIC, 4) != 4) || !SDL_WriteU32LE(io, TRACE_VERSION)) {
+        printf("⚠️ couldn't write MemMan trace to %s: %s\n", path, SDL_GetError());
+
+        if (io != NULL) {
+            SDL_CloseIO(io);
+            io = NULL;
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+void MemManTrace_Stop() {
+    if (io == NULL) {
+        return;
+    }
+
+    flush();
+
+    if ((io != NULL) && SDL_CloseIO(io)) {
+        printf("🧠 traced %d MemMan operations on %d heaps\n", record_count, traced_heap_count);
+    }
+
+    io = NULL;
+}
+
+void MemManTrace_NoteHeap(const _MEMMAN_OBJ* mmobj) {
+    if (io == NULL) {
+        return;
+    }
+
+    int heap = find_heap(mmobj);
+
+    if (heap < 0) {
+        if (traced_heap_count == TRACE_HEAPS_MAX) {
+            return;
+        }
+
+        heap = traced_heap_count;
+        traced_heaps[heap] = mmobj;
+        traced_heap_count += 1;
+    }
+
+    write_record(TRACE_OP_INIT, heap, 0, mmobj->memSize, mmobj->ownUnit);
+}
+
+void MemManTrace_NoteAlloc(const _MEMMAN_OBJ* mmobj, ssize_t size, s32 flag, const u8* adrs) {
+    if (io == NULL) {
+        return;
+    }
+
+    const int heap = find_heap(mmobj);
+
+    if (heap >= 0) {
+        const u32 offset = (adrs != NULL) ? (u32)(adrs - mmobj->memHead) : TRACE_FAILED;
+        write_record(TRACE_OP_ALLOC, heap, flag, size, offset);
+    }
+}
+
+void MemManTrace_NoteFree(const _MEMMAN_OBJ* mmobj, const u8* adrs) {
+    if (io == NULL) {
+        return;
+    }
+
+    const int heap = find_heap(mmobj);
+
+    if (heap >= 0) {
+        write_record(TRACE_OP_FREE, heap, 0, 0, adrs - mmobj->memHead);
+    }
+}
+
+// Replay
+
+static u32 read_u32(const u8* data) {
+    return data[0] | (data[1] << 8) | (data[2] << 16) | ((u32)data[3] << 24);
+}
+
+/// @return Records of the trace, or `NULL` if it couldn't be read. Free with `SDL_free`.
+static TraceRecord* load_trace(const char* path, int* count) {
+    size_t size = 0;
+    u8* data = SDL_LoadFile(path, &size);
+
+    if (data == NULL) {
+        printf("⚠️ couldn't read MemMan trace %s: %s\n", path, SDL_GetError());
+        return NULL;
+    }
+
+    if ((size < 8) || (SDL_memcmp(data, TRACE_MAGIC, 4) != 0) || (read_u32(data + 4) != TRACE_VERSION)) {
+        printf("⚠️ %s isn't a MemMan trace\n", path);
+        SDL_free(data);
+        return NULL;
+    }
+
+    *count = (size - 8) / TRACE_RECORD_SIZE;
+    TraceRecord* records = SDL_malloc(*count * sizeof(TraceRecord));
+
+    for (int i = 0; (records != NULL) && (i < *count); i++) {
+        const u8* record = data + 8 + i * TRACE_RECORD_SIZE;
+        records[i].op = record[0];
+        records[i].heap = record[1];
+        records[i].flag = record[2];
+        records[i].size = read_u32(record + 4);
+        records[i].value = read_u32(record + 8);
+    }
+
+    SDL_free(data);
+    return records;
+}
+
+/// Allocate a buffer for every heap that's big enough for every time it gets initialized
+static bool alloc_replay_heaps(const TraceRecord* records, int count, ReplayHeap* heaps) {
+    for (int i = 0; i < count; i++) {
+        const TraceRecord* record = &records[i];
+
+        if ((record->op == TRACE_OP_INIT) && (record->heap < TRACE_HEAPS_MAX)) {
+            ReplayHeap* heap = &heaps[record->heap];
+            heap->size = SDL_max(heap->size, record->size);
+            heap->unit = SDL_max(heap->unit, record->value);
+        }
+    }
+
+    for (int i = 0; i < TRACE_HEAPS_MAX; i++) {
+        ReplayHeap* heap = &heaps[i];
+
+        if (heap->size == 0) {
+            continue;
+        }
+
+        // Aligned to the unit, so the heap starts right at the buffer and offsets match the recorded ones
+        heap->buffer = SDL_aligned_alloc(heap->unit, heap->size);
+
+        if (heap->buffer == NULL) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// @return Index of the first record that was placed differently than when it was recorded, or -1 if all of them
+/// were placed the same way.
+static int replay(const TraceRecord* records, int count, ReplayHeap* heaps) {
+    for (int i = 0; i < count; i++) {
+        const TraceRecord* record = &records[i];
+        ReplayHeap* heap = &heaps[record->heap];
+
+        switch ((TraceOp)record->op) {
+        case TRACE_OP_INIT:
+            mmHeapInitialize(&heap->mmobj, heap->buffer, record->size, record->value, "- for trace replay -");
+            break;
+
+        case TRACE_OP_ALLOC:
+            const u8* adrs = mmAlloc(&heap->mmobj, record->size, record->flag);
+            const u32 offset = (adrs != NULL) ? (u32)(adrs - heap->mmobj.memHead) : TRACE_FAILED;
+
+            if (offset != record->value) {
+                return i;
+            }
+
+            break;
+
+        case TRACE_OP_FREE:
+            mmFree(&heap->mmobj, heap->mmobj.memHead + record->value);
+            break;
+        }
+    }
+
+    return -1;
+}
+
+/// @return Nanoseconds that replaying the trace took, or 0 if it went differently than when it was recorded.
+static Uint64 time_replay(const TraceRecord* records, int count, ReplayHeap* heaps, bool linear) {
+    mmUseLinearSearch(linear);
+    const Uint64 start = SDL_GetTicksNS();
+
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        const int mismatch = replay(records, count, heaps);
+
+        if (mismatch >= 0) {
+            printf("⚠️ the %s placed record %d differently than when it was recorded\n",
+                   linear ? "linear search" : "gap index",
+                   mismatch);
+            mmUseLinearSearch(false);
+            return 0;
+        }
+    }
+
+    const Uint64 elapsed = SDL_GetTicksNS() - start;
+    mmUseLinearSearch(false);
+    return elapsed;
+}
+
+void MemManTrace_RunBenchmark(const char* path) {
+    int count = 0;
+    TraceRecord* records = load_trace(path, &count);
+
+    if (records == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        if ((records[i].heap >= TRACE_HEAPS_MAX) || (records[i].op > TRACE_OP_FREE)) {
+            printf("⚠️ %s has an invalid record at %d\n", path, i);
+            SDL_free(records);
+            return;
+        }
+    }
+
+    ReplayHeap heaps[TRACE_HEAPS_MAX] = { 0 };
+
+    if (alloc_replay_heaps(records, count, heaps)) {
+        const Uint64 index_ns = time_replay(records, count, heaps, false);
+        const Uint64 linear_ns = time_replay(records, count, heaps, true);
+
+        if ((index_ns > 0) && (linear_ns > 0)) {
+            printf("⏱️ MemMan trace: %d operations, %d iterations\n", count, BENCH_ITERATIONS);
+            printf("⏱️   linear search: %.2f ms per replay\n", linear_ns / 1e6 / BENCH_ITERATIONS);
+            printf("⏱️   gap index: %.2f ms per replay\n", index_ns / 1e6 / BENCH_ITERATIONS);
+        }
+
+#if defined(DEBUG)
+        printf("⚠️ debug builds also check every allocation with a linear search, so timings aren't meaningful\n");
+#endif
+    } else {
+        printf("⚠️ couldn't allocate heaps to replay %s\n", path);
+    }
+
+    for (int i = 0; i < TRACE_HEAPS_MAX; i++) {
+        SDL_aligned_free(heaps[i].buffer);
+    }
+
+    SDL_free(records);
+}
+
+// Random test
+
+static bool run_random_sequence(Uint64 seed, u8* buffers[2]) {
+    _MEMMAN_OBJ heaps[2];
+    u32 live[RANDOM_LIVE_MAX];
+    int live_count = 0;
+
+    for (int i = 0; i < 2; i++) {
+        mmHeapInitialize(&heaps[i], buffers[i], RANDOM_HEAP_SIZE, RANDOM_HEAP_UNIT, "- for random test -");
+    }
+
+    for (int step = 0; step < RANDOM_OPS; step++) {
+        const bool should_free = (live_count > 0) && ((live_count == RANDOM_LIVE_MAX) || SDL_rand_r(&seed, 2));
+
+        if (should_free) {
+            const int index = SDL_rand_r(&seed, live_count);
+
+            for (int i = 0; i < 2; i++) {
+                mmFree(&heaps[i], heaps[i].memHead + live[index]);
+            }
+
+            live_count -= 1;
+            live[index] = live[live_count];
+            continue;
+        }
+
+        // Mostly small blocks with the odd big one, so that gaps of every size come and go
+        const ssize_t size = (SDL_rand_r(&seed, 4) == 0) ? SDL_rand_r(&seed, 30000) : SDL_rand_r(&seed, 700);
+        const s32 flag = SDL_rand_r(&seed, 2);
+        u32 offsets[2];
+
+        for (int i = 0; i < 2; i++) {
+            mmUseLinearSearch(i == 1);
+            const u8* adrs = mmAlloc(&heaps[i], size, flag);
+            offsets[i] = (adrs != NULL) ? (u32)(adrs - heaps[i].memHead) : TRACE_FAILED;
+        }
+
+        mmUseLinearSearch(false);
+
+        if ((offsets[0] != offsets[1]) || (heaps[0].remainder != heaps[1].remainder)) {
+            printf("⚠️ gap index and linear search disagree at step %d\n", step);
+            return false;
+        }
+
+        if (offsets[0] != TRACE_FAILED) {
+            live[live_count] = offsets[0];
+            live_count += 1;
+        }
+    }
+
+    return true;
+}
+
+bool MemManTrace_RunRandomTest(int seeds) {
+    u8* buffers[2] = { SDL_aligned_alloc(RANDOM_HEAP_UNIT, RANDOM_HEAP_SIZE),
+                       SDL_aligned_alloc(RANDOM_HEAP_UNIT, RANDOM_HEAP_SIZE) };
+    bool is_passing = (buffers[0] != NULL) && (buffers[1] != NULL);
+
+    for (int seed = 1; (seed <= seeds) && is_passing; seed++) {
+        is_passing = run_random_sequence(seed, buffers);
+
+        if (!is_passing) {
+            printf("⚠️ MemMan random test failed with seed %d\n", seed);
+        }
+    }
+
+    if (is_passing) {
+        printf("✅ gap index and linear search agreed on %d random sequences\n", seeds);
+    }
+
+    SDL_aligned_free(buffers[0]);
+    SDL_aligned_free(buffers[1]);
+    return is_passing;
+}
@@ -0,0 +1,31 @@
+#ifndef PORT_MEMMAN_TRACE_H
+#define PORT_MEMMAN_TRACE_H
+
+#include "structs.h"
+#include "types.h"
+
+#include <stdbool.h>
+
+/// Record every allocation and free of MemMan heaps to a file until `MemManTrace_Stop` is called
+/// @return Whether the file could be created.
+bool MemManTrace_Start(const char* path);
+
+void MemManTrace_Stop();
+
+void MemManTrace_NoteHeap(const _MEMMAN_OBJ* mmobj);
+
+/// @param adrs Block that was returned, or `NULL` if the allocation failed.
+void MemManTrace_NoteAlloc(const _MEMMAN_OBJ* mmobj, ssize_t size, s32 flag, const u8* adrs);
+
+void MemManTrace_NoteFree(const _MEMMAN_OBJ* mmobj, const u8* adrs);
+
+/// Replay a recorded trace with the gap index and with the linear search it replaced, make sure that both place every
+/// block where it was placed when the trace was recorded, and print how long they took
+void MemManTrace_RunBenchmark(const char* path);
+
+/// Run random sequences of allocations and frees on two heaps, one served by the gap index and one by the linear
+/// search, and make sure that they place every block at the same offset
+/// @return Whether all sequences agreed.
+bool MemManTrace_RunRandomTest(int seeds);
+
+#endif
@@ -0,0 +1,419 @@
+#include "port/replay_file.h"
+
+#include "zlib.h"
+#include <SDL3/SDL.h>
+
+// A replay file starts with a header and continues with chunks, each starting with a `ReplayChunkHeader`:
+// - Inputs chunks hold the inputs of consecutive frames as runs of identical inputs, like the game's own replay buffer
+// - Keyframe chunks hold the switches latched before the frame and a zlib compressed snapshot of the simulation
+//
+// Chunks are appended as the match is played, so a file that got cut off is still readable up to its last chunk.
+// Everything is stored in native byte order.
+
+#define MAGIC "3SXR"
+#define INPUT_CHUNK_FRAMES 60 // Write inputs once per second, so that little is lost if the game crashes
+
+typedef enum ReplayChunkType {
+    REPLAY_CHUNK_INPUTS = 1,
+    REPLAY_CHUNK_KEYFRAME = 2,
+} ReplayChunkType;
+
+typedef struct ReplayFileHeader {
+    char magic[4];
+    u32 version;
+    u32 keyframe_interval;
+    u32 state_size; // Keyframes are only usable by builds with the same state size and layout
+    u32 layout_fingerprint;
+    ReplaySetup setup;
+} ReplayFileHeader;
+
+typedef struct ReplayChunkHeader {
+    u32 type;
+    u32 frame; // First frame the chunk applies to
+    u32 size;  // Payload size, excluding this header
+} ReplayChunkHeader;
+
+typedef struct ReplayInputRun {
+    u16 sw[2];
+    u16 frames;
+} ReplayInputRun;
+
+typedef struct ReplayKeyframe {
+    int frame;
+    Sint64 offset; // Where the payload starts
+    u32 size;
+} ReplayKeyframe;
+
+struct ReplayFile {
+    SDL_IOStream* io;
+    size_t state_size;
+    bool are_keyframes_usable;
+    bool has_failed;
+
+    ReplayInputs* inputs;
+    int frame_count;
+    int inputs_capacity;
+    int written_frames;
+
+    ReplayKeyframe* keyframes;
+    int keyframe_count;
+    int keyframes_capacity;
+
+    // Scratch space for writing inputs and compressing keyframes
+    ReplayInputRun* runs;
+    u8* compressed;
+    uLong compressed_capacity;
+};
+
+/// Largest size that compressing a keyframe can produce
+static uLong get_compressed_bound(size_t state_size) {
+#if defined(ZLIB_VERNUM) && (ZLIB_VERNUM >= 0x1200)
+    return compressBound(state_size);
+#else
+    // zlib before 1.2 has no compressBound and documents this bound for compress2 instead
+    return state_size + state_size / 1000 + 12;
+#endif
+}
+
+/// Grow an array to hold at least `count` elements
+static bool reserve(void** array, int* capacity, int count, size_t element_size) {
+    if (count <= *capacity) {
+        return true;
+    }
+
+    const int new_capacity = SDL_max(count, SDL_max(*capacity * 2, 1024));
+    void* new_array = SDL_realloc(*array, new_capacity * element_size);
+
+    if (new_array == NULL) {
+        return false;
+    }
+
+    *array = new_array;
+    *capacity = new_capacity;
+    return true;
+}
+
+static bool write_chunk(ReplayFile* file, ReplayChunkType type, int frame, const void* payload, u32 size) {
+    if (file->has_failed) {
+        return false;
+    }
+
+    const ReplayChunkHeader header = { .type = type, .frame = frame, .size = size };
+
+    if ((SDL_WriteIO(file->io, &header, sizeof(header)) != sizeof(header)) ||
+        (SDL_WriteIO(file->io, payload, size) != size) || !SDL_FlushIO(file->io)) {
+        // Stop writing, so that the file at least ends with a complete chunk more often than not
+        SDL_Log("Couldn't write replay: %s", SDL_GetError());
+        file->has_failed = true;
+        return false;
+    }
+
+    return true;
+}
+
+/// Write inputs of the frames that haven't been written yet
+static void write_inputs(ReplayFile* file) {
+    int run_count = 0;
+
+    for (int frame = file->written_frames; frame < file->frame_count; frame++) {
+        const ReplayInputs* inputs = &file->inputs[frame];
+        ReplayInputRun* run = (run_count > 0) ? &file->runs[run_count - 1] : NULL;
+
+        if ((run != NULL) && (run->sw[0] == inputs->sw[0]) && (run->sw[1] == inputs->sw[1])) {
+            run->frames += 1;
+            continue;
+        }
+
+        run = &file->runs[run_count];
+        run->sw[0] = inputs->sw[0];
+        run->sw[1] = inputs->sw[1];
+        run->frames = 1;
+        run_count += 1;
+    }
+
+    if (run_count == 0) {
+        return;
+    }
+
+    write_chunk(file, REPLAY_CHUNK_INPUTS, file->written_frames, file->runs, run_count * sizeof(ReplayInputRun));
+    file->written_frames = file->frame_count;
+}
+
+ReplayFile* ReplayFile_Create(const char* path, const ReplaySetup* setup, int keyframe_interval, size_t state_size,
+                              u32 layout_fingerprint) {
+    ReplayFile* file = SDL_calloc(1, sizeof(ReplayFile));
+
+    if (file == NULL) {
+        return NULL;
+    }
+
+    // Deflate output can be slightly bigger than its input
+    file->state_size = state_size;
+    file->are_keyframes_usable = true;
+    file->compressed_capacity = sizeof(ReplayLatch) + get_compressed_bound(state_size);
+    file->compressed = SDL_malloc(file->compressed_capacity);
+
+    // Inputs get written once they've piled up for a second, so there's never more runs than that waiting
+    file->runs = SDL_malloc(INPUT_CHUNK_FRAMES * sizeof(ReplayInputRun));
+    file->io = SDL_IOFromFile(path, "w+b");
+
+    const ReplayFileHeader header = { .magic = MAGIC,
+                                      .version = REPLAY_FILE_VERSION,
+                                      .keyframe_interval = keyframe_interval,
+                                      .state_size = state_size,
+                                      .layout_fingerprint = layout_fingerprint,
+                                      .setup = *setup };
+
+    if ((file->compressed == NULL) || (file->runs == NULL) || (file->io == NULL) ||
+        (SDL_WriteIO(file->io, &header, sizeof(header)) != sizeof(header))) {
+        ReplayFile_Close(file);
+        return NULL;
+    }
+
+    return file;
+}
+
+static bool read_input_runs(ReplayFile* file, u32 size) {
+    ReplayInputRun run;
+
+    for (u32 i = 0; i < size / sizeof(ReplayInputRun); i++) {
+        if (SDL_ReadIO(file->io, &run, sizeof(run)) != sizeof(run)) {
+            return false;
+        }
+
+        const int frame_count = file->frame_count + run.frames;
+
+        if (!reserve((void**)&file->inputs, &file->inputs_capacity, frame_count, sizeof(ReplayInputs))) {
+            return false;
+        }
+
+        for (int j = 0; j < run.frames; j++) {
+            file->inputs[file->frame_count + j] = (ReplayInputs) { .sw = { run.sw[0], run.sw[1] } };
+        }
+
+        file->frame_count = frame_count;
+    }
+
+    return true;
+}
+
+static bool add_keyframe(ReplayFile* file, int frame, Sint64 offset, u32 size) {
+    const int keyframe_count = file->keyframe_count + 1;
+
+    if (!reserve((void**)&file->keyframes, &file->keyframes_capacity, keyframe_count, sizeof(ReplayKeyframe))) {
+        return false;
+    }
+
+    ReplayKeyframe* keyframe = &file->keyframes[file->keyframe_count];
+    keyframe->frame = frame;
+    keyframe->offset = offset;
+    keyframe->size = size;
+    file->keyframe_count = keyframe_count;
+    return true;
+}
+
+/// Read chunks up to the end of the file, or up to the first one that is incomplete
+static void read_chunks(ReplayFile* file) {
+    const Sint64 file_size = SDL_GetIOSize(file->io);
+    ReplayChunkHeader header;
+
+    while (SDL_ReadIO(file->io, &header, sizeof(header)) == sizeof(header)) {
+        const Sint64 offset = SDL_TellIO(file->io);
+        bool was_read = true;
+
+        if (offset + header.size > file_size) {
+            break;
+        }
+
+        switch (header.type) {
+        case REPLAY_CHUNK_INPUTS:
+            was_read = (header.frame == file->frame_count) && read_input_runs(file, header.size);
+            break;
+
+        case REPLAY_CHUNK_KEYFRAME:
+            was_read = !file->are_keyframes_usable || add_keyframe(file, header.frame, offset, header.size);
+            break;
+
+        default:
+            // Skip chunks this version doesn't know about
+            break;
+        }
+
+        if (!was_read || (SDL_SeekIO(file->io, offset + header.size, SDL_IO_SEEK_SET) < 0)) {
+            break;
+        }
+    }
+
+    // Drop keyframes past the last inputs, they can't be reached
+    while ((file->keyframe_count > 0) && (file->keyframes[file->keyframe_count - 1].frame > file->frame_count)) {
+        file->keyframe_count -= 1;
+    }
+
+    file->written_frames = file->frame_count;
+}
+
+ReplayFile* ReplayFile_Open(const char* path, ReplaySetup* setup, size_t state_size, u32 layout_fingerprint) {
+    ReplayFile* file = SDL_calloc(1, sizeof(ReplayFile));
+
+    if (file == NULL) {
+        return NULL;
+    }
+
+    ReplayFileHeader header;
+    file->state_size = state_size;
+    file->compressed_capacity = sizeof(ReplayLatch) + get_compressed_bound(state_size);
+    file->compressed = SDL_malloc(file->compressed_capacity);
+    file->io = SDL_IOFromFile(path, "rb");
+
+    if ((file->compressed == NULL) || (file->io == NULL) ||
+        (SDL_ReadIO(file->io, &header, sizeof(header)) != sizeof(header))) {
+        ReplayFile_Close(file);
+        return NULL;
+    }
+
+    if ((SDL_memcmp(header.magic, MAGIC, sizeof(header.magic)) != 0) || (header.version != REPLAY_FILE_VERSION)) {
+        SDL_SetError("not a replay file of version %d", REPLAY_FILE_VERSION);
+        ReplayFile_Close(file);
+        return NULL;
+    }
+
+    // Setup and inputs don't depend on the build, so they're still good for comparing builds
+    file->are_keyframes_usable = (header.state_size == state_size) && (header.layout_fingerprint == layout_fingerprint);
+    read_chunks(file);
+    *setup = header.setup;
+    return file;
+}
+
+void ReplayFile_Close(ReplayFile* file) {
+    if (file == NULL) {
+        return;
+    }
+
+    if (file->io != NULL) {
+        write_inputs(file);
+        SDL_CloseIO(file->io);
+    }
+
+    SDL_free(file->inputs);
+    SDL_free(file->keyframes);
+    SDL_free(file->runs);
+    SDL_free(file->compressed);
+    SDL_free(file);
+}
+
+void ReplayFile_AppendInputs(ReplayFile* file, ReplayInputs inputs) {
+    if (!reserve((void**)&file->inputs, &file->inputs_capacity, file->frame_count + 1, sizeof(ReplayInputs))) {
+        return;
+    }
+
+    file->inputs[file->frame_count] = inputs;
+    file->frame_count += 1;
+
+    if ((file->frame_count - file->written_frames) >= INPUT_CHUNK_FRAMES) {
+        write_inputs(file);
+    }
+}
+
+bool ReplayFile_AppendKeyframe(ReplayFile* file, const void* state, const ReplayLatch* latch) {
+    if ((file->keyframe_count > 0) && (file->keyframes[file->keyframe_count - 1].frame == file->frame_count)) {
+        return true;
+    }
+
+    const int keyframe_count = file->keyframe_count + 1;
+
+    if (!reserve((void**)&file->keyframes, &file->keyframes_capacity, keyframe_count, sizeof(ReplayKeyframe))) {
+        return false;
+    }
+
+    // The latched switches go in front of the compressed snapshot
+    const size_t latch_size = sizeof(ReplayLatch);
+    uLongf compressed_size = file->compressed_capacity - latch_size;
+
+    if (compress2(file->compressed + latch_size, &compressed_size, state, file->state_size, Z_BEST_SPEED) != Z_OK) {
+        return false;
+    }
+
+    SDL_memcpy(file->compressed, latch, latch_size);
+    write_inputs(file);
+
+    const Sint64 offset = SDL_TellIO(file->io) + sizeof(ReplayChunkHeader);
+    const u32 size = latch_size + compressed_size;
+
+    if (!write_chunk(file, REPLAY_CHUNK_KEYFRAME, file->frame_count, file->compressed, size)) {
+        return false;
+    }
+
+    ReplayKeyframe* keyframe = &file->keyframes[file->keyframe_count];
+    keyframe->frame = file->frame_count;
+    keyframe->offset = offset;
+    keyframe->size = size;
+    file->keyframe_count += 1;
+    return true;
+}
+
+int ReplayFile_GetFrameCount(const ReplayFile* file) {
+    return file->frame_count;
+}
+
+ReplayInputs ReplayFile_GetInputs(const ReplayFile* file, int frame) {
+    if ((frame < 0) || (frame >= file->frame_count)) {
+        return (ReplayInputs) { 0 };
+    }
+
+    return file->inputs[frame];
+}
+
+static const ReplayKeyframe* find_keyframe(const ReplayFile* file, int frame) {
+    int low = 0;
+    int high = file->keyframe_count;
+
+    // Find the first keyframe after `frame`
+    while (low < high) {
+        const int mid = (low + high) / 2;
+
+        if (file->keyframes[mid].frame <= frame) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return (low > 0) ? &file->keyframes[low - 1] : NULL;
+}
+
+int ReplayFile_FindKeyframe(const ReplayFile* file, int frame) {
+    const ReplayKeyframe* keyframe = find_keyframe(file, frame);
+    return (keyframe != NULL) ? keyframe->frame : -1;
+}
+
+bool ReplayFile_ReadKeyframe(ReplayFile* file, int frame, void* state, ReplayLatch* latch) {
+    const ReplayKeyframe* keyframe = find_keyframe(file, frame);
+
+    // Sizes come from the file, which may be truncated or corrupt
+    if ((keyframe == NULL) || (keyframe->frame != frame) || (keyframe->size < sizeof(ReplayLatch)) ||
+        (keyframe->size > file->compressed_capacity)) {
+        return false;
+    }
+
+    const Sint64 end = SDL_TellIO(file->io);
+    const bool was_read = (SDL_SeekIO(file->io, keyframe->offset, SDL_IO_SEEK_SET) >= 0) &&
+                          (SDL_ReadIO(file->io, file->compressed, keyframe->size) == keyframe->size);
+
+    // Go back to the end so that the next chunk gets appended
+    SDL_SeekIO(file->io, end, SDL_IO_SEEK_SET);
+
+    if (!was_read) {
+        return false;
+    }
+
+    const size_t latch_size = sizeof(ReplayLatch);
+    uLongf state_size = file->state_size;
+
+    if ((uncompress(state, &state_size, file->compressed + latch_size, keyframe->size - latch_size) != Z_OK) ||
+        (state_size != file->state_size)) {
+        return false;
+    }
+
+    SDL_memcpy(latch, file->compressed, latch_size);
+    return true;
+}
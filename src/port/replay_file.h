@@ -0,0 +1,72 @@
+#ifndef PORT_REPLAY_FILE_H
+#define PORT_REPLAY_FILE_H
+
+#include "types.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define REPLAY_FILE_VERSION 2
+
+/// What was picked before the match. Seeking doesn't depend on it, but starting playback from scratch has to load the
+/// same characters and stage.
+typedef struct ReplaySetup {
+    u8 mode;
+    u8 characters[2];
+    s8 super_arts[2];
+    s8 colors[2];
+    u8 stage;
+} ReplaySetup;
+
+/// Raw pad state of both players for one frame
+typedef struct ReplayInputs {
+    u16 sw[2];
+} ReplayInputs;
+
+/// Switches latched before a keyframe. They live outside of the simulation state, but the next frame reads them.
+typedef struct ReplayLatch {
+    u16 sw_0[2];
+    u16 sw_1[2];
+} ReplayLatch;
+
+typedef struct ReplayFile ReplayFile;
+
+/// Create a replay file and write its header. Inputs and keyframes are streamed to it as they get appended.
+/// @param state_size Size of the snapshots passed to `ReplayFile_AppendKeyframe`.
+/// @param layout_fingerprint Identifies the layout of the snapshots, see `GameState_GetLayoutFingerprint`.
+/// @return The file, or `NULL` if it couldn't be created.
+ReplayFile* ReplayFile_Create(const char* path, const ReplaySetup* setup, int keyframe_interval, size_t state_size,
+                              u32 layout_fingerprint);
+
+/// Open an existing replay file for reading. Inputs and keyframe positions are read right away.
+/// @param setup Filled with the setup the file was recorded with.
+/// @param state_size Size of the snapshots this build takes.
+/// @param layout_fingerprint Layout of the snapshots this build takes. Keyframes of files recorded with a different
+/// size or layout are left out, so that only their setup and inputs can be used.
+/// @return The file, or `NULL` if it couldn't be read.
+ReplayFile* ReplayFile_Open(const char* path, ReplaySetup* setup, size_t state_size, u32 layout_fingerprint);
+
+/// Write the inputs that haven't been written yet and close the file
+void ReplayFile_Close(ReplayFile* file);
+
+/// Append the inputs of the next frame
+void ReplayFile_AppendInputs(ReplayFile* file, ReplayInputs inputs);
+
+/// Append a snapshot taken before the next frame runs
+/// @return Whether the keyframe was written and can be seeked to.
+bool ReplayFile_AppendKeyframe(ReplayFile* file, const void* state, const ReplayLatch* latch);
+
+/// @return Number of frames that have inputs.
+int ReplayFile_GetFrameCount(const ReplayFile* file);
+
+ReplayInputs ReplayFile_GetInputs(const ReplayFile* file, int frame);
+
+/// @return Frame of the last keyframe at or before `frame`, or `-1` if there's none. Files recorded by a build with a
+/// different state layout have none.
+int ReplayFile_FindKeyframe(const ReplayFile* file, int frame);
+
+/// Read back the keyframe taken before `frame`
+/// @return Whether `state` and `latch` were filled.
+bool ReplayFile_ReadKeyframe(ReplayFile* file, int frame, void* state, ReplayLatch* latch);
+
+#endif
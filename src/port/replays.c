@@ -0,0 +1,418 @@
+#include "port/replays.h"
+#include "common.h"
+#include "main.h"
+#include "netplay/game_state.h"
+#include "netplay/netplay.h"
+#include "port/autostart.h"
+#include "port/config.h"
+#include "port/hash_stream.h"
+#include "port/match_farm.h"
+#include "port/paths.h"
+#include "port/replay_file.h"
+#include "port/video_export.h"
+#include "sf33rd/Source/Game/engine/workuser.h"
+#include "sf33rd/Source/Game/game.h"
+#include "sf33rd/Source/Game/rendering/dc_ghost.h"
+#include "sf33rd/Source/Game/rendering/mtrans.h"
+#include "sf33rd/Source/Game/stage/bg.h"
+#include "sf33rd/Source/Game/system/sys_sub.h"
+#include "sf33rd/Source/Game/system/work_sys.h"
+
+#include <SDL3/SDL.h>
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+
+// Local matches are streamed to `replays/<date>_<time>.3sxr` next to the config. Keyframes are snapshots of the
+// simulation, built on the same snapshots that netplay rolls back with. Seeking restores the last keyframe before the
+// target and resimulates the frames in between without rendering them.
+//
+// Snapshots hold pointers into loaded character and stage data, so each one comes with a map of where files were
+// loaded. Restoring a snapshot moves its pointers to where the same files are loaded now, which lets a saved replay be
+// played in a later session: the game goes through the menus into a versus match with the recorded characters and
+// stage, and the first keyframe replaces the match.
+
+#define FRAMES_PER_SECOND 60
+
+typedef enum ReplaysState {
+    REPLAYS_IDLE,
+    REPLAYS_RECORDING,
+    REPLAYS_REVIEWING,        // Going through frames that have already been recorded
+    REPLAYS_BOOTING,          // Waiting for the main menu before playing a saved replay
+    REPLAYS_SELECTING,        // Going through character select before playing a saved replay
+    REPLAYS_FINISHED_PLAYING, // A saved replay ran out, players are in control until the match ends
+} ReplaysState;
+
+static ReplaysState state = REPLAYS_IDLE;
+static ReplayFile* file = NULL;
+static bool is_saved_replay = false; // Whether `file` is played instead of recorded to
+static ReplaySetup setup = { 0 };
+static AutostartSetup autostart_setup = { 0 }; // How to get to the match of a saved replay
+static u8* snapshot = NULL; // Effect state, game state and heap map
+static size_t snapshot_size = 0;
+static int keyframe_interval = 0;
+static int frame = 0; // Next frame to run
+static int startup_frames = 0;
+static int pending_seek_frames = 0;
+
+static size_t get_game_state_offset() {
+    return ALIGN_UP(sizeof(EffectState), 16);
+}
+
+static size_t get_heap_map_offset() {
+    return ALIGN_UP(get_game_state_offset() + GameState_GetSize(), 16);
+}
+
+static bool should_record() {
+    const bool is_local_match = (Mode_Type == MODE_ARCADE) || (Mode_Type == MODE_VERSUS);
+
+    return Config_GetBool(CFG_KEY_RECORD_REPLAYS) && (Netplay_GetSessionState() == NETPLAY_SESSION_IDLE) &&
+           !VideoExport_IsActive() && !HashStream_IsActive() && !MatchFarm_IsActive() && is_local_match &&
+           (Demo_Flag != 0) && (G_No[1] == 2);
+}
+
+static void capture_snapshot() {
+    EffectState_SavePortable((EffectState*)snapshot);
+    GameState_SavePortable((GameState*)(snapshot + get_game_state_offset()));
+    GameState_MapHeap((GameStateHeapMap*)(snapshot + get_heap_map_offset()));
+}
+
+static void begin_recording() {
+    char timestamp[32];
+    const time_t now = time(NULL);
+    strftime(timestamp, sizeof(timestamp), "%Y%m%d_%H%M%S", localtime(&now));
+
+    char* dir;
+    char* path;
+    SDL_asprintf(&dir, "%sreplays", Paths_GetBasePath());
+    SDL_asprintf(&path, "%s/%s.3sxr", dir, timestamp);
+    SDL_CreateDirectory(dir);
+
+    setup = (ReplaySetup) { .mode = Mode_Type,
+                            .characters = { My_char[0], My_char[1] },
+                            .super_arts = { Super_Arts[0], Super_Arts[1] },
+                            .colors = { Player_Color[0], Player_Color[1] },
+                            .stage = bg_w.stage };
+
+    keyframe_interval = SDL_max(Config_GetInt(CFG_KEY_REPLAY_KEYFRAME_INTERVAL), 1) * FRAMES_PER_SECOND;
+    snapshot_size = Replays_GetSnapshotSize();
+    snapshot = SDL_aligned_alloc(16, snapshot_size);
+
+    if (snapshot != NULL) {
+        file = ReplayFile_Create(path, &setup, keyframe_interval, snapshot_size, GameState_GetLayoutFingerprint());
+    }
+
+    if (file == NULL) {
+        printf("⚠️ couldn't record replay to %s: %s\n", path, SDL_GetError());
+        SDL_aligned_free(snapshot);
+        snapshot = NULL;
+    } else {
+        printf("🎥 recording replay to %s\n", path);
+    }
+
+    // Stay in this state without a file, so that recording isn't attempted again until the next match
+    state = REPLAYS_RECORDING;
+    is_saved_replay = false;
+    frame = 0;
+    SDL_free(dir);
+    SDL_free(path);
+}
+
+static void end_recording() {
+    if ((file != NULL) && !is_saved_replay) {
+        printf("🎥 recorded %d frames\n", ReplayFile_GetFrameCount(file));
+    }
+
+    ReplayFile_Close(file);
+    SDL_aligned_free(snapshot);
+    file = NULL;
+    snapshot = NULL;
+    is_saved_replay = false;
+    state = REPLAYS_IDLE;
+}
+
+static void take_keyframe() {
+    const ReplayLatch latch = { .sw_0 = { p1sw_0, p2sw_0 }, .sw_1 = { p1sw_1, p2sw_1 } };
+
+    capture_snapshot();
+
+    if (!ReplayFile_AppendKeyframe(file, snapshot, &latch)) {
+        printf("⚠️ couldn't write replay keyframe for frame %d\n", frame);
+    }
+}
+
+size_t Replays_GetSnapshotSize() {
+    return get_heap_map_offset() + sizeof(GameStateHeapMap);
+}
+
+bool Replays_LoadKeyframe(ReplayFile* keyframe_file, int keyframe, void* buffer) {
+    GameState* game_state = (GameState*)((u8*)buffer + get_game_state_offset());
+    EffectState* effect_state = (EffectState*)buffer;
+    const GameStateHeapMap* heap_map = (const GameStateHeapMap*)((u8*)buffer + get_heap_map_offset());
+    ReplayLatch latch;
+
+    if (!ReplayFile_ReadKeyframe(keyframe_file, keyframe, buffer, &latch)) {
+        return false;
+    }
+
+    if (!GameState_RelocateHeap(game_state, effect_state, heap_map)) {
+        printf("⚠️ the keyframe at frame %d points into files that aren't loaded\n", keyframe);
+        return false;
+    }
+
+    GameState_LoadPortable(game_state);
+    EffectState_LoadPortable(effect_state);
+    p1sw_0 = latch.sw_0[0];
+    p2sw_0 = latch.sw_0[1];
+    p1sw_1 = latch.sw_1[0];
+    p2sw_1 = latch.sw_1[1];
+    return true;
+}
+
+/// Run a frame the same way `game_step_0` does, minus reading pads and rendering
+static void simulate_frame(int index) {
+    const ReplayInputs inputs = ReplayFile_GetInputs(file, index);
+
+    p1sw_buff = inputs.sw[0];
+    p2sw_buff = inputs.sw[1];
+    p3sw_buff = 0;
+    p4sw_buff = 0;
+    appLatchKeyData();
+
+    mpp_w.inGame = false;
+    njUserMain();
+    seqsBeforeProcess();
+    njdp2d_draw();
+    seqsAfterProcess();
+}
+
+static void seek(int target) {
+    const int frame_count = ReplayFile_GetFrameCount(file);
+    const Uint64 start = SDL_GetTicksNS();
+    int from = frame;
+
+    target = SDL_clamp(target, 0, frame_count);
+
+    if (target == frame) {
+        return;
+    }
+
+    // Going forward only needs a keyframe if there's one closer to the target than where we are
+    const int keyframe = ReplayFile_FindKeyframe(file, target);
+
+    // Past the end of a saved replay, players are in control and there's nothing to jump ahead to
+    if ((state == REPLAYS_FINISHED_PLAYING) && (target >= frame_count)) {
+        return;
+    }
+
+    if ((target < frame) || (keyframe > frame)) {
+        if ((keyframe < 0) || !Replays_LoadKeyframe(file, keyframe, snapshot)) {
+            printf("⚠️ no usable replay keyframe before frame %d\n", target);
+            return;
+        }
+
+        from = keyframe;
+    }
+
+    const u8 prev_no_trans = No_Trans;
+    No_Trans = 1;
+
+    for (int i = from; i < target; i++) {
+        simulate_frame(i);
+    }
+
+    No_Trans = prev_no_trans;
+    frame = target;
+
+    if (frame < frame_count) {
+        state = REPLAYS_REVIEWING;
+    } else {
+        state = is_saved_replay ? REPLAYS_FINISHED_PLAYING : REPLAYS_RECORDING;
+    }
+
+    printf("⏩ jumped to %d:%02d of the replay in %.3f ms, resimulated %d frames\n",
+           frame / FRAMES_PER_SECOND / 60,
+           frame / FRAMES_PER_SECOND % 60,
+           (SDL_GetTicksNS() - start) / 1000000.0,
+           target - from);
+}
+
+void Replays_RequestSeek(int seconds) {
+    pending_seek_frames += seconds * FRAMES_PER_SECOND;
+}
+
+bool Replays_Play(const char* path) {
+    file = ReplayFile_Open(path, &setup, Replays_GetSnapshotSize(), GameState_GetLayoutFingerprint());
+
+    if (file == NULL) {
+        printf("⚠️ couldn't read replay %s: %s\n", path, SDL_GetError());
+        return false;
+    }
+
+    const char* reason = NULL;
+
+    if (setup.mode != MODE_VERSUS) {
+        // The CPU opponent isn't controlled by the recorded inputs, so it can't be played in versus
+        reason = "only versus matches can be played back";
+    } else if (ReplayFile_FindKeyframe(file, 0) != 0) {
+        reason = "it was recorded by a different build";
+    }
+
+    snapshot_size = Replays_GetSnapshotSize();
+    snapshot = (reason == NULL) ? SDL_aligned_alloc(16, snapshot_size) : NULL;
+
+    if (snapshot == NULL) {
+        printf("⚠️ can't play replay %s: %s\n", path, (reason != NULL) ? reason : SDL_GetError());
+        ReplayFile_Close(file);
+        file = NULL;
+        return false;
+    }
+
+    printf("🎥 playing replay %s\n", path);
+    autostart_setup = Replays_GetAutostartSetup(&setup);
+    is_saved_replay = true;
+    startup_frames = 0;
+    state = REPLAYS_BOOTING;
+    return true;
+}
+
+/// Go through the menus into a versus match set up like the saved replay, and replace the match with its first
+/// keyframe once it has started
+static void update_startup() {
+    startup_frames += 1;
+
+    switch (state) {
+    case REPLAYS_BOOTING:
+        if (Autostart_IsMainMenuReady()) {
+            Autostart_StartVersus(&autostart_setup);
+            startup_frames = 0;
+            state = REPLAYS_SELECTING;
+        } else if (Autostart_HasTimedOut(AUTOSTART_BOOTING, startup_frames)) {
+            end_recording();
+        }
+
+        break;
+
+    case REPLAYS_SELECTING:
+        if (G_No[1] == 2) {
+            if (Replays_LoadKeyframe(file, 0, snapshot)) {
+                frame = 0;
+                state = REPLAYS_REVIEWING;
+            } else {
+                printf("⚠️ couldn't restore the start of the replay\n");
+                end_recording();
+            }
+        } else if (Autostart_HasTimedOut(AUTOSTART_SELECTING, startup_frames)) {
+            end_recording();
+        }
+
+        break;
+
+    case REPLAYS_IDLE:
+    case REPLAYS_RECORDING:
+    case REPLAYS_REVIEWING:
+    case REPLAYS_FINISHED_PLAYING:
+        break;
+    }
+}
+
+void Replays_Update() {
+    switch (state) {
+    case REPLAYS_IDLE:
+        if (should_record()) {
+            begin_recording();
+        }
+
+        break;
+
+    case REPLAYS_RECORDING:
+    case REPLAYS_REVIEWING:
+    case REPLAYS_FINISHED_PLAYING:
+        // A saved replay ends along with its match, a recording as soon as it shouldn't be recorded anymore
+        if (is_saved_replay ? (G_No[1] != 2) : !should_record()) {
+            end_recording();
+        }
+
+        break;
+
+    case REPLAYS_BOOTING:
+    case REPLAYS_SELECTING:
+        update_startup();
+        pending_seek_frames = 0;
+        return;
+    }
+
+    if ((file != NULL) && (pending_seek_frames != 0)) {
+        seek(frame + pending_seek_frames);
+    }
+
+    pending_seek_frames = 0;
+
+    if ((file != NULL) && (state == REPLAYS_RECORDING) && ((frame % keyframe_interval) == 0)) {
+        take_keyframe();
+    }
+}
+
+void Replays_InjectInputs() {
+    switch (state) {
+    case REPLAYS_IDLE:
+    case REPLAYS_FINISHED_PLAYING:
+        break;
+
+    case REPLAYS_BOOTING:
+        Autostart_InjectInputs(AUTOSTART_BOOTING, startup_frames, &autostart_setup);
+        break;
+
+    case REPLAYS_SELECTING:
+        Autostart_InjectInputs(AUTOSTART_SELECTING, startup_frames, &autostart_setup);
+        break;
+
+    case REPLAYS_RECORDING:
+        if (file != NULL) {
+            ReplayFile_AppendInputs(file, (ReplayInputs) { .sw = { p1sw_buff, p2sw_buff } });
+            frame += 1;
+        }
+
+        break;
+
+    case REPLAYS_REVIEWING:
+        const ReplayInputs inputs = ReplayFile_GetInputs(file, frame);
+        p1sw_buff = inputs.sw[0];
+        p2sw_buff = inputs.sw[1];
+        p3sw_buff = 0;
+        p4sw_buff = 0;
+        frame += 1;
+
+        if (frame < ReplayFile_GetFrameCount(file)) {
+            break;
+        }
+
+        if (is_saved_replay) {
+            printf("▶️ the replay is over, players are in control\n");
+            state = REPLAYS_FINISHED_PLAYING;
+        } else {
+            printf("▶️ caught up with the match\n");
+            state = REPLAYS_RECORDING;
+        }
+
+        break;
+    }
+}
+
+AutostartSetup Replays_GetAutostartSetup(const ReplaySetup* setup) {
+    return (AutostartSetup) { .characters = { setup->characters[0], setup->characters[1] },
+                              .stage = setup->stage,
+                              .super_arts = { setup->super_arts[0], setup->super_arts[1] },
+                              .colors = { setup->colors[0], setup->colors[1] } };
+}
+
+bool Replays_IsActive() {
+    return file != NULL;
+}
+
+void Replays_Quit() {
+    if (state != REPLAYS_IDLE) {
+        end_recording();
+    }
+}
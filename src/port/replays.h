@@ -0,0 +1,43 @@
+#ifndef PORT_REPLAYS_H
+#define PORT_REPLAYS_H
+
+#include "port/autostart.h"
+#include "port/replay_file.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/// Jump by the given number of seconds in the match that is being recorded or played at the start of the next frame.
+/// Jumping back plays the recording until it catches up with the match, then players are back in control.
+void Replays_RequestSeek(int seconds);
+
+/// Go into a versus match set up like a saved replay and play it from its first keyframe. It can be seeked through
+/// the same way as a recording, and players take over when it runs out.
+/// @return Whether the replay could be read and was recorded in versus by this build.
+bool Replays_Play(const char* path);
+
+/// Start or stop recording and carry out pending seeks. Call before the game reads inputs for the frame.
+void Replays_Update();
+
+/// Record the inputs of the frame, or replace them with recorded ones while going through the recording. Call after
+/// pads have been read.
+void Replays_InjectInputs();
+
+/// @return Size of the snapshots that go into keyframes.
+size_t Replays_GetSnapshotSize();
+
+/// Restore the simulation to a keyframe, along with the switches latched before it
+/// @param buffer Scratch space of `Replays_GetSnapshotSize()` bytes, aligned to 16 bytes.
+/// @return Whether the keyframe could be read. The simulation is left untouched if it couldn't.
+bool Replays_LoadKeyframe(ReplayFile* file, int frame, void* buffer);
+
+/// @return How to go through the menus into a match set up like a replay.
+AutostartSetup Replays_GetAutostartSetup(const ReplaySetup* setup);
+
+/// @return Whether a match is being recorded or played back from a file.
+bool Replays_IsActive();
+
+/// Finish the file of the match that is being recorded
+void Replays_Quit();
+
+#endif
@@ -4,6 +4,64 @@
 
 #include <SDL3/SDL.h>
 
+#define LINE_HEIGHT 8
+#define DEPTH_BUCKETS_SHOWN 4
+
+static bool show_details = false;
+
+static void render_line(int line, const char* text) {
+    SSPutStrPro(0, 2, 2 + line * LINE_HEIGHT, 9, 0xFFFFFFFF, text);
+}
+
+static void render_details(const NetworkStats* stats) {
+    NetplaySessionStats session_stats;
+    Netplay_GetSessionStats(&session_stats);
+
+    char buffer[64];
+
+    SDL_snprintf(buffer,
+                 sizeof(buffer),
+                 "D:%d J:%d ADV:%d",
+                 stats->delay,
+                 stats->jitter,
+                 (int)SDL_roundf(stats->frame_advantage));
+    render_line(1, buffer);
+
+    SDL_snprintf(buffer, sizeof(buffer), "RBF:%d CU:%d", stats->rolled_back_frames, stats->catch_up_frames);
+
+    if (stats->lost_packets >= 0) {
+        const size_t length = SDL_strlen(buffer);
+        SDL_snprintf(buffer + length, sizeof(buffer) - length, " LOST:%d", stats->lost_packets);
+    }
+
+    render_line(2, buffer);
+
+    SDL_snprintf(buffer,
+                 sizeof(buffer),
+                 "SV:%d LD:%d RS:%d US",
+                 stats->save_us,
+                 stats->load_us,
+                 stats->resimulate_us);
+    render_line(3, buffer);
+
+    // Rollback depth histogram for the whole session. The last bucket includes deeper rollbacks
+    int deeper = 0;
+
+    for (int i = DEPTH_BUCKETS_SHOWN; i <= NETPLAY_ROLLBACK_DEPTH_MAX; i++) {
+        deeper += session_stats.rollback_depths[i];
+    }
+
+    SDL_snprintf(buffer,
+                 sizeof(buffer),
+                 "1:%d 2:%d 3:%d %d:%d",
+                 session_stats.rollback_depths[1],
+                 session_stats.rollback_depths[2],
+                 session_stats.rollback_depths[3],
+                 DEPTH_BUCKETS_SHOWN,
+                 deeper);
+    render_line(4, buffer);
+}
+
 void NetstatsRenderer_Render() {
     if (Netplay_GetSessionState() != NETPLAY_SESSION_RUNNING) {
         return;
@@ -14,6 +72,13 @@ void NetstatsRenderer_Render() {
 
     char buffer[32];
     SDL_snprintf(buffer, sizeof(buffer), "R:%d P:%d", stats.rollback, stats.ping);
+    render_line(0, buffer);
+
+    if (show_details) {
+        render_details(&stats);
+    }
+}
 
-    SSPutStrPro(0, 2, 2, 9, 0xFFFFFFFF, buffer);
+void NetstatsRenderer_ToggleDetails() {
+    show_details = !show_details;
 }
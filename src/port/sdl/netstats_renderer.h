@@ -3,4 +3,7 @@
 
 void NetstatsRenderer_Render();
 
+/// Switch between showing just rollback and ping, and the full set of netplay stats.
+void NetstatsRenderer_ToggleDetails();
+
 #endif
@@ -1,17 +1,24 @@
 #include "port/sdl/sdl_app.h"
 #include "common.h"
 #include "port/config.h"
+#include "port/effect_profiler.h"
+#include "port/mem_stats.h"
+#include "port/replays.h"
 #include "port/sdl/netstats_renderer.h"
 #include "port/sdl/sdl_debug_text.h"
 #include "port/sdl/sdl_game_renderer.h"
 #include "port/sdl/sdl_message_renderer.h"
 #include "port/sdl/sdl_pad.h"
+#include "port/startup_trace.h"
+#include "port/training_states.h"
+#include "port/video_export.h"
 #include "port/sound/adx.h"
 #include "sf33rd/AcrSDK/ps2/foundaps2.h"
 
 #include <SDL3/SDL.h>
 
 #define FRAME_END_TIMES_MAX 30
+#define REPLAY_SEEK_SECONDS 5
 
 typedef enum ScaleMode {
     SCALEMODE_NEAREST,
@@ -33,6 +40,7 @@ static SDL_Texture* screen_texture = NULL;
 static ScaleMode scale_mode = SCALEMODE_SOFT_LINEAR;
 
 static Uint64 frame_deadline = 0;
+static double frame_time_scale = 1;
 static Uint64 frame_end_times[FRAME_END_TIMES_MAX];
 static int frame_end_times_index = 0;
 static bool frame_end_times_filled = false;
@@ -100,7 +108,9 @@ static void init_scalemode() {
 
 int SDLApp_Init() {
     Config_Init();
+    EffectProfiler_Init();
     init_scalemode();
+    StartupTrace_Mark("config");
 
     SDL_SetAppMetadata(app_name, "0.1", NULL);
     SDL_SetHint(SDL_HINT_VIDEO_WAYLAND_PREFER_LIBDECOR, "1");
@@ -111,6 +121,8 @@ int SDLApp_Init() {
         return 1;
     }
 
+    StartupTrace_Mark("SDL init");
+
     SDL_WindowFlags window_flags = SDL_WINDOW_RESIZABLE | SDL_WINDOW_HIGH_PIXEL_DENSITY;
 
     if (Config_GetBool(CFG_KEY_FULLSCREEN)) {
@@ -135,6 +147,7 @@ int SDLApp_Init() {
     }
 
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    StartupTrace_Mark("window and renderer");
 
     // Initialize rendering subsystems
     SDLMessageRenderer_Initialize(renderer);
@@ -149,11 +162,13 @@ int SDLApp_Init() {
 
     // Initialize pads
     SDLPad_Init();
+    StartupTrace_Mark("renderers and pads");
 
     return 0;
 }
 
 void SDLApp_Quit() {
+    EffectProfiler_Quit();
     Config_Destroy();
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
@@ -184,6 +199,61 @@ static void handle_fullscreen_toggle(SDL_KeyboardEvent* event) {
     }
 }
 
+static void handle_netstats_toggle(SDL_KeyboardEvent* event) {
+    if ((event->key == SDLK_F9) && event->down && !event->repeat) {
+        NetstatsRenderer_ToggleDetails();
+    }
+}
+
+static void handle_memstats_dump(SDL_KeyboardEvent* event) {
+    if ((event->key == SDLK_F10) && event->down && !event->repeat) {
+        MemStats_Dump("requested with F10");
+    }
+}
+
+static void handle_effect_profile_dump(SDL_KeyboardEvent* event) {
+    if ((event->key == SDLK_F8) && event->down && !event->repeat) {
+        EffectProfiler_Dump("requested with F8");
+    }
+}
+
+/// F1-F4 load a training state, Shift+F1-F4 save one, F5 goes back to the last one
+static void handle_training_state_keys(SDL_KeyboardEvent* event) {
+    if (!event->down || event->repeat) {
+        return;
+    }
+
+    if (event->key == SDLK_F5) {
+        TrainingStates_RequestReset();
+        return;
+    }
+
+    if ((event->key < SDLK_F1) || (event->key >= SDLK_F1 + TRAINING_STATE_SLOTS)) {
+        return;
+    }
+
+    const int slot = event->key - SDLK_F1;
+
+    if (event->mod & SDL_KMOD_SHIFT) {
+        TrainingStates_RequestSave(slot);
+    } else {
+        TrainingStates_RequestLoad(slot);
+    }
+}
+
+/// F6 rewinds the recorded match by 5 seconds, F7 skips ahead by 5 seconds. Holding either keeps seeking.
+static void handle_replay_seek_keys(SDL_KeyboardEvent* event) {
+    if (!event->down) {
+        return;
+    }
+
+    if (event->key == SDLK_F6) {
+        Replays_RequestSeek(-REPLAY_SEEK_SECONDS);
+    } else if (event->key == SDLK_F7) {
+        Replays_RequestSeek(REPLAY_SEEK_SECONDS);
+    }
+}
+
 static void handle_mouse_motion() {
     last_mouse_motion_time = SDL_GetTicks();
     SDL_ShowCursor();
@@ -221,6 +291,11 @@ bool SDLApp_PollEvents() {
         case SDL_EVENT_KEY_UP:
             set_screenshot_flag_if_needed(&event.key);
             handle_fullscreen_toggle(&event.key);
+            handle_netstats_toggle(&event.key);
+            handle_memstats_dump(&event.key);
+            handle_effect_profile_dump(&event.key);
+            handle_training_state_keys(&event.key);
+            handle_replay_seek_keys(&event.key);
             SDLPad_HandleKeyboardEvent(&event.key);
             break;
 
@@ -340,6 +415,8 @@ static void save_texture(SDL_Texture* texture, const char* filename) {
 }
 
 void SDLApp_EndFrame() {
+    EffectProfiler_EndFrame();
+
     // Run sound processing
     ADX_ProcessTracks();
 
@@ -354,6 +431,10 @@ void SDLApp_EndFrame() {
         save_texture(cps3_canvas, "screenshot_cps3.bmp");
     }
 
+    if (VideoExport_IsActive()) {
+        VideoExport_CaptureFrame(renderer, cps3_canvas);
+    }
+
     SDL_SetRenderTarget(renderer, screen_texture);
 
     // Render window background
@@ -396,10 +477,11 @@ void SDLApp_EndFrame() {
     hide_cursor_if_needed();
 
     // Do frame pacing
+    const Uint64 frame_time_ns = target_frame_time_ns * frame_time_scale;
     Uint64 now = SDL_GetTicksNS();
 
     if (frame_deadline == 0) {
-        frame_deadline = now + target_frame_time_ns;
+        frame_deadline = now + frame_time_ns;
     }
 
     if (now < frame_deadline) {
@@ -408,11 +490,11 @@ void SDLApp_EndFrame() {
         now = SDL_GetTicksNS();
     }
 
-    frame_deadline += target_frame_time_ns;
+    frame_deadline += frame_time_ns;
 
     // If we fell behind by more than one frame, resync to avoid spiraling
-    if (now > frame_deadline + target_frame_time_ns) {
-        frame_deadline = now + target_frame_time_ns;
+    if (now > frame_deadline + frame_time_ns) {
+        frame_deadline = now + frame_time_ns;
     }
 
     // Measure
@@ -421,6 +503,10 @@ void SDLApp_EndFrame() {
     update_fps();
 }
 
+void SDLApp_SetFrameTimeScale(double scale) {
+    frame_time_scale = scale;
+}
+
 void SDLApp_Exit() {
     SDL_Event quit_event;
     quit_event.type = SDL_EVENT_QUIT;
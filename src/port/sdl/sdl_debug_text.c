@@ -7,54 +7,211 @@
 
 #if defined(DEBUG)
 
+// Glyphs are drawn from an atlas that has two cells per character: the outline and the fill. Each cell has a 1 pixel
+// border around the 8x8 glyph to make room for the outline. All queued characters are submitted with a single
+// `SDL_RenderGeometry` call.
+
+#define GLYPH_FIRST 0x20
+#define GLYPH_LAST 0x7F
+#define GLYPH_COUNT (GLYPH_LAST - GLYPH_FIRST + 1)
+#define GLYPH_SIZE SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE
+#define CELL_SIZE (GLYPH_SIZE + 2)
+#define ATLAS_COLUMNS 16
+#define ATLAS_GLYPH_ROWS ((GLYPH_COUNT + ATLAS_COLUMNS - 1) / ATLAS_COLUMNS)
+#define ATLAS_WIDTH (ATLAS_COLUMNS * CELL_SIZE)
+#define ATLAS_HEIGHT (ATLAS_GLYPH_ROWS * 2 * CELL_SIZE) // Outlines on top, fills below
+#define MAX_CHARS 0x12C0                                // Size of the buffer allocated in flPrintL
+
 static SDL_Renderer* debug_renderer = NULL;
+static SDL_Texture* atlas = NULL;
+static SDL_Vertex* vertices = NULL;
+static int* indices = NULL;
 
-void SDLDebugText_Initialize(SDL_Renderer* renderer) {
-    debug_renderer = renderer;
-}
+static void draw_glyph_cell(int code, bool outline) {
+    const int index = code - GLYPH_FIRST;
+    const float cell_x = (index % ATLAS_COLUMNS) * CELL_SIZE;
+    const float cell_y = ((index / ATLAS_COLUMNS) + (outline ? 0 : ATLAS_GLYPH_ROWS)) * CELL_SIZE;
+    const char text[2] = { (char)code, '\0' };
 
-void SDLDebugText_Render() {
-    if (debug_renderer == NULL) {
+    if (!outline) {
+        SDL_RenderDebugText(debug_renderer, cell_x + 1, cell_y + 1, text);
         return;
     }
 
-    // Get the debug string buffer
-    RenderBuffer* buff_ptr = (RenderBuffer*)flPS2GetSystemBuffAdrs(flDebugStrHan);
-    if (buff_ptr == NULL || flDebugStrCtr == 0) {
-        return;
+    for (int dy = 0; dy <= 2; dy++) {
+        for (int dx = 0; dx <= 2; dx++) {
+            if ((dx != 1) || (dy != 1)) {
+                SDL_RenderDebugText(debug_renderer, cell_x + dx, cell_y + dy, text);
+            }
+        }
     }
+}
 
-    // Calculate scale factor based on current window height
-    int render_width, render_height;
-    SDL_GetRenderOutputSize(debug_renderer, &render_width, &render_height);
-    float scale = (float)render_height / 480.0f;
+/// Draw the glyphs into a render target and copy them into a static texture, which unlike a render target doesn't
+/// lose its contents when the graphics device gets reset.
+static bool create_atlas() {
+    SDL_Texture* canvas = SDL_CreateTexture(
+        debug_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, ATLAS_WIDTH, ATLAS_HEIGHT);
 
-    // Set blend mode for text
-    SDL_SetRenderDrawBlendMode(debug_renderer, SDL_BLENDMODE_BLEND);
+    if (canvas == NULL) {
+        return false;
+    }
 
-    // Apply render scale to scale the font
-    SDL_SetRenderScale(debug_renderer, scale, scale);
+    SDL_Texture* previous_target = SDL_GetRenderTarget(debug_renderer);
 
-    // Render all characters
-    for (u32 i = 0; i < flDebugStrCtr; i++) {
-        RenderBuffer* ch = &buff_ptr[i];
-        if (ch->code < 0x20 || ch->code > 0x7F) {
+    if (!SDL_SetRenderTarget(debug_renderer, canvas)) {
+        SDL_DestroyTexture(canvas);
+        return false;
+    }
+
+    // Glyphs are white so that vertex colors can tint them
+    SDL_SetRenderDrawColor(debug_renderer, 0, 0, 0, 0);
+    SDL_RenderClear(debug_renderer);
+    SDL_SetRenderDrawColor(debug_renderer, 255, 255, 255, 255);
+
+    for (int code = GLYPH_FIRST; code <= GLYPH_LAST; code++) {
+        draw_glyph_cell(code, true);
+        draw_glyph_cell(code, false);
+    }
+
+    SDL_Surface* surface = SDL_RenderReadPixels(debug_renderer, NULL);
+    SDL_SetRenderTarget(debug_renderer, previous_target);
+    SDL_DestroyTexture(canvas);
+
+    if (surface == NULL) {
+        return false;
+    }
+
+    atlas = SDL_CreateTextureFromSurface(debug_renderer, surface);
+    SDL_DestroySurface(surface);
+
+    if (atlas == NULL) {
+        return false;
+    }
+
+    SDL_SetTextureScaleMode(atlas, SDL_SCALEMODE_NEAREST);
+    SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+    return true;
+}
+
+static bool create_buffers() {
+    // Two quads per character
+    vertices = SDL_malloc(MAX_CHARS * 8 * sizeof(SDL_Vertex));
+    indices = SDL_malloc(MAX_CHARS * 12 * sizeof(int));
+
+    if ((vertices == NULL) || (indices == NULL)) {
+        return false;
+    }
+
+    for (int i = 0; i < MAX_CHARS * 2; i++) {
+        int* quad = &indices[i * 6];
+        const int first = i * 4;
+        quad[0] = first;
+        quad[1] = first + 1;
+        quad[2] = first + 2;
+        quad[3] = first + 2;
+        quad[4] = first + 1;
+        quad[5] = first + 3;
+    }
+
+    return true;
+}
+
+static void destroy_atlas() {
+    if (atlas != NULL) {
+        SDL_DestroyTexture(atlas);
+        atlas = NULL;
+    }
+
+    SDL_free(vertices);
+    SDL_free(indices);
+    vertices = NULL;
+    indices = NULL;
+}
+
+void SDLDebugText_Initialize(SDL_Renderer* renderer) {
+    debug_renderer = renderer;
+
+    if (!create_atlas() || !create_buffers()) {
+        SDL_Log("Couldn't create debug text atlas, falling back to per-character drawing: %s", SDL_GetError());
+        destroy_atlas();
+    }
+}
+
+static SDL_Color get_color(const RenderBuffer* ch) {
+    // Extract color components (ARGB format)
+    u8 a = (ch->col >> 24) & 0xFF;
+    u8 r = (ch->col >> 16) & 0xFF;
+    u8 g = (ch->col >> 8) & 0xFF;
+    u8 b = ch->col & 0xFF;
+
+    // The PS2 flPrintColor function halved all color values before storing them.
+    // We need to double them back to restore the original brightness.
+    // (see flPrintColor in flps2debug.c)
+    r = (r < 128) ? r * 2 : 255;
+    g = (g < 128) ? g * 2 : 255;
+    b = (b < 128) ? b * 2 : 255;
+    a = (a < 128) ? a * 2 : 255;
+
+    return (SDL_Color) { r, g, b, a };
+}
+
+static bool is_printable(const RenderBuffer* ch) {
+    return (ch->code >= GLYPH_FIRST) && (ch->code <= GLYPH_LAST);
+}
+
+static void write_quad(SDL_Vertex* quad, float x, float y, int code, bool outline, SDL_FColor color) {
+    const int index = code - GLYPH_FIRST;
+    const float u0 = (float)((index % ATLAS_COLUMNS) * CELL_SIZE) / ATLAS_WIDTH;
+    const float v0 = (float)(((index / ATLAS_COLUMNS) + (outline ? 0 : ATLAS_GLYPH_ROWS)) * CELL_SIZE) / ATLAS_HEIGHT;
+    const float u1 = u0 + (float)CELL_SIZE / ATLAS_WIDTH;
+    const float v1 = v0 + (float)CELL_SIZE / ATLAS_HEIGHT;
+
+    // The cell starts 1 pixel above and left of the glyph
+    x -= 1;
+    y -= 1;
+
+    quad[0] = (SDL_Vertex) { { x, y }, color, { u0, v0 } };
+    quad[1] = (SDL_Vertex) { { x + CELL_SIZE, y }, color, { u1, v0 } };
+    quad[2] = (SDL_Vertex) { { x, y + CELL_SIZE }, color, { u0, v1 } };
+    quad[3] = (SDL_Vertex) { { x + CELL_SIZE, y + CELL_SIZE }, color, { u1, v1 } };
+}
+
+static void render_batched(const RenderBuffer* buff_ptr, u32 count) {
+    const SDL_FColor outline_color = { 0, 0, 0, 1 };
+    int quad_count = 0;
+
+    for (u32 i = 0; i < count; i++) {
+        const RenderBuffer* ch = &buff_ptr[i];
+
+        if (!is_printable(ch)) {
             continue;
         }
 
-        // Extract color components (ARGB format)
-        u8 a = (ch->col >> 24) & 0xFF;
-        u8 r = (ch->col >> 16) & 0xFF;
-        u8 g = (ch->col >> 8) & 0xFF;
-        u8 b = ch->col & 0xFF;
+        const SDL_Color color = get_color(ch);
+        const SDL_FColor fill_color = { color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f };
+
+        // Outline and fill of each character are kept next to each other, so that characters overlap in the same
+        // order as when drawing them one by one
+        write_quad(&vertices[quad_count * 4], ch->x, ch->y, ch->code, true, outline_color);
+        write_quad(&vertices[(quad_count + 1) * 4], ch->x, ch->y, ch->code, false, fill_color);
+        quad_count += 2;
+    }
+
+    if (quad_count > 0) {
+        SDL_RenderGeometry(debug_renderer, atlas, vertices, quad_count * 4, indices, quad_count * 6);
+    }
+}
 
-        // The PS2 flPrintColor function halved all color values before storing them.
-        // We need to double them back to restore the original brightness.
-        // (see flPrintColor in flps2debug.c)
-        r = (r < 128) ? r * 2 : 255;
-        g = (g < 128) ? g * 2 : 255;
-        b = (b < 128) ? b * 2 : 255;
-        a = (a < 128) ? a * 2 : 255;
+static void render_unbatched(const RenderBuffer* buff_ptr, u32 count) {
+    for (u32 i = 0; i < count; i++) {
+        const RenderBuffer* ch = &buff_ptr[i];
+
+        if (!is_printable(ch)) {
+            continue;
+        }
+
+        const SDL_Color color = get_color(ch);
 
         // Create a single character string
         char text[2] = { (char)ch->code, '\0' };
@@ -71,9 +228,41 @@ void SDLDebugText_Render() {
         SDL_RenderDebugText(debug_renderer, ch->x + 1, ch->y + 1, text); // bottom-right
 
         // Draw colored character on top
-        SDL_SetRenderDrawColor(debug_renderer, r, g, b, a);
+        SDL_SetRenderDrawColor(debug_renderer, color.r, color.g, color.b, color.a);
         SDL_RenderDebugText(debug_renderer, ch->x, ch->y, text);
     }
+}
+
+void SDLDebugText_Render() {
+    if (debug_renderer == NULL) {
+        return;
+    }
+
+    // Get the debug string buffer
+    RenderBuffer* buff_ptr = (RenderBuffer*)flPS2GetSystemBuffAdrs(flDebugStrHan);
+    if (buff_ptr == NULL || flDebugStrCtr == 0) {
+        return;
+    }
+
+    // Calculate scale factor based on current window height
+    int render_width, render_height;
+    SDL_GetRenderOutputSize(debug_renderer, &render_width, &render_height);
+    float scale = (float)render_height / 480.0f;
+
+    // Set blend mode for text
+    SDL_SetRenderDrawBlendMode(debug_renderer, SDL_BLENDMODE_BLEND);
+
+    // Apply render scale to scale the font
+    SDL_SetRenderScale(debug_renderer, scale, scale);
+
+    // Render all characters
+    const u32 count = SDL_min(flDebugStrCtr, MAX_CHARS);
+
+    if (atlas != NULL) {
+        render_batched(buff_ptr, count);
+    } else {
+        render_unbatched(buff_ptr, count);
+    }
 
     // Reset render scale
     SDL_SetRenderScale(debug_renderer, 1.0f, 1.0f);
@@ -86,6 +275,7 @@ void SDLDebugText_Render() {
 }
 
 void SDLDebugText_Destroy() {
+    destroy_atlas();
     debug_renderer = NULL;
 }
 
@@ -45,19 +45,22 @@ typedef struct ADXLoopInfo {
 
 typedef struct ADXTrack {
     int size;
-    uint8_t* data;
-    bool should_free_data_after_use;
+    const uint8_t* data;
+    uint8_t* allocated_data; // Set when the data was read for the track and has to be freed
     int used_bytes;
     int processed_samples;
     ADXLoopInfo loop_info;
     ADXDecoderPipeline pipeline;
 } ADXTrack;
 
+static const SDL_AudioSpec output_spec = { .format = SDL_AUDIO_S16, .channels = N_CHANNELS, .freq = SAMPLE_RATE };
 static SDL_AudioStream* stream = NULL;
 static ADXTrack tracks[TRACKS_MAX] = { 0 };
 static int num_tracks = 0;
 static int first_track_index = 0;
 static bool has_tracks = false;
+static bool is_capturing = false;
+static bool is_capture_paused = false;
 
 static int stream_data_needed() {
     return MIN_QUEUED_DATA - SDL_GetAudioStreamQueued(stream);
@@ -101,17 +104,29 @@ static void pipeline_destroy(ADXDecoderPipeline* pipeline) {
     av_parser_close(pipeline->parser_context);
 }
 
-static void* load_file(int file_id, int* size) {
+/// @return The buffer that was allocated for the data, or `NULL` if it's read from the mapped archive.
+static uint8_t* load_file(int file_id, const uint8_t** data, int* size) {
     // FIXME: Remove dependency on GD3rd.h
     const unsigned int file_size = fsGetFileSize(file_id);
     *size = file_size;
+
+    // Tracks are only ever read from, so they can be decoded straight from the mapped archive
+    const void* mapped_data = AFS_GetData(file_id);
+
+    if (mapped_data != NULL) {
+        AFS_Prefetch(file_id);
+        *data = mapped_data;
+        return NULL;
+    }
+
     const size_t buff_size = (file_size + 2048 - 1) & ~(2048 - 1); // AFS reads data in 2048-byte chunks
-    void* buff = malloc(buff_size);
+    uint8_t* buff = malloc(buff_size);
 
     AFSHandle handle = AFS_Open(file_id);
     AFS_ReadSync(handle, fsCalSectorSize(file_size), buff);
     AFS_Close(handle);
 
+    *data = buff;
     return buff;
 }
 
@@ -308,12 +323,11 @@ static void track_init(ADXTrack* track, int file_id, void* buf, size_t buf_size,
     }
 
     if (file_id != -1) {
-        track->data = load_file(file_id, &track->size);
-        track->should_free_data_after_use = true;
+        track->allocated_data = load_file(file_id, &track->data, &track->size);
     } else {
         track->data = buf;
         track->size = buf_size;
-        track->should_free_data_after_use = false;
+        track->allocated_data = NULL;
     }
 
     track->used_bytes = 0;
@@ -330,10 +344,7 @@ static void track_destroy(ADXTrack* track) {
     pipeline_destroy(&track->pipeline);
     loop_info_destroy(&track->loop_info);
 
-    if (track->should_free_data_after_use) {
-        free(track->data);
-    }
-
+    free(track->allocated_data);
     SDL_zerop(track);
 }
 
@@ -370,8 +381,7 @@ void ADX_ProcessTracks() {
 }
 
 void ADX_Init() {
-    const SDL_AudioSpec spec = { .format = SDL_AUDIO_S16, .channels = N_CHANNELS, .freq = SAMPLE_RATE };
-    stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, NULL, NULL);
+    stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &output_spec, NULL, NULL);
 }
 
 void ADX_Exit() {
@@ -394,11 +404,17 @@ void ADX_Stop() {
 }
 
 int ADX_IsPaused() {
+    if (is_capturing) {
+        return is_capture_paused;
+    }
+
     return SDL_AudioStreamDevicePaused(stream);
 }
 
 void ADX_Pause(int pause) {
-    if (pause) {
+    if (is_capturing) {
+        is_capture_paused = pause;
+    } else if (pause) {
         SDL_PauseAudioStreamDevice(stream);
     } else {
         SDL_ResumeAudioStreamDevice(stream);
@@ -461,3 +477,24 @@ ADXState ADX_GetState() {
         }
     }
 }
+
+void ADX_BeginCapture() {
+    is_capture_paused = SDL_AudioStreamDevicePaused(stream);
+    is_capturing = true;
+
+    // Keep decoding into the same stream, but take samples out of it in the same format they went in
+    SDL_UnbindAudioStream(stream);
+    SDL_SetAudioStreamFormat(stream, NULL, &output_spec);
+}
+
+void ADX_ReadCapture(s16* output, int samples_per_channel) {
+    const int size = samples_per_channel * N_CHANNELS * BYTES_PER_SAMPLE;
+    int read = 0;
+
+    if (!is_capture_paused) {
+        read = SDL_max(SDL_GetAudioStreamData(stream, output, size), 0);
+    }
+
+    // Underruns and pauses come out as silence
+    SDL_memset((u8*)output + read, 0, size - read);
+}
@@ -1,6 +1,8 @@
 #ifndef SOUND_ADX_H
 #define SOUND_ADX_H
 
+#include "types.h"
+
 #include <stdbool.h>
 #include <stddef.h>
 
@@ -27,4 +29,10 @@ void ADX_SetOutVol(int volume);
 void ADX_SetMono(bool mono);
 ADXState ADX_GetState();
 
+/// Detach the stream from the audio device. Decoded samples are then only taken out by `ADX_ReadCapture`.
+void ADX_BeginCapture();
+
+/// Take interleaved stereo samples at 48 kHz out of the stream. Only call after `ADX_BeginCapture`.
+void ADX_ReadCapture(s16* output, int samples_per_channel);
+
 #endif
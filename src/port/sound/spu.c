@@ -311,32 +311,35 @@ void SPU_VoiceStart(int vnum, u32 start_addr) {
     v->nax = (v->nax + 1) & 0xfffff;
 }
 
-void SPU_SDL_CB(void* user, SDL_AudioStream* stream, int additional_amount, int total_amount) {
-    u32 samples_per_channel = (additional_amount / sizeof(s16)) >> 1;
-    static s16 outbuf[4096] = {};
-
+/// Produce stereo samples and run the eml callback in step with them
+static void mix(s16* output, u32 samples_per_channel) {
     // We need to run the eml callbaack at 250hz
     // 48000 / 250 = 192
     static int cb_timer = 192;
 
+    for (int i = 0; i < samples_per_channel; i++) {
+        SPU_Tick(output);
+        output += 2;
+
+        cb_timer--;
+        if (!cb_timer) {
+            timer_cb();
+            cb_timer = 192;
+        }
+    }
+}
+
+void SPU_SDL_CB(void* user, SDL_AudioStream* stream, int additional_amount, int total_amount) {
+    u32 samples_per_channel = (additional_amount / sizeof(s16)) >> 1;
+    static s16 outbuf[4096 * 2] = {};
+
     // TODO consider redesigning this whole system, emlshim and spu should probably run
     // on the same thread, no locks would be needed in the SDL audio callback path
     SDL_LockMutex(soundLock);
 
     while (samples_per_channel) {
         u32 batch_count = min(samples_per_channel, 4096);
-        s16* p = outbuf;
-        for (int i = 0; i < batch_count; i++) {
-            SPU_Tick(p);
-            p += 2;
-
-            cb_timer--;
-            if (!cb_timer) {
-                timer_cb();
-                cb_timer = 192;
-            }
-        }
-
+        mix(outbuf, batch_count);
         SDL_PutAudioStreamData(stream, outbuf, (batch_count * sizeof(s16)) << 1);
         samples_per_channel -= batch_count;
     }
@@ -344,6 +347,16 @@ void SPU_SDL_CB(void* user, SDL_AudioStream* stream, int additional_amount, int
     SDL_UnlockMutex(soundLock);
 }
 
+void SPU_BeginCapture() {
+    SDL_PauseAudioStreamDevice(stream);
+}
+
+void SPU_Render(s16* output, int samples_per_channel) {
+    SDL_LockMutex(soundLock);
+    mix(output, samples_per_channel);
+    SDL_UnlockMutex(soundLock);
+}
+
 static void nullcb() {}
 
 void SPU_Init(void (*cb)()) {
@@ -0,0 +1,52 @@
+#include "port/startup_trace.h"
+
+#include <SDL3/SDL.h>
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#define PHASES_MAX 32
+
+typedef struct StartupPhase {
+    const char* name;
+    Uint64 end_ns;
+} StartupPhase;
+
+static Uint64 start_ns = 0;
+static StartupPhase phases[PHASES_MAX] = { 0 };
+static int phase_count = 0;
+static bool is_finished = false;
+
+void StartupTrace_Begin() {
+    start_ns = SDL_GetTicksNS();
+}
+
+void StartupTrace_Mark(const char* phase) {
+    if (is_finished || (phase_count >= PHASES_MAX)) {
+        return;
+    }
+
+    phases[phase_count].name = phase;
+    phases[phase_count].end_ns = SDL_GetTicksNS();
+    phase_count += 1;
+}
+
+void StartupTrace_Finish() {
+    if (is_finished) {
+        return;
+    }
+
+    StartupTrace_Mark("first frame presented");
+    is_finished = true;
+
+    Uint64 previous_ns = start_ns;
+
+    for (int i = 0; i < phase_count; i++) {
+        const StartupPhase* phase = &phases[i];
+        printf("⏱️ startup: %-28s %8.1f ms (+%.1f ms)\n",
+               phase->name,
+               (phase->end_ns - start_ns) / 1000000.0,
+               (phase->end_ns - previous_ns) / 1000000.0);
+        previous_ns = phase->end_ns;
+    }
+}
@@ -0,0 +1,14 @@
+#ifndef PORT_STARTUP_TRACE_H
+#define PORT_STARTUP_TRACE_H
+
+/// Start timing startup. Call as early as possible.
+void StartupTrace_Begin();
+
+/// Record that a startup phase has finished
+void StartupTrace_Mark(const char* phase);
+
+/// Print how long each phase took. Call once the first game frame has been presented. Calls after the first one do
+/// nothing.
+void StartupTrace_Finish();
+
+#endif
@@ -0,0 +1,168 @@
+#include "port/training_states.h"
+#include "netplay/game_state.h"
+#include "sf33rd/Source/Game/engine/workuser.h"
+#include "sf33rd/Source/Game/io/gd3rd.h"
+
+#include <SDL3/SDL.h>
+
+#include <stdbool.h>
+#include <stdio.h>
+
+// Save states for training mode, built on the same snapshots that netplay rolls back with. Snapshots hold pointers
+// into loaded character and stage data, so they are only restored while that data hasn't been reloaded.
+
+#define ROUND_START_SLOT TRAINING_STATE_SLOTS
+#define NO_SLOT -1
+
+typedef enum TrainingStateAction {
+    TRAINING_STATE_NONE,
+    TRAINING_STATE_SAVE,
+    TRAINING_STATE_LOAD,
+} TrainingStateAction;
+
+typedef struct TrainingState {
+    bool is_used;
+    u32 load_generation;
+    GameState* gs; // Allocated on first save, since the size of the game state is only known at runtime
+    EffectState es;
+} TrainingState;
+
+static TrainingState slots[TRAINING_STATE_SLOTS + 1] = { 0 };
+static TrainingStateAction pending_action = TRAINING_STATE_NONE;
+static int pending_slot = NO_SLOT;
+static int last_slot = ROUND_START_SLOT;
+static bool was_battle_allowed = false;
+
+static bool is_training() {
+    return (Mode_Type == MODE_NORMAL_TRAINING) || (Mode_Type == MODE_PARRY_TRAINING);
+}
+
+/// @return Whether the round is running and the game isn't paused.
+static bool is_in_control() {
+    return is_training() && (Allow_a_battle_f != 0) && (Game_pause == 0);
+}
+
+static bool is_valid_slot(int slot) {
+    return (slot >= 0) && (slot <= ROUND_START_SLOT);
+}
+
+static bool save(int slot) {
+    TrainingState* state = &slots[slot];
+
+    if (state->gs == NULL) {
+        state->gs = SDL_malloc(GameState_GetSize());
+
+        if (state->gs == NULL) {
+            return false;
+        }
+    }
+
+    GameState_Save(state->gs);
+    EffectState_Save(&state->es);
+    state->load_generation = Get_LDREQ_Generation();
+    state->is_used = true;
+    return true;
+}
+
+static bool load(int slot) {
+    const TrainingState* state = &slots[slot];
+
+    if (!state->is_used || (state->load_generation != Get_LDREQ_Generation())) {
+        return false;
+    }
+
+    GameState_Load(state->gs);
+    EffectState_Load(&state->es);
+    return true;
+}
+
+void TrainingStates_RequestSave(int slot) {
+    if ((slot < 0) || (slot >= TRAINING_STATE_SLOTS)) {
+        return;
+    }
+
+    pending_action = TRAINING_STATE_SAVE;
+    pending_slot = slot;
+}
+
+void TrainingStates_RequestLoad(int slot) {
+    if ((slot < 0) || (slot >= TRAINING_STATE_SLOTS)) {
+        return;
+    }
+
+    pending_action = TRAINING_STATE_LOAD;
+    pending_slot = slot;
+}
+
+void TrainingStates_RequestReset() {
+    pending_action = TRAINING_STATE_LOAD;
+    pending_slot = last_slot;
+}
+
+static void run_pending_action() {
+    const Uint64 start = SDL_GetTicksNS();
+
+    switch (pending_action) {
+    case TRAINING_STATE_NONE:
+        break;
+
+    case TRAINING_STATE_SAVE:
+        if (!save(pending_slot)) {
+            printf("⚠️ couldn't allocate training state %d\n", pending_slot + 1);
+            break;
+        }
+
+        last_slot = pending_slot;
+        printf("💾 saved training state %d\n", pending_slot + 1);
+        break;
+
+    case TRAINING_STATE_LOAD:
+        if (!load(pending_slot)) {
+            printf("⚠️ training state %d is empty or belongs to another match\n", pending_slot + 1);
+            break;
+        }
+
+        last_slot = pending_slot;
+
+        if (pending_slot == ROUND_START_SLOT) {
+            printf("⏪ reset to the start of the round in %.3f ms\n", (SDL_GetTicksNS() - start) / 1000000.0);
+        } else {
+            printf("⏪ loaded training state %d in %.3f ms\n",
+                   pending_slot + 1,
+                   (SDL_GetTicksNS() - start) / 1000000.0);
+        }
+
+        break;
+    }
+}
+
+static void clear_slots() {
+    for (int i = 0; i < SDL_arraysize(slots); i++) {
+        slots[i].is_used = false;
+    }
+
+    last_slot = ROUND_START_SLOT;
+}
+
+void TrainingStates_Update() {
+    if (!is_training()) {
+        // Leaving training mode means going back through character select, which reloads everything
+        clear_slots();
+    }
+
+    // Keep the start of each round around so that resetting works before anything has been saved
+    const bool is_battle_allowed = is_training() && (Allow_a_battle_f != 0);
+
+    if (is_battle_allowed && !was_battle_allowed) {
+        save(ROUND_START_SLOT);
+    }
+
+    was_battle_allowed = is_battle_allowed;
+
+    if ((pending_action != TRAINING_STATE_NONE) && is_in_control() && is_valid_slot(pending_slot)) {
+        run_pending_action();
+    }
+
+    pending_action = TRAINING_STATE_NONE;
+    pending_slot = NO_SLOT;
+}
@@ -0,0 +1,19 @@
+#ifndef PORT_TRAINING_STATES_H
+#define PORT_TRAINING_STATES_H
+
+/// Number of slots players can save to. The start of the current round is kept in an extra slot.
+#define TRAINING_STATE_SLOTS 4
+
+/// Save the current position to a slot at the start of the next frame
+void TrainingStates_RequestSave(int slot);
+
+/// Restore the position from a slot at the start of the next frame
+void TrainingStates_RequestLoad(int slot);
+
+/// Restore the slot that was saved or loaded last, or the start of the round if there's none
+void TrainingStates_RequestReset();
+
+/// Carry out pending requests. Call before the game reads inputs for the frame.
+void TrainingStates_Update();
+
+#endif
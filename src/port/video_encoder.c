@@ -0,0 +1,490 @@
+#include "port/video_encoder.h"
+
+#include <SDL3/SDL.h>
+
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+#include <libavutil/audio_fifo.h>
+#include <libavutil/avutil.h>
+#include <libavutil/channel_layout.h>
+
+#include <stdio.h>
+
+// Frames go through a ring of slots. The game fills a slot and moves on, the encoder thread converts it to YUV,
+// encodes it and muxes the packets. The game only waits when every slot is still waiting to be encoded.
+
+#define QUEUE_FRAMES 8
+#define VIDEO_QUALITY 2 // MPEG-4 quantizer, from 1 (best) to 31
+#define GOP_FRAMES 60
+#define AUDIO_BIT_RATE 192000
+#define CHANNELS 2
+
+struct VideoEncoder {
+    VideoEncoderParams params;
+    bool has_failed;
+    bool is_header_written;
+
+    AVFormatContext* format;
+    AVCodecContext* video;
+    AVCodecContext* audio;
+    AVStream* video_stream;
+    AVStream* audio_stream;
+    AVFrame* video_frame;
+    AVFrame* audio_frame;
+    AVPacket* packet;
+    AVAudioFifo* fifo;
+    Sint64 audio_pts;
+    float planar_samples[CHANNELS][VIDEO_ENCODER_SAMPLES_MAX];
+
+    SDL_Thread* thread;
+    SDL_Mutex* mutex;
+    SDL_Condition* condition;
+    VideoEncoderFrame slots[QUEUE_FRAMES];
+    int submitted_frames;
+    int encoded_frames;
+    int stall_count;
+    bool is_closing;
+};
+
+static void fail(VideoEncoder* encoder, const char* action, int error) {
+    if (!encoder->has_failed) {
+        printf("⚠️ couldn't %s: %s\n", action, av_err2str(error));
+    }
+
+    encoder->has_failed = true;
+}
+
+static void write_packets(VideoEncoder* encoder, AVCodecContext* context, AVStream* stream) {
+    while (true) {
+        const int ret = avcodec_receive_packet(context, encoder->packet);
+
+        if ((ret == AVERROR(EAGAIN)) || (ret == AVERROR_EOF)) {
+            return;
+        }
+
+        if (ret < 0) {
+            fail(encoder, "encode frames", ret);
+            return;
+        }
+
+        av_packet_rescale_ts(encoder->packet, context->time_base, stream->time_base);
+        encoder->packet->stream_index = stream->index;
+
+        // Takes ownership of the packet data
+        const int write_ret = av_interleaved_write_frame(encoder->format, encoder->packet);
+
+        if (write_ret < 0) {
+            fail(encoder, "write the video file", write_ret);
+        }
+    }
+}
+
+/// Send a frame to an encoder and mux whatever comes out. `NULL` flushes the encoder.
+static void encode(VideoEncoder* encoder, AVCodecContext* context, AVStream* stream, const AVFrame* frame) {
+    const int ret = avcodec_send_frame(context, frame);
+
+    if (ret < 0) {
+        fail(encoder, "encode frames", ret);
+        return;
+    }
+
+    write_packets(encoder, context, stream);
+}
+
+/// Convert RGBA to BT.601 YUV 4:2:0 and upscale at the same time
+static void convert_to_yuv(VideoEncoder* encoder, const u8* pixels) {
+    const int scale = encoder->params.scale;
+    const int pitch = encoder->params.width * 4;
+    AVFrame* frame = encoder->video_frame;
+
+    for (int y = 0; y < frame->height; y++) {
+        const u8* row = pixels + (y / scale) * pitch;
+        u8* luma = frame->data[0] + y * frame->linesize[0];
+
+        for (int x = 0; x < frame->width; x++) {
+            const u8* p = row + (x / scale) * 4;
+            luma[x] = ((66 * p[0] + 129 * p[1] + 25 * p[2] + 128) >> 8) + 16;
+        }
+    }
+
+    for (int y = 0; y < frame->height / 2; y++) {
+        const u8* row = pixels + (y * 2 / scale) * pitch;
+        u8* cb = frame->data[1] + y * frame->linesize[1];
+        u8* cr = frame->data[2] + y * frame->linesize[2];
+
+        for (int x = 0; x < frame->width / 2; x++) {
+            const u8* p = row + (x * 2 / scale) * 4;
+            cb[x] = ((-38 * p[0] - 74 * p[1] + 112 * p[2] + 128) >> 8) + 128;
+            cr[x] = ((112 * p[0] - 94 * p[1] - 18 * p[2] + 128) >> 8) + 128;
+        }
+    }
+}
+
+static void encode_video(VideoEncoder* encoder, const VideoEncoderFrame* frame, int index) {
+    const int ret = av_frame_make_writable(encoder->video_frame);
+
+    if (ret < 0) {
+        fail(encoder, "encode video", ret);
+        return;
+    }
+
+    convert_to_yuv(encoder, frame->pixels);
+    encoder->video_frame->pts = index;
+    encode(encoder, encoder->video, encoder->video_stream, encoder->video_frame);
+}
+
+/// Encode one frame worth of samples from the FIFO. The last frame is padded with silence.
+static void encode_audio_frame(VideoEncoder* encoder) {
+    AVFrame* frame = encoder->audio_frame;
+    const int ret = av_frame_make_writable(frame);
+
+    if (ret < 0) {
+        fail(encoder, "encode audio", ret);
+        return;
+    }
+
+    const int read = SDL_max(av_audio_fifo_read(encoder->fifo, (void**)frame->data, frame->nb_samples), 0);
+
+    for (int i = 0; i < CHANNELS; i++) {
+        SDL_memset((float*)frame->data[i] + read, 0, (frame->nb_samples - read) * sizeof(float));
+    }
+
+    frame->pts = encoder->audio_pts;
+    encoder->audio_pts += frame->nb_samples;
+    encode(encoder, encoder->audio, encoder->audio_stream, frame);
+}
+
+static void encode_audio(VideoEncoder* encoder, const VideoEncoderFrame* frame) {
+    const int sample_count = SDL_min(frame->sample_count, VIDEO_ENCODER_SAMPLES_MAX);
+    float* planes[CHANNELS] = { encoder->planar_samples[0], encoder->planar_samples[1] };
+
+    for (int i = 0; i < sample_count; i++) {
+        for (int j = 0; j < CHANNELS; j++) {
+            planes[j][i] = frame->samples[i * CHANNELS + j] / 32768.0f;
+        }
+    }
+
+    if (av_audio_fifo_write(encoder->fifo, (void**)planes, sample_count) < sample_count) {
+        fail(encoder, "encode audio", AVERROR(ENOMEM));
+        return;
+    }
+
+    while (av_audio_fifo_size(encoder->fifo) >= encoder->audio_frame->nb_samples) {
+        encode_audio_frame(encoder);
+    }
+}
+
+static int SDLCALL run_encoder_thread(void* data) {
+    VideoEncoder* encoder = data;
+
+    SDL_LockMutex(encoder->mutex);
+
+    while (true) {
+        while ((encoder->encoded_frames == encoder->submitted_frames) && !encoder->is_closing) {
+            SDL_WaitCondition(encoder->condition, encoder->mutex);
+        }
+
+        if (encoder->encoded_frames == encoder->submitted_frames) {
+            break;
+        }
+
+        const int index = encoder->encoded_frames;
+        SDL_UnlockMutex(encoder->mutex);
+
+        // Keep taking frames after a failure, so that the game doesn't wait on a queue that never drains
+        const VideoEncoderFrame* frame = &encoder->slots[index % QUEUE_FRAMES];
+
+        if (!encoder->has_failed) {
+            encode_video(encoder, frame, index);
+            encode_audio(encoder, frame);
+        }
+
+        SDL_LockMutex(encoder->mutex);
+        encoder->encoded_frames += 1;
+        SDL_BroadcastCondition(encoder->condition);
+    }
+
+    SDL_UnlockMutex(encoder->mutex);
+    return 0;
+}
+
+static bool set_error(const char* action, int error) {
+    SDL_SetError("couldn't %s: %s", action, av_err2str(error));
+    return false;
+}
+
+static AVStream* add_stream(VideoEncoder* encoder, AVCodecContext* context) {
+    AVStream* stream = avformat_new_stream(encoder->format, NULL);
+
+    if ((stream == NULL) || (avcodec_parameters_from_context(stream->codecpar, context) < 0)) {
+        return NULL;
+    }
+
+    stream->time_base = context->time_base;
+    stream->sample_aspect_ratio = context->sample_aspect_ratio;
+    return stream;
+}
+
+static bool open_video(VideoEncoder* encoder) {
+    const VideoEncoderParams* params = &encoder->params;
+    const AVCodec* codec = avcodec_find_encoder(AV_CODEC_ID_MPEG4);
+
+    if (codec == NULL) {
+        return SDL_SetError("FFmpeg was built without the MPEG-4 encoder");
+    }
+
+    AVCodecContext* context = avcodec_alloc_context3(codec);
+    encoder->video = context;
+
+    if (context == NULL) {
+        return SDL_OutOfMemory();
+    }
+
+    context->width = params->width * params->scale;
+    context->height = params->height * params->scale;
+    context->pix_fmt = AV_PIX_FMT_YUV420P;
+
+    // MPEG-4 can't have time bases with denominators above 16 bits
+    context->framerate = av_d2q(params->frame_rate, 65535);
+    context->time_base = av_inv_q(context->framerate);
+    context->gop_size = GOP_FRAMES;
+    context->flags |= AV_CODEC_FLAG_QSCALE;
+    context->global_quality = FF_QP2LAMBDA * VIDEO_QUALITY;
+
+    if (params->display_aspect_ratio > 0) {
+        context->sample_aspect_ratio =
+            av_d2q(params->display_aspect_ratio * params->height / params->width, 255);
+    }
+
+    if (encoder->format->oformat->flags & AVFMT_GLOBALHEADER) {
+        context->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+    }
+
+    int ret = avcodec_open2(context, codec, NULL);
+
+    if (ret < 0) {
+        return set_error("open the video encoder", ret);
+    }
+
+    encoder->video_stream = add_stream(encoder, context);
+    encoder->video_frame = av_frame_alloc();
+
+    if ((encoder->video_stream == NULL) || (encoder->video_frame == NULL)) {
+        return SDL_OutOfMemory();
+    }
+
+    encoder->video_frame->format = context->pix_fmt;
+    encoder->video_frame->width = context->width;
+    encoder->video_frame->height = context->height;
+    ret = av_frame_get_buffer(encoder->video_frame, 0);
+    return (ret >= 0) || set_error("allocate video frames", ret);
+}
+
+static bool open_audio(VideoEncoder* encoder) {
+    const AVCodec* codec = avcodec_find_encoder(AV_CODEC_ID_AAC);
+
+    if (codec == NULL) {
+        return SDL_SetError("FFmpeg was built without the AAC encoder");
+    }
+
+    AVCodecContext* context = avcodec_alloc_context3(codec);
+    encoder->audio = context;
+
+    if (context == NULL) {
+        return SDL_OutOfMemory();
+    }
+
+    context->sample_fmt = AV_SAMPLE_FMT_FLTP;
+    context->sample_rate = VIDEO_ENCODER_SAMPLE_RATE;
+    context->time_base = (AVRational) { 1, VIDEO_ENCODER_SAMPLE_RATE };
+    context->bit_rate = AUDIO_BIT_RATE;
+    av_channel_layout_copy(&context->ch_layout, &(AVChannelLayout)AV_CHANNEL_LAYOUT_STEREO);
+
+    if (encoder->format->oformat->flags & AVFMT_GLOBALHEADER) {
+        context->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+    }
+
+    int ret = avcodec_open2(context, codec, NULL);
+
+    if (ret < 0) {
+        return set_error("open the audio encoder", ret);
+    }
+
+    encoder->audio_stream = add_stream(encoder, context);
+    encoder->audio_frame = av_frame_alloc();
+    encoder->fifo = av_audio_fifo_alloc(context->sample_fmt, CHANNELS, VIDEO_ENCODER_SAMPLES_MAX * 2);
+
+    if ((encoder->audio_stream == NULL) || (encoder->audio_frame == NULL) || (encoder->fifo == NULL)) {
+        return SDL_OutOfMemory();
+    }
+
+    // Encoders that take any number of samples report a frame size of 0
+    const bool is_size_fixed = !(codec->capabilities & AV_CODEC_CAP_VARIABLE_FRAME_SIZE);
+    encoder->audio_frame->nb_samples = is_size_fixed ? context->frame_size : VIDEO_ENCODER_SAMPLES_MAX;
+    encoder->audio_frame->format = context->sample_fmt;
+    encoder->audio_frame->sample_rate = context->sample_rate;
+    av_channel_layout_copy(&encoder->audio_frame->ch_layout, &context->ch_layout);
+    ret = av_frame_get_buffer(encoder->audio_frame, 0);
+    return (ret >= 0) || set_error("allocate audio frames", ret);
+}
+
+static bool open_file(VideoEncoder* encoder) {
+    int ret = avformat_alloc_output_context2(&encoder->format, NULL, "mp4", encoder->params.path);
+
+    if (ret < 0) {
+        return set_error("create the video file", ret);
+    }
+
+    if (!open_video(encoder) || !open_audio(encoder)) {
+        return false;
+    }
+
+    encoder->packet = av_packet_alloc();
+
+    if (encoder->packet == NULL) {
+        return SDL_OutOfMemory();
+    }
+
+    ret = avio_open(&encoder->format->pb, encoder->params.path, AVIO_FLAG_WRITE);
+
+    if (ret < 0) {
+        return set_error("create the video file", ret);
+    }
+
+    ret = avformat_write_header(encoder->format, NULL);
+
+    if (ret < 0) {
+        return set_error("write the video header", ret);
+    }
+
+    encoder->is_header_written = true;
+    return true;
+}
+
+static bool alloc_slots(VideoEncoder* encoder) {
+    const size_t pixels_size = encoder->params.width * encoder->params.height * 4;
+
+    for (int i = 0; i < QUEUE_FRAMES; i++) {
+        VideoEncoderFrame* slot = &encoder->slots[i];
+        slot->pixels = SDL_malloc(pixels_size);
+        slot->samples = SDL_malloc(VIDEO_ENCODER_SAMPLES_MAX * CHANNELS * sizeof(s16));
+
+        if ((slot->pixels == NULL) || (slot->samples == NULL)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+VideoEncoder* VideoEncoder_Open(const VideoEncoderParams* params) {
+    VideoEncoder* encoder = SDL_calloc(1, sizeof(VideoEncoder));
+
+    if (encoder == NULL) {
+        return NULL;
+    }
+
+    SDL_copyp(&encoder->params, params);
+    encoder->params.scale = SDL_max(params->scale, 1);
+
+    if (!open_file(encoder)) {
+        VideoEncoder_Close(encoder);
+        return NULL;
+    }
+
+    encoder->mutex = SDL_CreateMutex();
+    encoder->condition = SDL_CreateCondition();
+
+    if ((encoder->mutex == NULL) || (encoder->condition == NULL) || !alloc_slots(encoder)) {
+        VideoEncoder_Close(encoder);
+        return NULL;
+    }
+
+    encoder->thread = SDL_CreateThread(run_encoder_thread, "video encoder", encoder);
+
+    if (encoder->thread == NULL) {
+        VideoEncoder_Close(encoder);
+        return NULL;
+    }
+
+    return encoder;
+}
+
+VideoEncoderFrame* VideoEncoder_BeginFrame(VideoEncoder* encoder) {
+    SDL_LockMutex(encoder->mutex);
+
+    if ((encoder->submitted_frames - encoder->encoded_frames) >= QUEUE_FRAMES) {
+        encoder->stall_count += 1;
+    }
+
+    while ((encoder->submitted_frames - encoder->encoded_frames) >= QUEUE_FRAMES) {
+        SDL_WaitCondition(encoder->condition, encoder->mutex);
+    }
+
+    VideoEncoderFrame* frame = &encoder->slots[encoder->submitted_frames % QUEUE_FRAMES];
+    SDL_UnlockMutex(encoder->mutex);
+    return frame;
+}
+
+void VideoEncoder_SubmitFrame(VideoEncoder* encoder) {
+    SDL_LockMutex(encoder->mutex);
+    encoder->submitted_frames += 1;
+    SDL_BroadcastCondition(encoder->condition);
+    SDL_UnlockMutex(encoder->mutex);
+}
+
+int VideoEncoder_GetStallCount(const VideoEncoder* encoder) {
+    return encoder->stall_count;
+}
+
+bool VideoEncoder_Close(VideoEncoder* encoder) {
+    if (encoder == NULL) {
+        return false;
+    }
+
+    if (encoder->thread != NULL) {
+        SDL_LockMutex(encoder->mutex);
+        encoder->is_closing = true;
+        SDL_BroadcastCondition(encoder->condition);
+        SDL_UnlockMutex(encoder->mutex);
+        SDL_WaitThread(encoder->thread, NULL);
+    }
+
+    if (encoder->is_header_written) {
+        if (av_audio_fifo_size(encoder->fifo) > 0) {
+            encode_audio_frame(encoder);
+        }
+
+        encode(encoder, encoder->video, encoder->video_stream, NULL);
+        encode(encoder, encoder->audio, encoder->audio_stream, NULL);
+
+        const int ret = av_write_trailer(encoder->format);
+
+        if (ret < 0) {
+            fail(encoder, "finish the video file", ret);
+        }
+    }
+
+    const bool succeeded = encoder->is_header_written && !encoder->has_failed;
+
+    if (encoder->format != NULL) {
+        avio_closep(&encoder->format->pb);
+    }
+
+    for (int i = 0; i < QUEUE_FRAMES; i++) {
+        SDL_free(encoder->slots[i].pixels);
+        SDL_free(encoder->slots[i].samples);
+    }
+
+    avcodec_free_context(&encoder->video);
+    avcodec_free_context(&encoder->audio);
+    av_frame_free(&encoder->video_frame);
+    av_frame_free(&encoder->audio_frame);
+    av_packet_free(&encoder->packet);
+    av_audio_fifo_free(encoder->fifo);
+    avformat_free_context(encoder->format);
+    SDL_DestroyCondition(encoder->condition);
+    SDL_DestroyMutex(encoder->mutex);
+    SDL_free(encoder);
+    return succeeded;
+}
@@ -0,0 +1,46 @@
+#ifndef PORT_VIDEO_ENCODER_H
+#define PORT_VIDEO_ENCODER_H
+
+#include "types.h"
+
+#include <stdbool.h>
+
+#define VIDEO_ENCODER_SAMPLE_RATE 48000
+#define VIDEO_ENCODER_SAMPLES_MAX 1024 // Per channel, in a single frame
+
+typedef struct VideoEncoderParams {
+    const char* path;
+    int width;                   // Size of the frames that are passed in
+    int height;
+    int scale;                   // Frames are upscaled by this factor with nearest neighbour filtering
+    double frame_rate;
+    double display_aspect_ratio; // Aspect ratio players stretch the video to, or `0` for square pixels
+} VideoEncoderParams;
+
+/// One frame of video and the audio that plays along with it
+typedef struct VideoEncoderFrame {
+    u8* pixels;       // RGBA32 without padding between rows
+    s16* samples;     // Interleaved stereo at `VIDEO_ENCODER_SAMPLE_RATE`
+    int sample_count; // Per channel
+} VideoEncoderFrame;
+
+typedef struct VideoEncoder VideoEncoder;
+
+/// Create an MP4 file with MPEG-4 video and AAC audio. Frames are encoded on a thread of their own.
+/// @return The encoder, or `NULL` if the file couldn't be created. `SDL_GetError` tells why.
+VideoEncoder* VideoEncoder_Open(const VideoEncoderParams* params);
+
+/// Get the next frame to fill in. Blocks only while the encoder is a full queue of frames behind.
+VideoEncoderFrame* VideoEncoder_BeginFrame(VideoEncoder* encoder);
+
+/// Hand the frame from `VideoEncoder_BeginFrame` over to the encoder thread
+void VideoEncoder_SubmitFrame(VideoEncoder* encoder);
+
+/// @return How many times `VideoEncoder_BeginFrame` had to wait for the encoder thread.
+int VideoEncoder_GetStallCount(const VideoEncoder* encoder);
+
+/// Encode the frames that are still queued, finish the file and free the encoder
+/// @return Whether every frame made it into the file.
+bool VideoEncoder_Close(VideoEncoder* encoder);
+
+#endif
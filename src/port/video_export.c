@@ -0,0 +1,313 @@
+#include "port/video_export.h"
+#include "main.h"
+#include "netplay/game_state.h"
+#include "port/autostart.h"
+#include "port/replay_file.h"
+#include "port/replays.h"
+#include "port/sdl/sdl_app.h"
+#include "port/sound/adx.h"
+#include "port/sound/spu.h"
+#include "port/video_encoder.h"
+#include "sf33rd/Source/Game/engine/workuser.h"
+#include "sf33rd/Source/Game/system/work_sys.h"
+
+#include <SDL3/SDL.h>
+
+#include <stdio.h>
+
+// Boots into a versus match with the characters and stage of the replay, restores its first keyframe and feeds it the
+// recorded inputs. Pacing is off, so frames run as fast as they can be simulated, drawn and handed to the encoder.
+//
+// Sound normally runs off the audio device's clock. While exporting, the SPU and ADX streams are detached from the
+// device and pulled once per frame instead, so audio stays in step with frames no matter how fast they run.
+
+#define DISPLAY_ASPECT_RATIO (4.0 / 3.0)
+
+typedef enum VideoExportState {
+    VIDEO_EXPORT_INACTIVE,
+    VIDEO_EXPORT_BOOTING,
+    VIDEO_EXPORT_SELECTING, // Going through character select
+    VIDEO_EXPORT_PLAYING,
+    VIDEO_EXPORT_FINISHED,
+} VideoExportState;
+
+static VideoExportState state = VIDEO_EXPORT_INACTIVE;
+static VideoExportParams params = { 0 };
+static ReplayFile* file = NULL;
+static AutostartSetup autostart_setup = { 0 };
+static VideoEncoder* encoder = NULL;
+static void* snapshot = NULL;
+
+static int frame = 0;
+static int state_frame = 0; // Frame the current state was entered on
+static int played_frames = 0;
+static int captured_frames = 0;
+static Uint64 audio_frames = 0; // Frames that audio has been produced for
+static bool is_capturing_audio = false;
+static Uint64 playback_start_time = 0;
+
+static SDL_Texture* target = NULL;
+static VideoEncoderFrame* pending_frame = NULL; // Waiting for its picture to be read back
+static s16 discarded_samples[VIDEO_ENCODER_SAMPLES_MAX * 2];
+static s16 adx_samples[VIDEO_ENCODER_SAMPLES_MAX * 2];
+
+static void enter_state(VideoExportState new_state) {
+    state = new_state;
+    state_frame = frame;
+}
+
+static void finish(bool completed) {
+    const int stall_count = (encoder != NULL) ? VideoEncoder_GetStallCount(encoder) : 0;
+    const bool is_written = VideoEncoder_Close(encoder) && completed;
+    const double seconds = (SDL_GetTicksNS() - playback_start_time) / 1e9;
+
+    if (is_written) {
+        printf("🎬 exported %d frames to %s in %.1f s, %.1fx realtime. Frames waited on the encoder %d times\n",
+               captured_frames,
+               params.output_path,
+               seconds,
+               captured_frames / TARGET_FPS / seconds,
+               stall_count);
+    } else {
+        printf("⚠️ video export failed after %d frames\n", captured_frames);
+    }
+
+    ReplayFile_Close(file);
+    SDL_aligned_free(snapshot);
+    SDL_DestroyTexture(target);
+    file = NULL;
+    encoder = NULL;
+    snapshot = NULL;
+    target = NULL;
+    pending_frame = NULL;
+    enter_state(VIDEO_EXPORT_FINISHED);
+    SDLApp_Exit();
+}
+
+bool VideoExport_Init(const VideoExportParams* init_params) {
+    ReplaySetup setup;
+
+    SDL_copyp(&params, init_params);
+    file = ReplayFile_Open(
+        params.replay_path, &setup, Replays_GetSnapshotSize(), GameState_GetLayoutFingerprint());
+
+    if (file == NULL) {
+        printf("⚠️ couldn't read replay %s: %s\n", params.replay_path, SDL_GetError());
+        return false;
+    }
+
+    const char* reason = NULL;
+
+    if (ReplayFile_GetFrameCount(file) == 0) {
+        reason = "it has no inputs";
+    } else if (setup.mode != MODE_VERSUS) {
+        // The match is set up in versus, where the CPU opponent of an arcade match wouldn't be controlled by anyone
+        reason = "only versus matches can be exported";
+    } else if (ReplayFile_FindKeyframe(file, 0) != 0) {
+        reason = "it was recorded by a different build";
+    }
+
+    if (reason != NULL) {
+        printf("⚠️ can't export replay %s: %s\n", params.replay_path, reason);
+        ReplayFile_Close(file);
+        return false;
+    }
+
+    const VideoEncoderParams encoder_params = { .path = params.output_path,
+                                                .width = 384,
+                                                .height = 224,
+                                                .scale = params.scale,
+                                                .frame_rate = TARGET_FPS,
+                                                .display_aspect_ratio = DISPLAY_ASPECT_RATIO };
+
+    encoder = VideoEncoder_Open(&encoder_params);
+    snapshot = SDL_aligned_alloc(16, Replays_GetSnapshotSize());
+
+    if ((encoder == NULL) || (snapshot == NULL)) {
+        printf("⚠️ couldn't export video to %s: %s\n", params.output_path, SDL_GetError());
+        VideoEncoder_Close(encoder);
+        ReplayFile_Close(file);
+        SDL_aligned_free(snapshot);
+        return false;
+    }
+
+    autostart_setup = Replays_GetAutostartSetup(&setup);
+    SDLApp_SetFrameTimeScale(0);
+    enter_state(VIDEO_EXPORT_BOOTING);
+    return true;
+}
+
+bool VideoExport_IsActive() {
+    return (state != VIDEO_EXPORT_INACTIVE) && (state != VIDEO_EXPORT_FINISHED);
+}
+
+void VideoExport_InjectInputs() {
+    const int frames_in_state = frame - state_frame;
+
+    p1sw_buff = 0;
+    p2sw_buff = 0;
+
+    switch (state) {
+    case VIDEO_EXPORT_BOOTING:
+        // Nothing before the match gets captured, so skip building sprites
+        No_Trans = 1;
+        Autostart_InjectInputs(AUTOSTART_BOOTING, frames_in_state, &autostart_setup);
+        break;
+
+    case VIDEO_EXPORT_SELECTING:
+        No_Trans = 1;
+        Autostart_InjectInputs(AUTOSTART_SELECTING, frames_in_state, &autostart_setup);
+        break;
+
+    case VIDEO_EXPORT_PLAYING:
+        const ReplayInputs inputs = ReplayFile_GetInputs(file, played_frames);
+        p1sw_buff = inputs.sw[0];
+        p2sw_buff = inputs.sw[1];
+        played_frames += 1;
+        break;
+
+    case VIDEO_EXPORT_INACTIVE:
+    case VIDEO_EXPORT_FINISHED:
+        break;
+    }
+}
+
+static void begin_playback() {
+    // Refused when the files the keyframe points into aren't loaded the same way here
+    if (!Replays_LoadKeyframe(file, 0, snapshot)) {
+        printf("⚠️ couldn't restore the start of the replay\n");
+        finish(false);
+        return;
+    }
+
+    No_Trans = 0;
+    playback_start_time = SDL_GetTicksNS();
+    enter_state(VIDEO_EXPORT_PLAYING);
+}
+
+void VideoExport_Update() {
+    frame += 1;
+    const int frames_in_state = frame - state_frame;
+
+    switch (state) {
+    case VIDEO_EXPORT_BOOTING:
+        // Sound is set up along with the game, which has run by now
+        if (!is_capturing_audio) {
+            SPU_BeginCapture();
+            ADX_BeginCapture();
+            is_capturing_audio = true;
+        }
+
+        if (Autostart_IsMainMenuReady()) {
+            Autostart_StartVersus(&autostart_setup);
+            enter_state(VIDEO_EXPORT_SELECTING);
+        } else if (Autostart_HasTimedOut(AUTOSTART_BOOTING, frames_in_state)) {
+            finish(false);
+        }
+
+        break;
+
+    case VIDEO_EXPORT_SELECTING:
+        if (G_No[1] == 2) {
+            begin_playback();
+        } else if (Autostart_HasTimedOut(AUTOSTART_SELECTING, frames_in_state)) {
+            finish(false);
+        }
+
+        break;
+
+    case VIDEO_EXPORT_PLAYING:
+    case VIDEO_EXPORT_INACTIVE:
+    case VIDEO_EXPORT_FINISHED:
+        break;
+    }
+}
+
+/// @return Number of samples per channel that the next frame lasts. Frames don't last a whole number of samples, so
+/// this alternates to keep audio from drifting.
+static int next_sample_count() {
+    const Sint64 start = audio_frames * VIDEO_ENCODER_SAMPLE_RATE / TARGET_FPS;
+    const Sint64 end = (audio_frames + 1) * VIDEO_ENCODER_SAMPLE_RATE / TARGET_FPS;
+
+    audio_frames += 1;
+    return end - start;
+}
+
+/// Mix SPU and ADX output the same way the audio device does
+static void render_audio(s16* output, int sample_count) {
+    SPU_Render(output, sample_count);
+    ADX_ReadCapture(adx_samples, sample_count);
+
+    for (int i = 0; i < sample_count * 2; i++) {
+        output[i] = SDL_clamp(output[i] + adx_samples[i], INT16_MIN, INT16_MAX);
+    }
+}
+
+static void read_back(SDL_Renderer* renderer, VideoEncoderFrame* encoder_frame) {
+    SDL_Texture* prev_target = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, target);
+    SDL_Surface* surface = SDL_RenderReadPixels(renderer, NULL);
+    SDL_SetRenderTarget(renderer, prev_target);
+
+    if (surface == NULL) {
+        SDL_memset(encoder_frame->pixels, 0, target->w * target->h * 4);
+        return;
+    }
+
+    SDL_ConvertPixels(surface->w,
+                      surface->h,
+                      surface->format,
+                      surface->pixels,
+                      surface->pitch,
+                      SDL_PIXELFORMAT_RGBA32,
+                      encoder_frame->pixels,
+                      surface->w * 4);
+    SDL_DestroySurface(surface);
+}
+
+/// Copy the canvas to a texture of our own, because the canvas gets cleared before the next frame is read back
+static void draw_target(SDL_Renderer* renderer, SDL_Texture* canvas) {
+    if (target == NULL) {
+        target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, canvas->w, canvas->h);
+    }
+
+    SDL_Texture* prev_target = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, target);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
+    SDL_RenderTexture(renderer, canvas, NULL, NULL);
+    SDL_SetRenderTarget(renderer, prev_target);
+}
+
+void VideoExport_CaptureFrame(SDL_Renderer* renderer, SDL_Texture* canvas) {
+    if (!is_capturing_audio) {
+        return;
+    }
+
+    const int frame_count = ReplayFile_GetFrameCount(file);
+    const int sample_count = next_sample_count();
+
+    if (pending_frame != NULL) {
+        read_back(renderer, pending_frame);
+        VideoEncoder_SubmitFrame(encoder);
+        pending_frame = NULL;
+    }
+
+    // Only frames that ran with recorded inputs make it into the video
+    const bool has_new_frame = (captured_frames < played_frames) && (captured_frames < frame_count);
+
+    if ((state == VIDEO_EXPORT_PLAYING) && has_new_frame) {
+        pending_frame = VideoEncoder_BeginFrame(encoder);
+        pending_frame->sample_count = sample_count;
+        render_audio(pending_frame->samples, sample_count);
+        draw_target(renderer, canvas);
+        captured_frames += 1;
+    } else {
+        // Keep sound running while nothing is captured, it drives the sound driver
+        render_audio(discarded_samples, sample_count);
+    }
+
+    if ((state == VIDEO_EXPORT_PLAYING) && (pending_frame == NULL) && (captured_frames == frame_count)) {
+        finish(true);
+    }
+}
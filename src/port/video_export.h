@@ -0,0 +1,31 @@
+#ifndef PORT_VIDEO_EXPORT_H
+#define PORT_VIDEO_EXPORT_H
+
+#include <SDL3/SDL.h>
+
+#include <stdbool.h>
+
+typedef struct VideoExportParams {
+    const char* replay_path;
+    const char* output_path; // MP4 file to write
+    int scale;               // The 384x224 picture is upscaled by this factor
+} VideoExportParams;
+
+/// Play a replay file back as fast as possible and encode every frame of it to a video file, then exit
+/// @return Whether the replay and the video file could be opened.
+bool VideoExport_Init(const VideoExportParams* params);
+
+bool VideoExport_IsActive();
+
+/// Replace controller inputs with the ones that move through menus, or with recorded ones during the match. Call after
+/// inputs have been read.
+void VideoExport_InjectInputs();
+
+/// Start playback once the match has been set up. Call after the frame has run.
+void VideoExport_Update();
+
+/// Take the audio of the frame and queue the picture of the frame that has just been rendered to `canvas` for
+/// encoding. The picture is read back during the next call, so that reading doesn't wait on the frame being drawn.
+void VideoExport_CaptureFrame(SDL_Renderer* renderer, SDL_Texture* canvas);
+
+#endif
@@ -1,4 +1,5 @@
 #include "common.h"
+#include "port/mem_stats.h"
 #include "structs.h"
 
 ptrdiff_t fmsCalcSpace(FL_FMS* lp) {
@@ -13,6 +14,7 @@ s32 fmsInitialize(FL_FMS* lp, void* memory_ptr, s32 memsize, s32 memalign) {
     lp->baseandcap[1] = (u8*)(((uintptr_t)lp->memoryblock + memsize + lp->align - 1) & ~(lp->align - 1));
     lp->frame[0] = lp->baseandcap[0];
     lp->frame[1] = lp->baseandcap[1];
+    MemStats_RegisterHeap(lp, MEM_STATS_HEAP_FMS, "FMS", lp->baseandcap[1] - lp->baseandcap[0]);
     return 1;
 }
 
@@ -21,6 +23,7 @@ void* fmsAllocMemory(FL_FMS* lp, s32 bytes, s32 heapnum) {
     bytes = ~(lp->align - 1) & ((uintptr_t)bytes + lp->align - 1);
 
     if (lp->frame[0] + bytes > lp->frame[1]) {
+        MemStats_NoteFailure(lp, bytes);
         return NULL;
     }
 
@@ -32,6 +35,8 @@ void* fmsAllocMemory(FL_FMS* lp, s32 bytes, s32 heapnum) {
         lp->frame[0] += bytes;
     }
 
+    MemStats_NoteAlloc(lp, bytes);
+
     return pMem;
 }
 
@@ -1,5 +1,6 @@
 #include "sf33rd/AcrSDK/common/memmgr.h"
 #include "common.h"
+#include "port/mem_stats.h"
 #include "sf33rd/AcrSDK/common/prilay.h"
 
 #define ALIGN(ptr, len, alignment) ((~(alignment - 1)) & ((uintptr_t)(ptr) + len + alignment - 1))
@@ -28,6 +29,7 @@ void plmemInit(MEM_MGR* memmgr, MEM_BLOCK* block, s32 count, void* mem_ptr, s32
     memmgr->blocklist = MEM_NULL_HANDLE;
 
     plMemset(block, 0, count * sizeof(MEM_BLOCK));
+    MemStats_RegisterHeap(memmgr, MEM_STATS_HEAP_MEMMGR, "System", memsize);
 }
 
 u32 plmemRegister(MEM_MGR* memmgr, s32 len) {
@@ -38,6 +40,7 @@ u32 plmemRegisterAlign(MEM_MGR* memmgr, s32 len, s32 align) {
     u32 han;
 
     if (plmemGetFreeSpace(memmgr) <= len + align) {
+        MemStats_NoteFailure(memmgr, len);
         return 0;
     }
 
@@ -48,6 +51,7 @@ u32 plmemRegisterAlign(MEM_MGR* memmgr, s32 len, s32 align) {
     han = plmemPullHandle(memmgr);
 
     if (han == MEM_NULL_HANDLE) {
+        MemStats_NoteFailure(memmgr, len);
         return 0;
     }
 
@@ -66,6 +70,7 @@ u32 plmemRegisterAlign(MEM_MGR* memmgr, s32 len, s32 align) {
     }
 
     memmgr->used_size += len;
+    MemStats_NoteAlloc(memmgr, len);
     plmemAppendBlockList(memmgr, han);
 
     return han + 1;
@@ -104,6 +109,7 @@ u32 plmemRegisterS(MEM_MGR* memmgr, s32 len) {
                 memmgr->block[han].align = memmgr->memalign;
                 memmgr->block[han].ptr = data_ptr;
                 memmgr->used_size += len;
+                MemStats_NoteAlloc(memmgr, len);
                 plmemAppendBlockList(memmgr, han);
                 return han + 1;
             }
@@ -120,6 +126,7 @@ u32 plmemRegisterS(MEM_MGR* memmgr, s32 len) {
             memmgr->block[han].align = memmgr->memalign;
             memmgr->block[han].ptr = data_ptr;
             memmgr->used_size += len;
+            MemStats_NoteAlloc(memmgr, len);
             plmemAppendBlockList(memmgr, han);
             return han + 1;
         }
@@ -135,6 +142,7 @@ u32 plmemRegisterS(MEM_MGR* memmgr, s32 len) {
                 memmgr->block[han].align = memmgr->memalign;
                 memmgr->block[han].ptr = now_block->ptr - size;
                 memmgr->used_size += len;
+                MemStats_NoteAlloc(memmgr, len);
                 plmemAppendBlockList(memmgr, han);
                 return han + 1;
             }
@@ -150,6 +158,7 @@ u32 plmemRegisterS(MEM_MGR* memmgr, s32 len) {
             memmgr->block[han].align = memmgr->memalign;
             memmgr->block[han].ptr = now_block->ptr - size;
             memmgr->used_size += len;
+            MemStats_NoteAlloc(memmgr, len);
             plmemAppendBlockList(memmgr, han);
             return han + 1;
         }
@@ -203,6 +212,7 @@ s32 plmemRelease(MEM_MGR* memmgr, u32 handle) {
     }
 
     memmgr->used_size -= memmgr->block[index].len;
+    MemStats_NoteFree(memmgr, memmgr->block[index].len);
     memmgr->block[index].len = 0;
     memmgr->block[index].ptr = NULL;
     plmemDeleteBlockList(memmgr, index);
@@ -213,9 +223,11 @@ void* plmemCompact(MEM_MGR* memmgr) {
     MEM_BLOCK* now_block;
     MEM_BLOCK* next_block;
     u8* data_ptr;
+    size_t moved = 0;
 
     if (memmgr->blocklist == MEM_NULL_HANDLE) {
         memmgr->memnow = memmgr->memptr;
+        MemStats_NoteCompaction(memmgr, 0);
         return memmgr->memnow;
     }
 
@@ -226,6 +238,7 @@ void* plmemCompact(MEM_MGR* memmgr) {
 
         if (data_ptr != now_block->ptr) {
             plMemmove(data_ptr, now_block->ptr, now_block->len);
+            moved += now_block->len;
             now_block->ptr = data_ptr;
         }
 
@@ -235,6 +248,7 @@ void* plmemCompact(MEM_MGR* memmgr) {
 
             if (data_ptr != next_block->ptr) {
                 plMemmove(data_ptr, next_block->ptr, next_block->len);
+                moved += next_block->len;
                 next_block->ptr = data_ptr;
             }
 
@@ -247,6 +261,7 @@ void* plmemCompact(MEM_MGR* memmgr) {
 
         if (data_ptr != now_block->ptr) {
             plMemmove(data_ptr, now_block->ptr, now_block->len);
+            moved += now_block->len;
             now_block->ptr = data_ptr;
         }
 
@@ -256,6 +271,7 @@ void* plmemCompact(MEM_MGR* memmgr) {
 
             if (data_ptr != next_block->ptr) {
                 plMemmove(data_ptr, next_block->ptr, next_block->len);
+                moved += next_block->len;
                 next_block->ptr = data_ptr;
             }
 
@@ -265,6 +281,7 @@ void* plmemCompact(MEM_MGR* memmgr) {
         memmgr->memnow = now_block->ptr;
     }
 
+    MemStats_NoteCompaction(memmgr, moved);
     return memmgr->memnow;
 }
 
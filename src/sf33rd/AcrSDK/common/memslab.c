@@ -0,0 +1,261 @@
+#include "sf33rd/AcrSDK/common/memslab.h"
+#include "common.h"
+#include "port/mem_stats.h"
+
+#include <SDL3/SDL.h>
+
+// Slab allocator for texture and palette buffers.
+//
+// Buffers are rounded up to one of a set of size classes (four per power of two) and carved out of pages that only
+// hold buffers of that class. Freed slots are reused by the next buffer of the same class, so the pools never need
+// to be compacted, and pages that become empty are returned to the system.
+
+#define SLAB_ALIGN 0x40
+#define SLAB_PAGE_SIZE 0x40000
+#define SLAB_CLASS_STEPS 4
+#define SLAB_CLASSES_MAX 64
+#define SLAB_HANDLES_MAX 4096
+#define SLAB_NO_SLOT -1
+
+typedef struct SlabPage {
+    struct SlabPage* prev;
+    struct SlabPage* next;
+    u8* data;
+    s32 class_index;
+    s32 used;
+    s32 free_slot; // Free slots store the index of the next free slot in their first bytes
+} SlabPage;
+
+typedef struct SlabClass {
+    s32 slot_size;
+    s32 slots_per_page;
+    s32 page_count;
+    SlabPage* partial; // Pages that have at least one free slot
+} SlabClass;
+
+typedef struct SlabHandle {
+    SlabPage* page;
+    s32 slot;
+} SlabHandle;
+
+static SlabClass classes[SLAB_CLASSES_MAX] = { 0 };
+static s32 class_count = 0;
+static SlabHandle handles[SLAB_HANDLES_MAX] = { 0 };
+static u16 free_handles[SLAB_HANDLES_MAX] = { 0 };
+static s32 free_handle_count = 0;
+static size_t page_bytes = 0;
+
+static void init_classes() {
+    class_count = 0;
+
+    for (s32 base = SLAB_ALIGN; base <= MEM_SLAB_SIZE_MAX; base *= 2) {
+        for (s32 step = 0; step < SLAB_CLASS_STEPS; step++) {
+            const s32 slot_size = ALIGN_UP(base + base * step / SLAB_CLASS_STEPS, SLAB_ALIGN);
+
+            if ((slot_size > MEM_SLAB_SIZE_MAX) ||
+                ((class_count > 0) && (slot_size <= classes[class_count - 1].slot_size))) {
+                continue;
+            }
+
+            SlabClass* slab_class = &classes[class_count];
+            slab_class->slot_size = slot_size;
+            slab_class->slots_per_page = SDL_max(SLAB_PAGE_SIZE / slot_size, 1);
+            class_count += 1;
+        }
+    }
+}
+
+void plslabInit() {
+    init_classes();
+
+    for (s32 i = 0; i < SLAB_HANDLES_MAX; i++) {
+        free_handles[i] = SLAB_HANDLES_MAX - 1 - i;
+    }
+
+    free_handle_count = SLAB_HANDLES_MAX;
+    MemStats_RegisterHeap(classes, MEM_STATS_HEAP_SLAB, "Slabs", 0);
+}
+
+static s32 find_class(s32 len) {
+    s32 low = 0;
+    s32 high = class_count - 1;
+
+    while (low < high) {
+        const s32 mid = (low + high) / 2;
+
+        if (classes[mid].slot_size < len) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+static s32* slot_link(SlabPage* page, s32 slot) {
+    return (s32*)(page->data + slot * classes[page->class_index].slot_size);
+}
+
+static void link_partial(SlabClass* slab_class, SlabPage* page) {
+    page->prev = NULL;
+    page->next = slab_class->partial;
+
+    if (page->next != NULL) {
+        page->next->prev = page;
+    }
+
+    slab_class->partial = page;
+}
+
+static void unlink_partial(SlabClass* slab_class, SlabPage* page) {
+    if (page->prev != NULL) {
+        page->prev->next = page->next;
+    } else {
+        slab_class->partial = page->next;
+    }
+
+    if (page->next != NULL) {
+        page->next->prev = page->prev;
+    }
+
+    page->prev = NULL;
+    page->next = NULL;
+}
+
+static SlabPage* create_page(s32 class_index) {
+    SlabClass* slab_class = &classes[class_index];
+    const size_t size = (size_t)slab_class->slot_size * slab_class->slots_per_page;
+    SlabPage* page = SDL_calloc(1, sizeof(SlabPage));
+
+    if (page == NULL) {
+        return NULL;
+    }
+
+    page->data = SDL_aligned_alloc(SLAB_ALIGN, size);
+
+    if (page->data == NULL) {
+        SDL_free(page);
+        return NULL;
+    }
+
+    page->class_index = class_index;
+    page->free_slot = 0;
+
+    for (s32 slot = 0; slot < slab_class->slots_per_page; slot++) {
+        *slot_link(page, slot) = (slot + 1 < slab_class->slots_per_page) ? slot + 1 : SLAB_NO_SLOT;
+    }
+
+    slab_class->page_count += 1;
+    link_partial(slab_class, page);
+
+    page_bytes += size;
+    MemStats_SetCapacity(classes, page_bytes);
+    return page;
+}
+
+static void destroy_page(SlabPage* page) {
+    SlabClass* slab_class = &classes[page->class_index];
+
+    unlink_partial(slab_class, page);
+    slab_class->page_count -= 1;
+    page_bytes -= (size_t)slab_class->slot_size * slab_class->slots_per_page;
+    MemStats_SetCapacity(classes, page_bytes);
+
+    SDL_aligned_free(page->data);
+    SDL_free(page);
+}
+
+u32 plslabRegister(s32 len) {
+    if ((len <= 0) || (len > MEM_SLAB_SIZE_MAX) || (free_handle_count == 0)) {
+        return 0;
+    }
+
+    const s32 class_index = find_class(len);
+    SlabClass* slab_class = &classes[class_index];
+    SlabPage* page = slab_class->partial;
+
+    if (page == NULL) {
+        page = create_page(class_index);
+
+        if (page == NULL) {
+            MemStats_NoteFailure(classes, len);
+            return 0;
+        }
+    }
+
+    const s32 slot = page->free_slot;
+    page->free_slot = *slot_link(page, slot);
+    page->used += 1;
+
+    if (page->free_slot == SLAB_NO_SLOT) {
+        unlink_partial(slab_class, page);
+    }
+
+    free_handle_count -= 1;
+    const u16 index = free_handles[free_handle_count];
+    handles[index].page = page;
+    handles[index].slot = slot;
+
+    MemStats_NoteAlloc(classes, slab_class->slot_size);
+    return MEM_SLAB_HANDLE_FLAG | (index + 1);
+}
+
+static SlabHandle* get_handle(u32 handle) {
+    if (!plslabIsHandle(handle)) {
+        return NULL;
+    }
+
+    const u32 index = (handle & ~MEM_SLAB_HANDLE_FLAG) - 1;
+
+    if ((index >= SLAB_HANDLES_MAX) || (handles[index].page == NULL)) {
+        return NULL;
+    }
+
+    return &handles[index];
+}
+
+void* plslabRetrieve(u32 handle) {
+    SlabHandle* entry = get_handle(handle);
+
+    if (entry == NULL) {
+        return NULL;
+    }
+
+    return slot_link(entry->page, entry->slot);
+}
+
+s32 plslabRelease(u32 handle) {
+    SlabHandle* entry = get_handle(handle);
+
+    if (entry == NULL) {
+        return 0;
+    }
+
+    SlabPage* page = entry->page;
+    SlabClass* slab_class = &classes[page->class_index];
+    const bool was_full = (page->free_slot == SLAB_NO_SLOT);
+
+    *slot_link(page, entry->slot) = page->free_slot;
+    page->free_slot = entry->slot;
+    page->used -= 1;
+
+    if (was_full) {
+        link_partial(slab_class, page);
+    }
+
+    // Keep the last page of a class around so that loading and unloading a single buffer doesn't thrash
+    if ((page->used == 0) && (slab_class->page_count > 1)) {
+        destroy_page(page);
+    }
+
+    MemStats_NoteFree(classes, slab_class->slot_size);
+    SDL_zerop(entry);
+    free_handles[free_handle_count] = entry - handles;
+    free_handle_count += 1;
+    return 1;
+}
+
+bool plslabIsHandle(u32 handle) {
+    return (handle & MEM_SLAB_HANDLE_FLAG) != 0;
+}
@@ -1,7 +1,10 @@
 #include "sf33rd/AcrSDK/common/prilay.h"
 #include "common.h"
 #include "structs.h"
+#include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #if defined(TARGET_PS2)
 #include "mw_stdarg.h"
@@ -19,34 +22,53 @@ s32 plReport(s8* format, ...) {
 }
 
 void plMemset(void* dst, u32 pat, s32 size) {
-    s32 i;
-    s8* now = dst;
-
-    for (i = 0; i < size; i++) {
-        *(now++) = pat;
+    if (size <= 0) {
+        return;
     }
+
+    memset(dst, pat, size);
 }
 
+/// Copies as if through a temporary buffer, like the original byte loop that copied backwards when `dst` overlaps the
+/// end of `src`
 void plMemmove(void* dst, void* src, s32 size) {
-    s32 i;
-    s8* now[2];
+    if (size <= 0) {
+        return;
+    }
 
-    now[0] = dst;
-    now[1] = src;
+    memmove(dst, src, size);
+}
 
-    if (src < dst && (now[1] + size) > now[0]) {
-        now[0] += size - 1;
-        now[1] += size - 1;
+// The swaps are written so that compilers vectorize them
 
-        for (i = 0; i < size; i++) {
-            *(now[0]--) = *(now[1]--);
-        }
+void plSwapBytes16(void* data, s32 count) {
+    u16* values = data;
+    s32 i;
 
-        return;
+    for (i = 0; i < count; i++) {
+        const u16 value = values[i];
+        values[i] = (u16)((value << 8) | (value >> 8));
     }
+}
+
+void plSwapBytes32(void* data, s32 count) {
+    u32* values = data;
+    s32 i;
 
-    for (i = 0; i < size; i++) {
-        *(now[0]++) = *(now[1]++);
+    for (i = 0; i < count; i++) {
+        u32 value = values[i];
+        value = ((value & 0x00FF00FF) << 8) | ((value >> 8) & 0x00FF00FF);
+        values[i] = (value << 16) | (value >> 16);
+    }
+}
+
+void plSwapNibbles(void* data, s32 count) {
+    u8* values = data;
+    s32 i;
+
+    for (i = 0; i < count; i++) {
+        const u8 value = values[i];
+        values[i] = (u8)((value << 4) | (value >> 4));
     }
 }
 
@@ -249,7 +271,7 @@ u32 plGetColor(s32 x, s32 y, plContext* lpcontext) {
     return a << 24 | r << 16 | g << 8 | b;
 }
 
-s32 plConvertContext(plContext* dst, plContext* src) {
+static void convert_context_generic(plContext* dst, plContext* src) {
     s32 x;
     s32 y;
     u32 color;
@@ -260,6 +282,311 @@ s32 plConvertContext(plContext* dst, plContext* src) {
             plDrawPixel_3(dst, x, y, color);
         }
     }
+}
+
+// Specialized conversions
+//
+// Converting through plGetColor and plDrawPixel costs an address calculation, a switch and several divisions per
+// pixel. The formats that textures are locked and unlocked with get their own row conversions, which produce exactly
+// what the generic path does. Rows may be converted in place.
+
+typedef enum plFormat {
+    PL_FORMAT_UNKNOWN,
+    PL_FORMAT_ARGB1555,
+    PL_FORMAT_ABGR1555,
+    PL_FORMAT_RGB888,
+    PL_FORMAT_BGR888,
+    PL_FORMAT_ARGB8888,
+    PL_FORMAT_ABGR8888,
+} plFormat;
+
+typedef struct plFormatInfo {
+    plFormat format;
+    s32 bitdepth;
+    PixelFormat pixelformat;
+} plFormatInfo;
+
+typedef void (*plConvertRow)(u8* dst, const u8* src, s32 width);
+
+typedef struct plConversion {
+    plFormat src;
+    plFormat dst;
+    plConvertRow convert_row;
+} plConversion;
+
+static const plFormatInfo formats[] = {
+    { PL_FORMAT_ARGB1555, 2, { 5, 0xA, 0x1F, 5, 5, 0x1F, 5, 0, 0x1F, 1, 0xF, 1 } },
+    { PL_FORMAT_ABGR1555, 2, { 5, 0, 0x1F, 5, 5, 0x1F, 5, 0xA, 0x1F, 1, 0xF, 1 } },
+    { PL_FORMAT_RGB888, 3, { 8, 0x10, 0xFF, 8, 8, 0xFF, 8, 0, 0xFF, 0, 0, 0 } },
+    { PL_FORMAT_BGR888, 3, { 8, 0, 0xFF, 8, 8, 0xFF, 8, 0x10, 0xFF, 0, 0, 0 } },
+    { PL_FORMAT_ARGB8888, 4, { 8, 0x10, 0xFF, 8, 8, 0xFF, 8, 0, 0xFF, 8, 0x18, 0xFF } },
+    { PL_FORMAT_ABGR8888, 4, { 8, 0, 0xFF, 8, 8, 0xFF, 8, 0x10, 0xFF, 8, 0x18, 0xFF } },
+};
+
+/// Every 1555 color converted with the other two channels swapped. Going through 8 bits per channel and back isn't
+/// lossless, so each channel goes through the same rounding as in plGetColor and plDrawPixel.
+static u16 swap_1555_table[0x10000];
+static bool is_swap_1555_table_ready = false;
+
+static void init_context(plContext* context, const plFormatInfo* info, void* ptr, s32 width, s32 height) {
+    memset(context, 0, sizeof(plContext));
+    context->width = width;
+    context->height = height;
+    context->pitch = width * info->bitdepth;
+    context->ptr = ptr;
+    context->bitdepth = info->bitdepth;
+    context->pixelformat = info->pixelformat;
+}
+
+/// Widen a 5-bit channel to 8 bits like plGetColor and narrow it back like plDrawPixel
+static u32 round_trip_5(u32 channel) {
+    return ((channel * 0xFF) / 0x1F) * 0x1F / 0xFF;
+}
+
+static void init_swap_1555_table() {
+    u32 i;
+
+    for (i = 0; i < 0x10000; i++) {
+        const u32 high = round_trip_5((i >> 10) & 0x1F);
+        const u32 middle = round_trip_5((i >> 5) & 0x1F);
+        const u32 low = round_trip_5(i & 0x1F);
+
+        swap_1555_table[i] = (i & 0x8000) | (low << 10) | (middle << 5) | high;
+    }
+
+    is_swap_1555_table_ready = true;
+}
+
+static void convert_row_swap_1555(u8* dst, const u8* src, s32 width) {
+    const u16* src_pixels = (const u16*)src;
+    u16* dst_pixels = (u16*)dst;
+    s32 i;
+
+    if (!is_swap_1555_table_ready) {
+        init_swap_1555_table();
+    }
+
+    for (i = 0; i < width; i++) {
+        dst_pixels[i] = swap_1555_table[src_pixels[i]];
+    }
+}
+
+static void convert_row_swap_888(u8* dst, const u8* src, s32 width) {
+    s32 i;
+
+    for (i = 0; i < width * 3; i += 3) {
+        const u8 first = src[i];
+        const u8 second = src[i + 1];
+        const u8 third = src[i + 2];
+
+        dst[i] = third;
+        dst[i + 1] = second;
+        dst[i + 2] = first;
+    }
+}
+
+static void convert_row_swap_8888(u8* dst, const u8* src, s32 width) {
+    const u32* src_pixels = (const u32*)src;
+    u32* dst_pixels = (u32*)dst;
+    s32 i;
+
+    // Simple enough for compilers to vectorize
+    for (i = 0; i < width; i++) {
+        const u32 color = src_pixels[i];
+        dst_pixels[i] = (color & 0xFF00FF00) | ((color >> 16) & 0xFF) | ((color & 0xFF) << 16);
+    }
+}
+
+static const plConversion conversions[] = {
+    { PL_FORMAT_ARGB1555, PL_FORMAT_ABGR1555, convert_row_swap_1555 },
+    { PL_FORMAT_ABGR1555, PL_FORMAT_ARGB1555, convert_row_swap_1555 },
+    { PL_FORMAT_RGB888, PL_FORMAT_BGR888, convert_row_swap_888 },
+    { PL_FORMAT_BGR888, PL_FORMAT_RGB888, convert_row_swap_888 },
+    { PL_FORMAT_ARGB8888, PL_FORMAT_ABGR8888, convert_row_swap_8888 },
+    { PL_FORMAT_ABGR8888, PL_FORMAT_ARGB8888, convert_row_swap_8888 },
+};
+
+static plFormat identify_format(const plContext* context) {
+    s32 i;
+
+    // Palettized
+    if (context->desc & 4) {
+        return PL_FORMAT_UNKNOWN;
+    }
+
+    for (i = 0; i < sizeof(formats) / sizeof(formats[0]); i++) {
+        if ((context->bitdepth == formats[i].bitdepth) &&
+            (memcmp(&context->pixelformat, &formats[i].pixelformat, sizeof(PixelFormat)) == 0)) {
+            return formats[i].format;
+        }
+    }
+
+    return PL_FORMAT_UNKNOWN;
+}
+
+static const plConversion* find_conversion(plContext* dst, plContext* src) {
+    const plFormat src_format = identify_format(src);
+    const plFormat dst_format = identify_format(dst);
+    s32 i;
+
+    if ((src_format == PL_FORMAT_UNKNOWN) || (dst_format == PL_FORMAT_UNKNOWN)) {
+        return NULL;
+    }
+
+    for (i = 0; i < sizeof(conversions) / sizeof(conversions[0]); i++) {
+        if ((conversions[i].src == src_format) && (conversions[i].dst == dst_format)) {
+            return &conversions[i];
+        }
+    }
+
+    return NULL;
+}
+
+s32 plConvertContext(plContext* dst, plContext* src) {
+    const plConversion* conversion = find_conversion(dst, src);
+    s32 y;
+
+    // Reading outside of the source gives black pixels, which only the generic path does
+    if ((conversion == NULL) || (src->width < dst->width) || (src->height < dst->height)) {
+        convert_context_generic(dst, src);
+        return 1;
+    }
+
+    for (y = 0; y < dst->height; y++) {
+        conversion->convert_row((u8*)dst->ptr + (dst->pitch * y), (const u8*)src->ptr + (src->pitch * y), dst->width);
+    }
 
     return 1;
 }
+
+// Conversion test
+
+typedef struct ConversionTestSize {
+    s32 src_width;
+    s32 src_height;
+    s32 dst_width;
+    s32 dst_height;
+} ConversionTestSize;
+
+static const ConversionTestSize conversion_test_sizes[] = {
+    { 1, 1, 1, 1 },     { 3, 5, 3, 5 },     { 17, 9, 17, 9 }, { 255, 1, 255, 1 }, { 256, 256, 256, 256 },
+    { 16, 16, 17, 16 }, { 16, 16, 16, 17 }, { 5, 3, 8, 8 },   { 33, 7, 31, 5 },
+};
+
+/// Fill a source with pseudo-random pixels. 16-bit pixels step through every value, so that a 256x256 source holds
+/// each of them once.
+static void fill_test_pixels(u8* pixels, s32 length, s32 bitdepth, u32 seed) {
+    s32 i;
+
+    if (bitdepth == 2) {
+        for (i = 0; i < length / 2; i++) {
+            ((u16*)pixels)[i] = (u16)(i * 0x9E37 + seed);
+        }
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        seed = seed * 1103515245 + 12345;
+        pixels[i] = seed >> 16;
+    }
+}
+
+/// Convert a source with plConvertContext and with the generic path, out of place and, when the formats are the same
+/// size, in place, and compare the results
+static bool check_conversion(const plFormatInfo* src_info, const plFormatInfo* dst_info,
+                             const ConversionTestSize* size, u32 seed) {
+    const s32 src_length = size->src_width * size->src_height * src_info->bitdepth;
+    const s32 dst_length = size->dst_width * size->dst_height * dst_info->bitdepth;
+    const bool can_convert_in_place = (src_info->bitdepth == dst_info->bitdepth) &&
+                                      (size->src_width == size->dst_width) && (size->src_height == size->dst_height);
+    u8* pixels = malloc(src_length);
+    u8* expected = malloc(dst_length);
+    u8* actual = malloc(dst_length);
+    plContext src;
+    plContext dst;
+    bool is_same;
+
+    if ((pixels == NULL) || (expected == NULL) || (actual == NULL)) {
+        printf("⚠️ couldn't allocate the conversion buffers\n");
+        free(pixels);
+        free(expected);
+        free(actual);
+        return false;
+    }
+
+    fill_test_pixels(pixels, src_length, src_info->bitdepth, seed);
+    init_context(&src, src_info, pixels, size->src_width, size->src_height);
+
+    // Pixels that neither path writes have to stay the same too
+    memset(expected, 0xCD, dst_length);
+    init_context(&dst, dst_info, expected, size->dst_width, size->dst_height);
+    convert_context_generic(&dst, &src);
+
+    memset(actual, 0xCD, dst_length);
+    dst.ptr = actual;
+    plConvertContext(&dst, &src);
+    is_same = memcmp(expected, actual, dst_length) == 0;
+
+    if (is_same && can_convert_in_place) {
+        memcpy(actual, pixels, src_length);
+        src.ptr = actual;
+        plConvertContext(&dst, &src);
+        is_same = memcmp(expected, actual, dst_length) == 0;
+    }
+
+    free(pixels);
+    free(expected);
+    free(actual);
+    return is_same;
+}
+
+bool plRunConversionTest(s32 seeds) {
+    const s32 format_count = sizeof(formats) / sizeof(formats[0]);
+    const s32 size_count = sizeof(conversion_test_sizes) / sizeof(conversion_test_sizes[0]);
+    s32 specialized_count = 0;
+    s32 src_index;
+    s32 dst_index;
+    s32 size_index;
+    s32 seed;
+
+    for (src_index = 0; src_index < format_count; src_index++) {
+        for (dst_index = 0; dst_index < format_count; dst_index++) {
+            const plFormatInfo* src_info = &formats[src_index];
+            const plFormatInfo* dst_info = &formats[dst_index];
+            plContext src;
+            plContext dst;
+
+            init_context(&src, src_info, NULL, 1, 1);
+            init_context(&dst, dst_info, NULL, 1, 1);
+
+            if (find_conversion(&dst, &src) != NULL) {
+                specialized_count += 1;
+            }
+
+            for (size_index = 0; size_index < size_count; size_index++) {
+                const ConversionTestSize* size = &conversion_test_sizes[size_index];
+
+                for (seed = 0; seed < seeds; seed++) {
+                    if (!check_conversion(src_info, dst_info, size, seed)) {
+                        printf("⚠️ converting format %d to %d at %dx%d to %dx%d with seed %d doesn't match the generic "
+                               "path\n",
+                               src_info->format,
+                               dst_info->format,
+                               size->src_width,
+                               size->src_height,
+                               size->dst_width,
+                               size->dst_height,
+                               seed);
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    printf("✅ all %d format pairs match the generic path, %d of them through row conversions\n",
+           format_count * format_count,
+           specialized_count);
+    return true;
+}
@@ -1,7 +1,9 @@
 #include "sf33rd/AcrSDK/ps2/flps2etc.h"
 #include "common.h"
+#include "port/mem_stats.h"
 #include "sf33rd/AcrSDK/common/fbms.h"
 #include "sf33rd/AcrSDK/common/memfound.h"
+#include "sf33rd/AcrSDK/common/memslab.h"
 #include "sf33rd/AcrSDK/common/plapx.h"
 #include "sf33rd/AcrSDK/common/plbmp.h"
 #include "sf33rd/AcrSDK/common/plcommon.h"
@@ -10,11 +12,16 @@
 #include "sf33rd/AcrSDK/ps2/flps2debug.h"
 #include "sf33rd/AcrSDK/ps2/flps2vram.h"
 #include "sf33rd/AcrSDK/ps2/foundaps2.h"
+#include "sf33rd/AcrSDK/common/prilay.h"
 #include "structs.h"
 
+#include <SDL3/SDL.h>
+
 #include <fcntl.h>
 #include <libgraph.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 
@@ -131,20 +138,43 @@ s32 flFileLength(s8* filename) {
     return length;
 }
 
-// FIXME: use memset instead
 void flMemset(void* dst, u32 pat, s32 size) {
+    if (size <= 0) {
+        return;
+    }
+
+    memset(dst, pat, size);
+}
+
+void flMemcpy(void* dst, void* src, s32 size) {
+    u8* now[2];
     s32 i;
-    u8* now = dst;
 
-    for (i = 0; i < size; i++) {
-        *now++ = pat;
+    if (size <= 0) {
+        return;
+    }
+
+    now[0] = dst;
+    now[1] = src;
+
+    // Copying forwards into a destination that overlaps the end of the source repeats the start of the source, which
+    // memmove doesn't do
+    if ((now[0] > now[1]) && (now[0] < now[1] + size)) {
+        for (i = 0; i < size; i++) {
+            *now[0]++ = *now[1]++;
+        }
+
+        return;
     }
+
+    memmove(dst, src, size);
 }
 
-// FIXME: use memcpy instead
-void flMemcpy(void* dst, void* src, s32 size) {
+// The byte loops that the memory helpers replaced, which they have to match
+
+static void copy_bytes_forward(void* dst, void* src, s32 size) {
+    u8* now[2];
     s32 i;
-    s8* now[2];
 
     now[0] = dst;
     now[1] = src;
@@ -154,6 +184,178 @@ void flMemcpy(void* dst, void* src, s32 size) {
     }
 }
 
+static void move_bytes(void* dst, void* src, s32 size) {
+    s8* now[2];
+    s32 i;
+
+    now[0] = dst;
+    now[1] = src;
+
+    if (src < dst && (now[1] + size) > now[0]) {
+        now[0] += size - 1;
+        now[1] += size - 1;
+
+        for (i = 0; i < size; i++) {
+            *(now[0]--) = *(now[1]--);
+        }
+
+        return;
+    }
+
+    for (i = 0; i < size; i++) {
+        *(now[0]++) = *(now[1]++);
+    }
+}
+
+static void fill_pattern(u8* data, s32 size) {
+    s32 i;
+
+    for (i = 0; i < size; i++) {
+        data[i] = i * 13;
+    }
+}
+
+/// Copy and move inside one buffer at every overlap with both the helpers and the byte loops, and swap random data
+/// byte by byte and with the swap helpers
+/// @return Whether all of them agreed.
+static bool check_memory_helpers() {
+    u8 expected[256];
+    u8 actual[256];
+    u8 swapped[256];
+    u32 seed = 0x3339;
+    s32 offset;
+    s32 size;
+    s32 i;
+
+    for (offset = -40; offset <= 40; offset++) {
+        for (size = 0; size <= 64; size++) {
+            fill_pattern(expected, sizeof(expected));
+            fill_pattern(actual, sizeof(actual));
+            move_bytes(expected + 100 + offset, expected + 100, size);
+            plMemmove(actual + 100 + offset, actual + 100, size);
+
+            if (memcmp(expected, actual, sizeof(expected)) != 0) {
+                printf("⚠️ plMemmove differs at offset %d, size %d\n", offset, size);
+                return false;
+            }
+
+            fill_pattern(expected, sizeof(expected));
+            fill_pattern(actual, sizeof(actual));
+            copy_bytes_forward(expected + 100 + offset, expected + 100, size);
+            flMemcpy(actual + 100 + offset, actual + 100, size);
+
+            if (memcmp(expected, actual, sizeof(expected)) != 0) {
+                printf("⚠️ flMemcpy differs at offset %d, size %d\n", offset, size);
+                return false;
+            }
+        }
+    }
+
+    for (i = 0; i < sizeof(expected); i++) {
+        seed = seed * 1103515245 + 12345;
+        expected[i] = seed >> 16;
+    }
+
+    memcpy(swapped, expected, sizeof(swapped));
+    plSwapBytes16(swapped, sizeof(swapped) / 2);
+
+    for (i = 0; i < sizeof(swapped); i++) {
+        if (swapped[i] != expected[i ^ 1]) {
+            printf("⚠️ plSwapBytes16 differs at byte %d\n", i);
+            return false;
+        }
+    }
+
+    memcpy(swapped, expected, sizeof(swapped));
+    plSwapBytes32(swapped, sizeof(swapped) / 4);
+
+    for (i = 0; i < sizeof(swapped); i++) {
+        if (swapped[i] != expected[i ^ 3]) {
+            printf("⚠️ plSwapBytes32 differs at byte %d\n", i);
+            return false;
+        }
+    }
+
+    memcpy(swapped, expected, sizeof(swapped));
+    plSwapNibbles(swapped, sizeof(swapped));
+
+    for (i = 0; i < sizeof(swapped); i++) {
+        if (swapped[i] != (u8)((expected[i] << 4) | (expected[i] >> 4))) {
+            printf("⚠️ plSwapNibbles differs at byte %d\n", i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool flRunMemoryBenchmark(s32 iterations) {
+    // A 512x512 texture at 32 bits per pixel, the largest copy that texture and palette loading does
+    const s32 size = 512 * 512 * 4;
+    // Compacting the system heap moves blocks a little towards its start
+    const s32 move_distance = 64;
+    u8* src;
+    u8* dst;
+    u64 start;
+    u64 bytes_ns;
+    u64 helper_ns;
+    s32 i;
+
+    if (!check_memory_helpers()) {
+        return false;
+    }
+
+    printf("✅ memory helpers match the byte loops they replaced\n");
+    src = malloc(size + move_distance);
+    dst = malloc(size);
+
+    if ((src == NULL) || (dst == NULL)) {
+        printf("⚠️ couldn't allocate the benchmark buffers\n");
+        free(src);
+        free(dst);
+        return true;
+    }
+
+    fill_pattern(src, size + move_distance);
+    start = SDL_GetTicksNS();
+
+    for (i = 0; i < iterations; i++) {
+        copy_bytes_forward(dst, src, size);
+    }
+
+    bytes_ns = SDL_GetTicksNS() - start;
+    start = SDL_GetTicksNS();
+
+    for (i = 0; i < iterations; i++) {
+        flMemcpy(dst, src, size);
+    }
+
+    helper_ns = SDL_GetTicksNS() - start;
+    printf("⏱️ texture copy: %.1f us with the byte loop, %.1f us with flMemcpy\n",
+           bytes_ns / 1000.0 / iterations,
+           helper_ns / 1000.0 / iterations);
+    start = SDL_GetTicksNS();
+
+    for (i = 0; i < iterations; i++) {
+        move_bytes(src, src + move_distance, size);
+    }
+
+    bytes_ns = SDL_GetTicksNS() - start;
+    start = SDL_GetTicksNS();
+
+    for (i = 0; i < iterations; i++) {
+        plMemmove(src, src + move_distance, size);
+    }
+
+    helper_ns = SDL_GetTicksNS() - start;
+    printf("⏱️ compaction move: %.1f us with the byte loop, %.1f us with plMemmove\n",
+           bytes_ns / 1000.0 / iterations,
+           helper_ns / 1000.0 / iterations);
+    free(src);
+    free(dst);
+    return true;
+}
+
 void* flAllocMemory(s32 size) {
     return fmsAllocMemory(&flFMS, size, 0);
 }
@@ -170,27 +372,83 @@ void* flAllocMemoryS(s32 size) {
     return fmsAllocMemory(&flFMS, size, 1);
 }
 
-u32 flPS2GetSystemMemoryHandle(s32 len, s32 type) {
-    u32 handle = mflRegisterS(len);
+typedef struct SystemMemorySite {
+    int site;
+    s32 len;
+} SystemMemorySite;
+
+static SystemMemorySite system_memory_sites[sizeof(sysmemblock) / sizeof(MEM_BLOCK)];
+static SystemMemorySite slab_sites[sizeof(sysmemblock) / sizeof(MEM_BLOCK)];
+
+static SystemMemorySite* get_site(u32 handle) {
+    SystemMemorySite* sites = system_memory_sites;
+
+    if (plslabIsHandle(handle)) {
+        sites = slab_sites;
+        handle &= ~MEM_SLAB_HANDLE_FLAG;
+    }
+
+    if ((handle == 0) || (handle > (sizeof(system_memory_sites) / sizeof(SystemMemorySite)))) {
+        return NULL;
+    }
+
+    return &sites[handle - 1];
+}
+
+u32 flPS2GetSystemMemoryHandleAt(s32 len, s32 type, const char* site) {
+    u32 handle = 0;
+
+    // Textures and palettes come and go with every character and stage. Serving them from slabs keeps them from
+    // fragmenting the system heap, which would otherwise have to be compacted
+    if (type == 2) {
+        handle = plslabRegister(len);
+    }
+
+    if (handle == 0) {
+        handle = mflRegisterS(len);
+    }
 
     if (handle == 0) {
         flCompact();
         handle = mflRegister(len);
 
         if (handle == 0) {
+            MemStats_Dump("system memory exhausted");
             flPS2SystemError(0, "ERROR flPS2GetSystemMemoryHandle flps2etc.c");
             while (1) {}
         }
     }
 
+    SystemMemorySite* entry = get_site(handle);
+
+    if (entry != NULL) {
+        entry->site = MemStats_NoteSiteAlloc(&sysmemmgr, site, type, len);
+        entry->len = len;
+    }
+
     return handle;
 }
 
 void flPS2ReleaseSystemMemory(u32 handle) {
-    mflRelease(handle);
+    SystemMemorySite* entry = get_site(handle);
+
+    if (entry != NULL) {
+        MemStats_NoteSiteFree(entry->site, entry->len);
+        entry->site = -1;
+    }
+
+    if (plslabIsHandle(handle)) {
+        plslabRelease(handle);
+    } else {
+        mflRelease(handle);
+    }
 }
 
 void* flPS2GetSystemBuffAdrs(u32 handle) {
+    if (plslabIsHandle(handle)) {
+        return plslabRetrieve(handle);
+    }
+
     return mflRetrieve(handle);
 }
 
@@ -3,6 +3,7 @@
 #include "sf33rd/AcrSDK/MiddleWare/PS2/CapSndEng/cse.h"
 #include "sf33rd/AcrSDK/common/fbms.h"
 #include "sf33rd/AcrSDK/common/memfound.h"
+#include "sf33rd/AcrSDK/common/memslab.h"
 #include "sf33rd/AcrSDK/common/mlPAD.h"
 #include "sf33rd/AcrSDK/common/prilay.h"
 #include "sf33rd/AcrSDK/ps2/flps2debug.h"
@@ -60,6 +61,7 @@ static s32 system_work_init() {
     const int system_memory_size = 0xA00000;
     temp = flAllocMemoryS(system_memory_size);
     mflInit(temp, system_memory_size, 0x40);
+    plslabInit();
 
     return 1;
 }
@@ -1,13 +1,25 @@
 #include "sf33rd/Source/Common/MemMan.h"
 #include "common.h"
+#include "port/mem_stats.h"
+#include "port/memman_trace.h"
+
+#include <SDL3/SDL.h>
 
 u32 mmInitialNumber;
 
+static bool use_linear_search = false;
+
+static void insert_gap(_MEMMAN_OBJ* mmobj, struct _MEMMAN_CELL* owner);
+
 void mmSystemInitialize() {
     mmInitialNumber = 0;
 }
 
 void mmHeapInitialize(_MEMMAN_OBJ* mmobj, u8* adrs, s32 size, s32 unit, s8* format) {
+    if (unit < (s32)sizeof(_MEMMAN_GAP)) {
+        fatal_error("MemMan unit %d is too small to track free gaps", unit);
+    }
+
     mmobj->oriHead = adrs;
     mmobj->oriSize = size;
     mmobj->ownUnit = unit;
@@ -24,6 +36,11 @@ void mmHeapInitialize(_MEMMAN_OBJ* mmobj, u8* adrs, s32 size, s32 unit, s8* form
     mmobj->cell_fin->prev = mmobj->cell_1st;
     mmobj->cell_fin->next = NULL;
     mmobj->cell_fin->size = mmobj->ownUnit;
+    SDL_zeroa(mmobj->gapBin);
+    mmobj->gapBinMap = 0;
+    insert_gap(mmobj, mmobj->cell_1st);
+    MemStats_RegisterHeap(mmobj, MEM_STATS_HEAP_MEMMAN, (const char*)format, mmobj->memSize);
+    MemManTrace_NoteHeap(mmobj);
 }
 
 uintptr_t mmRoundUp(s32 unit, uintptr_t num) {
@@ -38,6 +55,10 @@ void mmDebWriteTag(s8* /* unused */) {
     // Do nothing
 }
 
+void mmUseLinearSearch(bool use) {
+    use_linear_search = use;
+}
+
 ssize_t mmGetRemainder(_MEMMAN_OBJ* mmobj) {
     return mmobj->remainder;
 }
@@ -46,33 +67,128 @@ ssize_t mmGetRemainderMin(_MEMMAN_OBJ* mmobj) {
     return mmobj->remainderMin;
 }
 
-u8* mmAlloc(_MEMMAN_OBJ* mmobj, ssize_t size, s32 flag) {
-    struct _MEMMAN_CELL* cell = mmAllocSub(mmobj, size, flag);
+// Free gap index
+//
+// Every run of free space is owned by the cell right before it and is binned by size, so that allocation only has to
+// look at gaps that are big enough instead of walking every cell in the heap. Bins are split at powers of two and once
+// more in the middle, so all gaps in a bin are smaller than all gaps in the next one.
 
-    if (cell == NULL) {
-        return NULL;
+static ptrdiff_t gap_size(const struct _MEMMAN_CELL* owner) {
+    return (intptr_t)owner->next - (intptr_t)owner - owner->size;
+}
+
+static s32 gap_bin(const _MEMMAN_OBJ* mmobj, ptrdiff_t gap) {
+    const uintptr_t units = gap / mmobj->ownUnit;
+    s32 log2 = 0;
+
+    while ((units >> (log2 + 1)) != 0) {
+        log2 += 1;
     }
 
-    mmobj->remainder -= cell->size;
+    const s32 upper_half = (log2 > 0) ? ((units >> (log2 - 1)) & 1) : 0;
+    return SDL_min(log2 * 2 + upper_half, MEMMAN_GAP_BINS - 1);
+}
 
-    if (mmobj->remainderMin > mmobj->remainder) {
-        mmobj->remainderMin = mmobj->remainder;
+static _MEMMAN_GAP* gap_of(const struct _MEMMAN_CELL* owner) {
+    return (_MEMMAN_GAP*)((uintptr_t)owner + owner->size);
+}
+
+/// Has to be called after the gap following `owner` has been created or resized.
+static void insert_gap(_MEMMAN_OBJ* mmobj, struct _MEMMAN_CELL* owner) {
+    const ptrdiff_t gap = gap_size(owner);
+
+    if (gap <= 0) {
+        return;
     }
 
-    return (u8*)cell + mmobj->ownUnit;
+    _MEMMAN_GAP* node = gap_of(owner);
+    const s32 bin = gap_bin(mmobj, gap);
+
+    node->owner = owner;
+    node->prev = NULL;
+    node->next = mmobj->gapBin[bin];
+
+    if (node->next != NULL) {
+        node->next->prev = node;
+    }
+
+    mmobj->gapBin[bin] = node;
+    mmobj->gapBinMap |= (u64)1 << bin;
 }
 
-struct _MEMMAN_CELL* mmAllocSub(_MEMMAN_OBJ* mmobj, ssize_t size, s32 flag) {
+/// Has to be called before the gap following `owner` is resized or filled.
+static void remove_gap(_MEMMAN_OBJ* mmobj, struct _MEMMAN_CELL* owner) {
+    const ptrdiff_t gap = gap_size(owner);
+
+    if (gap <= 0) {
+        return;
+    }
+
+    _MEMMAN_GAP* node = gap_of(owner);
+    const s32 bin = gap_bin(mmobj, gap);
+
+    if (node->prev != NULL) {
+        node->prev->next = node->next;
+    } else {
+        mmobj->gapBin[bin] = node->next;
+    }
+
+    if (node->next != NULL) {
+        node->next->prev = node->prev;
+    }
+
+    if (mmobj->gapBin[bin] == NULL) {
+        mmobj->gapBinMap &= ~((u64)1 << bin);
+    }
+}
+
+/// @brief Find the gap that fits `sizeTrue` most tightly.
+///
+/// Ties go to the lowest address when allocating from the front (`flag != 1`) and to the highest address when
+/// allocating from the back, which is the order in which the cell list used to be walked.
+///
+/// @return Cell that owns the gap.
+static struct _MEMMAN_CELL* find_gap(const _MEMMAN_OBJ* mmobj, ssize_t sizeTrue, s32 flag) {
+    for (s32 bin = gap_bin(mmobj, sizeTrue); bin < MEMMAN_GAP_BINS; bin++) {
+        if (!(mmobj->gapBinMap & ((u64)1 << bin))) {
+            continue;
+        }
+
+        struct _MEMMAN_CELL* best = NULL;
+        ptrdiff_t best_gap = 0;
+
+        for (_MEMMAN_GAP* node = mmobj->gapBin[bin]; node != NULL; node = node->next) {
+            const ptrdiff_t gap = gap_size(node->owner);
+
+            if (gap < sizeTrue) {
+                continue;
+            }
+
+            const bool is_better = (best == NULL) || (gap < best_gap) ||
+                                   ((gap == best_gap) && ((flag != 1) ? (node->owner < best) : (node->owner > best)));
+
+            if (is_better) {
+                best = node->owner;
+                best_gap = gap;
+            }
+        }
+
+        // Gaps in the following bins are all bigger than the ones in this bin
+        if (best != NULL) {
+            return best;
+        }
+    }
+
+    return NULL;
+}
+
+/// Best-fit search that walks the whole cell list, the way gaps were found before they were indexed
+static struct _MEMMAN_CELL* find_gap_linear(const _MEMMAN_OBJ* mmobj, ssize_t sizeTrue, s32 flag) {
     struct _MEMMAN_CELL* myself;
     struct _MEMMAN_CELL* next;
-    struct _MEMMAN_CELL* cell;
-    ssize_t sizeTrue;
+    struct _MEMMAN_CELL* cell = NULL;
     ptrdiff_t gap;
-    ptrdiff_t gapMin;
-
-    sizeTrue = mmobj->ownUnit + mmRoundUp(mmobj->ownUnit, size);
-    gapMin = 0x7FFFFFFF;
-    cell = NULL;
+    ptrdiff_t gapMin = 0x7FFFFFFF;
 
     if (flag != 1) {
         myself = mmobj->cell_1st;
@@ -81,32 +197,15 @@ struct _MEMMAN_CELL* mmAllocSub(_MEMMAN_OBJ* mmobj, ssize_t size, s32 flag) {
             next = myself->next;
             gap = (intptr_t)next - (intptr_t)myself - myself->size;
 
-            if (gap >= sizeTrue) {
-                if (gap == sizeTrue) {
-                    cell = myself;
-                    break;
-                } else {
-                    if ((gap - sizeTrue) < gapMin) {
-                        gapMin = gap - sizeTrue;
-                        cell = myself;
-                    }
-                }
+            if ((gap >= sizeTrue) && ((gap - sizeTrue) < gapMin)) {
+                gapMin = gap - sizeTrue;
+                cell = myself;
             }
 
             myself = next;
         } while (myself->next != NULL);
 
-        if (cell == NULL) {
-            return NULL;
-        }
-
-        myself = (struct _MEMMAN_CELL*)((uintptr_t)cell + cell->size);
-        myself->prev = cell;
-        myself->next = cell->next;
-        myself->size = sizeTrue;
-        cell->next->prev = myself;
-        cell->next = myself;
-        return myself;
+        return cell;
     }
 
     myself = mmobj->cell_fin;
@@ -115,31 +214,84 @@ struct _MEMMAN_CELL* mmAllocSub(_MEMMAN_OBJ* mmobj, ssize_t size, s32 flag) {
         next = myself->prev;
         gap = (intptr_t)myself - (intptr_t)next - next->size;
 
-        if (gap >= sizeTrue) {
-            if (gap == sizeTrue) {
-                cell = myself;
-                break;
-            } else {
-                if ((gap - sizeTrue) < gapMin) {
-                    gapMin = gap - sizeTrue;
-                    cell = myself;
-                }
-            }
+        if ((gap >= sizeTrue) && ((gap - sizeTrue) < gapMin)) {
+            gapMin = gap - sizeTrue;
+            cell = next;
         }
 
         myself = next;
     } while (myself->prev != NULL);
 
+    return cell;
+}
+
+u8* mmAlloc(_MEMMAN_OBJ* mmobj, ssize_t size, s32 flag) {
+    struct _MEMMAN_CELL* cell = mmAllocSub(mmobj, size, flag);
+
     if (cell == NULL) {
+        MemStats_NoteFailure(mmobj, size);
+        MemManTrace_NoteAlloc(mmobj, size, flag, NULL);
         return NULL;
     }
 
-    myself = (struct _MEMMAN_CELL*)((uintptr_t)cell - sizeTrue);
-    myself->prev = cell->prev;
-    myself->next = cell;
+    mmobj->remainder -= cell->size;
+    MemStats_NoteAlloc(mmobj, cell->size);
+
+    if (mmobj->remainderMin > mmobj->remainder) {
+        mmobj->remainderMin = mmobj->remainder;
+    }
+
+    u8* adrs = (u8*)cell + mmobj->ownUnit;
+    MemManTrace_NoteAlloc(mmobj, size, flag, adrs);
+    return adrs;
+}
+
+struct _MEMMAN_CELL* mmAllocSub(_MEMMAN_OBJ* mmobj, ssize_t size, s32 flag) {
+    struct _MEMMAN_CELL* myself;
+    struct _MEMMAN_CELL* cell;
+    ssize_t sizeTrue;
+
+    sizeTrue = mmobj->ownUnit + mmRoundUp(mmobj->ownUnit, size);
+    if (use_linear_search) {
+        cell = find_gap_linear(mmobj, sizeTrue, flag);
+    } else {
+        cell = find_gap(mmobj, sizeTrue, flag);
+    }
+
+#if defined(DEBUG)
+    if (!use_linear_search && (cell != find_gap_linear(mmobj, sizeTrue, flag))) {
+        fatal_error("MemMan gap index picked a different gap than a linear search (size = %zd, flag = %d)",
+                    sizeTrue,
+                    flag);
+    }
+#endif
+
+    if (cell == NULL) {
+        return NULL;
+    }
+
+    remove_gap(mmobj, cell);
+
+    if (flag != 1) {
+        // Place the new cell at the start of the gap
+        myself = (struct _MEMMAN_CELL*)((uintptr_t)cell + cell->size);
+        myself->prev = cell;
+        myself->next = cell->next;
+        myself->size = sizeTrue;
+        cell->next->prev = myself;
+        cell->next = myself;
+        insert_gap(mmobj, myself);
+        return myself;
+    }
+
+    // Place the new cell at the end of the gap
+    myself = (struct _MEMMAN_CELL*)((uintptr_t)cell->next - sizeTrue);
+    myself->prev = cell;
+    myself->next = cell->next;
     myself->size = sizeTrue;
-    cell->prev->next = myself;
-    cell->prev = myself;
+    cell->next->prev = myself;
+    cell->next = myself;
+    insert_gap(mmobj, cell);
     return myself;
 }
 
@@ -149,8 +301,13 @@ void mmFree(_MEMMAN_OBJ* mmobj, u8* adrs) {
     if (adrs != NULL) {
         cell = (struct _MEMMAN_CELL*)((intptr_t)adrs - mmobj->ownUnit);
         mmobj->remainder += cell->size;
+        MemStats_NoteFree(mmobj, cell->size);
+        MemManTrace_NoteFree(mmobj, adrs);
+        remove_gap(mmobj, cell->prev);
+        remove_gap(mmobj, cell);
         cell->prev->next = cell->next;
         cell->next->prev = cell->prev;
+        insert_gap(mmobj, cell->prev);
     } else {
         return;
     }
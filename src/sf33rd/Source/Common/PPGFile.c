@@ -2,6 +2,8 @@
 #include "common.h"
 #include "port/sdl/sdl_game_renderer.h"
 #include "sf33rd/AcrSDK/common/plcommon.h"
+#include "sf33rd/AcrSDK/common/prilay.h"
+#include "sf33rd/AcrSDK/ps2/flps2etc.h"
 #include "sf33rd/AcrSDK/ps2/flps2render.h"
 #include "sf33rd/AcrSDK/ps2/flps2vram.h"
 #include "sf33rd/AcrSDK/ps2/foundaps2.h"
@@ -16,7 +18,6 @@
 #define REVERT_U32(val)                                                                                                \
     (((val & 0xFF) << 0x18) | ((val & 0xFF00) << 8) | ((val >> 8) & 0xFF00) | ((val >> 0x18) & 0xFF))
 #define REVERT_U16(val) (((val >> 8) & 0xFF) | ((val & 0xFF) << 8))
-#define REVERT_U8(val) (((val << 4) & 0xF0) | ((val >> 4) & 0xF))
 
 #define CODE_0(val) ((val & 0xF0) << 8) + ((val & 0xF) << 4)
 #define CODE_1(val) ((val & 0x38) << 0xA) + ((val & 7) << 5)
@@ -411,20 +412,12 @@ s32 ppgWriteQuadUseTrans(Vertex* pos, u32 col, PPGDataList* tb, s32 tix, s32 cix
 }
 
 ssize_t ppgDecompress(s32 koCmpr, void* srcAdrs, s32 srcSize, void* dstAdrs, s32 dstSize) {
-    u8* src;
-    u8* dst;
-    s32 i;
     ssize_t rnum = 0;
 
     switch (koCmpr) {
     default:
         if (srcAdrs != dstAdrs) {
-            src = srcAdrs;
-            dst = dstAdrs;
-
-            for (i = 0; i < dstSize; i++) {
-                *dst++ = *src++;
-            }
+            flMemcpy(dstAdrs, srcAdrs, dstSize);
         }
 
         rnum = srcSize;
@@ -683,10 +676,6 @@ error_handler:
 }
 
 void ppgChangeDataEndian(u8* adrs, s32 size, s32 dendL, s32 col4, s32 depth, s32 excdot) {
-    s32 i;
-    u32* c4;
-    u16* c2;
-
     if (depth == 1) {
         return;
     }
@@ -694,17 +683,9 @@ void ppgChangeDataEndian(u8* adrs, s32 size, s32 dendL, s32 col4, s32 depth, s32
     if (depth != 0) {
         if (dendL == 0) {
             if (col4 != 0) {
-                c4 = (u32*)adrs;
-
-                for (i = 0; i < size / 4; i++) {
-                    c4[i] = REVERT_U32(c4[i]);
-                }
+                plSwapBytes32(adrs, size / 4);
             } else {
-                c2 = (u16*)adrs;
-
-                for (i = 0; i < size / 2; i++) {
-                    c2[i] = REVERT_U16(c2[i]);
-                }
+                plSwapBytes16(adrs, size / 2);
             }
         }
 
@@ -712,9 +693,7 @@ void ppgChangeDataEndian(u8* adrs, s32 size, s32 dendL, s32 col4, s32 depth, s32
     }
 
     if (excdot != 0) {
-        for (i = 0; i < size; i++) {
-            adrs[i] = REVERT_U8(adrs[i]);
-        }
+        plSwapNibbles(adrs, size);
     }
 }
 
@@ -5,1004 +5,393 @@
 
 #include "sf33rd/Source/Game/com/active/active00.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Pattern00_Tbl[68])();
-
-void Computer00(PLW* wk) {
-    Pattern00_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Pattern00_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x100);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 2, 0x10);
-        break;
-
-    case 1:
-        Jump(wk, 1);
-        break;
-
-    case 2:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 8, 0x40, 2, -0x7F90, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x50, 2, 0);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 0, 6, 0x99);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FB0, 8, 0x10, 0, 8, 8, 8);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 8, 0x400, 0, -0x7F90, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Search_Back_Term(wk, 0x60, 2, 0x12);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x83, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 2, 0);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FB0, 0xB, 0x20, 0, -0x7F90, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xC3, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xC, 0x100);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 0xC, 0x100);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xC, 0x10);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 0xC, 0x20);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x20);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        ETC_Term(wk, 0, 6, 0x99);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x40);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xA, 0x202);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x200);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern00_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
+static const s16 Pattern00_0000[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Pattern00_0001[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0002[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern00_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x12);
-        break;
+static const s16 Pattern00_0003[] = {
+    COM_ADJUST_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
+static const s16 Pattern00_0004[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Pattern00_0005[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0006[] = {
+    COM_WAIT, 0,
+    COM_END,
+};
 
-void Pattern00_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 8, 0x400, 0, -1, -1, -1);
-        break;
+static const s16 Pattern00_0007[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0008[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Pattern00_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 8, 0x40, 0, -1, -1, -1);
-        break;
+static const s16 Pattern00_0009[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 2, 0x10,
+    COM_JUMP, 1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0010[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Pattern00_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FC0, 8, 0x400, 0, -1, -1, 0xFFFF);
-        break;
+static const s16 Pattern00_0011[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0012[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Pattern00_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x39, 0x39, 0x41, 0x41, 0);
-        break;
+static const s16 Pattern00_0013[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0014[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 8, 0x40, 2, -0x7F90, 8, 0x20,
+    COM_END,
+};
 
-void Pattern00_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x39, 0x39, 0x41, 0x41, 0);
-        break;
+static const s16 Pattern00_0015[] = {
+    COM_WALK, 0, 0x30, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0016[] = {
+    COM_SEARCH_BACK_TERM, 0x50, 2, 0,
+    COM_WALK, 1, 0x30, 0,
+    COM_END,
+};
 
-void Pattern00_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x39, 0x39, 0x41, 0x41, 0);
-        break;
+static const s16 Pattern00_0017[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0018[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Pattern00_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern00_0019[] = {
+    COM_ETC_TERM, 0, 6, 0x99,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0020[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FB0, 8, 0x10, 0, 8, 8, 8,
+    COM_END,
+};
 
-void Pattern00_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
+static const s16 Pattern00_0021[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 8, 0x400, 0, -0x7F90, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0022[] = {
+    COM_PIERCE_ON,
+    COM_SEARCH_BACK_TERM, 0x60, 2, 0x12,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Pattern00_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Pattern00_0023[] = {
+    COM_APPROACH_WALK, 0x83, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0024[] = {
+    COM_WALK, 0, 0x60, 0,
+    COM_END,
+};
 
-void Pattern00_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 0, 6, 0x9A);
-        break;
+static const s16 Pattern00_0025[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 2, 0,
+    COM_WALK, 1, 0x60, 0,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 2, 0x31, 0x31, 0x31, 0x32, 0);
-        break;
+static const s16 Pattern00_0026[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0027[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FB0, 0xB, 0x20, 0, -0x7F90, 8, 0x20,
+    COM_END,
+};
 
-void Pattern00_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x31, 0x31, 0x32, 0x33, 0);
-        break;
+static const s16 Pattern00_0028[] = {
+    COM_APPROACH_WALK, 0xC3, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0029[] = {
+    COM_ADJUST_ATTACK, 0xC, 0x100,
+    COM_ADJUST_ATTACK, 0xC, 0x100,
+    COM_ADJUST_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Pattern00_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x31, 0x32, 0x32, 0x33, 0);
-        break;
+static const s16 Pattern00_0030[] = {
+    COM_ADJUST_ATTACK, 0xC, 0x10,
+    COM_ADJUST_ATTACK, 0xC, 0x20,
+    COM_ADJUST_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0031[] = {
+    COM_NORMAL_ATTACK, 9, 0x20,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern00_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
+static const s16 Pattern00_0032[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x10,
+    COM_LEVER_ATTACK, 8, 1, 0x20,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x110);
-        break;
+static const s16 Pattern00_0033[] = {
+    COM_ADJUST_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0034[] = {
+    COM_ADJUST_ATTACK, 9, 0x100,
+    COM_ETC_TERM, 0, 6, 0x99,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Pattern00_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 2, 0x10);
-        break;
+static const s16 Pattern00_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 1:
-        Jump_Attack_Term(wk, -1, -0x7FB8, 8, 0x400, 1, -0x7F90, -1, 0x200);
-        break;
+static const s16 Pattern00_0036[] = {
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0037[] = {
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_LEVER_ATTACK, 8, 1, 0x20,
+    COM_END,
+};
 
-void Pattern00_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_SA(wk, 2, 0x34);
-        break;
+static const s16 Pattern00_0038[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 0xA, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x8018, 0xA, -1);
-        break;
+static const s16 Pattern00_0039[] = {
+    COM_NORMAL_ATTACK, 9, 0x200,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0040[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern00_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
+static const s16 Pattern00_0041[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Look(wk, 0);
-        break;
+static const s16 Pattern00_0042[] = {
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0043[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 8, 0x400, 0, -1, -1, -1,
+    COM_END,
+};
 
-void Pattern00_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
+static const s16 Pattern00_0044[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 8, 0x40, 0, -1, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0045[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FC0, 8, 0x400, 0, -1, -1, (s16)0xFFFF,
+    COM_END,
+};
 
-void Pattern00_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
+static const s16 Pattern00_0046[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x39, 0x39, 0x41, 0x41, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0047[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x39, 0x39, 0x41, 0x41, 0,
+    COM_END,
+};
 
-void Pattern00_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x12);
-        break;
+static const s16 Pattern00_0048[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x39, 0x39, 0x41, 0x41, 0,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x22);
-        break;
+static const s16 Pattern00_0049[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0050[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Pattern00_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x22);
-        break;
+static const s16 Pattern00_0051[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0052[] = {
+    COM_ETC_TERM, 0, 6, 0x9A,
+    COM_COM_RANDOM_SELECT, 2, 0x31, 0x31, 0x31, 0x32, 0,
+    COM_END,
+};
 
-void Pattern00_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 1, 0x20);
-        break;
+static const s16 Pattern00_0053[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x31, 0x31, 0x32, 0x33, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0054[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x31, 0x32, 0x32, 0x33, 0,
+    COM_END,
+};
 
-void Pattern00_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0xA);
-        break;
+static const s16 Pattern00_0055[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0056[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 2, 0x10,
+    COM_JUMP_ATTACK_TERM, -1, -0x7FB8, 8, 0x400, 1, -0x7F90, -1, 0x200,
+    COM_END,
+};
 
-void Pattern00_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_SA(wk, 2, 0x34);
-        break;
+static const s16 Pattern00_0057[] = {
+    COM_CHECK_SA, 2, 0x34,
+    COM_COMMAND_ATTACK, 8, (s16)0x8018, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x8019, 0xA, -1);
-        break;
+static const s16 Pattern00_0058[] = {
+    COM_JUMP, 0,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0059[] = {
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-void Pattern00_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 0, 6, 0x9A);
-        break;
+static const s16 Pattern00_0060[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern00_0061[] = {
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0062[] = {
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_END,
+};
 
-void Pattern00_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 0, 6, 0x9A);
-        break;
+static const s16 Pattern00_0063[] = {
+    COM_LEVER_ATTACK, 8, 1, 0x20,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern00_0064[] = {
+    COM_WAIT, 0xA,
+    COM_END,
+};
 
-    case 2:
-        ETC_Term(wk, 0, 6, 0x9A);
-        break;
+static const s16 Pattern00_0065[] = {
+    COM_CHECK_SA, 2, 0x34,
+    COM_COMMAND_ATTACK, 8, (s16)0x8019, 0xA, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern00_0066[] = {
+    COM_ETC_TERM, 0, 6, 0x9A,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern00_0067[] = {
+    COM_ETC_TERM, 0, 6, 0x9A,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_ETC_TERM, 0, 6, 0x9A,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void (*const Pattern00_Tbl[68])(PLW*) = {
+const s16* const Pattern00_Tbl[68] = {
     Pattern00_0000, Pattern00_0001, Pattern00_0002, Pattern00_0003, Pattern00_0004, Pattern00_0005, Pattern00_0006,
     Pattern00_0007, Pattern00_0008, Pattern00_0009, Pattern00_0010, Pattern00_0011, Pattern00_0012, Pattern00_0013,
     Pattern00_0014, Pattern00_0015, Pattern00_0016, Pattern00_0017, Pattern00_0018, Pattern00_0019, Pattern00_0020,
@@ -1014,3 +403,7 @@ void (*const Pattern00_Tbl[68])(PLW*) = {
     Pattern00_0056, Pattern00_0057, Pattern00_0058, Pattern00_0059, Pattern00_0060, Pattern00_0061, Pattern00_0062,
     Pattern00_0063, Pattern00_0064, Pattern00_0065, Pattern00_0066, Pattern00_0067
 };
+
+void Computer00(PLW* wk) {
+    Exec_Com_Pattern(wk, Pattern00_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
@@ -5,1131 +5,439 @@
 
 #include "sf33rd/Source/Game/com/active/active02.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Pattern02_Tbl[75])();
-
-void Computer02(PLW* wk) {
-    Pattern02_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Pattern02_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 0, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 1, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0x1E);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F90, -0x7FC0, 0, 0x200, 0, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC8, 8, 0x200, 2, -0x7F80, -1, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 1);
-        break;
-
-    case 1:
-        Lever_Off(wk);
-        break;
-
-    case 2:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, 0x88, -1, 0, 2, 5);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x41, 0x42, 0x43, 0x44, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC8, 8, 0x40, 0, -0x7f90, -1, 0x100);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 1:
-        Lever_Off(wk);
-        break;
-
-    case 2:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x200, 0, -0x7f68, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x10);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0, 0x100);
-        break;
-
-    case 1:
-        Lever_Off(wk);
-        break;
-
-    case 2:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xA, 0x202);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x202);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x40, 0, -1, 0x30, 0x401E);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x40, 0, -1, 0x30, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x400, 0, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x15, 0);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x13, 0);
-        break;
-
-    case 2:
-        Walk(wk, 0, 0x10, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Command_Attack_Term(wk, 8, 0x1E, 0xA, -1, -0x7FA0, 0x30, 0, -1, 0x30, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern02_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, 0x50, -1, 5, 2, 0);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, 0x8060, 0x8040, 9, 0x400, 0, 0x8080, -1, 0x200);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x42);
-        break;
-
-    case 3:
-        Command_Attack(wk, 0xc, 0x1d, 10, -1);
-        break;
-
-    case 4:
-        Wait(wk, 5);
-        break;
-
-    case 5:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0x47);
-        break;
+static const s16 Pattern02_0000[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0001[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_END,
+};
 
-void Pattern02_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FA0, -1, 0x400);
-        break;
+static const s16 Pattern02_0002[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
+static const s16 Pattern02_0003[] = {
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_ADJUST_ATTACK, 0, 0x10,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 0xC, 0x1D, 0xA, -1);
-        break;
+static const s16 Pattern02_0004[] = {
+    COM_COMMAND_ATTACK, 1, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 3:
-        Wait(wk, 5);
-        break;
+static const s16 Pattern02_0005[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    case 4:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0x47);
-        break;
+static const s16 Pattern02_0006[] = {
+    COM_WAIT, 0x1E,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0007[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-void Pattern02_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack(wk, 8, 0xA, 0x400, 2);
-        break;
+static const s16 Pattern02_0008[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F90, -0x7FC0, 0, 0x200, 0, -1, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0009[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Pattern02_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, 0x30, 8, 0x40, 0, -1, -1, 0xFFFF);
-        break;
+static const s16 Pattern02_0010[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0011[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Pattern02_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Command_Attack_Term(wk, 8, 0x1E, 0xA, -1, -1, 0x30, 0, -1, -1, 0xFFFF);
-        break;
+static const s16 Pattern02_0012[] = {
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0013[] = {
+    COM_NORMAL_ATTACK, 9, 0x200,
+    COM_END,
+};
 
-void Pattern02_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8014, 0xA, -1);
-        break;
+static const s16 Pattern02_0014[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC8, 8, 0x200, 2, -0x7F80, -1, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0015[] = {
+    COM_WALK, 0, 0x30, 0,
+    COM_END,
+};
 
-void Pattern02_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 0xA, -1);
-        break;
+static const s16 Pattern02_0016[] = {
+    COM_WALK, 1, 0x30, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0017[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern02_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Setup_DENJIN_LEVEL(wk);
-        break;
+static const s16 Pattern02_0018[] = {
+    COM_JUMP, 1,
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0019[] = {
+    COM_EM_TERM, 0x88, -1, 0, 2, 5,
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-void Pattern02_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8015, 8, -1);
-        break;
+static const s16 Pattern02_0020[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x41, 0x42, 0x43, 0x44, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0021[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-void Pattern02_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8015, 9, -1);
-        break;
+static const s16 Pattern02_0022[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC8, 8, 0x40, 0, -0x7F90, -1, 0x100,
+    COM_END,
+};
 
-    case 1:
-        Push_Shot(wk, 5);
-        break;
+static const s16 Pattern02_0023[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0024[] = {
+    COM_WALK, 0, 0x60, 0,
+    COM_END,
+};
 
-void Pattern02_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8015, 9, -1);
-        break;
+static const s16 Pattern02_0025[] = {
+    COM_WALK, 1, 0x60, 0,
+    COM_END,
+};
 
-    case 1:
-        Push_Shot(wk, 0xB);
-        break;
+static const s16 Pattern02_0026[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0027[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-void Pattern02_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8015, 9, -1);
-        break;
+static const s16 Pattern02_0028[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_END,
+};
 
-    case 1:
-        Push_Shot(wk, 0x10);
-        break;
+static const s16 Pattern02_0029[] = {
+    COM_ADJUST_ATTACK, 9, 0x100,
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0030[] = {
+    COM_ADJUST_ATTACK, 9, 0x100,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-void Pattern02_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8015, 0xA, -1);
-        break;
+static const s16 Pattern02_0031[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x200, 0, -0x7F68, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Push_Shot(wk, 0xFF);
-        break;
+static const s16 Pattern02_0032[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x10,
+    COM_ADJUST_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0033[] = {
+    COM_ADJUST_ATTACK, 9, 0x10,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Pattern02_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    default:
-        End_Pattern(wk);
-    }
-}
+static const s16 Pattern02_0034[] = {
+    COM_NORMAL_ATTACK, 0, 0x100,
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Pattern02_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0x36, 0xFFFF, 0x47);
-        break;
+static const s16 Pattern02_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x19, 0x3C);
-        break;
+static const s16 Pattern02_0036[] = {
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0037[] = {
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_END,
+};
 
-void Pattern02_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F90, -0x7FC0, 8, 0x200, 0, -0x7F68, -1, 0x400);
-        break;
+static const s16 Pattern02_0038[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 0xA, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0039[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Pattern02_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7F80, -1, 0x400);
-        break;
+static const s16 Pattern02_0040[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x202,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x202);
-        break;
+static const s16 Pattern02_0041[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 0xC, 0x1D, 0xA, -1);
-        break;
+static const s16 Pattern02_0042[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    case 3:
-        Wait(wk, 5);
-        break;
+static const s16 Pattern02_0043[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x40, 0, -1, 0x30, 0x401E,
+    COM_END,
+};
 
-    case 4:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
+static const s16 Pattern02_0044[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x40, 0, -1, 0x30, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0045[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x400, 0, -1, -1, -1,
+    COM_END,
+};
 
-void Pattern02_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Pattern02_0046[] = {
+    COM_WALK, 0, 0x15, 0,
+    COM_WALK, 1, 0x13, 0,
+    COM_WALK, 0, 0x10, 0,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Pattern02_0047[] = {
+    COM_HI_JUMP_COMMAND_ATTACK_TERM, 8, 0x1E, 0xA, -1, -0x7FA0, 0x30, 0, -1, 0x30, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0048[] = {
+    COM_EM_TERM, 0x50, -1, 5, 2, 0,
+    COM_JUMP_ATTACK_TERM, (s16)0x8060, (s16)0x8040, 9, 0x400, 0, (s16)0x8080, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x42,
+    COM_COMMAND_ATTACK, 0xC, 0x1D, 10, -1,
+    COM_WAIT, 5,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0x47,
+    COM_END,
+};
 
-void Pattern02_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Pattern02_0049[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FA0, -1, 0x400,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_COMMAND_ATTACK, 0xC, 0x1D, 0xA, -1,
+    COM_WAIT, 5,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0x47,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
+static const s16 Pattern02_0050[] = {
+    COM_HI_JUMP_ATTACK, 8, 0xA, 0x400, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0051[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, 0x30, 8, 0x40, 0, -1, -1, (s16)0xFFFF,
+    COM_END,
+};
 
-void Pattern02_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
+static const s16 Pattern02_0052[] = {
+    COM_HI_JUMP_COMMAND_ATTACK_TERM, 8, 0x1E, 0xA, -1, -1, 0x30, 0, -1, -1, (s16)0xFFFF,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Pattern02_0053[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8014, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0054[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 0xA, -1,
+    COM_END,
+};
 
-void Pattern02_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
+static const s16 Pattern02_0055[] = {
+    COM_SETUP_DENJIN_LEVEL,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Pattern02_0056[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8015, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0057[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8015, 9, -1,
+    COM_PUSH_SHOT, 5,
+    COM_END,
+};
 
-void Pattern02_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
+static const s16 Pattern02_0058[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8015, 9, -1,
+    COM_PUSH_SHOT, 0xB,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
+static const s16 Pattern02_0059[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8015, 9, -1,
+    COM_PUSH_SHOT, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0060[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8015, 0xA, -1,
+    COM_PUSH_SHOT, 0xFF,
+    COM_END,
+};
 
-void Pattern02_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 2, 0x14);
-        break;
+static const s16 Pattern02_0061[] = {
+    COM_END,
+};
 
-    case 1:
-        Jump(wk, 1);
-        break;
+static const s16 Pattern02_0062[] = {
+    COM_SA_TERM, 0x35, 0x36, (s16)0xFFFF, 0x47,
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x19, 0x3C,
+    COM_END,
+};
 
-    case 2:
-        Next_Another_Menu(wk, 2, 0x14);
-        break;
+static const s16 Pattern02_0063[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F90, -0x7FC0, 8, 0x200, 0, -0x7F68, -1, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0064[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7F80, -1, 0x400,
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_COMMAND_ATTACK, 0xC, 0x1D, 0xA, -1,
+    COM_WAIT, 5,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_END,
+};
 
-void Pattern02_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 5, 2, 0x17);
-        break;
+static const s16 Pattern02_0065[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Provoke(wk, -1);
-        break;
+static const s16 Pattern02_0066[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0067[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Pattern02_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2E, 8, -1, -0x7FA0, 0x48, 0, -1, 0x30, 0x20);
-        break;
+static const s16 Pattern02_0068[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0069[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Pattern02_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
+static const s16 Pattern02_0070[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 2, 0x14,
+    COM_JUMP, 1,
+    COM_NEXT_ANOTHER_MENU, 2, 0x14,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0071[] = {
+    COM_ETC_TERM, 5, 2, 0x17,
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-void Pattern02_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
+static const s16 Pattern02_0072[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2E, 8, -1, -0x7FA0, 0x48, 0, -1, 0x30, 0x20,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Pattern02_0073[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern02_0074[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void (*const Pattern02_Tbl[75])(PLW*) = {
+const s16* const Pattern02_Tbl[75] = {
     Pattern02_0000, Pattern02_0001, Pattern02_0002, Pattern02_0003, Pattern02_0004, Pattern02_0005, Pattern02_0006,
     Pattern02_0007, Pattern02_0008, Pattern02_0009, Pattern02_0010, Pattern02_0011, Pattern02_0012, Pattern02_0013,
     Pattern02_0014, Pattern02_0015, Pattern02_0016, Pattern02_0017, Pattern02_0018, Pattern02_0019, Pattern02_0020,
@@ -1142,3 +450,7 @@ void (*const Pattern02_Tbl[75])(PLW*) = {
     Pattern02_0063, Pattern02_0064, Pattern02_0065, Pattern02_0066, Pattern02_0067, Pattern02_0068, Pattern02_0069,
     Pattern02_0070, Pattern02_0071, Pattern02_0072, Pattern02_0073, Pattern02_0074
 };
+
+void Computer02(PLW* wk) {
+    Exec_Com_Pattern(wk, Pattern02_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
@@ -5,1019 +5,397 @@
 
 #include "sf33rd/Source/Game/com/active/active04.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Pattern04_Tbl[68])();
-
-void Computer04(PLW* wk) {
-    Pattern04_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Pattern04_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0x1E);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 2, 0x14);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F90, -0x7FC0, 8, 0x400, 0, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC8, 8, 0x200, 2, -0x7F80, -1, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 2, 0x31);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Jump(wk, 1);
-        break;
-
-    case 3:
-        Lever_Off(wk);
-        break;
-
-    case 4:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, 0x88, -1, 0, 2, 5);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC8, 8, 0x40, 0, -0x7F90, -1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x9F, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 1:
-        Lever_Off(wk);
-        break;
-
-    case 2:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xDF, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 9, 0x100);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x400, 0, -0x7F68, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    case 1:
-        Lever_Off(wk);
-        break;
-
-    case 2:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0xFFFF, 0x37, 0);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xA, 0x102);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 9, 0, 0x200);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern04_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
+static const s16 Pattern04_0000[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xB, 0x400);
-        break;
+static const s16 Pattern04_0001[] = {
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Pattern04_0002[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0003[] = {
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-void Pattern04_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
+static const s16 Pattern04_0004[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Pattern04_0005[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Pattern04_0006[] = {
+    COM_WAIT, 0x1E,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Pattern04_0007[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 2, 0x14,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-    case 4:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Pattern04_0008[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F90, -0x7FC0, 8, 0x400, 0, -1, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0009[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Pattern04_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x40, 0, -1, 0x30, 0x4020);
-        break;
+static const s16 Pattern04_0010[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0011[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Pattern04_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x40, 0, -1, 0x30, 0x400);
-        break;
+static const s16 Pattern04_0012[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0013[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-void Pattern04_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x400, 0, -1, -1, -1);
-        break;
+static const s16 Pattern04_0014[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC8, 8, 0x200, 2, -0x7F80, -1, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0015[] = {
+    COM_WALK, 0, 0x30, 0,
+    COM_END,
+};
 
-void Pattern04_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x15, 0);
-        break;
+static const s16 Pattern04_0016[] = {
+    COM_WALK, 1, 0x30, 0,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x13, 0);
-        break;
+static const s16 Pattern04_0017[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        Walk(wk, 0, 0x10, 0);
-        break;
+static const s16 Pattern04_0018[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 2, 0x31,
+    COM_PIERCE_ON,
+    COM_JUMP, 1,
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0019[] = {
+    COM_EM_TERM, 0x88, -1, 0, 2, 5,
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_END,
+};
 
-void Pattern04_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Command_Attack_Term(wk, 8, 0x20, 0xA, -1, -0x7FA0, 0x30, 0, -1, 0x30, 0x400);
-        break;
+static const s16 Pattern04_0020[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0021[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-void Pattern04_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
+static const s16 Pattern04_0022[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC8, 8, 0x40, 0, -0x7F90, -1, 0x20,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 0xD, 0, 0x10);
-        break;
+static const s16 Pattern04_0023[] = {
+    COM_APPROACH_WALK, 0x9F, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0024[] = {
+    COM_WALK, 0, 0x60, 0,
+    COM_END,
+};
 
-void Pattern04_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern04_0025[] = {
+    COM_WALK, 1, 0x60, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0026[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Pattern04_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack(wk, 8, 0xA, 0x400, 2);
-        break;
+static const s16 Pattern04_0027[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0028[] = {
+    COM_APPROACH_WALK, 0xDF, 2,
+    COM_END,
+};
 
-void Pattern04_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, 0x30, 8, 0x40, 0, -1, -1, 0xFFFF);
-        break;
+static const s16 Pattern04_0029[] = {
+    COM_ADJUST_ATTACK, 9, 0x102,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0030[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_ADJUST_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Pattern04_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Command_Attack_Term(wk, 8, 0x20, 0xA, -1, -1, 0x30, 0, -1, -1, 0xFFFF);
-        break;
+static const s16 Pattern04_0031[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x400, 0, -0x7F68, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0032[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x10,
+    COM_ADJUST_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-void Pattern04_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8014, 0xA, -1);
-        break;
+static const s16 Pattern04_0033[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_ADJUST_ATTACK, 0xB, 0x10,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0034[] = {
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Pattern04_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8215, 0xA, -1);
-        break;
+static const s16 Pattern04_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0036[] = {
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-void Pattern04_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 0xA, -1);
-        break;
+static const s16 Pattern04_0037[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0038[] = {
+    COM_SA_TERM, 0x35, (s16)0xFFFF, 0x37, 0,
+    COM_PIERCE_ON,
+    COM_ADJUST_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 0xA, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Pattern04_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
+static const s16 Pattern04_0039[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0040[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_LEVER_ATTACK, 9, 0, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Pattern04_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Pattern04_0041[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_NORMAL_ATTACK, 0xB, 0x400,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0042[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Pattern04_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
+static const s16 Pattern04_0043[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x40, 0, -1, 0x30, 0x4020,
+    COM_END,
+};
 
-    case 1:
-        Approach_Walk(wk, 0x47, 2);
-        break;
+static const s16 Pattern04_0044[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x40, 0, -1, 0x30, 0x400,
+    COM_END,
+};
 
-    case 2:
-        Lever_Attack(wk, 0xD, 0, 0x200);
-        break;
+static const s16 Pattern04_0045[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x400, 0, -1, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0046[] = {
+    COM_WALK, 0, 0x15, 0,
+    COM_WALK, 1, 0x13, 0,
+    COM_WALK, 0, 0x10, 0,
+    COM_END,
+};
 
-void Pattern04_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
+static const s16 Pattern04_0047[] = {
+    COM_HI_JUMP_COMMAND_ATTACK_TERM, 8, 0x20, 0xA, -1, -0x7FA0, 0x30, 0, -1, 0x30, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
+static const s16 Pattern04_0048[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_LEVER_ATTACK, 0xD, 0, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0049[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern04_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, 0, 0, 2, 0);
-        break;
+static const s16 Pattern04_0050[] = {
+    COM_HI_JUMP_ATTACK, 8, 0xA, 0x400, 2,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 0xD, 0x20, 0x609, -1);
-        break;
+static const s16 Pattern04_0051[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, 0x30, 8, 0x40, 0, -1, -1, (s16)0xFFFF,
+    COM_END,
+};
 
-    case 2:
-        Approach_Walk(wk, 0x47, 2);
-        break;
+static const s16 Pattern04_0052[] = {
+    COM_HI_JUMP_COMMAND_ATTACK_TERM, 8, 0x20, 0xA, -1, -1, 0x30, 0, -1, -1, (s16)0xFFFF,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 0xD, 0x100);
-        break;
+static const s16 Pattern04_0053[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8014, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0054[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8215, 0xA, -1,
+    COM_END,
+};
 
-void Pattern04_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x40, 0x41, 0x43, 0x43, 1);
-        break;
+static const s16 Pattern04_0055[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0056[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Pattern04_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x40, 0x41, 0x42, 0x43, 1);
-        break;
+static const s16 Pattern04_0057[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0058[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_LEVER_ATTACK, 0xD, 0, 0x200,
+    COM_END,
+};
 
-void Pattern04_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F90, -0x7FC0, 8, 0x200, 0, 0 - 0x7F68, -1, 0x400);
-        break;
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0059[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-void Pattern04_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x21, 8, -1);
-        break;
+static const s16 Pattern04_0060[] = {
+    COM_EM_TERM, -0x7F90, 0, 0, 2, 0,
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x609, -1,
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_NORMAL_ATTACK, 0xD, 0x100,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0061[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x40, 0x41, 0x43, 0x43, 1,
+    COM_END,
+};
 
-void Pattern04_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x21, 9, -1);
-        break;
+static const s16 Pattern04_0062[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x40, 0x41, 0x42, 0x43, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0063[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F90, -0x7FC0, 8, 0x200, 0, 0 - 0x7F68, -1, 0x400,
+    COM_END,
+};
 
-void Pattern04_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x21, 0xA, -1);
-        break;
+static const s16 Pattern04_0064[] = {
+    COM_COMMAND_ATTACK, 8, 0x21, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0065[] = {
+    COM_COMMAND_ATTACK, 8, 0x21, 9, -1,
+    COM_END,
+};
 
-void Pattern04_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x21, 0xA, 0x700);
-        break;
+static const s16 Pattern04_0066[] = {
+    COM_COMMAND_ATTACK, 8, 0x21, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern04_0067[] = {
+    COM_COMMAND_ATTACK, 8, 0x21, 0xA, 0x700,
+    COM_END,
+};
 
-void (*const Pattern04_Tbl[68])(PLW*) = {
+const s16* const Pattern04_Tbl[68] = {
     Pattern04_0000, Pattern04_0001, Pattern04_0002, Pattern04_0003, Pattern04_0004, Pattern04_0005, Pattern04_0006,
     Pattern04_0007, Pattern04_0008, Pattern04_0009, Pattern04_0010, Pattern04_0011, Pattern04_0012, Pattern04_0013,
     Pattern04_0014, Pattern04_0015, Pattern04_0016, Pattern04_0017, Pattern04_0018, Pattern04_0019, Pattern04_0020,
@@ -1029,3 +407,7 @@ void (*const Pattern04_Tbl[68])(PLW*) = {
     Pattern04_0056, Pattern04_0057, Pattern04_0058, Pattern04_0059, Pattern04_0060, Pattern04_0061, Pattern04_0062,
     Pattern04_0063, Pattern04_0064, Pattern04_0065, Pattern04_0066, Pattern04_0067
 };
+
+void Computer04(PLW* wk) {
+    Exec_Com_Pattern(wk, Pattern04_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
@@ -5,1301 +5,484 @@
 
 #include "sf33rd/Source/Game/com/active/active07.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Pattern07_Tbl[76])();
-
-void Computer07(PLW* wk) {
-    Pattern07_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Pattern07_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 0xB, 0x1C, 8, -1);
-        break;
-
-    case 1:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x20);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x400);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 0xB, 0, 0x400);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F90, -0x7FC0, 8, 0x40, 0, -0x7F90, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F90, -0x7FC0, 8, 0x40, 0, -0x7F90, -1, 0x200);
-        break;
-    case 1:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 0xB, 0, 0x202);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x200);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 9, 0x1E, 9, -1);
-        break;
-
-    case 2:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 1, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x200, 2, -0x7F80, -1, 0x200);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 9, 0, 0x200);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x20, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x50, 1, -1);
-        break;
-
-    case 1:
-        Jump(wk, 1);
-        break;
-
-    case 2:
-        Lever_Off(wk);
-        break;
-
-    case 3:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F9C, -0x7FC0, 8, 0x100, 0, -0x7F90, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F9C, -0x7FC0, 8, 0x20, 0, -0x7F90, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x400);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x40, 0, -0x7F90, -1, 0x100);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xC7, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xA, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    case 2:
-        Lever_Off(wk);
-        break;
-
-    case 3:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1d, 10, -1);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 4:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 5:
-        Command_Attack(wk, 8, 1, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x78, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 9, 0x100);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x200, 0, -0x7F68, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 0xB, 0, 0x100);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x20, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x200);
-        break;
-
-    case 3:
-        Lever_Off(wk);
-        break;
-
-    case 4:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    case 1:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 4:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xA, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x202);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x20, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x40, 0, -1, 0x30, 0x4020);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x40, 0, -1, 0x30, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x400, 0, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Command_Attack_Term(wk, 8, 0x2E, 9, -1, -0x7FA0, 0x38, 0x0, -1, 0x30, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x100);
-        break;
-
-    case 2:
-        Jump_Command_Attack_Term(wk, 8, 0x2E, 0xA, -1, -1, 0x38, 1, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern07_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FC8, 8, 0x200, 0, -0x7FA8, -1, 0x200);
-        break;
+static const s16 Pattern07_0000[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 9, 0, 0x100);
-        break;
+static const s16 Pattern07_0001[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 2:
-        Lever_Attack(wk, 9, 0, 0x100);
-        break;
+static const s16 Pattern07_0002[] = {
+    COM_J_COMMAND_ATTACK, 0xB, 0x1C, 8, -1,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 8, 0x200);
-        break;
+static const s16 Pattern07_0003[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 9, 0x20,
+    COM_NORMAL_ATTACK, 9, 0x400,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0004[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-void Pattern07_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack(wk, 8, 0xA, 0x400, 2);
-        break;
+static const s16 Pattern07_0005[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_LEVER_ATTACK, 0xB, 0, 0x400,
+    COM_COMMAND_ATTACK, 8, 1, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0006[] = {
+    COM_WAIT, 0,
+    COM_END,
+};
 
-void Pattern07_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FC8, 8, 0x20, 0, -0x7FA8, -1, 0x200);
-        break;
+static const s16 Pattern07_0007[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Pattern07_0008[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F90, -0x7FC0, 8, 0x40, 0, -0x7F90, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0009[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Pattern07_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Command_Attack_Term(wk, 8, 0x8126, 0xA, -1, -1, 0x30, 0, -1, -1, -1);
-        break;
+static const s16 Pattern07_0010[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F90, -0x7FC0, 8, 0x40, 0, -0x7F90, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0011[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_LEVER_ATTACK, 0xB, 0, 0x202,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Pattern07_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 2, 0x38, 0x3A, 0x3A, 0x3A);
-        break;
+static const s16 Pattern07_0012[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0013[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x200,
+    COM_J_COMMAND_ATTACK, 9, 0x1E, 9, -1,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, 0xA, -1,
+    COM_END,
+};
 
-void Pattern07_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8015, 0xA, -1);
-        break;
+static const s16 Pattern07_0014[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x200, 2, -0x7F80, -1, 0x200,
+    COM_LEVER_ATTACK, 9, 0, 0x200,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0015[] = {
+    COM_WALK, 0, 0x30, 0,
+    COM_END,
+};
 
-void Pattern07_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8014, 0xA, -1);
-        break;
+static const s16 Pattern07_0016[] = {
+    COM_WALK, 1, 0x30, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0017[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x20, 0xA, -1,
+    COM_END,
+};
 
-void Pattern07_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x8126, 9, -1, -1, 0x40, 1, -1, -1, -1);
-        break;
+static const s16 Pattern07_0018[] = {
+    COM_SEARCH_BACK_TERM, 0x50, 1, -1,
+    COM_JUMP, 1,
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0019[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F9C, -0x7FC0, 8, 0x100, 0, -0x7F90, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_J_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-void Pattern07_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x8126, 9, -1, -1, 0x40, 2, -1, -1, -1);
-        break;
+static const s16 Pattern07_0020[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0021[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F9C, -0x7FC0, 8, 0x20, 0, -0x7F90, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x400,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Pattern07_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x8126, 0xA, -1, -1, 0x30, 2, -1, -1, -1);
-        break;
+static const s16 Pattern07_0022[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x40, 0, -0x7F90, -1, 0x100,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0023[] = {
+    COM_APPROACH_WALK, 0xC7, 2,
+    COM_END,
+};
 
-void Pattern07_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
+static const s16 Pattern07_0024[] = {
+    COM_WALK, 0, 0x60, 0,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
+static const s16 Pattern07_0025[] = {
+    COM_WALK, 1, 0x60, 0,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x200);
-        break;
+static const s16 Pattern07_0026[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xA, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Pattern07_0027[] = {
+    COM_JUMP, 0,
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0028[] = {
+    COM_APPROACH_WALK, 0x78, 2,
+    COM_END,
+};
 
-void Pattern07_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x15, 0);
-        break;
+static const s16 Pattern07_0029[] = {
+    COM_ADJUST_ATTACK, 9, 0x100,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x14, 0);
-        break;
+static const s16 Pattern07_0030[] = {
+    COM_ADJUST_ATTACK, 9, 0x100,
+    COM_ADJUST_ATTACK, 9, 0x100,
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-    case 2:
-        Walk(wk, 0, 0x10, 0);
-        break;
+static const s16 Pattern07_0031[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x200, 0, -0x7F68, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0032[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_LEVER_ATTACK, 0xB, 0, 0x100,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-void Pattern07_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x14, 0);
-        break;
+static const s16 Pattern07_0033[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x10,
+    COM_J_COMMAND_ATTACK, 8, 0x20, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 0, 0x10, 0);
-        break;
+static const s16 Pattern07_0034[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_NORMAL_ATTACK, 0xB, 0x200,
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 2:
-        Walk(wk, 1, 0x18, 0);
-        break;
+static const s16 Pattern07_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 3:
-        Walk(wk, 0, 0x10, 0);
-        break;
+static const s16 Pattern07_0036[] = {
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0037[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, 0xA, -1,
+    COM_END,
+};
 
-void Pattern07_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x10, 0);
-        break;
+static const s16 Pattern07_0038[] = {
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_PIERCE_ON,
+    COM_ADJUST_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x18, 0);
-        break;
+static const s16 Pattern07_0039[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xA, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Wait(wk, 0x10);
-        break;
+static const s16 Pattern07_0040[] = {
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 3:
-        Walk(wk, 0, 0x10, 0);
-        break;
+static const s16 Pattern07_0041[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_J_COMMAND_ATTACK, 8, 0x20, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0042[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Pattern07_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F98, 0, 4, 2, 0);
-        break;
+static const s16 Pattern07_0043[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x40, 0, -1, 0x30, 0x4020,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0, 0xA, -1);
-        break;
+static const s16 Pattern07_0044[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x40, 0, -1, 0x30, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0045[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x400, 0, -1, -1, -1,
+    COM_END,
+};
 
-void Pattern07_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Pattern07_0046[] = {
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0047[] = {
+    COM_HI_JUMP_COMMAND_ATTACK_TERM, 8, 0x2E, 9, -1, -0x7FA0, 0x38, 0x0, -1, 0x30, 0x400,
+    COM_END,
+};
 
-void Pattern07_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
+static const s16 Pattern07_0048[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_LEVER_ATTACK, 8, 0, 0x100,
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2E, 0xA, -1, -1, 0x38, 1, -1, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0049[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FC8, 8, 0x200, 0, -0x7FA8, -1, 0x200,
+    COM_LEVER_ATTACK, 9, 0, 0x100,
+    COM_LEVER_ATTACK, 9, 0, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Pattern07_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
+static const s16 Pattern07_0050[] = {
+    COM_HI_JUMP_ATTACK, 8, 0xA, 0x400, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0051[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FC8, 8, 0x20, 0, -0x7FA8, -1, 0x200,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Pattern07_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x22, 8, -1);
-        break;
+static const s16 Pattern07_0052[] = {
+    COM_HI_JUMP_COMMAND_ATTACK_TERM, 8, (s16)0x8126, 0xA, -1, -1, 0x30, 0, -1, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0053[] = {
+    COM_BRANCH_UNIT_AREA, 2, 0x38, 0x3A, 0x3A, 0x3A,
+    COM_END,
+};
 
-void Pattern07_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x22, 0xA, -1);
-        break;
+static const s16 Pattern07_0054[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8015, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0055[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8014, 0xA, -1,
+    COM_END,
+};
 
-void Pattern07_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x22, 0xA, -1);
-        break;
+static const s16 Pattern07_0056[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, (s16)0x8126, 9, -1, -1, 0x40, 1, -1, -1, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
+static const s16 Pattern07_0057[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, (s16)0x8126, 9, -1, -1, 0x40, 2, -1, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0058[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, (s16)0x8126, 0xA, -1, -1, 0x30, 2, -1, -1, -1,
+    COM_END,
+};
 
-void Pattern07_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Pattern07_0059[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, 0x50, -0x7FB0, 8, 1, -1);
-        break;
+static const s16 Pattern07_0060[] = {
+    COM_WALK, 0, 0x15, 0,
+    COM_WALK, 1, 0x14, 0,
+    COM_WALK, 0, 0x10, 0,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x2E, 8, -1);
-        break;
+static const s16 Pattern07_0061[] = {
+    COM_WALK, 1, 0x14, 0,
+    COM_WALK, 0, 0x10, 0,
+    COM_WALK, 1, 0x18, 0,
+    COM_WALK, 0, 0x10, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0062[] = {
+    COM_WALK, 0, 0x10, 0,
+    COM_WALK, 1, 0x18, 0,
+    COM_WAIT, 0x10,
+    COM_WALK, 0, 0x10, 0,
+    COM_END,
+};
 
-void Pattern07_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Pattern07_0063[] = {
+    COM_EM_TERM, -0x7F98, 0, 4, 2, 0,
+    COM_COMMAND_ATTACK, 8, 0, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, 0x50, -0x7FB0, 8, 1, -1);
-        break;
+static const s16 Pattern07_0064[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        SA_Term(wk, 0x48, 0xFFFF, 0xFFFF, 0);
-        break;
+static const s16 Pattern07_0065[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x2E, 8, -1);
-        break;
+static const s16 Pattern07_0066[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0067[] = {
+    COM_COMMAND_ATTACK, 8, 0x22, 8, -1,
+    COM_END,
+};
 
-void Pattern07_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 2, 0x49, 0x49, 0x4A, 0x4B);
-        break;
+static const s16 Pattern07_0068[] = {
+    COM_COMMAND_ATTACK, 8, 0x22, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0069[] = {
+    COM_COMMAND_ATTACK, 8, 0x22, 0xA, -1,
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_END,
+};
 
-void Pattern07_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8126, 8, -1);
-        break;
+static const s16 Pattern07_0070[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_EM_TERM, 0x50, -0x7FB0, 8, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x2E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0071[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_EM_TERM, 0x50, -0x7FB0, 8, 1, -1,
+    COM_SA_TERM, 0x48, (s16)0xFFFF, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x2E, 8, -1,
+    COM_END,
+};
 
-void Pattern07_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8126, 9, -1);
-        break;
+static const s16 Pattern07_0072[] = {
+    COM_BRANCH_UNIT_AREA, 2, 0x49, 0x49, 0x4A, 0x4B,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0073[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8126, 8, -1,
+    COM_END,
+};
 
-void Pattern07_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8126, 0xA, -1);
-        break;
+static const s16 Pattern07_0074[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8126, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern07_0075[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8126, 0xA, -1,
+    COM_END,
+};
 
-void (*const Pattern07_Tbl[76])(PLW*) = {
+const s16* const Pattern07_Tbl[76] = {
     Pattern07_0000, Pattern07_0001, Pattern07_0002, Pattern07_0003, Pattern07_0004, Pattern07_0005, Pattern07_0006,
     Pattern07_0007, Pattern07_0008, Pattern07_0009, Pattern07_0010, Pattern07_0011, Pattern07_0012, Pattern07_0013,
     Pattern07_0014, Pattern07_0015, Pattern07_0016, Pattern07_0017, Pattern07_0018, Pattern07_0019, Pattern07_0020,
@@ -1312,3 +495,7 @@ void (*const Pattern07_Tbl[76])(PLW*) = {
     Pattern07_0063, Pattern07_0064, Pattern07_0065, Pattern07_0066, Pattern07_0067, Pattern07_0068, Pattern07_0069,
     Pattern07_0070, Pattern07_0071, Pattern07_0072, Pattern07_0073, Pattern07_0074, Pattern07_0075
 };
+
+void Computer07(PLW* wk) {
+    Exec_Com_Pattern(wk, Pattern07_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
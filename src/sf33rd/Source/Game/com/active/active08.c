@@ -5,1178 +5,443 @@
 
 #include "sf33rd/Source/Game/com/active/active08.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Pattern08_Tbl[71])();
-
-void Computer08(PLW* wk) {
-    Pattern08_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Pattern08_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x10);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 0xB, 0x1E, 9, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    case 2:
-        Pierce_On(wk);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 1, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 2, 3);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F90, -0x7FC0, 8, 0x200, 0, -0x7F98, -1, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 9, 0x1E, 0xA, -1);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 9, 0x1E, 0xA, -1);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC8, 8, 0x200, 2, -1, -0x7FF0, 0x100);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 1:
-        Jump(wk, 1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0, 0xA, -1);
-        break;
-
-    case 3:
-        Lever_Off(wk);
-        break;
-
-    case 4:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, 0x70, -1, 0, 2, 5);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 9, 0x1D, 0xA, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F98, -0x7FC0, 9, 0x40, 0, -0x7F90, -1, 0x100);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7B, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 1:
-        Lever_Off(wk);
-        break;
-
-    case 2:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xBF, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    case 3:
-        Lever_Attack(wk, 8, 0, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x200);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F98, -0x7FC0, 8, 0x200, 0, -0x7F68, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 9, 0, 0x20);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xb, 0x100);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xb, 0x40);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xb, 0x402);
-        break;
-
-    case 3:
-        Pierce_On(wk);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 1, 10, -1);
-        break;
-
-    case 5:
-        Lever_Off(wk);
-        break;
-
-    case 6:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 8, 0x200);
-        break;
-
-    case 3:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
-
-    case 4:
-        Lever_Attack(wk, 8, 0, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x202);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x40);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F90, -0x7FC0, 8, 0x200, 0, -0x7F70, -1, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F98, -0x7FC0, 8, 0x40, 0, -1, -0x7FE0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F98, -0x7FC0, 8, 0x40, 0, -0x7F70, -1, 0x200);
-        break;
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern08_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F98, -0x7FC0, 0xB, 0x400, 0, -0x7F70, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Pattern08_0000[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0001[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x402,
+    COM_END,
+};
 
-void Pattern08_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x15, 0);
-        break;
+static const s16 Pattern08_0002[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x13, 0);
-        break;
+static const s16 Pattern08_0003[] = {
+    COM_ADJUST_ATTACK, 9, 0x10,
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    case 2:
-        Walk(wk, 0, 0x10, 0);
-        break;
+static const s16 Pattern08_0004[] = {
+    COM_J_COMMAND_ATTACK, 0xB, 0x1E, 9, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0005[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Pattern08_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, 0);
-        break;
+static const s16 Pattern08_0006[] = {
+    COM_WAIT, 0,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 0, 0x14, 0);
-        break;
+static const s16 Pattern08_0007[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 2, 3,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Walk(wk, 1, 0x18, 0);
-        break;
+static const s16 Pattern08_0008[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F90, -0x7FC0, 8, 0x200, 0, -0x7F98, -1, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    case 3:
-        Wait(wk, 0x14);
-        break;
+static const s16 Pattern08_0009[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_J_COMMAND_ATTACK, 9, 0x1E, 0xA, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 4:
-        Walk(wk, 0, 0x14, 0);
-        break;
+static const s16 Pattern08_0010[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0011[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_J_COMMAND_ATTACK, 9, 0x1E, 0xA, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Pattern08_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0x3C);
-        break;
+static const s16 Pattern08_0012[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0013[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Pattern08_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xA, -1);
-        break;
+static const s16 Pattern08_0014[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC8, 8, 0x200, 2, -1, -0x7FF0, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0015[] = {
+    COM_WALK, 0, 0x30, 0,
+    COM_END,
+};
 
-void Pattern08_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7F98, -0x7FB8, 8, 0x400, 2, -1, -0x7FF0, 0x10);
-        break;
+static const s16 Pattern08_0016[] = {
+    COM_WALK, 1, 0x30, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0017[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Pattern08_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7F98, -0x7FB8, 8, 0x40, 0, -1, -0x7FF0, 0x10);
-        break;
+static const s16 Pattern08_0018[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_JUMP, 1,
+    COM_COMMAND_ATTACK, 8, 0, 0xA, -1,
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0019[] = {
+    COM_EM_TERM, 0x70, -1, 0, 2, 5,
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-void Pattern08_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7F98, -0x7FB8, 8, 0x40, 0, -1, -0x7FF0, 0x10);
-        break;
+static const s16 Pattern08_0020[] = {
+    COM_J_COMMAND_ATTACK, 9, 0x1D, 0xA, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0021[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Pattern08_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern08_0022[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F98, -0x7FC0, 9, 0x40, 0, -0x7F90, -1, 0x100,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Pattern08_0023[] = {
+    COM_APPROACH_WALK, 0x7B, 2,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 1, 0xA, -1);
-        break;
+static const s16 Pattern08_0024[] = {
+    COM_WALK, 0, 0x60, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0025[] = {
+    COM_WALK, 1, 0x60, 0,
+    COM_END,
+};
 
-void Pattern08_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Pattern08_0026[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0027[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-void Pattern08_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
+static const s16 Pattern08_0028[] = {
+    COM_APPROACH_WALK, 0xBF, 2,
+    COM_END,
+};
 
-    case 1:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern08_0029[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_LEVER_ATTACK, 8, 0, 0x402,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 1, 10, -1);
-        break;
+static const s16 Pattern08_0030[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_NORMAL_ATTACK, 9, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 3:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
+static const s16 Pattern08_0031[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F98, -0x7FC0, 8, 0x200, 0, -0x7F68, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 4:
-        Command_Attack(wk, 8, 1, 10, -1);
-        break;
+static const s16 Pattern08_0032[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x10,
+    COM_ADJUST_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 5:
-        J_Command_Attack(wk, 8, 0x1d, 10, -1);
-        break;
+static const s16 Pattern08_0033[] = {
+    COM_LEVER_ATTACK, 9, 0, 0x20,
+    COM_LEVER_ATTACK, 8, 0, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0034[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x100,
+    COM_NORMAL_ATTACK, 0xB, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x402,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 10, -1,
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Pattern08_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
+static const s16 Pattern08_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 1:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern08_0036[] = {
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 1, 10, -1);
-        break;
+static const s16 Pattern08_0037[] = {
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_END,
+};
 
-    case 3:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
+static const s16 Pattern08_0038[] = {
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_PIERCE_ON,
+    COM_ADJUST_ATTACK, 8, 0x200,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_LEVER_ATTACK, 8, 0, 0x402,
+    COM_END,
+};
 
-    case 4:
-        Command_Attack(wk, 8, 1, 10, -1);
-        break;
+static const s16 Pattern08_0039[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 5:
-        SA_Term(wk, -1, -1, 0x3b, 0);
-        break;
+static const s16 Pattern08_0040[] = {
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0041[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x402,
+    COM_END,
+};
 
-void Pattern08_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x8014, 0xA, -1);
-        break;
+static const s16 Pattern08_0042[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F90, -0x7FC0, 8, 0x200, 0, -0x7F70, -1, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0043[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F98, -0x7FC0, 8, 0x40, 0, -1, -0x7FE0, 0x200,
+    COM_END,
+};
 
-void Pattern08_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x8015, 0xA, -1);
-        break;
+static const s16 Pattern08_0044[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F98, -0x7FC0, 8, 0x40, 0, -0x7F70, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0045[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F98, -0x7FC0, 0xB, 0x400, 0, -0x7F70, -1, 0x20,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Pattern08_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 0xA, -1);
-        break;
+static const s16 Pattern08_0046[] = {
+    COM_WALK, 0, 0x15, 0,
+    COM_WALK, 1, 0x13, 0,
+    COM_WALK, 0, 0x10, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0047[] = {
+    COM_WALK, 1, 0x20, 0,
+    COM_WALK, 0, 0x14, 0,
+    COM_WALK, 1, 0x18, 0,
+    COM_WAIT, 0x14,
+    COM_WALK, 0, 0x14, 0,
+    COM_END,
+};
 
-void Pattern08_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0048[] = {
+    COM_WAIT, 0x3C,
+    COM_END,
+};
 
-void Pattern08_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 1, 0xA, -1);
-        break;
+static const s16 Pattern08_0049[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x3B, 0);
-        break;
+static const s16 Pattern08_0050[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7F98, -0x7FB8, 8, 0x400, 2, -1, -0x7FF0, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0051[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7F98, -0x7FB8, 8, 0x40, 0, -1, -0x7FF0, 0x10,
+    COM_END,
+};
 
-void Pattern08_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
+static const s16 Pattern08_0052[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7F98, -0x7FB8, 8, 0x40, 0, -1, -0x7FF0, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0053[] = {
+    COM_PIERCE_ON,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_COMMAND_ATTACK, 8, 1, 0xA, -1,
+    COM_END,
+};
 
-void Pattern08_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0054[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Pattern08_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
+static const s16 Pattern08_0055[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 10, -1,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, 10, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0056[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 10, -1,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, 10, -1,
+    COM_SA_TERM, -1, -1, 0x3B, 0,
+    COM_END,
+};
 
-void Pattern08_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 9, 0x1F, 8, -1);
-        break;
+static const s16 Pattern08_0057[] = {
+    COM_J_COMMAND_ATTACK, 8, (s16)0x8014, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0058[] = {
+    COM_J_COMMAND_ATTACK, 8, (s16)0x8015, 0xA, -1,
+    COM_END,
+};
 
-void Pattern08_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 9, 0x1F, 9, -1);
-        break;
+static const s16 Pattern08_0059[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0060[] = {
+    COM_END,
+};
 
-void Pattern08_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 9, 0x1F, 0xA, -1);
-        break;
+static const s16 Pattern08_0061[] = {
+    COM_COMMAND_ATTACK, 8, 1, 0xA, -1,
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x3B, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0062[] = {
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_END,
+};
 
-void Pattern08_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 9, 0x1F, 0xA, 0x700);
-        break;
+static const s16 Pattern08_0063[] = {
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0064[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_END,
+};
 
-void Pattern08_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
+static const s16 Pattern08_0065[] = {
+    COM_COMMAND_ATTACK, 9, 0x1F, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 9, 0x1F, 9, -1);
-        break;
+static const s16 Pattern08_0066[] = {
+    COM_COMMAND_ATTACK, 9, 0x1F, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0067[] = {
+    COM_COMMAND_ATTACK, 9, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-void Pattern08_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F98, -0x7FC0, 9, 0x400, 0, -0x7F90, -1, 0x100);
-        break;
+static const s16 Pattern08_0068[] = {
+    COM_COMMAND_ATTACK, 9, 0x1F, 0xA, 0x700,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 9, 0x1F, 0xA, -1);
-        break;
+static const s16 Pattern08_0069[] = {
+    COM_JUMP, 0,
+    COM_COMMAND_ATTACK, 9, 0x1F, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern08_0070[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F98, -0x7FC0, 9, 0x400, 0, -0x7F90, -1, 0x100,
+    COM_COMMAND_ATTACK, 9, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-void (*const Pattern08_Tbl[71])(PLW*) = {
+const s16* const Pattern08_Tbl[71] = {
     Pattern08_0000, Pattern08_0001, Pattern08_0002, Pattern08_0003, Pattern08_0004, Pattern08_0005, Pattern08_0006,
     Pattern08_0007, Pattern08_0008, Pattern08_0009, Pattern08_0010, Pattern08_0011, Pattern08_0012, Pattern08_0013,
     Pattern08_0014, Pattern08_0015, Pattern08_0016, Pattern08_0017, Pattern08_0018, Pattern08_0019, Pattern08_0020,
@@ -1189,3 +454,7 @@ void (*const Pattern08_Tbl[71])(PLW*) = {
     Pattern08_0063, Pattern08_0064, Pattern08_0065, Pattern08_0066, Pattern08_0067, Pattern08_0068, Pattern08_0069,
     Pattern08_0070
 };
+
+void Computer08(PLW* wk) {
+    Exec_Com_Pattern(wk, Pattern08_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
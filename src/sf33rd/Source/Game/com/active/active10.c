@@ -5,1156 +5,435 @@
 
 #include "sf33rd/Source/Game/com/active/active10.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Pattern10_Tbl[70])();
-
-void Computer10(PLW* wk) {
-    Pattern10_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Pattern10_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 2, 0x31, 0x32, 0x33, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0x1E);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 2, 1);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 2, 0x10);
-        break;
-
-    case 1:
-        Jump(wk, 1);
-        break;
-
-    case 2:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x20, 2, -0x7FA0, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 2, 0);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xe, 0x1e, 8, -1);
-        break;
-
-    case 2:
-        Wait(wk, 0xe);
-        break;
-
-    case 3:
-        Command_Attack(wk, 0xe, 0x1e, 8, -1);
-        break;
-
-    case 4:
-        Wait(wk, 0xe);
-        break;
-
-    case 5:
-        Command_Attack(wk, 0xe, 0x1e, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack(wk, 8, 0xC, 0x8400, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xe, 0x1e, 9, -1);
-        break;
-
-    case 2:
-        Wait(wk, 0xe);
-        break;
-
-    case 3:
-        Command_Attack(wk, 0xe, 0x1e, 9, -1);
-        break;
-
-    case 4:
-        Wait(wk, 0xe);
-        break;
-
-    case 5:
-        Command_Attack(wk, 0xe, 0x1e, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x40, 0, -0x7FA0, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7FB0, -1, 8, 0x8100, 0, -0x7FA0, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x83, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x20, 2, -0x7FA0, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 2, 0);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xC3, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 0xC, 0x100);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 0xC, 0x202);
-        break;
-
-    case 3:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x10);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 0xC, 0x20);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 8, 0x40);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x20);
-        break;
-
-    case 1:
-        Branch_Unit_Area(wk, 2, 0x31, 0x32, 0x33, 0x33);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xA, 0x202);
-        break;
-
-    case 2:
-        Branch_Unit_Area(wk, 2, 0x31, 0x32, 0x33, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
-
-    case 1:
-        Branch_Unit_Area(wk, 2, 0x31, 0x32, 0x33, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x202);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xb, 0x42);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 0xe, 0x1e, 8, -1);
-        break;
-
-    case 3:
-        Wait(wk, 0xe);
-        break;
-
-    case 4:
-        Command_Attack(wk, 0xe, 0x1e, 8, -1);
-        break;
-
-    case 5:
-        Wait(wk, 0xe);
-        break;
-
-    case 6:
-        Command_Attack(wk, 0xe, 0x1e, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, 8, 8, 0x8400, 0, -1, -0x7FA0, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x20, 0, -0x7FA0, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x14, 0);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x16, 0);
-        break;
-
-    case 2:
-        Walk(wk, 0, 0x18, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8015, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern10_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8014, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0000[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Pattern10_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
+static const s16 Pattern10_0001[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0002[] = {
+    COM_BRANCH_UNIT_AREA, 2, 0x31, 0x32, 0x33, 1,
+    COM_END,
+};
 
-void Pattern10_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
+static const s16 Pattern10_0003[] = {
+    COM_ADJUST_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0004[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 0xA, -1,
+    COM_END,
+};
 
-void Pattern10_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Pattern10_0005[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0006[] = {
+    COM_WAIT, 0x1E,
+    COM_END,
+};
 
-void Pattern10_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x2E, 0x2F, 0xFFFF, 0);
-        break;
+static const s16 Pattern10_0007[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 2, 1,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x20, 0xA, -1);
-        break;
+static const s16 Pattern10_0008[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0009[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 2, 0x10,
+    COM_JUMP, 1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Pattern10_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x2E, 0x2F, 0x30, 0x8040);
-        break;
+static const s16 Pattern10_0010[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern10_0011[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0012[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Pattern10_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x30, 0);
-        break;
+static const s16 Pattern10_0013[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-    case 1:
-        Hi_Jump_Attack_Term(wk, -0x7FB0, 8, 8, 0x8400, 0, -0x7FA0, 8, 0x20);
-        break;
+static const s16 Pattern10_0014[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x20, 2, -0x7FA0, 8, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0015[] = {
+    COM_WALK, 0, 0x30, 0,
+    COM_END,
+};
 
-void Pattern10_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x40, 0, -0x7FA0, 8, 0x20);
-        break;
+static const s16 Pattern10_0016[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 2, 0,
+    COM_WALK, 1, 0x30, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0017[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xE, 0x1E, 8, -1,
+    COM_WAIT, 0xE,
+    COM_COMMAND_ATTACK, 0xE, 0x1E, 8, -1,
+    COM_WAIT, 0xE,
+    COM_COMMAND_ATTACK, 0xE, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern10_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Pattern10_0018[] = {
+    COM_JUMP_ATTACK, 8, 0xC, (s16)0x8400, 2,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 2, 0x31, 4, 5, 1, 0);
-        break;
+static const s16 Pattern10_0019[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xE, 0x1E, 9, -1,
+    COM_WAIT, 0xE,
+    COM_COMMAND_ATTACK, 0xE, 0x1E, 9, -1,
+    COM_WAIT, 0xE,
+    COM_COMMAND_ATTACK, 0xE, 0x1E, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0020[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern10_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 6, 0x12);
-        break;
+static const s16 Pattern10_0021[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x40, 0, -0x7FA0, 8, 0x200,
+    COM_END,
+};
 
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x20, 1, -0x7FA0, 8, 0x200);
-        break;
+static const s16 Pattern10_0022[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7FB0, -1, 8, (s16)0x8100, 0, -0x7FA0, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0023[] = {
+    COM_APPROACH_WALK, 0x83, 2,
+    COM_END,
+};
 
-void Pattern10_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 2, 0x11);
-        break;
+static const s16 Pattern10_0024[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x20, 2, -0x7FA0, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x20, 1, -0x7FA0, 8, 0x200);
-        break;
+static const s16 Pattern10_0025[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 2, 0,
+    COM_WALK, 1, 0x60, 0,
+    COM_END,
+};
 
-    case 2:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern10_0026[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
+static const s16 Pattern10_0027[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-    case 4:
-        Com_Random_Select(wk, 2, 0x18, 0x18, 0x11, 0x11, 0);
-        break;
+static const s16 Pattern10_0028[] = {
+    COM_APPROACH_WALK, 0xC3, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0029[] = {
+    COM_ADJUST_ATTACK, 9, 0x100,
+    COM_ADJUST_ATTACK, 0xC, 0x100,
+    COM_ADJUST_ATTACK, 0xC, 0x202,
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-void Pattern10_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 2, 0x11);
-        break;
+static const s16 Pattern10_0030[] = {
+    COM_ADJUST_ATTACK, 9, 0x10,
+    COM_ADJUST_ATTACK, 0xC, 0x20,
+    COM_ADJUST_ATTACK, 8, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern10_0031[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x20,
+    COM_BRANCH_UNIT_AREA, 2, 0x31, 0x32, 0x33, 0x33,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
+static const s16 Pattern10_0032[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x10,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
+static const s16 Pattern10_0033[] = {
+    COM_ADJUST_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-    case 4:
-        Com_Random_Select(wk, 2, 0x18, 0x18, 0x11, 0x11, 0);
-        break;
+static const s16 Pattern10_0034[] = {
+    COM_ADJUST_ATTACK, 9, 0x102,
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-void Pattern10_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 2, 0);
-        break;
+static const s16 Pattern10_0036[] = {
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x200, 0, -1, -1, -1);
-        break;
+static const s16 Pattern10_0037[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern10_0038[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 0xA, 0x202,
+    COM_BRANCH_UNIT_AREA, 2, 0x31, 0x32, 0x33, 1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
+static const s16 Pattern10_0039[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_BRANCH_UNIT_AREA, 2, 0x31, 0x32, 0x33, 1,
+    COM_END,
+};
 
-    case 4:
-        Com_Random_Select(wk, 2, 0x18, 0x18, 0x11, 0x11, 0);
-        break;
+static const s16 Pattern10_0040[] = {
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0041[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x42,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xE, 0x1E, 8, -1,
+    COM_WAIT, 0xE,
+    COM_COMMAND_ATTACK, 0xE, 0x1E, 8, -1,
+    COM_WAIT, 0xE,
+    COM_COMMAND_ATTACK, 0xE, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern10_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 2, 0);
-        break;
+static const s16 Pattern10_0042[] = {
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern10_0043[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, 8, 8, (s16)0x8400, 0, -1, -0x7FA0, 0x400,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
+static const s16 Pattern10_0044[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x20, 0, -0x7FA0, 8, 0x400,
+    COM_END,
+};
 
-    case 3:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -1, 8, 0x8400, 0, -0x7FA0, -1, 0x8400);
-        break;
+static const s16 Pattern10_0045[] = {
+    COM_WALK, 0, 0x14, 0,
+    COM_WALK, 1, 0x16, 0,
+    COM_WALK, 0, 0x18, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0046[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8015, 0xA, -1,
+    COM_END,
+};
 
-void Pattern10_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x20, 0, -0x7FA0, 8, 0x200);
-        break;
+static const s16 Pattern10_0047[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 2, 0x18, 0x18, 0x11, 0x11, 0);
-        break;
+static const s16 Pattern10_0048[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8014, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0049[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-void Pattern10_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
+static const s16 Pattern10_0050[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Pattern10_0051[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0052[] = {
+    COM_SA_TERM, 0x2E, 0x2F, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x20, 0xA, -1,
+    COM_END,
+};
 
-void Pattern10_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
+static const s16 Pattern10_0053[] = {
+    COM_SA_TERM, 0x2E, 0x2F, 0x30, (s16)0x8040,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
+static const s16 Pattern10_0054[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x30, 0,
+    COM_HI_JUMP_ATTACK_TERM, -0x7FB0, 8, 8, (s16)0x8400, 0, -0x7FA0, 8, 0x20,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
+static const s16 Pattern10_0055[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x40, 0, -0x7FA0, 8, 0x20,
+    COM_END,
+};
 
-    case 3:
-        Com_Random_Select(wk, 6, 0x37, 0x37, 0x27, 0x27, 0);
-        break;
+static const s16 Pattern10_0056[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_COM_RANDOM_SELECT, 2, 0x31, 4, 5, 1, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0057[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 6, 0x12,
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x20, 1, -0x7FA0, 8, 0x200,
+    COM_END,
+};
 
-void Pattern10_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x200);
-        break;
+static const s16 Pattern10_0058[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 2, 0x11,
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x20, 1, -0x7FA0, 8, 0x200,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_COM_RANDOM_SELECT, 2, 0x18, 0x18, 0x11, 0x11, 0,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
+static const s16 Pattern10_0059[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 2, 0x11,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_COM_RANDOM_SELECT, 2, 0x18, 0x18, 0x11, 0x11, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0060[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 2, 0,
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x200, 0, -1, -1, -1,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_COM_RANDOM_SELECT, 2, 0x18, 0x18, 0x11, 0x11, 0,
+    COM_END,
+};
 
-void Pattern10_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 6, 0x2D, 0x19, 0x10, 0x17, 0);
-        break;
+static const s16 Pattern10_0061[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 2, 0,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -1, 8, (s16)0x8400, 0, -0x7FA0, -1, (s16)0x8400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0062[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x20, 0, -0x7FA0, 8, 0x200,
+    COM_COM_RANDOM_SELECT, 2, 0x18, 0x18, 0x11, 0x11, 0,
+    COM_END,
+};
 
-void Pattern10_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xD, 0x100);
-        break;
+static const s16 Pattern10_0063[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0064[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COM_RANDOM_SELECT, 6, 0x37, 0x37, 0x27, 0x27, 0,
+    COM_END,
+};
 
-void Pattern10_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
+static const s16 Pattern10_0065[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x200,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0066[] = {
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0x19, 0x10, 0x17, 0,
+    COM_END,
+};
 
-void Pattern10_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
+static const s16 Pattern10_0067[] = {
+    COM_NORMAL_ATTACK, 0xD, 0x100,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
+static const s16 Pattern10_0068[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern10_0069[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-void (*const Pattern10_Tbl[70])(PLW*) = {
+const s16* const Pattern10_Tbl[70] = {
     Pattern10_0000, Pattern10_0001, Pattern10_0002, Pattern10_0003, Pattern10_0004, Pattern10_0005, Pattern10_0006,
     Pattern10_0007, Pattern10_0008, Pattern10_0009, Pattern10_0010, Pattern10_0011, Pattern10_0012, Pattern10_0013,
     Pattern10_0014, Pattern10_0015, Pattern10_0016, Pattern10_0017, Pattern10_0018, Pattern10_0019, Pattern10_0020,
@@ -1166,3 +445,7 @@ void (*const Pattern10_Tbl[70])(PLW*) = {
     Pattern10_0056, Pattern10_0057, Pattern10_0058, Pattern10_0059, Pattern10_0060, Pattern10_0061, Pattern10_0062,
     Pattern10_0063, Pattern10_0064, Pattern10_0065, Pattern10_0066, Pattern10_0067, Pattern10_0068, Pattern10_0069
 };
+
+void Computer10(PLW* wk) {
+    Exec_Com_Pattern(wk, Pattern10_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
@@ -5,1408 +5,538 @@
 
 #include "sf33rd/Source/Game/com/active/active11.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Pattern11_Tbl[90])();
-
-void Computer11(PLW* wk) {
-    Pattern11_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Pattern11_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0xFFFF, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack_SP(wk, 8, 0x200, 0x12);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, -1);
-        break;
-
-    case 1:
-        ETC_Term(wk, 4, 2, 0x13);
-        break;
-
-    case 2:
-        Next_Another_Menu(wk, 2, 0x37);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 1);
-        break;
-
-    case 1:
-        ETC_Term(wk, 4, 2, 0x13);
-        break;
-
-    case 2:
-        Next_Another_Menu(wk, 2, 0x37);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Jump(wk, 0);
-        break;
-
-    case 2:
-        Com_Random_Select(wk, 2, 0x53, 0x4D, 0x20, 0xA, 4);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Jump(wk, 0);
-        break;
-
-    case 2:
-        Com_Random_Select(wk, 2, 0x53, 0x4E, 0x51, 0x59, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 1);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 2, 0x11, 0, 0x56, 0x2F, 3);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, -1);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 2, 0x11, 0, 0x24, 0x23, 3);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x20);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x30, 0x31, 0x32, 0x7F);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    case 3:
-        Com_Random_Select(wk, 2, 0, 0xA, 0x13, 0x1F, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x30, 0x31, 0x32, 0x7F);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x30, 0x31, 0x32, 0x7F);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x400);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
-
-    case 2:
-        Command_Attack(wk, 0xC, 0x1D, 0xA, -1);
-        break;
-
-    case 3:
-        Wait(wk, 0xA);
-        break;
-
-    case 4:
-        SA_Term(wk, 0x30, 0x31, 0x32, 0x7F);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, -1, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8014, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x8115, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0x7F, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    case 4:
-        Com_Random_Select(wk, 2, 0x2D, 0x13, 0x13, 0xFF, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern11_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0000[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Pattern11_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xBF, 2);
-        break;
+static const s16 Pattern11_0001[] = {
+    COM_WAIT, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0002[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Pattern11_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Pattern11_0003[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0004[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_LEVER_ATTACK, 8, (s16)0xFFFF, 0x110,
+    COM_END,
+};
 
-void Pattern11_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Pattern11_0005[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0006[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Pattern11_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 3, 2, 0x11);
-        break;
+static const s16 Pattern11_0007[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern11_0008[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0009[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Pattern11_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 3, 2, 0x12);
-        break;
+static const s16 Pattern11_0010[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
+static const s16 Pattern11_0011[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0012[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-void Pattern11_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 3, 2, 0x13);
-        break;
+static const s16 Pattern11_0013[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Pattern11_0014[] = {
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0015[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Pattern11_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern11_0016[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Pattern11_0017[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 0xC, 0x202);
-        break;
+static const s16 Pattern11_0018[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
+static const s16 Pattern11_0019[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0020[] = {
+    COM_NORMAL_ATTACK_SP, 8, 0x200, 0x12,
+    COM_END,
+};
 
-void Pattern11_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern11_0021[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Pattern11_0022[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
+static const s16 Pattern11_0023[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Pattern11_0024[] = {
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_END,
+};
 
-    case 4:
-        Com_Random_Select(wk, 2, 0, 0xA, 0x13, 0x1F, 0);
-        break;
+static const s16 Pattern11_0025[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0026[] = {
+    COM_WALK, 1, 0x20, -1,
+    COM_ETC_TERM, 4, 2, 0x13,
+    COM_NEXT_ANOTHER_MENU, 2, 0x37,
+    COM_END,
+};
 
-void Pattern11_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern11_0027[] = {
+    COM_KEEP_AWAY, 0xBF, 1,
+    COM_ETC_TERM, 4, 2, 0x13,
+    COM_NEXT_ANOTHER_MENU, 2, 0x37,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Pattern11_0028[] = {
+    COM_PIERCE_ON,
+    COM_JUMP, 0,
+    COM_COM_RANDOM_SELECT, 2, 0x53, 0x4D, 0x20, 0xA, 4,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
+static const s16 Pattern11_0029[] = {
+    COM_PIERCE_ON,
+    COM_JUMP, 0,
+    COM_COM_RANDOM_SELECT, 2, 0x53, 0x4E, 0x51, 0x59, 1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Pattern11_0030[] = {
+    COM_KEEP_AWAY, 0xBF, 1,
+    COM_COM_RANDOM_SELECT, 2, 0x11, 0, 0x56, 0x2F, 3,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0031[] = {
+    COM_WALK, 1, 0x20, -1,
+    COM_COM_RANDOM_SELECT, 2, 0x11, 0, 0x24, 0x23, 3,
+    COM_END,
+};
 
-void Pattern11_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Pattern11_0032[] = {
+    COM_NORMAL_ATTACK, 9, 0x20,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
+static const s16 Pattern11_0033[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_SA_TERM, 0x30, 0x31, 0x32, 0x7F,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Pattern11_0034[] = {
+    COM_KEEP_AWAY, 0xBF, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0035[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-void Pattern11_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 3, 2, 0);
-        break;
+static const s16 Pattern11_0036[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern11_0037[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0038[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_COM_RANDOM_SELECT, 2, 0, 0xA, 0x13, 0x1F, 0,
+    COM_END,
+};
 
-void Pattern11_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 3, 2, 0);
-        break;
+static const s16 Pattern11_0039[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_SA_TERM, 0x30, 0x31, 0x32, 0x7F,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
+static const s16 Pattern11_0040[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0041[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Pattern11_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 3, 2, 0);
-        break;
+static const s16 Pattern11_0042[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1,
+    COM_SA_TERM, 0x30, 0x31, 0x32, 0x7F,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Pattern11_0043[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x400,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0044[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Pattern11_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x1E, 0xA, 0x700, -1, 0x30, 0, -1, -1, -1);
-        break;
+static const s16 Pattern11_0045[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0046[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_COMMAND_ATTACK, 0xC, 0x1D, 0xA, -1,
+    COM_WAIT, 0xA,
+    COM_SA_TERM, 0x30, 0x31, 0x32, 0x7F,
+    COM_END,
+};
 
-void Pattern11_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Command_Attack_Term(wk, 8, 0x1E, 0xA, 0x700, -1, 0x30, 0, -1, -1, -1);
-        break;
+static const s16 Pattern11_0047[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, -1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0048[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8014, 0xA, -1,
+    COM_END,
+};
 
-void Pattern11_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0xA, 0x48, 0x48, 0x49, 0);
-        break;
+static const s16 Pattern11_0049[] = {
+    COM_J_COMMAND_ATTACK, 8, (s16)0x8115, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0050[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 0xA, -1,
+    COM_END,
+};
 
-void Pattern11_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, -1);
-        break;
+static const s16 Pattern11_0051[] = {
+    COM_KEEP_AWAY, 0x7F, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0052[] = {
+    COM_PIERCE_ON,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Pattern11_0076(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 5, 6, 0);
-        break;
+static const s16 Pattern11_0053[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_END,
+};
 
-    case 1:
-        Provoke(wk, -1);
-        break;
+static const s16 Pattern11_0054[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0055[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Pattern11_0077(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 1, 0x200);
-        break;
+static const s16 Pattern11_0056[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0057[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_COM_RANDOM_SELECT, 2, 0x2D, 0x13, 0x13, 0xFF, 0,
+    COM_END,
+};
 
-void Pattern11_0078(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
+static const s16 Pattern11_0058[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0059[] = {
+    COM_APPROACH_WALK, 0xBF, 2,
+    COM_END,
+};
 
-void Pattern11_0079(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack_SP(wk, 8, 0, 0x400, 0x12);
-        break;
+static const s16 Pattern11_0060[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0061[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-void Pattern11_0080(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_On(wk, 1, 2);
-        break;
+static const s16 Pattern11_0062[] = {
+    COM_ETC_TERM, 3, 2, 0x11,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Look(wk, 0);
-        break;
+static const s16 Pattern11_0063[] = {
+    COM_ETC_TERM, 3, 2, 0x12,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0064[] = {
+    COM_ETC_TERM, 3, 2, 0x13,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-void Pattern11_0081(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x4D, 0x4E, 0x14, 0x17, 3);
-        break;
+static const s16 Pattern11_0065[] = {
+    COM_PIERCE_ON,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_NORMAL_ATTACK, 0xC, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0066[] = {
+    COM_PIERCE_ON,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_COM_RANDOM_SELECT, 2, 0, 0xA, 0x13, 0x1F, 0,
+    COM_END,
+};
 
-void Pattern11_0082(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern11_0067[] = {
+    COM_PIERCE_ON,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
+static const s16 Pattern11_0068[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Lever_Attack(wk, 8, 1, 0x200);
-        break;
+static const s16 Pattern11_0069[] = {
+    COM_ETC_TERM, 3, 2, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0070[] = {
+    COM_ETC_TERM, 3, 2, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Pattern11_0083(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x53, 0x54, 0x55, 0x55, 4);
-        break;
+static const s16 Pattern11_0071[] = {
+    COM_ETC_TERM, 3, 2, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0072[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x1E, 0xA, 0x700, -1, 0x30, 0, -1, -1, -1,
+    COM_END,
+};
 
-void Pattern11_0084(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack_SP(wk, 8, 0, 0x400, 0x12);
-        break;
+static const s16 Pattern11_0073[] = {
+    COM_HI_JUMP_COMMAND_ATTACK_TERM, 8, 0x1E, 0xA, 0x700, -1, 0x30, 0, -1, -1, -1,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 2, 2, 3, 4, 4, 4);
-        break;
+static const s16 Pattern11_0074[] = {
+    COM_COM_RANDOM_SELECT, 2, 0xA, 0x48, 0x48, 0x49, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0075[] = {
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-void Pattern11_0085(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern11_0076[] = {
+    COM_ETC_TERM, 5, 6, 0,
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack_SP(wk, 8, 0, 0x400, 0x12);
-        break;
+static const s16 Pattern11_0077[] = {
+    COM_LEVER_ATTACK, 8, 1, 0x200,
+    COM_END,
+};
 
-    case 2:
-        Com_Random_Select(wk, 2, 0x25, 0x23, 0x52, 0x41, 0);
-        break;
+static const s16 Pattern11_0078[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0079[] = {
+    COM_LEVER_ATTACK_SP, 8, 0, 0x400, 0x12,
+    COM_END,
+};
 
-void Pattern11_0086(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x4D, 0x4E, 0x10, 0x14, 0);
-        break;
+static const s16 Pattern11_0080[] = {
+    COM_LEVER_ON, 1, 2,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0081[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x4D, 0x4E, 0x14, 0x17, 3,
+    COM_END,
+};
 
-void Pattern11_0087(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 6, 0, 0, 0, 0x50, 3);
-        break;
+static const s16 Pattern11_0082[] = {
+    COM_PIERCE_ON,
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_LEVER_ATTACK, 8, 1, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0083[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x53, 0x54, 0x55, 0x55, 4,
+    COM_END,
+};
 
-void Pattern11_0088(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 6, 0x50, 0, 0, 0, 2);
-        break;
+static const s16 Pattern11_0084[] = {
+    COM_LEVER_ATTACK_SP, 8, 0, 0x400, 0x12,
+    COM_COM_RANDOM_SELECT, 2, 2, 3, 4, 4, 4,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0085[] = {
+    COM_PIERCE_ON,
+    COM_LEVER_ATTACK_SP, 8, 0, 0x400, 0x12,
+    COM_COM_RANDOM_SELECT, 2, 0x25, 0x23, 0x52, 0x41, 0,
+    COM_END,
+};
 
-void Pattern11_0089(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 5, 6, 0x57);
-        break;
+static const s16 Pattern11_0086[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x4D, 0x4E, 0x10, 0x14, 0,
+    COM_END,
+};
 
-    case 1:
-        Branch_Unit_Area(wk, 2, 0x53, 0x56, 0x55, 0x4C);
-        break;
+static const s16 Pattern11_0087[] = {
+    COM_COM_RANDOM_SELECT, 6, 0, 0, 0, 0x50, 3,
+    COM_END,
+};
 
-    case 2:
-        Provoke(wk, -1);
-        break;
+static const s16 Pattern11_0088[] = {
+    COM_COM_RANDOM_SELECT, 6, 0x50, 0, 0, 0, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern11_0089[] = {
+    COM_ETC_TERM, 5, 6, 0x57,
+    COM_BRANCH_UNIT_AREA, 2, 0x53, 0x56, 0x55, 0x4C,
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-void (*const Pattern11_Tbl[90])(PLW*) = {
+const s16* const Pattern11_Tbl[90] = {
     Pattern11_0000, Pattern11_0001, Pattern11_0002, Pattern11_0003, Pattern11_0004, Pattern11_0005, Pattern11_0006,
     Pattern11_0007, Pattern11_0008, Pattern11_0009, Pattern11_0010, Pattern11_0011, Pattern11_0012, Pattern11_0013,
     Pattern11_0014, Pattern11_0015, Pattern11_0016, Pattern11_0017, Pattern11_0018, Pattern11_0019, Pattern11_0020,
@@ -1421,3 +551,7 @@ void (*const Pattern11_Tbl[90])(PLW*) = {
     Pattern11_0077, Pattern11_0078, Pattern11_0079, Pattern11_0080, Pattern11_0081, Pattern11_0082, Pattern11_0083,
     Pattern11_0084, Pattern11_0085, Pattern11_0086, Pattern11_0087, Pattern11_0088, Pattern11_0089
 };
+
+void Computer11(PLW* wk) {
+    Exec_Com_Pattern(wk, Pattern11_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
@@ -5,1380 +5,523 @@
 
 #include "sf33rd/Source/Game/com/active/active12.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Pattern12_Tbl[86])();
-
-void Computer12(PLW* wk) {
-    Pattern12_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Pattern12_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x20, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 0x4008, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 0x4009, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 0x400A, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Jump(wk, 0);
-        break;
-
-    case 2:
-        Com_Random_Select(wk, 6, 2, 4, 0x20, 0xA, 4);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Jump(wk, 0);
-        break;
-
-    case 2:
-        Com_Random_Select(wk, 6, 2, 4, 0, 0xD, 3);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 1);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 6, 0x11, 0, 0x10, 0x2F, 3);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, -1);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 6, 0x11, 0, 0x24, 0x23, 3);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x20);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x30, 0x31, 0x32, 0);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 0x4009, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 0x400A, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    case 3:
-        Com_Random_Select(wk, 6, 0, 0xA, 0x13, 0x1F, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x30, 0x31, 0x32, 0);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x30, 0x31, 0x32, 0);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 0x400A, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x400);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
-
-    case 2:
-        Command_Attack(wk, 0xC, 0x1C, 0x400A, -1);
-        break;
-
-    case 3:
-        Wait(wk, 5);
-        break;
-
-    case 4:
-        SA_Term(wk, 0x30, 0x31, 0x32, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, -1, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8014, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x8215, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0x7F, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x20, 0xA, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, 0x8058, 0x8040, 9, 0x20, 0, 0x8050, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1c, 0x4008, -1);
-        break;
-
-    case 5:
-        Com_Random_Select(wk, 6, 0x2d, 0xff, 0xff, 0xff, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern12_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xBF, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0000[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Pattern12_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Pattern12_0001[] = {
+    COM_WAIT, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0002[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Pattern12_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Pattern12_0003[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0004[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-void Pattern12_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0x37, 0);
-        break;
+static const s16 Pattern12_0005[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0006[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-void Pattern12_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0x7F, 0);
-        break;
+static const s16 Pattern12_0007[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0008[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_END,
+};
 
-void Pattern12_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 0);
-        break;
+static const s16 Pattern12_0009[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0010[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x20, 0xA, -1,
+    COM_END,
+};
 
-void Pattern12_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 0);
-        break;
+static const s16 Pattern12_0011[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0012[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-void Pattern12_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
+static const s16 Pattern12_0013[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
+static const s16 Pattern12_0014[] = {
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 0x400A, -1);
-        break;
+static const s16 Pattern12_0015[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0016[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Pattern12_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Pattern12_0017[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 0x4008, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Pattern12_0018[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 0x4009, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Pattern12_0019[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 0x400A, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0020[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Pattern12_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Pattern12_0021[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
+static const s16 Pattern12_0022[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x40);
-        break;
+static const s16 Pattern12_0023[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Pattern12_0024[] = {
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0025[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-void Pattern12_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern12_0026[] = {
+    COM_WALK, 1, 0x20, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0027[] = {
+    COM_KEEP_AWAY, 0xBF, 1,
+    COM_END,
+};
 
-void Pattern12_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
+static const s16 Pattern12_0028[] = {
+    COM_PIERCE_ON,
+    COM_JUMP, 0,
+    COM_COM_RANDOM_SELECT, 6, 2, 4, 0x20, 0xA, 4,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0029[] = {
+    COM_PIERCE_ON,
+    COM_JUMP, 0,
+    COM_COM_RANDOM_SELECT, 6, 2, 4, 0, 0xD, 3,
+    COM_END,
+};
 
-void Pattern12_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Pattern12_0030[] = {
+    COM_KEEP_AWAY, 0xBF, 1,
+    COM_COM_RANDOM_SELECT, 6, 0x11, 0, 0x10, 0x2F, 3,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Pattern12_0031[] = {
+    COM_WALK, 1, 0x20, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x11, 0, 0x24, 0x23, 3,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Pattern12_0032[] = {
+    COM_NORMAL_ATTACK, 9, 0x20,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern12_0033[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_SA_TERM, 0x30, 0x31, 0x32, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0034[] = {
+    COM_KEEP_AWAY, 0xBF, 0,
+    COM_END,
+};
 
-void Pattern12_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Pattern12_0035[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0x4009, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
+static const s16 Pattern12_0036[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0x400A, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 0xC, 0x1D, 0xA, -1);
-        break;
+static const s16 Pattern12_0037[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 3:
-        Wait(wk, 5);
-        break;
+static const s16 Pattern12_0038[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_COM_RANDOM_SELECT, 6, 0, 0xA, 0x13, 0x1F, 0,
+    COM_END,
+};
 
-    case 4:
-        SA_Term(wk, 0x30, 0x31, 0x32, 0);
-        break;
+static const s16 Pattern12_0039[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_SA_TERM, 0x30, 0x31, 0x32, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0040[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-void Pattern12_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x40);
-        break;
+static const s16 Pattern12_0041[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_J_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 0xC, 0x1C, 9, -1);
-        break;
+static const s16 Pattern12_0042[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1,
+    COM_SA_TERM, 0x30, 0x31, 0x32, 0,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0x400A, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern12_0043[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x400,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0044[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Pattern12_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x93, 2);
-        break;
+static const s16 Pattern12_0045[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0xFFFF, 0x31, 0xFFFF, 0);
-        break;
+static const s16 Pattern12_0046[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_COMMAND_ATTACK, 0xC, 0x1C, 0x400A, -1,
+    COM_WAIT, 5,
+    COM_SA_TERM, 0x30, 0x31, 0x32, 0,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Pattern12_0047[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, -1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0048[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8014, 0xA, -1,
+    COM_END,
+};
 
-void Pattern12_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Pattern12_0049[] = {
+    COM_J_COMMAND_ATTACK, 8, (s16)0x8215, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Pattern12_0050[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        SA_Term(wk, 0xFFFF, 0x30, 0xFFFF, 0);
-        break;
+static const s16 Pattern12_0051[] = {
+    COM_KEEP_AWAY, 0x7F, 0,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Pattern12_0052[] = {
+    COM_PIERCE_ON,
+    COM_J_COMMAND_ATTACK, 8, 0x20, 0xA, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0053[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_END,
+};
 
-void Pattern12_0076(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern12_0054[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
+static const s16 Pattern12_0055[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0056[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_END,
+};
 
-void Pattern12_0077(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 0);
-        break;
+static const s16 Pattern12_0057[] = {
+    COM_JUMP_ATTACK_TERM, (s16)0x8058, (s16)0x8040, 9, 0x20, 0, (s16)0x8050, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0x4008, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 0,
+    COM_END,
+};
 
-    case 1:
-        Keep_Away(wk, 0x7F, 0);
-        break;
+static const s16 Pattern12_0058[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200,
+    COM_END,
+};
 
-    case 2:
-        Keep_Away(wk, 0xBF, 0);
-        break;
+static const s16 Pattern12_0059[] = {
+    COM_APPROACH_WALK, 0xBF, 2,
+    COM_END,
+};
 
-    case 3:
-        Keep_Away(wk, 0x37, 0);
-        break;
+static const s16 Pattern12_0060[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0061[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-void Pattern12_0078(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
+static const s16 Pattern12_0062[] = {
+    COM_KEEP_AWAY, 0x37, 0,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
+static const s16 Pattern12_0063[] = {
+    COM_KEEP_AWAY, 0x7F, 0,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 0x400A, -1);
-        break;
+static const s16 Pattern12_0064[] = {
+    COM_KEEP_AWAY, 0xBF, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0065[] = {
+    COM_KEEP_AWAY, 0xBF, 0,
+    COM_END,
+};
 
-void Pattern12_0079(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x402);
-        break;
+static const s16 Pattern12_0066[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0x400A, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xB, 0x402);
-        break;
+static const s16 Pattern12_0067[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Pattern12_0068[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0069[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern12_0080(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Pattern12_0070[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
+static const s16 Pattern12_0071[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
+static const s16 Pattern12_0072[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_COMMAND_ATTACK, 0xC, 0x1D, 0xA, -1,
+    COM_WAIT, 5,
+    COM_SA_TERM, 0x30, 0x31, 0x32, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0073[] = {
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_COMMAND_ATTACK, 0xC, 0x1C, 9, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern12_0081(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xC, 0x20, 0xA, -1);
-        break;
+static const s16 Pattern12_0074[] = {
+    COM_APPROACH_WALK, 0x93, 2,
+    COM_SA_TERM, (s16)0xFFFF, 0x31, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0075[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_SA_TERM, (s16)0xFFFF, 0x30, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-void Pattern12_0082(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xC, 0x20, 0xA, -1);
-        break;
+static const s16 Pattern12_0076[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0077[] = {
+    COM_KEEP_AWAY, 0xBF, 0,
+    COM_KEEP_AWAY, 0x7F, 0,
+    COM_KEEP_AWAY, 0xBF, 0,
+    COM_KEEP_AWAY, 0x37, 0,
+    COM_END,
+};
 
-void Pattern12_0083(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump(wk, 0xC, 1);
-        break;
+static const s16 Pattern12_0078[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0x400A, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 0xC, 0x20, 0xA, -1);
-        break;
+static const s16 Pattern12_0079[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x402,
+    COM_NORMAL_ATTACK, 0xB, 0x402,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0080[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-void Pattern12_0084(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 5, 1, 0xFFFF);
-        break;
+static const s16 Pattern12_0081[] = {
+    COM_COMMAND_ATTACK, 0xC, 0x20, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Provoke(wk, -1);
-        break;
+static const s16 Pattern12_0082[] = {
+    COM_COMMAND_ATTACK, 0xC, 0x20, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0083[] = {
+    COM_HI_JUMP, 0xC, 1,
+    COM_COMMAND_ATTACK, 0xC, 0x20, 0xA, -1,
+    COM_END,
+};
 
-void Pattern12_0085(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
+static const s16 Pattern12_0084[] = {
+    COM_ETC_TERM, 5, 1, (s16)0xFFFF,
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern12_0085[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_END,
+};
 
-void (*const Pattern12_Tbl[86])(PLW*) = {
+const s16* const Pattern12_Tbl[86] = {
     Pattern12_0000, Pattern12_0001, Pattern12_0002, Pattern12_0003, Pattern12_0004, Pattern12_0005, Pattern12_0006,
     Pattern12_0007, Pattern12_0008, Pattern12_0009, Pattern12_0010, Pattern12_0011, Pattern12_0012, Pattern12_0013,
     Pattern12_0014, Pattern12_0015, Pattern12_0016, Pattern12_0017, Pattern12_0018, Pattern12_0019, Pattern12_0020,
@@ -1393,3 +536,7 @@ void (*const Pattern12_Tbl[86])(PLW*) = {
     Pattern12_0077, Pattern12_0078, Pattern12_0079, Pattern12_0080, Pattern12_0081, Pattern12_0082, Pattern12_0083,
     Pattern12_0084, Pattern12_0085
 };
+
+void Computer12(PLW* wk) {
+    Exec_Com_Pattern(wk, Pattern12_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
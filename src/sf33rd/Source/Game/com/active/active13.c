@@ -5,1200 +5,468 @@
 
 #include "sf33rd/Source/Game/com/active/active13.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Pattern13_Tbl[81])();
-
-void Computer13(PLW* wk) {
-    Pattern13_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Pattern13_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xD, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0x1E);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x100);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 2, 0x10);
-        break;
-
-    case 1:
-        Jump(wk, 1);
-        break;
-
-    case 2:
-        Lever_On(wk, 1, 2);
-        break;
-
-    case 3:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_On(wk, 1, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 8, 0x40, 2, -0x7F90, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x50, 2, 0);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FB0, 8, 0x10, 0, -0x7F90, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 8, 0x400, 0, -0x7F90, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Search_Back_Term(wk, 0x60, 2, 0x12);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7B, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 2, 0);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FB0, 0xB, 0x10, 0, -0x7F90, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7B, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xC, 0x100);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 0xC, 0x100);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xC, 0x10);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 0xC, 0x20);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x20);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Lever_On(wk, 1, 2);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Lever_On(wk, 1, 2);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x42);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_On(wk, 1, 0);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xA, 0x202);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x200);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_On(wk, 1, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 8, 0x400, 0, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 8, 0x40, 0, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FC0, 8, 0x400, 0, -1, -1, 0xFFFF);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8014, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern13_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8014, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0000[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Pattern13_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern13_0001[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0002[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern13_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
+static const s16 Pattern13_0003[] = {
+    COM_ADJUST_ATTACK, 0xD, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0004[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-void Pattern13_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Pattern13_0005[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0006[] = {
+    COM_WAIT, 0x1E,
+    COM_END,
+};
 
-void Pattern13_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x31, 0x31, 0x31, 0x32, 0);
-        break;
+static const s16 Pattern13_0007[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0008[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Pattern13_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x31, 0x31, 0x32, 0x33, 0);
-        break;
+static const s16 Pattern13_0009[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 2, 0x10,
+    COM_JUMP, 1,
+    COM_LEVER_ON, 1, 2,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0010[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Pattern13_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x31, 0x32, 0x32, 0x33, 0);
-        break;
+static const s16 Pattern13_0011[] = {
+    COM_LEVER_ON, 1, 2,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0012[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Pattern13_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
+static const s16 Pattern13_0013[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
+static const s16 Pattern13_0014[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 8, 0x40, 2, -0x7F90, 8, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0015[] = {
+    COM_WALK, 0, 0x30, 0,
+    COM_END,
+};
 
-void Pattern13_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 2, 0x10);
-        break;
+static const s16 Pattern13_0016[] = {
+    COM_SEARCH_BACK_TERM, 0x50, 2, 0,
+    COM_WALK, 1, 0x30, 0,
+    COM_END,
+};
 
-    case 1:
-        Jump_Attack_Term(wk, -1, -0x7FB8, 8, 0x400, 1, -0x7F90, -1, 0x200);
-        break;
+static const s16 Pattern13_0017[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0018[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Pattern13_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8014, 0xA, -1);
-        break;
+static const s16 Pattern13_0019[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0020[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FB0, 8, 0x10, 0, -0x7F90, 8, 0x20,
+    COM_END,
+};
 
-void Pattern13_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8015, 0xA, -1);
-        break;
+static const s16 Pattern13_0021[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 8, 0x400, 0, -0x7F90, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0022[] = {
+    COM_PIERCE_ON,
+    COM_SEARCH_BACK_TERM, 0x60, 2, 0x12,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Pattern13_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 8, -1);
-        break;
+static const s16 Pattern13_0023[] = {
+    COM_APPROACH_WALK, 0x7B, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0024[] = {
+    COM_WALK, 0, 0x60, 0,
+    COM_END,
+};
 
-void Pattern13_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 9, -1);
-        break;
+static const s16 Pattern13_0025[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 2, 0,
+    COM_WALK, 1, 0x60, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0026[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Pattern13_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 0xA, -1);
-        break;
+static const s16 Pattern13_0027[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FB0, 0xB, 0x10, 0, -0x7F90, 8, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0028[] = {
+    COM_APPROACH_WALK, 0x7B, 2,
+    COM_END,
+};
 
-void Pattern13_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 0xB, -1);
-        break;
+static const s16 Pattern13_0029[] = {
+    COM_ADJUST_ATTACK, 0xC, 0x100,
+    COM_ADJUST_ATTACK, 0xC, 0x100,
+    COM_ADJUST_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0030[] = {
+    COM_ADJUST_ATTACK, 0xC, 0x10,
+    COM_ADJUST_ATTACK, 0xC, 0x20,
+    COM_ADJUST_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Pattern13_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 7, 2, 0x44);
-        break;
+static const s16 Pattern13_0031[] = {
+    COM_NORMAL_ATTACK, 9, 0x20,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Check_SA(wk, 2, 0x44);
-        break;
+static const s16 Pattern13_0032[] = {
+    COM_PIERCE_ON,
+    COM_LEVER_ON, 1, 2,
+    COM_ADJUST_ATTACK, 0xB, 0x10,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        Branch_Unit_Area(wk, 2, 0x40, 0x40, 0x41, 0x42);
-        break;
+static const s16 Pattern13_0033[] = {
+    COM_ADJUST_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0034[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Pattern13_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 9, -1);
-        break;
+static const s16 Pattern13_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 1:
-        Check_SA(wk, 2, 0x35);
-        break;
+static const s16 Pattern13_0036[] = {
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x8016, 8, -1);
-        break;
+static const s16 Pattern13_0037[] = {
+    COM_PIERCE_ON,
+    COM_LEVER_ON, 1, 2,
+    COM_NORMAL_ATTACK, 9, 0x42,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern13_0038[] = {
+    COM_LEVER_ON, 1, 0,
+    COM_ADJUST_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 0xA, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0039[] = {
+    COM_NORMAL_ATTACK, 9, 0x200,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern13_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 0xA, -1);
-        break;
+static const s16 Pattern13_0040[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Check_SA(wk, 2, 0x35);
-        break;
+static const s16 Pattern13_0041[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x8016, 8, -1);
-        break;
+static const s16 Pattern13_0042[] = {
+    COM_LEVER_ON, 1, 2,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern13_0043[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 8, 0x400, 0, -1, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0044[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 8, 0x40, 0, -1, -1, -1,
+    COM_END,
+};
 
-void Pattern13_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 0xA, -1);
-        break;
+static const s16 Pattern13_0045[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FC0, 8, 0x400, 0, -1, -1, (s16)0xFFFF,
+    COM_END,
+};
 
-    case 1:
-        Check_SA(wk, 2, 0x34);
-        break;
+static const s16 Pattern13_0046[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern13_0047[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8014, 0xA, -1,
+    COM_END,
+};
 
-    case 3:
-        Com_Random_Select(wk, 2, 0x31, 0x31, 0x32, 0x33, 0);
-        break;
+static const s16 Pattern13_0048[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8014, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0049[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern13_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, 0x70);
-        break;
+static const s16 Pattern13_0050[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
+static const s16 Pattern13_0051[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0052[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x31, 0x31, 0x31, 0x32, 0,
+    COM_END,
+};
 
-void Pattern13_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x39, 0x3A, 0x3C, 0xFFFF);
-        break;
+static const s16 Pattern13_0053[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x31, 0x31, 0x32, 0x33, 0,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Pattern13_0054[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x31, 0x32, 0x32, 0x33, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0055[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Pattern13_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x40, 0, -0x7F90, 8, 0x400);
-        break;
+static const s16 Pattern13_0056[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 2, 0x10,
+    COM_JUMP_ATTACK_TERM, -1, -0x7FB8, 8, 0x400, 1, -0x7F90, -1, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0057[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8014, 0xA, -1,
+    COM_END,
+};
 
-void Pattern13_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
+static const s16 Pattern13_0058[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8015, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0059[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 8, -1,
+    COM_END,
+};
 
-void Pattern13_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
+static const s16 Pattern13_0060[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0061[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 0xA, -1,
+    COM_END,
+};
 
-void Pattern13_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
+static const s16 Pattern13_0062[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 0xB, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0063[] = {
+    COM_ETC_TERM, 7, 2, 0x44,
+    COM_CHECK_SA, 2, 0x44,
+    COM_BRANCH_UNIT_AREA, 2, 0x40, 0x40, 0x41, 0x42,
+    COM_END,
+};
 
-void Pattern13_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 0xD, 0, 0x20);
-        break;
+static const s16 Pattern13_0064[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 9, -1,
+    COM_CHECK_SA, 2, 0x35,
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 8, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0065[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 0xA, -1,
+    COM_CHECK_SA, 2, 0x35,
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 8, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern13_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
+static const s16 Pattern13_0066[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 0xA, -1,
+    COM_CHECK_SA, 2, 0x34,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_COM_RANDOM_SELECT, 2, 0x31, 0x31, 0x32, 0x33, 0,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
+static const s16 Pattern13_0067[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, 0x70,
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0068[] = {
+    COM_SA_TERM, 0x39, 0x3A, 0x3C, (s16)0xFFFF,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Pattern13_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 0x4008, -1);
-        break;
+static const s16 Pattern13_0069[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x40, 0, -0x7F90, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0070[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-void Pattern13_0076(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 0x4009, -1);
-        break;
+static const s16 Pattern13_0071[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0072[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_END,
+};
 
-void Pattern13_0077(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 0x400A, -1);
-        break;
+static const s16 Pattern13_0073[] = {
+    COM_LEVER_ATTACK, 0xD, 0, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0074[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-void Pattern13_0078(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x31, 0x31, 0x31, 0x4B, 4);
-        break;
+static const s16 Pattern13_0075[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 0x4008, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0076[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 0x4009, -1,
+    COM_END,
+};
 
-void Pattern13_0079(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x32, 0x32, 0x31, 0x4C, 4);
-        break;
+static const s16 Pattern13_0077[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 0x400A, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0078[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x31, 0x31, 0x31, 0x4B, 4,
+    COM_END,
+};
 
-void Pattern13_0080(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x31, 0x32, 0x33, 0x4C, 4);
-        break;
+static const s16 Pattern13_0079[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x32, 0x32, 0x31, 0x4C, 4,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern13_0080[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x31, 0x32, 0x33, 0x4C, 4,
+    COM_END,
+};
 
-void (*const Pattern13_Tbl[81])(PLW*) = {
+const s16* const Pattern13_Tbl[81] = {
     Pattern13_0000, Pattern13_0001, Pattern13_0002, Pattern13_0003, Pattern13_0004, Pattern13_0005, Pattern13_0006,
     Pattern13_0007, Pattern13_0008, Pattern13_0009, Pattern13_0010, Pattern13_0011, Pattern13_0012, Pattern13_0013,
     Pattern13_0014, Pattern13_0015, Pattern13_0016, Pattern13_0017, Pattern13_0018, Pattern13_0019, Pattern13_0020,
@@ -1212,3 +480,7 @@ void (*const Pattern13_Tbl[81])(PLW*) = {
     Pattern13_0070, Pattern13_0071, Pattern13_0072, Pattern13_0073, Pattern13_0074, Pattern13_0075, Pattern13_0076,
     Pattern13_0077, Pattern13_0078, Pattern13_0079, Pattern13_0080
 };
+
+void Computer13(PLW* wk) {
+    Exec_Com_Pattern(wk, Pattern13_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
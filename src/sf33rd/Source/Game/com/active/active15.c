@@ -5,1035 +5,403 @@
 
 #include "sf33rd/Source/Game/com/active/active15.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Pattern15_Tbl[69])();
-
-void Computer15(PLW* wk) {
-    Pattern15_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Pattern15_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 2, 0x41, 0x31, 0x32, 0x33);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 2, 0x3E, 0x3E, 0x3F, 0x3F, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0x1E);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 2, 1);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 6, 0x12);
-        break;
-
-    case 1:
-        Jump(wk, 1);
-        break;
-
-    case 2:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FB0, 0xB, 0x20, 2, -0x7FA0, -1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 6, 0xF);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack(wk, 8, 0xC, 0x202, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    case 1:
-        Jump_Attack(wk, 8, 0xC, 0x202, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FA0, 0xB, 0x400, 0, -0x7FA0, -1, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack(wk, 8, 0xF, 0x40, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 6, 0xF);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xBF, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x100);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x200);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FA0, 0xB, 0x200, 0, -0x7FA0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, 0x70);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x100);
-        break;
-
-    case 1:
-        Branch_Unit_Area(wk, 2, 1, 0x31, 0x32, 0x33);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x102);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x102);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xA, 0x202);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x202);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x22);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern15_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 2, 0xF);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x20, 0);
-        break;
-
-    case 2:
-        Wait(wk, 3);
-        break;
+static const s16 Pattern15_0000[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 3:
-        Walk(wk, 0, 0x30, 0);
-        break;
+static const s16 Pattern15_0001[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 4:
-        Wait(wk, 9);
-        break;
+static const s16 Pattern15_0002[] = {
+    COM_BRANCH_UNIT_AREA, 2, 0x41, 0x31, 0x32, 0x33,
+    COM_END,
+};
 
-    case 5:
-        Walk(wk, 0, 0x20, 0);
-        break;
+static const s16 Pattern15_0003[] = {
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0004[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-void Pattern15_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x20, 2, 0x1B);
-        break;
+static const s16 Pattern15_0005[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_COM_RANDOM_SELECT, 2, 0x3E, 0x3E, 0x3F, 0x3F, 1,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x18, 0);
-        break;
+static const s16 Pattern15_0006[] = {
+    COM_WAIT, 0x1E,
+    COM_END,
+};
 
-    case 2:
-        Wait(wk, 8);
-        break;
+static const s16 Pattern15_0007[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 2, 1,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-    case 3:
-        Search_Back_Term(wk, 0x30, 2, 0x1B);
-        break;
+static const s16 Pattern15_0008[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 4:
-        Walk(wk, 1, 0x20, 0);
-        break;
+static const s16 Pattern15_0009[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 6, 0x12,
+    COM_JUMP, 1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0010[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Pattern15_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x20, 0);
-        break;
+static const s16 Pattern15_0011[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    case 1:
-        Search_Back_Term(wk, 0x30, 2, 6);
-        break;
+static const s16 Pattern15_0012[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 2:
-        Walk(wk, 1, 0x28, 0);
-        break;
+static const s16 Pattern15_0013[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 3:
-        Wait(wk, 8);
-        break;
+static const s16 Pattern15_0014[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FB0, 0xB, 0x20, 2, -0x7FA0, -1, 0x20,
+    COM_END,
+};
 
-    case 4:
-        Walk(wk, 0, 0x20, 0);
-        break;
+static const s16 Pattern15_0015[] = {
+    COM_WALK, 0, 0x30, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0016[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 6, 0xF,
+    COM_WALK, 1, 0x30, 0,
+    COM_END,
+};
 
-void Pattern15_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8014, 0xA, -1);
-        break;
+static const s16 Pattern15_0017[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0018[] = {
+    COM_JUMP_ATTACK, 8, 0xC, 0x202, 0,
+    COM_END,
+};
 
-void Pattern15_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8015, 0xA, -1);
-        break;
+static const s16 Pattern15_0019[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0020[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_JUMP_ATTACK, 8, 0xC, 0x202, 0,
+    COM_END,
+};
 
-void Pattern15_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 0xA, -1);
-        break;
+static const s16 Pattern15_0021[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FA0, 0xB, 0x400, 0, -0x7FA0, -1, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0022[] = {
+    COM_JUMP_ATTACK, 8, 0xF, 0x40, 0,
+    COM_END,
+};
 
-void Pattern15_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
+static const s16 Pattern15_0023[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0024[] = {
+    COM_WALK, 0, 0x60, 0,
+    COM_END,
+};
 
-void Pattern15_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
+static const s16 Pattern15_0025[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 6, 0xF,
+    COM_WALK, 1, 0x60, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0026[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Pattern15_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Pattern15_0027[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0028[] = {
+    COM_APPROACH_WALK, 0xBF, 2,
+    COM_END,
+};
 
-void Pattern15_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0x2F, 0x30, 0);
-        break;
+static const s16 Pattern15_0029[] = {
+    COM_ADJUST_ATTACK, 8, 0x100,
+    COM_ADJUST_ATTACK, 8, 0x200,
+    COM_ADJUST_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 2, 0x3E, 0x3E, 0x3F, 0x3F, 1);
-        break;
+static const s16 Pattern15_0030[] = {
+    COM_ADJUST_ATTACK, 9, 0x100,
+    COM_ADJUST_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0031[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FA0, 0xB, 0x200, 0, -0x7FA0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Pattern15_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x2E, 0x2F, 0xFFFF, 0);
-        break;
+static const s16 Pattern15_0032[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x10,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, 0x70,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Pattern15_0033[] = {
+    COM_ADJUST_ATTACK, 8, 0x100,
+    COM_BRANCH_UNIT_AREA, 2, 1, 0x31, 0x32, 0x33,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0034[] = {
+    COM_ADJUST_ATTACK, 8, 0x102,
+    COM_ADJUST_ATTACK, 8, 0x102,
+    COM_ADJUST_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Pattern15_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0x2F, 0xFFFF, 0);
-        break;
+static const s16 Pattern15_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 1:
-        Approach_Walk(wk, 0xBF, 2);
-        break;
+static const s16 Pattern15_0036[] = {
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    case 2:
-        SA_Term(wk, 0x2E, 0xFFFF, 0xFFFF, 0);
-        break;
+static const s16 Pattern15_0037[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Pattern15_0038[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 0xA, 0x202,
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0039[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-void Pattern15_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
+static const s16 Pattern15_0040[] = {
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Look(wk, 0);
-        break;
+static const s16 Pattern15_0041[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0042[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Pattern15_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 9, 0x700);
-        break;
+static const s16 Pattern15_0043[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 2, 0xF,
+    COM_WALK, 1, 0x20, 0,
+    COM_WAIT, 3,
+    COM_WALK, 0, 0x30, 0,
+    COM_WAIT, 9,
+    COM_WALK, 0, 0x20, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0044[] = {
+    COM_SEARCH_BACK_TERM, 0x20, 2, 0x1B,
+    COM_WALK, 1, 0x18, 0,
+    COM_WAIT, 8,
+    COM_SEARCH_BACK_TERM, 0x30, 2, 0x1B,
+    COM_WALK, 1, 0x20, 0,
+    COM_END,
+};
 
-void Pattern15_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Pattern15_0045[] = {
+    COM_WALK, 0, 0x20, 0,
+    COM_SEARCH_BACK_TERM, 0x30, 2, 6,
+    COM_WALK, 1, 0x28, 0,
+    COM_WAIT, 8,
+    COM_WALK, 0, 0x20, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0046[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8014, 0xA, -1,
+    COM_END,
+};
 
-void Pattern15_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
+static const s16 Pattern15_0047[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8015, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0048[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 0xA, -1,
+    COM_END,
+};
 
-void Pattern15_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Pattern15_0049[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0050[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-void Pattern15_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 9, 0x70);
-        break;
+static const s16 Pattern15_0051[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0052[] = {
+    COM_SA_TERM, (s16)0xFFFF, 0x2F, 0x30, 0,
+    COM_COM_RANDOM_SELECT, 2, 0x3E, 0x3E, 0x3F, 0x3F, 1,
+    COM_END,
+};
 
-void Pattern15_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_EX(wk, 2, 2);
-        break;
+static const s16 Pattern15_0053[] = {
+    COM_SA_TERM, 0x2E, 0x2F, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 0xA, 0x700);
-        break;
+static const s16 Pattern15_0054[] = {
+    COM_SA_TERM, (s16)0xFFFF, 0x2F, (s16)0xFFFF, 0,
+    COM_APPROACH_WALK, 0xBF, 2,
+    COM_SA_TERM, 0x2E, (s16)0xFFFF, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0055[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Pattern15_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
+static const s16 Pattern15_0056[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, 0x700,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0057[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Pattern15_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
+static const s16 Pattern15_0058[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0059[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Pattern15_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Pattern15_0060[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, 0x70,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0061[] = {
+    COM_CHECK_EX, 2, 2,
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, 0x700,
+    COM_END,
+};
 
-void Pattern15_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Rapid_Command_Attack(wk, 8, 0x4D, 0x100, 0x78);
-        break;
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0062[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Pattern15_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Rapid_Command_Attack(wk, 8, 0x4D, 0x400, 0x78);
-        break;
+static const s16 Pattern15_0063[] = {
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0064[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Pattern15_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack_SP(wk, 8, 0x200, 0x12);
-        break;
+static const s16 Pattern15_0065[] = {
+    COM_RAPID_COMMAND_ATTACK, 8, 0x4D, 0x100, 0x78,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0066[] = {
+    COM_RAPID_COMMAND_ATTACK, 8, 0x4D, 0x400, 0x78,
+    COM_END,
+};
 
-void Pattern15_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Rapid_Command_Attack(wk, 8, 0x4D, 0x100, 0x78);
-        break;
+static const s16 Pattern15_0067[] = {
+    COM_NORMAL_ATTACK_SP, 8, 0x200, 0x12,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern15_0068[] = {
+    COM_RAPID_COMMAND_ATTACK, 8, 0x4D, 0x100, 0x78,
+    COM_END,
+};
 
-void (*const Pattern15_Tbl[69])(PLW*) = {
+const s16* const Pattern15_Tbl[69] = {
     Pattern15_0000, Pattern15_0001, Pattern15_0002, Pattern15_0003, Pattern15_0004, Pattern15_0005, Pattern15_0006,
     Pattern15_0007, Pattern15_0008, Pattern15_0009, Pattern15_0010, Pattern15_0011, Pattern15_0012, Pattern15_0013,
     Pattern15_0014, Pattern15_0015, Pattern15_0016, Pattern15_0017, Pattern15_0018, Pattern15_0019, Pattern15_0020,
@@ -1045,3 +413,7 @@ void (*const Pattern15_Tbl[69])(PLW*) = {
     Pattern15_0056, Pattern15_0057, Pattern15_0058, Pattern15_0059, Pattern15_0060, Pattern15_0061, Pattern15_0062,
     Pattern15_0063, Pattern15_0064, Pattern15_0065, Pattern15_0066, Pattern15_0067, Pattern15_0068
 };
+
+void Computer15(PLW* wk) {
+    Exec_Com_Pattern(wk, Pattern15_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
@@ -5,1416 +5,527 @@
 
 #include "sf33rd/Source/Game/com/active/active17.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Pattern17_Tbl[83])();
-
-void Computer17(PLW* wk) {
-    Pattern17_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Pattern17_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x41, 2);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 2, 0x3E, 0x3F, 0x40, 0x40, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0x1E);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 2, 1);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x10);
-        break;
-
-    case 1:
-        Jump(wk, 1);
-        break;
-
-    case 2:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FB0, 0xB, 0x20, 2, -0x7FA0, -1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack(wk, 8, 8, 0x402, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FA0, 0xB, 0x200, 0, -0x7FA0, -1, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack(wk, 8, 0xF, 0x40, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xBF, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x100);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x200);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x40, 0xB, 0x40, 0, -0x7FA0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x102);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x102);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xA, 0x202);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    case 1:
-        Wait(wk, 6);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x202);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x22);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 2, 0xF);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x20, 0);
-        break;
-
-    case 2:
-        Wait(wk, 3);
-        break;
-
-    case 3:
-        Walk(wk, 0, 0x30, 0);
-        break;
-
-    case 4:
-        Wait(wk, 9);
-        break;
-
-    case 5:
-        Walk(wk, 0, 0x20, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x20, 2, 0x1B);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x18, 0);
-        break;
-
-    case 2:
-        Wait(wk, 8);
-        break;
-
-    case 3:
-        Search_Back_Term(wk, 0x30, 2, 0x1B);
-        break;
-
-    case 4:
-        Walk(wk, 1, 0x20, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x20, 0);
-        break;
-
-    case 1:
-        Search_Back_Term(wk, 0x30, 2, 6);
-        break;
-
-    case 2:
-        Walk(wk, 1, 0x28, 0);
-        break;
-
-    case 3:
-        Wait(wk, 8);
-        break;
-
-    case 4:
-        Walk(wk, 0, 0x20, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8014, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8015, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x8016, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x8016, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x8016, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FD0, 5, 2, 0);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x2E, 0x2F, 0xFFFF, 0);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FD0, 5, 2, 0);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x2e, -1, -1, 0);
-        break;
-
-    case 2:
-        Approach_Walk(wk, 0x7f, 2);
-        break;
-
-    case 3:
-        SA_Term(wk, -1, 0x2f, -1, 0);
-        break;
-
-    case 4:
-        Approach_Walk(wk, 0x41, 2);
-        break;
-
-    case 5:
-        Command_Attack(wk, 8, 0x1f, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x30, 0);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 9, 0x700);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 9, 0x70);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 0xA, 0x700);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern17_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0000[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Pattern17_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
+static const s16 Pattern17_0001[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0002[] = {
+    COM_APPROACH_WALK, 0x41, 2,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-void Pattern17_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x4B, 2);
-        break;
+static const s16 Pattern17_0003[] = {
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x21, 0xA, -1);
-        break;
+static const s16 Pattern17_0004[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0005[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_COM_RANDOM_SELECT, 2, 0x3E, 0x3F, 0x40, 0x40, 1,
+    COM_END,
+};
 
-void Pattern17_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 0xA, -1);
-        break;
+static const s16 Pattern17_0006[] = {
+    COM_WAIT, 0x1E,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0007[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 2, 1,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-void Pattern17_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern17_0008[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 9, 0x1F, 8, -1);
-        break;
+static const s16 Pattern17_0009[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x10,
+    COM_JUMP, 1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 2:
-        Wait(wk, 2);
-        break;
+static const s16 Pattern17_0010[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 3:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
+static const s16 Pattern17_0011[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0012[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Pattern17_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern17_0013[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 9, 0x1F, 8, -1);
-        break;
+static const s16 Pattern17_0014[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FB0, 0xB, 0x20, 2, -0x7FA0, -1, 0x20,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x40);
-        break;
+static const s16 Pattern17_0015[] = {
+    COM_WALK, 0, 0x30, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0016[] = {
+    COM_WALK, 1, 0x30, 0,
+    COM_END,
+};
 
-void Pattern17_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern17_0017[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 9, 0x1F, 8, -1);
-        break;
+static const s16 Pattern17_0018[] = {
+    COM_JUMP_ATTACK, 8, 8, 0x402, 0,
+    COM_END,
+};
 
-    case 2:
-        Walk(wk, 0, 8, 0);
-        break;
+static const s16 Pattern17_0019[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Pattern17_0020[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0021[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FA0, 0xB, 0x200, 0, -0x7FA0, -1, 0x200,
+    COM_END,
+};
 
-void Pattern17_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 9, 0x1F, 0xA, -1);
-        break;
+static const s16 Pattern17_0022[] = {
+    COM_JUMP_ATTACK, 8, 0xF, 0x40, 0,
+    COM_END,
+};
 
-    case 1:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern17_0023[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_END,
+};
 
-    case 2:
-        Provoke(wk, -1);
-        break;
+static const s16 Pattern17_0024[] = {
+    COM_WALK, 0, 0x60, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0025[] = {
+    COM_WALK, 1, 0x60, 0,
+    COM_END,
+};
 
-void Pattern17_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 9, 0x1F, 0xA, -1);
-        break;
+static const s16 Pattern17_0026[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 1:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern17_0027[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-    case 2:
-        Provoke(wk, 1);
-        break;
+static const s16 Pattern17_0028[] = {
+    COM_APPROACH_WALK, 0xBF, 2,
+    COM_END,
+};
 
-    case 3:
-        Com_Random_Select(wk, 6, 0x85, 0x86, 0x87, 0x70, 1);
-        break;
+static const s16 Pattern17_0029[] = {
+    COM_ADJUST_ATTACK, 8, 0x100,
+    COM_ADJUST_ATTACK, 8, 0x200,
+    COM_ADJUST_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0030[] = {
+    COM_ADJUST_ATTACK, 9, 0x100,
+    COM_ADJUST_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Pattern17_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_SA(wk, 2, 0x44);
-        break;
+static const s16 Pattern17_0031[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x40, 0xB, 0x40, 0, -0x7FA0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 1:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern17_0032[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x10,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 9, 0x1f, 8, -1);
-        break;
+static const s16 Pattern17_0033[] = {
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    case 3:
-        Walk(wk, 0, 8, 0);
-        break;
+static const s16 Pattern17_0034[] = {
+    COM_ADJUST_ATTACK, 8, 0x102,
+    COM_ADJUST_ATTACK, 8, 0x102,
+    COM_ADJUST_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 4:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
+static const s16 Pattern17_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 5:
-        SA_Term(wk, -1, 0x2f, -1, 0);
-        break;
+static const s16 Pattern17_0036[] = {
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0037[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Pattern17_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern17_0038[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 0xA, 0x202,
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 9, 0x1F, 8, -1);
-        break;
+static const s16 Pattern17_0039[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_WAIT, 6,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 2:
-        Walk(wk, 0, 8, 0);
-        break;
+static const s16 Pattern17_0040[] = {
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 3:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
+static const s16 Pattern17_0041[] = {
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    case 4:
-        Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
+static const s16 Pattern17_0042[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0043[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 2, 0xF,
+    COM_WALK, 1, 0x20, 0,
+    COM_WAIT, 3,
+    COM_WALK, 0, 0x30, 0,
+    COM_WAIT, 9,
+    COM_WALK, 0, 0x20, 0,
+    COM_END,
+};
 
-void Pattern17_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern17_0044[] = {
+    COM_SEARCH_BACK_TERM, 0x20, 2, 0x1B,
+    COM_WALK, 1, 0x18, 0,
+    COM_WAIT, 8,
+    COM_SEARCH_BACK_TERM, 0x30, 2, 0x1B,
+    COM_WALK, 1, 0x20, 0,
+    COM_END,
+};
 
-    case 1:
-        Hi_Jump_Attack_Term(wk, -1, 0x40, 8, 0x40, 0, -0x7FA0, -1, 0x200);
-        break;
+static const s16 Pattern17_0045[] = {
+    COM_WALK, 0, 0x20, 0,
+    COM_SEARCH_BACK_TERM, 0x30, 2, 6,
+    COM_WALK, 1, 0x28, 0,
+    COM_WAIT, 8,
+    COM_WALK, 0, 0x20, 0,
+    COM_END,
+};
 
-    case 2:
-        Lever_On(wk, 1, 0xffff);
-        break;
+static const s16 Pattern17_0046[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8014, 0xA, -1,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Pattern17_0047[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8015, 0xA, -1,
+    COM_END,
+};
 
-    case 4:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Pattern17_0048[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 0xA, -1,
+    COM_END,
+};
 
-    case 5:
-        Command_Attack(wk, 8, 0x1c, 8, -1);
-        break;
+static const s16 Pattern17_0049[] = {
+    COM_J_COMMAND_ATTACK, 8, (s16)0x8016, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0050[] = {
+    COM_J_COMMAND_ATTACK, 8, (s16)0x8016, 9, -1,
+    COM_END,
+};
 
-void Pattern17_0076(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_On(wk, 1, 0xFFFF);
-        break;
+static const s16 Pattern17_0051[] = {
+    COM_J_COMMAND_ATTACK, 8, (s16)0x8016, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Pattern17_0052[] = {
+    COM_EM_TERM, -1, -0x7FD0, 5, 2, 0,
+    COM_SA_TERM, 0x2E, 0x2F, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Pattern17_0053[] = {
+    COM_EM_TERM, -1, -0x7FD0, 5, 2, 0,
+    COM_SA_TERM, 0x2E, -1, -1, 0,
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_SA_TERM, -1, 0x2F, -1, 0,
+    COM_APPROACH_WALK, 0x41, 2,
+    COM_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 0x4008, -1);
-        break;
+static const s16 Pattern17_0054[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x30, 0,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0055[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Pattern17_0077(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_On(wk, 1, 0xFFFF);
-        break;
+static const s16 Pattern17_0056[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Pattern17_0057[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Pattern17_0058[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
+static const s16 Pattern17_0059[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, 0x700,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0060[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, 0x70,
+    COM_END,
+};
 
-void Pattern17_0078(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern17_0061[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, 0x700,
+    COM_END,
+};
 
-    case 1:
-        Lever_On(wk, 1, 0xFFFF);
-        break;
+static const s16 Pattern17_0062[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    case 2:
-        Lever_Attack(wk, 8, 1, 0x402);
-        break;
+static const s16 Pattern17_0063[] = {
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
+static const s16 Pattern17_0064[] = {
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0065[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_END,
+};
 
-void Pattern17_0079(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern17_0066[] = {
+    COM_APPROACH_WALK, 0x4B, 2,
+    COM_COMMAND_ATTACK, 8, 0x21, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Hi_Jump_Attack_Term(wk, -1, 0x40, 8, 0x400, 0, -0x7FA0, -1, 0x200);
-        break;
+static const s16 Pattern17_0067[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Lever_On(wk, 1, 0xFFFF);
-        break;
+static const s16 Pattern17_0068[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 9, 0x1F, 8, -1,
+    COM_WAIT, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-    case 3:
-        Lever_Attack(wk, 8, 1, 0x402);
-        break;
+static const s16 Pattern17_0069[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 9, 0x1F, 8, -1,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 4:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Pattern17_0070[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 9, 0x1F, 8, -1,
+    COM_WALK, 0, 8, 0,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0071[] = {
+    COM_COMMAND_ATTACK, 9, 0x1F, 0xA, -1,
+    COM_PIERCE_ON,
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-void Pattern17_0080(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_On(wk, 1, 0xFFFF);
-        break;
+static const s16 Pattern17_0072[] = {
+    COM_COMMAND_ATTACK, 9, 0x1F, 0xA, -1,
+    COM_PIERCE_ON,
+    COM_PROVOKE, 1,
+    COM_COM_RANDOM_SELECT, 6, 0x85, 0x86, 0x87, 0x70, 1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Pattern17_0073[] = {
+    COM_CHECK_SA, 2, 0x44,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 9, 0x1F, 8, -1,
+    COM_WALK, 0, 8, 0,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_SA_TERM, -1, 0x2F, -1, 0,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Pattern17_0074[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 9, 0x1F, 8, -1,
+    COM_WALK, 0, 8, 0,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 0x4008, -1);
-        break;
+static const s16 Pattern17_0075[] = {
+    COM_PIERCE_ON,
+    COM_HI_JUMP_ATTACK_TERM, -1, 0x40, 8, 0x40, 0, -0x7FA0, -1, 0x200,
+    COM_LEVER_ON, 1, (s16)0xFFFF,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0076[] = {
+    COM_LEVER_ON, 1, (s16)0xFFFF,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0x4008, -1,
+    COM_END,
+};
 
-void Pattern17_0081(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_On(wk, 1, 0xFFFF);
-        break;
+static const s16 Pattern17_0077[] = {
+    COM_LEVER_ON, 1, (s16)0xFFFF,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Pattern17_0078[] = {
+    COM_PIERCE_ON,
+    COM_LEVER_ON, 1, (s16)0xFFFF,
+    COM_LEVER_ATTACK, 8, 1, 0x402,
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Pattern17_0079[] = {
+    COM_PIERCE_ON,
+    COM_HI_JUMP_ATTACK_TERM, -1, 0x40, 8, 0x400, 0, -0x7FA0, -1, 0x200,
+    COM_LEVER_ON, 1, (s16)0xFFFF,
+    COM_LEVER_ATTACK, 8, 1, 0x402,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
+static const s16 Pattern17_0080[] = {
+    COM_LEVER_ON, 1, (s16)0xFFFF,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0x4008, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0081[] = {
+    COM_LEVER_ON, 1, (s16)0xFFFF,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-void Pattern17_0082(PLW* wk)
-
-{
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-    case 1:
-        Hi_Jump_Attack_Term(wk, -1, 0x40, 8, 0x400, 0, -0x7FA0, -1, 0x200);
-        break;
-    case 2:
-        Lever_On(wk, 1, 0xffff);
-        break;
-    case 3:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-    case 4:
-        Normal_Attack(wk, 8, 0x22);
-        break;
-    case 5:
-        Command_Attack(wk, 8, 0x1c, 8, -1);
-        break;
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern17_0082[] = {
+    COM_PIERCE_ON,
+    COM_HI_JUMP_ATTACK_TERM, -1, 0x40, 8, 0x400, 0, -0x7FA0, -1, 0x200,
+    COM_LEVER_ON, 1, (s16)0xFFFF,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void (*const Pattern17_Tbl[83])(PLW*) = {
+const s16* const Pattern17_Tbl[83] = {
     Pattern17_0000, Pattern17_0001, Pattern17_0002, Pattern17_0003, Pattern17_0004, Pattern17_0005, Pattern17_0006,
     Pattern17_0007, Pattern17_0008, Pattern17_0009, Pattern17_0010, Pattern17_0011, Pattern17_0012, Pattern17_0013,
     Pattern17_0014, Pattern17_0015, Pattern17_0016, Pattern17_0017, Pattern17_0018, Pattern17_0019, Pattern17_0020,
@@ -1428,3 +539,7 @@ void (*const Pattern17_Tbl[83])(PLW*) = {
     Pattern17_0070, Pattern17_0071, Pattern17_0072, Pattern17_0073, Pattern17_0074, Pattern17_0075, Pattern17_0076,
     Pattern17_0077, Pattern17_0078, Pattern17_0079, Pattern17_0080, Pattern17_0081, Pattern17_0082
 };
+
+void Computer17(PLW* wk) {
+    Exec_Com_Pattern(wk, Pattern17_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
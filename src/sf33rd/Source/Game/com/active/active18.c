@@ -5,1587 +5,621 @@
 
 #include "sf33rd/Source/Game/com/active/active18.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Pattern18_Tbl[109])();
-
-void Computer18(PLW* wk) {
-    Pattern18_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Pattern18_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2F, 9, -1, -1, -0x7FA8, 1, -1, 0x30, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 2, 0x3E, 0x3F, 0x40, 0x40, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0x1E);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 2, 1);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x10);
-        break;
-
-    case 1:
-        Jump(wk, 1);
-        break;
-
-    case 2:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FB0, 0xB, 0x20, 2, -0x7FA0, -1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x30, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2F, 9, -1, -1, -0x7FA8, 1, -1, 0x30, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 2, 0x41, 0x41, 0x42, 0x43);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FA0, 0xB, 0x400, 0, -0x7FA0, -1, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack(wk, 8, 0xF, 0x400, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x60, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xBF, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x100);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x200);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FA0, 0xB, 0x400, 0, -0x7FA0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Branch_Unit_Area(wk, 2, 0x41, 0x41, 0x42, 0x43);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x102);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x102);
-        break;
-
-    case 2:
-        Adjust_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 2, 0x41, 0x41, 0x42, 0x43);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x42);
-        break;
-
-    case 1:
-        Branch_Unit_Area(wk, 2, 0x41, 0x41, 0x42, 0x43);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 2, 0xF);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x20, 0);
-        break;
-
-    case 2:
-        Wait(wk, 3);
-        break;
-
-    case 3:
-        Walk(wk, 0, 0x30, 0);
-        break;
-
-    case 4:
-        Wait(wk, 9);
-        break;
-
-    case 5:
-        Walk(wk, 0, 0x20, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x20, 2, 0x1B);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x18, 0);
-        break;
-
-    case 2:
-        Wait(wk, 8);
-        break;
-
-    case 3:
-        Search_Back_Term(wk, 0x30, 2, 0x1B);
-        break;
-
-    case 4:
-        Walk(wk, 1, 0x20, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x20, 0);
-        break;
-
-    case 1:
-        Search_Back_Term(wk, 0x30, 2, 6);
-        break;
-
-    case 2:
-        Walk(wk, 1, 0x28, 0);
-        break;
-
-    case 3:
-        Wait(wk, 8);
-        break;
-
-    case 4:
-        Walk(wk, 0, 0x20, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8014, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x8026, 0xA, -1, 0x30, -0x7FB0, 1, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8015, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x8026, 8, -1, 0x30, -0x7FB0, 0, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x8026, 9, -1, 0x30, -0x7FB0, 2, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x8026, 0xA, -1, 0x30, -0x7FB0, 1, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x41, 2);
-        break;
-
-    case 1:
-        SA_Term(wk, 0xFFFF, 0x2F, 0xFFFF, 0);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x2E, 0x2F, 0xFFFF, 0);
-        break;
-
-    case 1:
-        Branch_Unit_Area(wk, 2, 0x41, 0x41, 0x42, 0x43);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x2E, 0x2F, 0xFFFF, 0);
-        break;
-
-    case 1:
-        Branch_Unit_Area(wk, 2, 0x41, 0x41, 0x42, 0x43);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 2, 0x41, 0x41, 0x42, 0x43);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 2, 0x48, 0x48, 0x49, 0x4A);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 9, 0x70);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2F, 9, 0x700, -1, -0x7FA8, 1, -1, 0x30, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Pattern18_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
+static const s16 Pattern18_0000[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0001[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-void Pattern18_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Pattern18_0002[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2F, 9, -1, -1, -0x7FA8, 1, -1, 0x30, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0003[] = {
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Pattern18_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Command_Attack_Term(wk, 8, 0x2E, 9, -1, -1, 0x50, 0, -0x7FA0, -1, 0x40);
-        break;
+static const s16 Pattern18_0004[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0005[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_COM_RANDOM_SELECT, 2, 0x3E, 0x3F, 0x40, 0x40, 1,
+    COM_END,
+};
 
-void Pattern18_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x10);
-        break;
+static const s16 Pattern18_0006[] = {
+    COM_WAIT, 0x1E,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
+static const s16 Pattern18_0007[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 2, 1,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0008[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Pattern18_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x10);
-        break;
+static const s16 Pattern18_0009[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x10,
+    COM_JUMP, 1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Pattern18_0010[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0011[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Pattern18_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, -1);
-        break;
+static const s16 Pattern18_0012[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0013[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-void Pattern18_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 8, 0x70);
-        break;
+static const s16 Pattern18_0014[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FB0, 0xB, 0x20, 2, -0x7FA0, -1, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0015[] = {
+    COM_WALK, 0, 0x30, 0,
+    COM_END,
+};
 
-void Pattern18_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 9, 0x70);
-        break;
+static const s16 Pattern18_0016[] = {
+    COM_WALK, 1, 0x30, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0017[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Pattern18_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 0xA, 0x70);
-        break;
+static const s16 Pattern18_0018[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2F, 9, -1, -1, -0x7FA8, 1, -1, 0x30, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0019[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Pattern18_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
+static const s16 Pattern18_0020[] = {
+    COM_BRANCH_UNIT_AREA, 2, 0x41, 0x41, 0x42, 0x43,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0021[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FA0, 0xB, 0x400, 0, -0x7FA0, -1, 0x200,
+    COM_END,
+};
 
-void Pattern18_0076(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x40, 2, 0x1B);
-        break;
+static const s16 Pattern18_0022[] = {
+    COM_JUMP_ATTACK, 8, 0xF, 0x400, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0023[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_END,
+};
 
-void Pattern18_0077(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Pattern18_0024[] = {
+    COM_WALK, 0, 0x60, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0025[] = {
+    COM_WALK, 1, 0x60, 0,
+    COM_END,
+};
 
-void Pattern18_0078(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x100);
-        break;
+static const s16 Pattern18_0026[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0027[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-void Pattern18_0079(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Pattern18_0028[] = {
+    COM_APPROACH_WALK, 0xBF, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0029[] = {
+    COM_ADJUST_ATTACK, 8, 0x100,
+    COM_ADJUST_ATTACK, 8, 0x200,
+    COM_ADJUST_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Pattern18_0080(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x51, 0x51, 0x52, 0x53, 0);
-        break;
+static const s16 Pattern18_0030[] = {
+    COM_ADJUST_ATTACK, 9, 0x100,
+    COM_ADJUST_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0031[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FA0, 0xB, 0x400, 0, -0x7FA0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Pattern18_0081(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2F, 8, -1, -1, -0x7FA8, 2, -1, 0x30, 0x400);
-        break;
+static const s16 Pattern18_0032[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x10,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0033[] = {
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_BRANCH_UNIT_AREA, 2, 0x41, 0x41, 0x42, 0x43,
+    COM_END,
+};
 
-void Pattern18_0082(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2F, 9, -1, -1, -0x7FA8, 2, -1, 0x30, 0x400);
-        break;
+static const s16 Pattern18_0034[] = {
+    COM_ADJUST_ATTACK, 8, 0x102,
+    COM_ADJUST_ATTACK, 8, 0x102,
+    COM_ADJUST_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-void Pattern18_0083(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2F, 0xA, -1, -1, -0x7FA8, 2, -1, 0x30, 0x400);
-        break;
+static const s16 Pattern18_0036[] = {
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0037[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Pattern18_0084(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x55, 0x55, 0x56, 0x57, 0);
-        break;
+static const s16 Pattern18_0038[] = {
+    COM_ADJUST_ATTACK, 0xB, 0x20,
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0039[] = {
+    COM_BRANCH_UNIT_AREA, 2, 0x41, 0x41, 0x42, 0x43,
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-void Pattern18_0085(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2F, 8, -1, -1, -0x7FA8, 0, -1, 0x30, 0x400);
-        break;
+static const s16 Pattern18_0040[] = {
+    COM_NORMAL_ATTACK, 9, 0x42,
+    COM_BRANCH_UNIT_AREA, 2, 0x41, 0x41, 0x42, 0x43,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0041[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x40,
+    COM_END,
+};
 
-void Pattern18_0086(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2F, 9, -1, -1, -0x7FA8, 0, -1, 0x30, 0x400);
-        break;
+static const s16 Pattern18_0042[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0043[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 2, 0xF,
+    COM_WALK, 1, 0x20, 0,
+    COM_WAIT, 3,
+    COM_WALK, 0, 0x30, 0,
+    COM_WAIT, 9,
+    COM_WALK, 0, 0x20, 0,
+    COM_END,
+};
 
-void Pattern18_0087(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2F, 0xA, -1, -1, -0x7FA8, 0, -1, 0x30, 0x400);
-        break;
+static const s16 Pattern18_0044[] = {
+    COM_SEARCH_BACK_TERM, 0x20, 2, 0x1B,
+    COM_WALK, 1, 0x18, 0,
+    COM_WAIT, 8,
+    COM_SEARCH_BACK_TERM, 0x30, 2, 0x1B,
+    COM_WALK, 1, 0x20, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0045[] = {
+    COM_WALK, 0, 0x20, 0,
+    COM_SEARCH_BACK_TERM, 0x30, 2, 6,
+    COM_WALK, 1, 0x28, 0,
+    COM_WAIT, 8,
+    COM_WALK, 0, 0x20, 0,
+    COM_END,
+};
 
-void Pattern18_0088(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x59, 0x59, 0x5A, 0x5B, 0);
-        break;
+static const s16 Pattern18_0046[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8014, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0047[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, (s16)0x8026, 0xA, -1, 0x30, -0x7FB0, 1, -1, -1, -1,
+    COM_END,
+};
 
-void Pattern18_0089(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2F, 8, -1, -1, -0x7FA8, 0, -1, 0x30, 0x400);
-        break;
+static const s16 Pattern18_0048[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8015, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0049[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, (s16)0x8026, 8, -1, 0x30, -0x7FB0, 0, -1, -1, -1,
+    COM_END,
+};
 
-void Pattern18_0090(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2F, 9, -1, -1, -0x7FA8, 0, -1, 0x30, 0x400);
-        break;
+static const s16 Pattern18_0050[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, (s16)0x8026, 9, -1, 0x30, -0x7FB0, 2, -1, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0051[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, (s16)0x8026, 0xA, -1, 0x30, -0x7FB0, 1, -1, -1, -1,
+    COM_END,
+};
 
-void Pattern18_0091(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2F, 0xA, -1, -1, -0x7FA8, 0, -1, 0x30, 0x400);
-        break;
+static const s16 Pattern18_0052[] = {
+    COM_APPROACH_WALK, 0x41, 2,
+    COM_SA_TERM, (s16)0xFFFF, 0x2F, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0053[] = {
+    COM_SA_TERM, 0x2E, 0x2F, (s16)0xFFFF, 0,
+    COM_BRANCH_UNIT_AREA, 2, 0x41, 0x41, 0x42, 0x43,
+    COM_END,
+};
 
-void Pattern18_0092(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x100);
-        break;
+static const s16 Pattern18_0054[] = {
+    COM_SA_TERM, 0x2E, 0x2F, (s16)0xFFFF, 0,
+    COM_BRANCH_UNIT_AREA, 2, 0x41, 0x41, 0x42, 0x43,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
+static const s16 Pattern18_0055[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0056[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-void Pattern18_0093(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x200);
-        break;
+static const s16 Pattern18_0057[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Pattern18_0058[] = {
+    COM_BRANCH_UNIT_AREA, 2, 0x41, 0x41, 0x42, 0x43,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0059[] = {
+    COM_BRANCH_UNIT_AREA, 2, 0x48, 0x48, 0x49, 0x4A,
+    COM_END,
+};
 
-void Pattern18_0094(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x20);
-        break;
+static const s16 Pattern18_0060[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, 0x70,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
+static const s16 Pattern18_0061[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2F, 9, 0x700, -1, -0x7FA8, 1, -1, 0x30, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0062[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Pattern18_0095(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x20);
-        break;
+static const s16 Pattern18_0063[] = {
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Pattern18_0064[] = {
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0065[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-void Pattern18_0096(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x10);
-        break;
+static const s16 Pattern18_0066[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
+static const s16 Pattern18_0067[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0068[] = {
+    COM_HI_JUMP_COMMAND_ATTACK_TERM, 8, 0x2E, 9, -1, -1, 0x50, 0, -0x7FA0, -1, 0x40,
+    COM_END,
+};
 
-void Pattern18_0097(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x10);
-        break;
+static const s16 Pattern18_0069[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x10,
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Pattern18_0070[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x10,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0071[] = {
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-void Pattern18_0098(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x100);
-        break;
+static const s16 Pattern18_0072[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, 0x70,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
+static const s16 Pattern18_0073[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, 0x70,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0074[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, 0x70,
+    COM_END,
+};
 
-void Pattern18_0099(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x20);
-        break;
+static const s16 Pattern18_0075[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Pattern18_0076[] = {
+    COM_SEARCH_BACK_TERM, 0x40, 2, 0x1B,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0077[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-void Pattern18_0100(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x20);
-        break;
+static const s16 Pattern18_0078[] = {
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
+static const s16 Pattern18_0079[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0080[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x51, 0x51, 0x52, 0x53, 0,
+    COM_END,
+};
 
-void Pattern18_0101(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x20);
-        break;
+static const s16 Pattern18_0081[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2F, 8, -1, -1, -0x7FA8, 2, -1, 0x30, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Pattern18_0082[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2F, 9, -1, -1, -0x7FA8, 2, -1, 0x30, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0083[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2F, 0xA, -1, -1, -0x7FA8, 2, -1, 0x30, 0x400,
+    COM_END,
+};
 
-void Pattern18_0102(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
+static const s16 Pattern18_0084[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x55, 0x55, 0x56, 0x57, 0,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
+static const s16 Pattern18_0085[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2F, 8, -1, -1, -0x7FA8, 0, -1, 0x30, 0x400,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Pattern18_0086[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2F, 9, -1, -1, -0x7FA8, 0, -1, 0x30, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0087[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2F, 0xA, -1, -1, -0x7FA8, 0, -1, 0x30, 0x400,
+    COM_END,
+};
 
-void Pattern18_0103(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Pattern18_0088[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x59, 0x59, 0x5A, 0x5B, 0,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
+static const s16 Pattern18_0089[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2F, 8, -1, -1, -0x7FA8, 0, -1, 0x30, 0x400,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Pattern18_0090[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2F, 9, -1, -1, -0x7FA8, 0, -1, 0x30, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0091[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2F, 0xA, -1, -1, -0x7FA8, 0, -1, 0x30, 0x400,
+    COM_END,
+};
 
-void Pattern18_0104(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern18_0092[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x100,
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Pattern18_0093[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x200,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
+static const s16 Pattern18_0094[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x20,
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Pattern18_0095[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x20,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0096[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x10,
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-void Pattern18_0105(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x30, 0);
-        break;
+static const s16 Pattern18_0097[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x10,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Branch_Unit_Area(wk, 2, 0x41, 0x41, 0x42, 0x43);
-        break;
+static const s16 Pattern18_0098[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x100,
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0099[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x20,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Pattern18_0106(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 2, 0x11, 0x6B, 0x6C, 0x67, 4);
-        break;
+static const s16 Pattern18_0100[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x20,
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0101[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x20,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Pattern18_0107(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Pattern18_0102[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
+static const s16 Pattern18_0103[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0104[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Pattern18_0108(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Pattern18_0105[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x30, 0,
+    COM_BRANCH_UNIT_AREA, 2, 0x41, 0x41, 0x42, 0x43,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Pattern18_0106[] = {
+    COM_COM_RANDOM_SELECT, 2, 0x11, 0x6B, 0x6C, 0x67, 4,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
+static const s16 Pattern18_0107[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Pattern18_0108[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void (*const Pattern18_Tbl[109])(PLW*) = {
+const s16* const Pattern18_Tbl[109] = {
     Pattern18_0000, Pattern18_0001, Pattern18_0002, Pattern18_0003, Pattern18_0004, Pattern18_0005, Pattern18_0006,
     Pattern18_0007, Pattern18_0008, Pattern18_0009, Pattern18_0010, Pattern18_0011, Pattern18_0012, Pattern18_0013,
     Pattern18_0014, Pattern18_0015, Pattern18_0016, Pattern18_0017, Pattern18_0018, Pattern18_0019, Pattern18_0020,
@@ -1603,3 +637,7 @@ void (*const Pattern18_Tbl[109])(PLW*) = {
     Pattern18_0098, Pattern18_0099, Pattern18_0100, Pattern18_0101, Pattern18_0102, Pattern18_0103, Pattern18_0104,
     Pattern18_0105, Pattern18_0106, Pattern18_0107, Pattern18_0108
 };
+
+void Computer18(PLW* wk) {
+    Exec_Com_Pattern(wk, Pattern18_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
@@ -0,0 +1,364 @@
+/**
+ * @file com_pattern.c
+ * COM Pattern Interpreter
+ */
+
+#include "sf33rd/Source/Game/com/com_pattern.h"
+#include "common.h"
+#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/engine/workuser.h"
+
+static const u8 Com_Step_Arg_Count[COM_STEP_COUNT] = {
+    [COM_END] = 0,
+    [COM_NEXT_BE_PASSIVE] = 1,
+    [COM_TURN_OVER_ON] = 0,
+    [COM_ONLY_SHOT] = 1,
+    [COM_LEVER_ON] = 2,
+    [COM_LEVER_OFF] = 0,
+    [COM_PIERCE_ON] = 0,
+    [COM_SETUP_DENJIN_LEVEL] = 0,
+    [COM_PUSH_SHOT] = 1,
+    [COM_KEEP_AWAY] = 2,
+    [COM_SEARCH_BACK_TERM] = 3,
+    [COM_APPROACH_WALK] = 2,
+    [COM_WALK] = 3,
+    [COM_FORCED_GUARD] = 1,
+    [COM_PROVOKE] = 1,
+    [COM_NORMAL_ATTACK] = 2,
+    [COM_NORMAL_ATTACK_M_LV] = 1,
+    [COM_NORMAL_ATTACK_SP] = 3,
+    [COM_ADJUST_ATTACK] = 2,
+    [COM_LEVER_ATTACK] = 3,
+    [COM_LEVER_ATTACK_SP] = 4,
+    [COM_SA_TERM] = 4,
+    [COM_CHECK_SA] = 2,
+    [COM_CHECK_EX] = 2,
+    [COM_CHECK_SA_FULL] = 2,
+    [COM_BRANCH_UNIT_AREA] = 5,
+    [COM_COM_RANDOM_SELECT] = 6,
+    [COM_BRANCH_WAIT_AREA] = 4,
+    [COM_WAIT] = 1,
+    [COM_LOOK] = 1,
+    [COM_KEEP_STATUS] = 2,
+    [COM_VS_JUMP_GUARD] = 0,
+    [COM_WAIT_LIE] = 1,
+    [COM_WAIT_GET_UP] = 2,
+    [COM_WAIT_ATTACK_COMPLETE] = 2,
+    [COM_SHORT_RANGE_ATTACK] = 4,
+    [COM_EM_TERM] = 5,
+    [COM_JUMP] = 1,
+    [COM_HI_JUMP] = 2,
+    [COM_JUMP_ATTACK] = 4,
+    [COM_JUMP_ATTACK_TERM] = 8,
+    [COM_HI_JUMP_ATTACK] = 4,
+    [COM_HI_JUMP_ATTACK_TERM] = 8,
+    [COM_ORO_JA_TERM] = 10,
+    [COM_ORO_HJA_TERM] = 10,
+    [COM_COMMAND_ATTACK] = 4,
+    [COM_J_COMMAND_ATTACK] = 4,
+    [COM_RAPID_COMMAND_ATTACK] = 4,
+    [COM_ORO_JCA_TERM] = 12,
+    [COM_ORO_HJCA_TERM] = 12,
+    [COM_JUMP_COMMAND_ATTACK_TERM] = 10,
+    [COM_HI_JUMP_COMMAND_ATTACK_TERM] = 10,
+    [COM_CHECK_STORE_LEVER] = 3,
+    [COM_NEXT_ANOTHER_MENU] = 2,
+    [COM_CHECK_BOSS] = 2,
+    [COM_CHECK_BOSS_EX] = 2,
+    [COM_ETC_TERM] = 3,
+    [COM_SHELL_TERM] = 5,
+    [COM_NEXT_BE_FLIP] = 1,
+};
+
+/// Step that the last call of each player ran. Patterns advance by one step at a time, so the next call only has to
+/// move past that step instead of walking the pattern from its start.
+typedef struct StepCursor {
+    const s16* pattern;
+    const s16* step;
+    s16 index;
+} StepCursor;
+
+/// Only ever points at constant pattern data and is checked against `CP_Index` on every call, so it doesn't need to be
+/// part of saved states
+static StepCursor step_cursors[2];
+
+void Exec_Com_Pattern(PLW* wk, const s16* pattern) {
+    StepCursor* cursor = &step_cursors[wk->wu.id];
+    const s16 index = CP_Index[wk->wu.id][0];
+    const s16* arg;
+
+    if ((cursor->pattern != pattern) || (cursor->index > index)) {
+        cursor->pattern = pattern;
+        cursor->step = pattern;
+        cursor->index = 0;
+    }
+
+    while ((cursor->index < index) && (*cursor->step != COM_END)) {
+        cursor->step += Com_Step_Arg_Count[*cursor->step] + 1;
+        cursor->index++;
+    }
+
+    arg = cursor->step + 1;
+
+    switch (*cursor->step) {
+    case COM_END:
+        End_Pattern(wk);
+        break;
+
+    case COM_NEXT_BE_PASSIVE:
+        Next_Be_Passive(wk, arg[0]);
+        break;
+
+    case COM_TURN_OVER_ON:
+        Turn_Over_On(wk);
+        break;
+
+    case COM_ONLY_SHOT:
+        Only_Shot(wk, arg[0]);
+        break;
+
+    case COM_LEVER_ON:
+        Lever_On(wk, arg[0], arg[1]);
+        break;
+
+    case COM_LEVER_OFF:
+        Lever_Off(wk);
+        break;
+
+    case COM_PIERCE_ON:
+        Pierce_On(wk);
+        break;
+
+    case COM_SETUP_DENJIN_LEVEL:
+        Setup_DENJIN_LEVEL(wk);
+        break;
+
+    case COM_PUSH_SHOT:
+        Push_Shot(wk, arg[0]);
+        break;
+
+    case COM_KEEP_AWAY:
+        Keep_Away(wk, arg[0], arg[1]);
+        break;
+
+    case COM_SEARCH_BACK_TERM:
+        Search_Back_Term(wk, arg[0], arg[1], arg[2]);
+        break;
+
+    case COM_APPROACH_WALK:
+        Approach_Walk(wk, arg[0], arg[1]);
+        break;
+
+    case COM_WALK:
+        Walk(wk, arg[0], arg[1], arg[2]);
+        break;
+
+    case COM_FORCED_GUARD:
+        Forced_Guard(wk, arg[0]);
+        break;
+
+    case COM_PROVOKE:
+        Provoke(wk, arg[0]);
+        break;
+
+    case COM_NORMAL_ATTACK:
+        Normal_Attack(wk, arg[0], arg[1]);
+        break;
+
+    case COM_NORMAL_ATTACK_M_LV:
+        Normal_Attack(wk, arg[0], M_Lv[wk->wu.id]);
+        break;
+
+    case COM_NORMAL_ATTACK_SP:
+        Normal_Attack_SP(wk, arg[0], arg[1], arg[2]);
+        break;
+
+    case COM_ADJUST_ATTACK:
+        Adjust_Attack(wk, arg[0], arg[1]);
+        break;
+
+    case COM_LEVER_ATTACK:
+        Lever_Attack(wk, arg[0], arg[1], arg[2]);
+        break;
+
+    case COM_LEVER_ATTACK_SP:
+        Lever_Attack_SP(wk, arg[0], arg[1], arg[2], arg[3]);
+        break;
+
+    case COM_SA_TERM:
+        SA_Term(wk, arg[0], arg[1], arg[2], arg[3]);
+        break;
+
+    case COM_CHECK_SA:
+        Check_SA(wk, arg[0], arg[1]);
+        break;
+
+    case COM_CHECK_EX:
+        Check_EX(wk, arg[0], arg[1]);
+        break;
+
+    case COM_CHECK_SA_FULL:
+        Check_SA_Full(wk, arg[0], arg[1]);
+        break;
+
+    case COM_BRANCH_UNIT_AREA:
+        Branch_Unit_Area(wk, arg[0], arg[1], arg[2], arg[3], arg[4]);
+        break;
+
+    case COM_COM_RANDOM_SELECT:
+        Com_Random_Select(wk, arg[0], arg[1], arg[2], arg[3], arg[4], arg[5]);
+        break;
+
+    case COM_BRANCH_WAIT_AREA:
+        Branch_Wait_Area(wk, arg[0], arg[1], arg[2], arg[3]);
+        break;
+
+    case COM_WAIT:
+        Wait(wk, arg[0]);
+        break;
+
+    case COM_LOOK:
+        Look(wk, arg[0]);
+        break;
+
+    case COM_KEEP_STATUS:
+        Keep_Status(wk, arg[0], arg[1]);
+        break;
+
+    case COM_VS_JUMP_GUARD:
+        VS_Jump_Guard(wk);
+        break;
+
+    case COM_WAIT_LIE:
+        Wait_Lie(wk, arg[0]);
+        break;
+
+    case COM_WAIT_GET_UP:
+        Wait_Get_Up(wk, arg[0], arg[1]);
+        break;
+
+    case COM_WAIT_ATTACK_COMPLETE:
+        Wait_Attack_Complete(wk, arg[0], arg[1]);
+        break;
+
+    case COM_SHORT_RANGE_ATTACK:
+        Short_Range_Attack(wk, arg[0], arg[1], arg[2], arg[3]);
+        break;
+
+    case COM_EM_TERM:
+        EM_Term(wk, arg[0], arg[1], arg[2], arg[3], arg[4]);
+        break;
+
+    case COM_JUMP:
+        Jump(wk, arg[0]);
+        break;
+
+    case COM_HI_JUMP:
+        Hi_Jump(wk, arg[0], arg[1]);
+        break;
+
+    case COM_JUMP_ATTACK:
+        Jump_Attack(wk, arg[0], arg[1], arg[2], arg[3]);
+        break;
+
+    case COM_JUMP_ATTACK_TERM:
+        Jump_Attack_Term(wk, arg[0], arg[1], arg[2], arg[3], arg[4], arg[5], arg[6], arg[7]);
+        break;
+
+    case COM_HI_JUMP_ATTACK:
+        Hi_Jump_Attack(wk, arg[0], arg[1], arg[2], arg[3]);
+        break;
+
+    case COM_HI_JUMP_ATTACK_TERM:
+        Hi_Jump_Attack_Term(wk, arg[0], arg[1], arg[2], arg[3], arg[4], arg[5], arg[6], arg[7]);
+        break;
+
+    case COM_ORO_JA_TERM:
+        ORO_JA_Term(wk, arg[0], arg[1], arg[2], arg[3], arg[4], arg[5], arg[6], arg[7], arg[8], arg[9]);
+        break;
+
+    case COM_ORO_HJA_TERM:
+        ORO_HJA_Term(wk, arg[0], arg[1], arg[2], arg[3], arg[4], arg[5], arg[6], arg[7], arg[8], arg[9]);
+        break;
+
+    case COM_COMMAND_ATTACK:
+        Command_Attack(wk, arg[0], arg[1], arg[2], arg[3]);
+        break;
+
+    case COM_J_COMMAND_ATTACK:
+        J_Command_Attack(wk, arg[0], arg[1], arg[2], arg[3]);
+        break;
+
+    case COM_RAPID_COMMAND_ATTACK:
+        Rapid_Command_Attack(wk, arg[0], arg[1], arg[2], arg[3]);
+        break;
+
+    case COM_ORO_JCA_TERM:
+        ORO_JCA_Term(wk,
+                     arg[0],
+                     arg[1],
+                     arg[2],
+                     arg[3],
+                     arg[4],
+                     arg[5],
+                     arg[6],
+                     arg[7],
+                     arg[8],
+                     arg[9],
+                     arg[10],
+                     arg[11]);
+        break;
+
+    case COM_ORO_HJCA_TERM:
+        ORO_HJCA_Term(wk,
+                      arg[0],
+                      arg[1],
+                      arg[2],
+                      arg[3],
+                      arg[4],
+                      arg[5],
+                      arg[6],
+                      arg[7],
+                      arg[8],
+                      arg[9],
+                      arg[10],
+                      arg[11]);
+        break;
+
+    case COM_JUMP_COMMAND_ATTACK_TERM:
+        Jump_Command_Attack_Term(wk, arg[0], arg[1], arg[2], arg[3], arg[4], arg[5], arg[6], arg[7], arg[8], arg[9]);
+        break;
+
+    case COM_HI_JUMP_COMMAND_ATTACK_TERM:
+        Hi_Jump_Command_Attack_Term(wk, arg[0], arg[1], arg[2], arg[3], arg[4], arg[5], arg[6], arg[7], arg[8], arg[9]);
+        break;
+
+    case COM_CHECK_STORE_LEVER:
+        Check_Store_Lever(wk, arg[0], arg[1], arg[2]);
+        break;
+
+    case COM_NEXT_ANOTHER_MENU:
+        Next_Another_Menu(wk, arg[0], arg[1]);
+        break;
+
+    case COM_CHECK_BOSS:
+        Check_BOSS(wk, arg[0], arg[1]);
+        break;
+
+    case COM_CHECK_BOSS_EX:
+        Check_BOSS_EX(wk, arg[0], arg[1]);
+        break;
+
+    case COM_ETC_TERM:
+        ETC_Term(wk, arg[0], arg[1], arg[2]);
+        break;
+
+    case COM_SHELL_TERM:
+        SHELL_Term(wk, arg[0], arg[1], arg[2], arg[3], arg[4]);
+        break;
+
+    case COM_NEXT_BE_FLIP:
+        Next_Be_Flip(wk, arg[0]);
+        break;
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef COM_PATTERN_H
+#define COM_PATTERN_H
+
+#include "structs.h"
+#include "types.h"
+
+/// Steps of a CPU pattern. A pattern is an array of steps, each followed by the arguments of its subroutine, and
+/// ends with `COM_END`.
+typedef enum ComStep {
+    COM_END,
+    COM_NEXT_BE_PASSIVE,
+    COM_TURN_OVER_ON,
+    COM_ONLY_SHOT,
+    COM_LEVER_ON,
+    COM_LEVER_OFF,
+    COM_PIERCE_ON,
+    COM_SETUP_DENJIN_LEVEL,
+    COM_PUSH_SHOT,
+    COM_KEEP_AWAY,
+    COM_SEARCH_BACK_TERM,
+    COM_APPROACH_WALK,
+    COM_WALK,
+    COM_FORCED_GUARD,
+    COM_PROVOKE,
+    COM_NORMAL_ATTACK,
+    COM_NORMAL_ATTACK_M_LV, // Normal_Attack with M_Lv as the lever data
+    COM_NORMAL_ATTACK_SP,
+    COM_ADJUST_ATTACK,
+    COM_LEVER_ATTACK,
+    COM_LEVER_ATTACK_SP,
+    COM_SA_TERM,
+    COM_CHECK_SA,
+    COM_CHECK_EX,
+    COM_CHECK_SA_FULL,
+    COM_BRANCH_UNIT_AREA,
+    COM_COM_RANDOM_SELECT,
+    COM_BRANCH_WAIT_AREA,
+    COM_WAIT,
+    COM_LOOK,
+    COM_KEEP_STATUS,
+    COM_VS_JUMP_GUARD,
+    COM_WAIT_LIE,
+    COM_WAIT_GET_UP,
+    COM_WAIT_ATTACK_COMPLETE,
+    COM_SHORT_RANGE_ATTACK,
+    COM_EM_TERM,
+    COM_JUMP,
+    COM_HI_JUMP,
+    COM_JUMP_ATTACK,
+    COM_JUMP_ATTACK_TERM,
+    COM_HI_JUMP_ATTACK,
+    COM_HI_JUMP_ATTACK_TERM,
+    COM_ORO_JA_TERM,
+    COM_ORO_HJA_TERM,
+    COM_COMMAND_ATTACK,
+    COM_J_COMMAND_ATTACK,
+    COM_RAPID_COMMAND_ATTACK,
+    COM_ORO_JCA_TERM,
+    COM_ORO_HJCA_TERM,
+    COM_JUMP_COMMAND_ATTACK_TERM,
+    COM_HI_JUMP_COMMAND_ATTACK_TERM,
+    COM_CHECK_STORE_LEVER,
+    COM_NEXT_ANOTHER_MENU,
+    COM_CHECK_BOSS,
+    COM_CHECK_BOSS_EX,
+    COM_ETC_TERM,
+    COM_SHELL_TERM,
+    COM_NEXT_BE_FLIP,
+    COM_STEP_COUNT,
+} ComStep;
+
+/// Run the step of `pattern` that `CP_Index` points to, or end the pattern when it has run out of steps
+void Exec_Com_Pattern(PLW* wk, const s16* pattern);
+
+#endif
@@ -5,2784 +5,1018 @@
 
 #include "sf33rd/Source/Game/com/passive/pass00.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Passive00_Tbl[158])();
-
-void Passive00(PLW* wk) {
-    Passive00_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Passive00_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xD, M_Lv[wk->wu.id]);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0, 0xA, -1);
-        break;
-
-    case 3:
-        EM_Term(wk, 0x7FFF, -1, 1, 1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        VS_Jump_Guard(wk);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x53);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, 0x7FFF, -1, 1, 1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, 0xB, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, 0x38, 7, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Short_Range_Attack(wk, 8, 0x40, 6, 0x1D);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, 0, 0, 2, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x71, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x71, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x71, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 2:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Check_BOSS(wk, 6, 0x17);
-        break;
-
-    case 2:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 0xB, 0x40, 0, -0x7F90, -1, 0x20);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 0xB, 0x10, 0, -1, -1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x68);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xA, -1);
-        break;
-
-    case 3:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FA0, 6, 1, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x220);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FE8, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 3:
-        ETC_Term(wk, 0, 6, 0x99);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FFE, 6, 1, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FFE, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        EM_Term(wk, -0x7F80, -0x7FB0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x42);
-        break;
-
-    case 3:
-        Wait(wk, 5);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x100);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 8, 0x40, 0, -0x7F90, -1, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_BOSS(wk, 6, 0x1B);
-        break;
-
-    case 1:
-        EM_Term(wk, -0x7F80, -0x7FB0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FC0, 6, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_BOSS(wk, 6, 0x1B);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7F90, 6, 1, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Status(wk, 2, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -0x7FC0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x22);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x220);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FA8, 8, 0x100, 0, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FA8, 8, 0x10, 0, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Status(wk, 2, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 0, 6, 0x34);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 0, 6, 0x99);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x43, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 0, 6, 0x99);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 6, 0x59, 0x59, 0x59, 0x5a, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, 0xB, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x220);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, 0xB, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FA0, 8, 0x400, 0, -0x7F90, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0076(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xB1, 2);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 8, 0x400, 0, -0x7F90, -1, 0x20);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 4:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0077(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 0xB, 0x40, 0, -0x7F90, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0078(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 0xB, 0x400, 0, -0x7F90, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0079(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 0xB, 0x40, 0, -1, -1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0080(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FB0, 0xB, 0x40, 0, -0x7F90, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x200);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0081(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FA0, 0xB, 0x400, 0, -0x7F90, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0082(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FA0, 0xB, 0x40, 0, -1, -1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0083(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FA0, 0xB, 0x400, 0, -0x7F90, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0084(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FA0, 0xB, 0x400, 0, -0x7F90, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0085(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 8);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0086(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_BOSS(wk, 6, 0x49);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 4:
-        Wait(wk, 5);
-        break;
-
-    case 5:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0087(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_BOSS(wk, 6, 0x49);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 4:
-        J_Command_Attack(wk, 0xB, 0x1F, 10, -1);
-        break;
-
-    case 5:
-        ETC_Term(wk, 2, 6, 1);
-        break;
-
-    case 6:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0088(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Approach_Walk(wk, 0xB1, 2);
-        break;
-
-    case 2:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 0xB, 0x400, 0, -0x7F90, -1, 0x200);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 4:
-        J_Command_Attack(wk, 0xB, 0x1F, 10, -1);
-        break;
-
-    case 5:
-        ETC_Term(wk, 2, 6, 1);
-        break;
-
-    case 6:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0089(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0090(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0091(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0092(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB8, 6, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0093(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0094(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 6, 0x59, 0x5A, 0x5A, 0x5B, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0095(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x30, 0);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 6, 0x59, 0x59, 0x59, 0x5A, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0096(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0097(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FFE, 6, 1, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0098(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 4:
-        Check_BOSS(wk, 6, 0xe);
-        break;
-
-    case 5:
-        J_Command_Attack(wk, 8, 0x1f, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0099(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0100(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Check_BOSS(wk, 6, 0x88);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0101(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 6, 0x59, 0x5A, 0x5A, 0x5B, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0102(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 6, 0x59, 0x59, 0x59, 0x5A, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0103(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x68);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x20, 0);
-        break;
-
-    case 2:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0104(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump(wk, 0, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0105(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x68);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xA, -1);
-        break;
-
-    case 3:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0106(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x68);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x38, 0);
-        break;
-
-    case 2:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0107(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0108(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xBB, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive00_0109(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive00_0000[] = {
+    COM_NORMAL_ATTACK_M_LV, 0xD,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, -0x7F90, 6, 1, -1);
-        break;
+static const s16 Passive00_0001[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 0xB, 0x1F, 0xA, -1);
-        break;
+static const s16 Passive00_0002[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, 0xA, -1,
+    COM_EM_TERM, 0x7FFF, -1, 1, 1, -1,
+    COM_END,
+};
 
-    case 3:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
+static const s16 Passive00_0003[] = {
+    COM_VS_JUMP_GUARD,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0004[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x53,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-void Passive00_0110(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive00_0005[] = {
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0006[] = {
+    COM_APPROACH_WALK, 0x7B, 2,
+    COM_EM_TERM, 0x7FFF, -1, 1, 1, -1,
+    COM_END,
+};
 
-void Passive00_0111(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7B, 2);
-        break;
+static const s16 Passive00_0007[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, -0x7FA0, 6, 1, -1);
-        break;
+static const s16 Passive00_0008[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, 0xB, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
+static const s16 Passive00_0009[] = {
+    COM_EM_TERM, -1, 0x38, 7, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0010[] = {
+    COM_SHORT_RANGE_ATTACK, 8, 0x40, 6, 0x1D,
+    COM_END,
+};
 
-void Passive00_0112(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive00_0011[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
+static const s16 Passive00_0012[] = {
+    COM_EM_TERM, -0x7F80, 0, 0, 2, 0,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
+static const s16 Passive00_0013[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Passive00_0014[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0015[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-void Passive00_0113(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_BOSS(wk, 6, 0x70);
-        break;
+static const s16 Passive00_0016[] = {
+    COM_APPROACH_WALK, 0x71, 2,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_END,
+};
 
-    case 1:
-        Pierce_On(wk);
-        break;
+static const s16 Passive00_0017[] = {
+    COM_APPROACH_WALK, 0x71, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        EM_Term(wk, -1, -0x7FA8, 6, 1, -1);
-        break;
+static const s16 Passive00_0018[] = {
+    COM_APPROACH_WALK, 0x71, 2,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 8, 0x42);
-        break;
+static const s16 Passive00_0019[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    case 4:
-        J_Command_Attack(wk, 0xB, 0x1F, 10, -1);
-        break;
+static const s16 Passive00_0020[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    case 5:
-        Normal_Attack(wk, 8, 0x40);
-        break;
+static const s16 Passive00_0021[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0022[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_CHECK_BOSS, 6, 0x17,
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 0xB, 0x40, 0, -0x7F90, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive00_0114(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive00_0023[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 0xB, 0x10, 0, -1, -1, -1,
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, 0x30, 7, 1, -1);
-        break;
+static const s16 Passive00_0024[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 0xB, 0x1F, 0xA, -1);
-        break;
+static const s16 Passive00_0025[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x68,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xA, -1,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 0xB, 0x1F, 0xA, -1);
-        break;
+static const s16 Passive00_0026[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0027[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_EM_TERM, -1, -0x7FA0, 6, 1, -1,
+    COM_LEVER_ATTACK, 8, 1, 0x20,
+    COM_END,
+};
 
-void Passive00_0115(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive00_0028[] = {
+    COM_NORMAL_ATTACK, 8, 0x220,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
+static const s16 Passive00_0029[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
+static const s16 Passive00_0030[] = {
+    COM_EM_TERM, -0x7F80, -0x7FD0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 0xb, 0x1f, 10, -1);
-        break;
+static const s16 Passive00_0031[] = {
+    COM_WALK, 1, 0x20, 1,
+    COM_END,
+};
 
-    case 4:
-        ETC_Term(wk, 2, 6, 1);
-        break;
+static const s16 Passive00_0032[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 5:
-        Normal_Attack(wk, 8, 0x42);
-        break;
+static const s16 Passive00_0033[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0034[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive00_0116(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x10, 8, 0x400, 1, -1, 0x10, 0x400);
-        break;
+static const s16 Passive00_0035[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0036[] = {
+    COM_EM_TERM, -1, -0x7FE8, 6, 1, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_ETC_TERM, 0, 6, 0x99,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive00_0117(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x10, 8, 0x200, 1, -1, 0x10, 0x20);
-        break;
+static const s16 Passive00_0037[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_EM_TERM, -1, -0x7FFE, 6, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0038[] = {
+    COM_EM_TERM, -1, -0x7FFE, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-void Passive00_0118(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x10, 8, 0x20, 1, -1, 0x10, 0x20);
-        break;
+static const s16 Passive00_0039[] = {
+    COM_APPROACH_WALK, 0x7B, 2,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0040[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -0x7F80, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x42,
+    COM_WAIT, 5,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Passive00_0119(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x10, 8, 0x400, 0, -1, 0x10, 0x400);
-        break;
+static const s16 Passive00_0041[] = {
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0042[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 8, 0x40, 0, -0x7F90, -1, 0x40,
+    COM_END,
+};
 
-void Passive00_0120(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x10, 8, 0x200, 0, -1, 0x10, 0x20);
-        break;
+static const s16 Passive00_0043[] = {
+    COM_CHECK_BOSS, 6, 0x1B,
+    COM_EM_TERM, -0x7F80, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0044[] = {
+    COM_EM_TERM, -1, -0x7FC0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Passive00_0121(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x10, 8, 0x20, 0, -1, 0x10, 0x20);
-        break;
+static const s16 Passive00_0045[] = {
+    COM_CHECK_BOSS, 6, 0x1B,
+    COM_EM_TERM, -1, -0x7F90, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0046[] = {
+    COM_KEEP_STATUS, 2, -1,
+    COM_END,
+};
 
-void Passive00_0122(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, 0x30, 6, 1, -1);
-        break;
+static const s16 Passive00_0047[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x42);
-        break;
+static const s16 Passive00_0048[] = {
+    COM_EM_TERM, -0x7F80, -0x7FC0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0049[] = {
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-void Passive00_0123(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive00_0050[] = {
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, 0x30, 6, 1, -1);
-        break;
+static const s16 Passive00_0051[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x220,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 9, 0x42);
-        break;
+static const s16 Passive00_0052[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    case 3:
-        Wait(wk, 5);
-        break;
+static const s16 Passive00_0053[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-    case 4:
-        Normal_Attack(wk, 8, 0x40);
-        break;
+static const s16 Passive00_0054[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0055[] = {
+    COM_LEVER_ATTACK, 8, 8, 0x40,
+    COM_END,
+};
 
-void Passive00_0124(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive00_0056[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FA8, 8, 0x100, 0, -1, -1, -1,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, 0x30, 6, 1, -1);
-        break;
+static const s16 Passive00_0057[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FA8, 8, 0x10, 0, -1, -1, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
+static const s16 Passive00_0058[] = {
+    COM_KEEP_STATUS, 2, 1,
+    COM_END,
+};
 
-    case 3:
-        Wait(wk, 5);
-        break;
+static const s16 Passive00_0059[] = {
+    COM_ETC_TERM, 0, 6, 0x34,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 4:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive00_0060[] = {
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0061[] = {
+    COM_ETC_TERM, 0, 6, 0x99,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive00_0125(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x48, 6, 0x22);
-        break;
+static const s16 Passive00_0062[] = {
+    COM_APPROACH_WALK, 0x43, 2,
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x18, 0);
-        break;
+static const s16 Passive00_0063[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive00_0064[] = {
+    COM_LEVER_ATTACK, 8, 1, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0065[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Passive00_0126(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
+static const s16 Passive00_0066[] = {
+    COM_ETC_TERM, 0, 6, 0x99,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0067[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Passive00_0127(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x48, 6, 0x7E);
-        break;
+static const s16 Passive00_0068[] = {
+    COM_COM_RANDOM_SELECT, 6, 0x59, 0x59, 0x59, 0x5A, 0,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x18, 0);
-        break;
+static const s16 Passive00_0069[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, 0xB, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x40);
-        break;
+static const s16 Passive00_0070[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0071[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_NORMAL_ATTACK, 0xB, 0x220,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive00_0128(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -0x7FB0, 6, 1, -1);
-        break;
+static const s16 Passive00_0072[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, 0xB, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Passive00_0073[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FA0, 8, 0x400, 0, -0x7F90, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Passive00_0074[] = {
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0075[] = {
+    COM_NORMAL_ATTACK, 9, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-void Passive00_0129(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x40, 6, 0x40);
-        break;
+static const s16 Passive00_0076[] = {
+    COM_APPROACH_WALK, 0xB1, 2,
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 8, 0x400, 0, -0x7F90, -1, 0x20,
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x10, 0);
-        break;
+static const s16 Passive00_0077[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 0xB, 0x40, 0, -0x7F90, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 2:
-        Lever_Attack(wk, 8, 1, 0x20);
-        break;
+static const s16 Passive00_0078[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 0xB, 0x400, 0, -0x7F90, -1, 0x20,
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0079[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 0xB, 0x40, 0, -1, -1, -1,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Passive00_0130(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x50, 6, 0x6E);
-        break;
+static const s16 Passive00_0080[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FB0, 0xB, 0x40, 0, -0x7F90, -1, 0x200,
+    COM_NORMAL_ATTACK, 0xB, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x18, 0);
-        break;
+static const s16 Passive00_0081[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FA0, 0xB, 0x400, 0, -0x7F90, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 2:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
+static const s16 Passive00_0082[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FA0, 0xB, 0x40, 0, -1, -1, -1,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive00_0083[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FA0, 0xB, 0x400, 0, -0x7F90, -1, 0x20,
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0084[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FA0, 0xB, 0x400, 0, -0x7F90, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive00_0131(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x71, 2);
-        break;
+static const s16 Passive00_0085[] = {
+    COM_WAIT, 8,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x100);
-        break;
+static const s16 Passive00_0086[] = {
+    COM_CHECK_BOSS, 6, 0x49,
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_WAIT, 5,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive00_0087[] = {
+    COM_CHECK_BOSS, 6, 0x49,
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 0xB, 0x1F, 10, -1,
+    COM_ETC_TERM, 2, 6, 1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0088[] = {
+    COM_PIERCE_ON,
+    COM_APPROACH_WALK, 0xB1, 2,
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 0xB, 0x400, 0, -0x7F90, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 0xB, 0x1F, 10, -1,
+    COM_ETC_TERM, 2, 6, 1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive00_0132(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x2E, 0x2F, 0x30, 0);
-        break;
+static const s16 Passive00_0089[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Passive00_0090[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0091[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-void Passive00_0133(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0);
-        break;
+static const s16 Passive00_0092[] = {
+    COM_EM_TERM, -1, -0x7FB8, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0093[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_END,
+};
 
-void Passive00_0134(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Attack_Complete(wk, 3, 0);
-        break;
+static const s16 Passive00_0094[] = {
+    COM_COM_RANDOM_SELECT, 6, 0x59, 0x5A, 0x5A, 0x5B, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0095[] = {
+    COM_WALK, 1, 0x30, 0,
+    COM_COM_RANDOM_SELECT, 6, 0x59, 0x59, 0x59, 0x5A, 0,
+    COM_END,
+};
 
-void Passive00_0135(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, -1);
-        break;
+static const s16 Passive00_0096[] = {
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0097[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_EM_TERM, -1, -0x7FFE, 6, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Passive00_0136(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
+static const s16 Passive00_0098[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_CHECK_BOSS, 6, 0xE,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0099[] = {
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-void Passive00_0137(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x22);
-        break;
+static const s16 Passive00_0100[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_CHECK_BOSS, 6, 0x88,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0101[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x59, 0x5A, 0x5A, 0x5B, 0,
+    COM_END,
+};
 
-void Passive00_0138(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 5);
-        break;
+static const s16 Passive00_0102[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x59, 0x59, 0x59, 0x5A, 0,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 8, 1, 0x20);
-        break;
+static const s16 Passive00_0103[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x68,
+    COM_WALK, 1, 0x20, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0104[] = {
+    COM_HI_JUMP, 0, 0,
+    COM_END,
+};
 
-void Passive00_0139(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 1);
-        break;
+static const s16 Passive00_0105[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x68,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xA, -1,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    case 1:
-        Look(wk, 0);
-        break;
+static const s16 Passive00_0106[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x68,
+    COM_WALK, 1, 0x38, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0107[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Passive00_0140(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F70, -1, 8, 0x40, 1, -1, 0x20, 0x40);
-        break;
+static const s16 Passive00_0108[] = {
+    COM_APPROACH_WALK, 0xBB, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0109[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7F90, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 0xB, 0x1F, 0xA, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-void Passive00_0141(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F70, -0x7FC0, 8, 0x40, 2, -1, -0x7FB0, 0x40);
-        break;
+static const s16 Passive00_0110[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
+static const s16 Passive00_0111[] = {
+    COM_APPROACH_WALK, 0x7B, 2,
+    COM_EM_TERM, -1, -0x7FA0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0112[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-void Passive00_0142(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F70, -0x7FC0, 9, 0x40, 2, -1, -1, -1);
-        break;
+static const s16 Passive00_0113[] = {
+    COM_CHECK_BOSS, 6, 0x70,
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7FA8, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 0xB, 0x1F, 10, -1,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
+static const s16 Passive00_0114[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, 0x30, 7, 1, -1,
+    COM_J_COMMAND_ATTACK, 0xB, 0x1F, 0xA, -1,
+    COM_J_COMMAND_ATTACK, 0xB, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Passive00_0115[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 0xB, 0x1F, 10, -1,
+    COM_ETC_TERM, 2, 6, 1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0116[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x10, 8, 0x400, 1, -1, 0x10, 0x400,
+    COM_END,
+};
 
-void Passive00_0143(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0xA);
-        break;
+static const s16 Passive00_0117[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x10, 8, 0x200, 1, -1, 0x10, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0118[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x10, 8, 0x20, 1, -1, 0x10, 0x20,
+    COM_END,
+};
 
-void Passive00_0144(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
+static const s16 Passive00_0119[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x10, 8, 0x400, 0, -1, 0x10, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x42);
-        break;
+static const s16 Passive00_0120[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x10, 8, 0x200, 0, -1, 0x10, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0121[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x10, 8, 0x20, 0, -1, 0x10, 0x20,
+    COM_END,
+};
 
-void Passive00_0145(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, -1, 6, 1, -1);
-        break;
+static const s16 Passive00_0122[] = {
+    COM_EM_TERM, -1, 0x30, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Passive00_0123[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, 0x30, 6, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x42,
+    COM_WAIT, 5,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Passive00_0124[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, 0x30, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_WAIT, 5,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0125[] = {
+    COM_SEARCH_BACK_TERM, 0x48, 6, 0x22,
+    COM_WALK, 1, 0x18, 0,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive00_0146(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, -1, 6, 1, -1);
-        break;
+static const s16 Passive00_0126[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
+static const s16 Passive00_0127[] = {
+    COM_SEARCH_BACK_TERM, 0x48, 6, 0x7E,
+    COM_WALK, 1, 0x18, 0,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0128[] = {
+    COM_EM_TERM, -0x7F80, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-void Passive00_0147(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, -1, 6, 1, -1);
-        break;
+static const s16 Passive00_0129[] = {
+    COM_SEARCH_BACK_TERM, 0x40, 6, 0x40,
+    COM_WALK, 1, 0x10, 0,
+    COM_LEVER_ATTACK, 8, 1, 0x20,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Passive00_0130[] = {
+    COM_SEARCH_BACK_TERM, 0x50, 6, 0x6E,
+    COM_WALK, 1, 0x18, 0,
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Passive00_0131[] = {
+    COM_APPROACH_WALK, 0x71, 2,
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0132[] = {
+    COM_SA_TERM, 0x2E, 0x2F, 0x30, 0,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Passive00_0148(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 0xB, 0x400, 1, -0x7F90, -1, 0x400);
-        break;
+static const s16 Passive00_0133[] = {
+    COM_WAIT, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0134[] = {
+    COM_WAIT_ATTACK_COMPLETE, 3, 0,
+    COM_END,
+};
 
-void Passive00_0149(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive00_0135[] = {
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0136[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-void Passive00_0150(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, -1, 6, 1, -1);
-        break;
+static const s16 Passive00_0137[] = {
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x42);
-        break;
+static const s16 Passive00_0138[] = {
+    COM_WAIT, 5,
+    COM_LEVER_ATTACK, 8, 1, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0139[] = {
+    COM_JUMP, 1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Passive00_0151(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, -1, 6, 1, -1);
-        break;
+static const s16 Passive00_0140[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F70, -1, 8, 0x40, 1, -1, 0x20, 0x40,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive00_0141[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F70, -0x7FC0, 8, 0x40, 2, -1, -0x7FB0, 0x40,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0142[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F70, -0x7FC0, 9, 0x40, 2, -1, -1, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Passive00_0152(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
+static const s16 Passive00_0143[] = {
+    COM_WAIT, 0xA,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive00_0144[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0145[] = {
+    COM_EM_TERM, -0x7F90, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-void Passive00_0153(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 6, 0x59, 0x6E, 0x89, 0x98, 0);
-        break;
+static const s16 Passive00_0146[] = {
+    COM_EM_TERM, -0x7F70, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0147[] = {
+    COM_EM_TERM, -0x7F90, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-void Passive00_0154(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 6, 0x6C, 0x9B, 0x5A, 0x98, 0);
-        break;
+static const s16 Passive00_0148[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 0xB, 0x400, 1, -0x7F90, -1, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0149[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive00_0155(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xC, 0, 0xB, -1);
-        break;
+static const s16 Passive00_0150[] = {
+    COM_EM_TERM, -0x7F90, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0151[] = {
+    COM_EM_TERM, -0x7F90, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive00_0156(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 5);
-        break;
+static const s16 Passive00_0152[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
+static const s16 Passive00_0153[] = {
+    COM_COM_RANDOM_SELECT, 6, 0x59, 0x6E, 0x89, 0x98, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0154[] = {
+    COM_COM_RANDOM_SELECT, 6, 0x6C, 0x9B, 0x5A, 0x98, 0,
+    COM_END,
+};
 
-void Passive00_0157(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 0, 6, 0x9A);
-        break;
+static const s16 Passive00_0155[] = {
+    COM_COMMAND_ATTACK, 0xC, 0, 0xB, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Passive00_0156[] = {
+    COM_WAIT, 5,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive00_0157[] = {
+    COM_ETC_TERM, 0, 6, 0x9A,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void (*const Passive00_Tbl[158])(PLW*) = {
+const s16* const Passive00_Tbl[158] = {
     Passive00_0000, Passive00_0001, Passive00_0002, Passive00_0003, Passive00_0004, Passive00_0005, Passive00_0006,
     Passive00_0007, Passive00_0008, Passive00_0009, Passive00_0010, Passive00_0011, Passive00_0012, Passive00_0013,
     Passive00_0014, Passive00_0015, Passive00_0016, Passive00_0017, Passive00_0018, Passive00_0019, Passive00_0020,
@@ -2807,3 +1041,7 @@ void (*const Passive00_Tbl[158])(PLW*) = {
     Passive00_0147, Passive00_0148, Passive00_0149, Passive00_0150, Passive00_0151, Passive00_0152, Passive00_0153,
     Passive00_0154, Passive00_0155, Passive00_0156, Passive00_0157
 };
+
+void Passive00(PLW* wk) {
+    Exec_Com_Pattern(wk, Passive00_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
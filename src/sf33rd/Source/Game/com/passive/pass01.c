@@ -5,2948 +5,1095 @@
 
 #include "sf33rd/Source/Game/com/passive/pass01.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Passive01_Tbl[176])();
-
-void Passive01(PLW* wk) {
-    Passive01_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Passive01_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xD, M_Lv[wk->wu.id]);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 3:
-        EM_Term(wk, 0x7FFF, -1, 1, 1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        VS_Jump_Guard(wk);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x53);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x83, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, 0x7FFF, -1, 1, 1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x83, 2);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, 0xB, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Short_Range_Attack(wk, 8, 0x40, 6, 0x1D);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FB0, 0xB, 0x20, 2, -0x7FA0, -1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x6C);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 3);
-        break;
-
-    case 1:
-        Branch_Unit_Area(wk, 6, 0x59, 0x5A, 0x5B, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x6C);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Keep_Away(wk, 0x8D, 0);
-        break;
-
-    case 3:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 4:
-        Branch_Unit_Area(wk, 6, 0x69, 0x6A, 1, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x6C);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Keep_Away(wk, 0x8D, 0);
-        break;
-
-    case 3:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 5:
-        Branch_Unit_Area(wk, 6, 0x69, 0x6A, 1, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7F80, -0x7FB0, 0xB, 0x100, 0, -0x7FA0, -1, 0x200);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F60, -0x7FB0, 0xB, 0x20, 0, -0x7FA0, -1, 0x200);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x6C);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Keep_Away(wk, 0x8D, 0);
-        break;
-
-    case 3:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x6C);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Keep_Away(wk, 0x8D, 0);
-        break;
-
-    case 3:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 5:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 6:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack(wk, 8, 0xA, 0x400, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -0x7FB8, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x2E, 0x2F, 0xFFFF, 0x59);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 6, 0x9D, 0x9D, 0x9E, 0x9E, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x10);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xB, 0x1E, 0xA, -1);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 6, 0x42, 0x46, 0x4A, 0x4A, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF8, 6, 1, -1);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 6, 0x9D, 0x9D, 0x9E, 0x9E, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x4F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD8, 6, 1, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB8, 6, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF8, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x83, 3);
-        break;
-
-    case 1:
-        EM_Term(wk, -0x7F80, -0x7FC0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack(wk, 8, 0xC, 0x42, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -0x7FB0, 6, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x4F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD8, 6, 1, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -0x7FD8, 6, 1, -1);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 1, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Status(wk, 2, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x220);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 6, 0x68, 0x6A, 1, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F60, -0x7FA0, 8, 0x200, 0, -0x7FA0, -1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F60, -0x7FA0, 8, 0x20, 0, -0x7FA0, -1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Status(wk, 2, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0x2F, 0xFFFF, 0);
-        break;
-
-    case 1:
-        Approach_Walk(wk, 0x59, 2);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x2E, 0xFFFF, 0xFFFF, 0x59);
-        break;
-
-    case 3:
-        Approach_Walk(wk, 0x4F, 2);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        ETC_Term(wk, 0, 2, 0xD);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 0, 6, 0x21);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 1, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    case 2:
-        Com_Random_Select(wk, 6, 0x42, 0x46, 0x4A, 0x4A, 1);
-        break;
-
-    case 3:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x4F, 2);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x83, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F60, -0x7FA0, 8, 0x200, 0, -0x7FA0, -1, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack(wk, 0xC, 0xC, 0x42, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x83, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 1, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 6, 0x9D, 0x9D, 0x9E, 0x9E, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, 0xB, -1);
-        break;
-
-    case 2:
-        Approach_Walk(wk, 0x4F, 2);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xC3, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 2:
-        Branch_Unit_Area(wk, 6, 0x69, 0x6A, 1, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x2E, 0x2F, 0x30, 0x59);
-        break;
-
-    case 1:
-        Approach_Walk(wk, 0x4F, 2);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0x2F, 0x30, 0);
-        break;
-
-    case 1:
-        Approach_Walk(wk, 0x59, 2);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x2E, 0xFFFF, 0xFFFF, 0x59);
-        break;
-
-    case 3:
-        Approach_Walk(wk, 0x4F, 2);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0076(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x30, 0);
-        break;
-
-    case 1:
-        Approach_Walk(wk, 0xC3, 2);
-        break;
-
-    case 2:
-        Jump_Attack(wk, 8, 0xC, 0x42, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0077(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F60, -0x7FA0, 0xB, 0x40, 0, -0x7FA0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0078(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F60, -0x7FB0, 0xB, 0x100, 0, -0x7FA0, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0079(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F60, -0x7FB0, 0xB, 0x20, 0, -0x7FA0, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0080(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7F60, -0x7FA0, 0xB, 0x200, 0, -0x7FA0, -1, 0x400);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0081(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7F60, -0x7FA0, 0xB, 0x100, 0, -0x7FA0, -1, 0x400);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0082(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7F60, -0x7FA0, 0xB, 0x20, 0, -0x7FA0, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0083(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FA0, 0xB, 0x200, 0, -0x7FA0, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0084(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack(wk, 0xC, 0xC, 0x42, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0085(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0xA);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 6, 5, 9, 0x35, 1, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0086(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x59, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD8, 6, 1, -1);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x2E, 0xFFFF, 0xFFFF, 0x59);
-        break;
-
-    case 3:
-        Approach_Walk(wk, 0x4F, 2);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0087(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x59, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD8, 6, 1, -1);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x2E, 0x2F, 0xFFFF, 0x59);
-        break;
-
-    case 3:
-        Approach_Walk(wk, 0x4F, 2);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0088(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FA0, 6, 1, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x30, 0);
-        break;
-
-    case 2:
-        Branch_Unit_Area(wk, 6, 0x59, 0x5A, 0x5B, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0089(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0090(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0091(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0092(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x83, 3);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FA0, 6, 1, -1);
-        break;
-
-    case 2:
-        Branch_Unit_Area(wk, 6, 0x59, 0x5A, 0x5B, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0093(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0094(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0095(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 2:
-        Branch_Unit_Area(wk, 6, 0x68, 0x69, 0x6A, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0096(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x83, 3);
-        break;
-
-    case 1:
-        EM_Term(wk, -0x7F80, -0x7FD8, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0097(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 6, 1, -1);
-        break;
-
-    case 2:
-        Com_Random_Select(wk, 6, 0x9D, 0x9D, 0x9E, 0x9E, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0098(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FC0, 6, 1, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    case 3:
-        Com_Random_Select(wk, 6, 0x42, 0x46, 0x4A, 0x4A, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0099(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FA0, 0xB, 0x200, 0, -0x7FA0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0100(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x4F, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 2:
-        SA_Term(wk, 0xFFFF, 0x2F, 0x30, 0);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0101(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x2E, 0x2F, 0x30, 0x59);
-        break;
-
-    case 2:
-        Branch_Unit_Area(wk, 6, 0x69, 0x6A, 1, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0102(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0103(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0104(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0105(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0106(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0107(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x6C);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x20, 0);
-        break;
-
-    case 2:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0108(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump(wk, 1, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0109(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x6C);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xA, -1);
-        break;
-
-    case 3:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0110(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x6C);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x38, 0);
-        break;
-
-    case 2:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0111(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x42);
-        break;
-
-    case 2:
-        Com_Random_Select(wk, 6, 0x4B, 0x36, 0x3B, 0x70, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0112(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 1, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0113(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x42);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 6, 0x4B, 0x36, 0x3B, 0x70, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive01_0114(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0000[] = {
+    COM_NORMAL_ATTACK_M_LV, 0xD,
+    COM_END,
+};
 
-void Passive01_0115(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FA0, 0xB, 0x200, 0, -0x7FA0, -1, 0x20);
-        break;
+static const s16 Passive01_0001[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0002[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_EM_TERM, 0x7FFF, -1, 1, 1, -1,
+    COM_END,
+};
 
-void Passive01_0116(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FA0, 0xB, 0x400, 0, -0x7FA0, -1, 0x20);
-        break;
+static const s16 Passive01_0003[] = {
+    COM_VS_JUMP_GUARD,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0004[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x53,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-void Passive01_0117(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack(wk, 8, 0xC, 0x100, 0);
-        break;
+static const s16 Passive01_0005[] = {
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0006[] = {
+    COM_APPROACH_WALK, 0x83, 2,
+    COM_EM_TERM, 0x7FFF, -1, 1, 1, -1,
+    COM_END,
+};
 
-void Passive01_0118(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
+static const s16 Passive01_0007[] = {
+    COM_APPROACH_WALK, 0x83, 2,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0008[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, 0xB, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Passive01_0119(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_On(wk, 1, 2);
-        break;
+static const s16 Passive01_0009[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
+static const s16 Passive01_0010[] = {
+    COM_SHORT_RANGE_ATTACK, 8, 0x40, 6, 0x1D,
+    COM_END,
+};
 
-    case 2:
-        Check_Store_Lever(wk, 0x1F, 1, -1);
-        break;
+static const s16 Passive01_0011[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FB0, 0xB, 0x20, 2, -0x7FA0, -1, 0x20,
+    COM_END,
+};
 
-    case 3:
-        Branch_Unit_Area(wk, 6, 0x69, 0x6A, 1, 1);
-        break;
+static const s16 Passive01_0012[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0013[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x6C,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-void Passive01_0120(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x20, 8, 0x400, 1, -1, 0x20, 0x400);
-        break;
+static const s16 Passive01_0014[] = {
+    COM_WAIT, 3,
+    COM_BRANCH_UNIT_AREA, 6, 0x59, 0x5A, 0x5B, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0015[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-void Passive01_0121(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x20, 8, 0x20, 1, -1, 0x20, 0x20);
-        break;
+static const s16 Passive01_0016[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x6C,
+    COM_PIERCE_ON,
+    COM_KEEP_AWAY, 0x8D, 0,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_BRANCH_UNIT_AREA, 6, 0x69, 0x6A, 1, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0017[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Passive01_0122(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x20, 8, 0x40, 1, -1, 0x20, 0x40);
-        break;
+static const s16 Passive01_0018[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x6C,
+    COM_PIERCE_ON,
+    COM_KEEP_AWAY, 0x8D, 0,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_BRANCH_UNIT_AREA, 6, 0x69, 0x6A, 1, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0019[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-void Passive01_0123(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x20, 8, 0x400, 2, -1, 0x20, 0x400);
-        break;
+static const s16 Passive01_0020[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0021[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Passive01_0124(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x20, 8, 0x20, 2, -1, 0x20, 0x20);
-        break;
+static const s16 Passive01_0022[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_JUMP_ATTACK_TERM, -0x7F80, -0x7FB0, 0xB, 0x100, 0, -0x7FA0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0023[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F60, -0x7FB0, 0xB, 0x20, 0, -0x7FA0, -1, 0x200,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Passive01_0125(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x20, 8, 0x40, 2, -1, 0x20, 0x40);
-        break;
+static const s16 Passive01_0024[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x6C,
+    COM_PIERCE_ON,
+    COM_KEEP_AWAY, 0x8D, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0025[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x6C,
+    COM_PIERCE_ON,
+    COM_KEEP_AWAY, 0x8D, 0,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Passive01_0126(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, 0x30, 6, 1, -1);
-        break;
+static const s16 Passive01_0026[] = {
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x42);
-        break;
+static const s16 Passive01_0027[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0028[] = {
+    COM_JUMP_ATTACK, 8, 0xA, 0x400, 1,
+    COM_END,
+};
 
-void Passive01_0127(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
+static const s16 Passive01_0029[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0030[] = {
+    COM_EM_TERM, -0x7F80, -0x7FB8, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive01_0128(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_EX(wk, 6, 0x36);
-        break;
+static const s16 Passive01_0031[] = {
+    COM_WALK, 1, 0x20, 1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 9, 0x700);
-        break;
+static const s16 Passive01_0032[] = {
+    COM_SA_TERM, 0x2E, 0x2F, (s16)0xFFFF, 0x59,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0033[] = {
+    COM_COM_RANDOM_SELECT, 6, 0x9D, 0x9D, 0x9E, 0x9E, 1,
+    COM_END,
+};
 
-void Passive01_0129(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
+static const s16 Passive01_0034[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x10,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Passive01_0130(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
+static const s16 Passive01_0036[] = {
+    COM_COMMAND_ATTACK, 0xB, 0x1E, 0xA, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x42, 0x46, 0x4A, 0x4A, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0037[] = {
+    COM_EM_TERM, -1, -0x7FF8, 6, 1, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x9D, 0x9D, 0x9E, 0x9E, 1,
+    COM_END,
+};
 
-void Passive01_0131(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 0xA, -1);
-        break;
+static const s16 Passive01_0038[] = {
+    COM_APPROACH_WALK, 0x4F, 2,
+    COM_EM_TERM, -1, -0x7FD8, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0039[] = {
+    COM_EM_TERM, -1, -0x7FB8, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Passive01_0132(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 6, 0x81, 0x82, 0x82, 0x83);
-        break;
+static const s16 Passive01_0040[] = {
+    COM_EM_TERM, -1, -0x7FF8, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0041[] = {
+    COM_APPROACH_WALK, 0x83, 3,
+    COM_EM_TERM, -0x7F80, -0x7FC0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x40,
+    COM_END,
+};
 
-void Passive01_0133(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_EX(wk, 6, 0x84);
-        break;
+static const s16 Passive01_0042[] = {
+    COM_JUMP_ATTACK, 8, 0xC, 0x42, 2,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x20, 0xA, 0x700);
-        break;
+static const s16 Passive01_0043[] = {
+    COM_EM_TERM, -0x7F80, -0x7FB0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0044[] = {
+    COM_APPROACH_WALK, 0x4F, 2,
+    COM_EM_TERM, -1, -0x7FD8, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-void Passive01_0134(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 0xA, 0x70);
-        break;
+static const s16 Passive01_0045[] = {
+    COM_EM_TERM, -0x7F80, -0x7FD8, 6, 1, -1,
+    COM_LEVER_ATTACK, 8, 1, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0046[] = {
+    COM_KEEP_STATUS, 2, -1,
+    COM_END,
+};
 
-void Passive01_0135(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_EX(wk, 6, 1);
-        break;
+static const s16 Passive01_0047[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, 0x700);
-        break;
+static const s16 Passive01_0048[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0049[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_ADJUST_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-void Passive01_0136(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_EX(wk, 6, 0x36);
-        break;
+static const s16 Passive01_0050[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, 0x700);
-        break;
+static const s16 Passive01_0051[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x220,
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0052[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Passive01_0137(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
+static const s16 Passive01_0053[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 0xA, 0x70);
-        break;
+static const s16 Passive01_0054[] = {
+    COM_BRANCH_UNIT_AREA, 6, 0x68, 0x6A, 1, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0055[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Passive01_0138(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_EX(wk, 6, 0x22);
-        break;
+static const s16 Passive01_0056[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F60, -0x7FA0, 8, 0x200, 0, -0x7FA0, -1, 0x20,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, 0x700);
-        break;
+static const s16 Passive01_0057[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F60, -0x7FA0, 8, 0x20, 0, -0x7FA0, -1, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0058[] = {
+    COM_KEEP_STATUS, 2, 1,
+    COM_END,
+};
 
-void Passive01_0139(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack(wk, 0xC, 0xA, 0x42, 2);
-        break;
+static const s16 Passive01_0059[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0060[] = {
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-void Passive01_0140(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0);
-        break;
+static const s16 Passive01_0061[] = {
+    COM_SA_TERM, (s16)0xFFFF, 0x2F, (s16)0xFFFF, 0,
+    COM_APPROACH_WALK, 0x59, 2,
+    COM_SA_TERM, 0x2E, (s16)0xFFFF, (s16)0xFFFF, 0x59,
+    COM_APPROACH_WALK, 0x4F, 2,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0062[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_ETC_TERM, 0, 2, 0xD,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Passive01_0141(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
+static const s16 Passive01_0063[] = {
+    COM_ETC_TERM, 0, 6, 0x21,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_LEVER_ATTACK, 8, 1, 0x40,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x40);
-        break;
+static const s16 Passive01_0064[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0065[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x42, 0x46, 0x4A, 0x4A, 1,
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_END,
+};
 
-void Passive01_0142(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, -1);
-        break;
+static const s16 Passive01_0066[] = {
+    COM_APPROACH_WALK, 0x4F, 2,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0067[] = {
+    COM_APPROACH_WALK, 0x83, 2,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive01_0143(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, 1);
-        break;
+static const s16 Passive01_0068[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F60, -0x7FA0, 8, 0x200, 0, -0x7FA0, -1, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 0x85, 0x86, 0x7F, 0x70, 1);
-        break;
+static const s16 Passive01_0069[] = {
+    COM_JUMP_ATTACK, 0xC, 0xC, 0x42, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0070[] = {
+    COM_APPROACH_WALK, 0x83, 2,
+    COM_LEVER_ATTACK, 8, 1, 0x40,
+    COM_END,
+};
 
-void Passive01_0144(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, 1);
-        break;
+static const s16 Passive01_0071[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_COM_RANDOM_SELECT, 6, 0x9D, 0x9D, 0x9E, 0x9E, 1,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0x2E, 0x2F, 0x30, 0x59);
-        break;
+static const s16 Passive01_0072[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, 0xB, -1,
+    COM_APPROACH_WALK, 0x4F, 2,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Com_Random_Select(wk, 6, 0x85, 0x86, 0x7F, 0x70, 1);
-        break;
+static const s16 Passive01_0073[] = {
+    COM_APPROACH_WALK, 0xC3, 2,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_BRANCH_UNIT_AREA, 6, 0x69, 0x6A, 1, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0074[] = {
+    COM_SA_TERM, 0x2E, 0x2F, 0x30, 0x59,
+    COM_APPROACH_WALK, 0x4F, 2,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Passive01_0145(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, 1);
-        break;
+static const s16 Passive01_0075[] = {
+    COM_SA_TERM, (s16)0xFFFF, 0x2F, 0x30, 0,
+    COM_APPROACH_WALK, 0x59, 2,
+    COM_SA_TERM, 0x2E, (s16)0xFFFF, (s16)0xFFFF, 0x59,
+    COM_APPROACH_WALK, 0x4F, 2,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x30, 0xFFFF);
-        break;
+static const s16 Passive01_0076[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x30, 0,
+    COM_APPROACH_WALK, 0xC3, 2,
+    COM_JUMP_ATTACK, 8, 0xC, 0x42, 0,
+    COM_END,
+};
 
-    case 2:
-        Com_Random_Select(wk, 6, 0x85, 0x73, 0x92, 0x93, 1);
-        break;
+static const s16 Passive01_0077[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F60, -0x7FA0, 0xB, 0x40, 0, -0x7FA0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0078[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F60, -0x7FB0, 0xB, 0x100, 0, -0x7FA0, -1, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Passive01_0146(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, 1);
-        break;
+static const s16 Passive01_0079[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F60, -0x7FB0, 0xB, 0x20, 0, -0x7FA0, -1, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 1:
-        Pierce_On(wk);
-        break;
+static const s16 Passive01_0080[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7F60, -0x7FA0, 0xB, 0x200, 0, -0x7FA0, -1, 0x400,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 0xC, 0, 0xB, -1);
-        break;
+static const s16 Passive01_0081[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7F60, -0x7FA0, 0xB, 0x100, 0, -0x7FA0, -1, 0x400,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 0xC, 0, 0xB, -1);
-        break;
+static const s16 Passive01_0082[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7F60, -0x7FA0, 0xB, 0x20, 0, -0x7FA0, -1, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 4:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Passive01_0083[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FA0, 0xB, 0x200, 0, -0x7FA0, -1, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0084[] = {
+    COM_HI_JUMP_ATTACK, 0xC, 0xC, 0x42, 0,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Passive01_0147(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_EX(wk, 6, 0x85);
-        break;
+static const s16 Passive01_0085[] = {
+    COM_WAIT, 0xA,
+    COM_COM_RANDOM_SELECT, 6, 5, 9, 0x35, 1, 1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, 0x700);
-        break;
+static const s16 Passive01_0086[] = {
+    COM_APPROACH_WALK, 0x59, 2,
+    COM_EM_TERM, -1, -0x7FD8, 6, 1, -1,
+    COM_SA_TERM, 0x2E, (s16)0xFFFF, (s16)0xFFFF, 0x59,
+    COM_APPROACH_WALK, 0x4F, 2,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0087[] = {
+    COM_APPROACH_WALK, 0x59, 2,
+    COM_EM_TERM, -1, -0x7FD8, 6, 1, -1,
+    COM_SA_TERM, 0x2E, 0x2F, (s16)0xFFFF, 0x59,
+    COM_APPROACH_WALK, 0x4F, 2,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Passive01_0148(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 1);
-        break;
+static const s16 Passive01_0088[] = {
+    COM_EM_TERM, -1, -0x7FA0, 6, 1, -1,
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x30, 0,
+    COM_BRANCH_UNIT_AREA, 6, 0x59, 0x5A, 0x5B, 1,
+    COM_END,
+};
 
-    case 1:
-        Look(wk, 0);
-        break;
+static const s16 Passive01_0089[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0090[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Passive01_0149(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F70, -1, 8, 0x200, 1, -1, 0x20, 0x200);
-        break;
+static const s16 Passive01_0091[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0092[] = {
+    COM_APPROACH_WALK, 0x83, 3,
+    COM_EM_TERM, -1, -0x7FA0, 6, 1, -1,
+    COM_BRANCH_UNIT_AREA, 6, 0x59, 0x5A, 0x5B, 1,
+    COM_END,
+};
 
-void Passive01_0150(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F70, -0x7FB0, 8, 0x20, 2, -1, -0x7FB0, 0x20);
-        break;
+static const s16 Passive01_0093[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
+static const s16 Passive01_0094[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0095[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_BRANCH_UNIT_AREA, 6, 0x68, 0x69, 0x6A, 1,
+    COM_END,
+};
 
-void Passive01_0151(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Passive01_0096[] = {
+    COM_APPROACH_WALK, 0x83, 3,
+    COM_EM_TERM, -0x7F80, -0x7FD8, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Passive01_0097[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_EM_TERM, -1, -0x7FF8, 6, 1, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x9D, 0x9D, 0x9E, 0x9E, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0098[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_EM_TERM, -1, -0x7FC0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x42, 0x46, 0x4A, 0x4A, 1,
+    COM_END,
+};
 
-void Passive01_0152(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, -1, 6, 1, -1);
-        break;
+static const s16 Passive01_0099[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FA0, 0xB, 0x200, 0, -0x7FA0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Passive01_0100[] = {
+    COM_APPROACH_WALK, 0x4F, 2,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_SA_TERM, (s16)0xFFFF, 0x2F, 0x30, 0,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Passive01_0101[] = {
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_SA_TERM, 0x2E, 0x2F, 0x30, 0x59,
+    COM_BRANCH_UNIT_AREA, 6, 0x69, 0x6A, 1, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0102[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-void Passive01_0153(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, -1, 6, 1, -1);
-        break;
+static const s16 Passive01_0103[] = {
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive01_0104[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0105[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-void Passive01_0154(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, -1, 6, 1, -1);
-        break;
+static const s16 Passive01_0106[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Passive01_0107[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x6C,
+    COM_WALK, 1, 0x20, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Passive01_0108[] = {
+    COM_HI_JUMP, 1, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0109[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x6C,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xA, -1,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-void Passive01_0155(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 6);
-        break;
+static const s16 Passive01_0110[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x6C,
+    COM_WALK, 1, 0x38, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    case 1:
-        Branch_Unit_Area(wk, 6, 0x59, 0x5A, 0x5B, 1);
-        break;
+static const s16 Passive01_0111[] = {
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 0xC, 0x42,
+    COM_COM_RANDOM_SELECT, 6, 0x4B, 0x36, 0x3B, 0x70, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0112[] = {
+    COM_LEVER_ATTACK, 8, 1, 0x40,
+    COM_END,
+};
 
-void Passive01_0156(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_EX(wk, 6, 0x9B);
-        break;
+static const s16 Passive01_0113[] = {
+    COM_NORMAL_ATTACK, 9, 0x42,
+    COM_COM_RANDOM_SELECT, 6, 0x4B, 0x36, 0x3B, 0x70, 1,
+    COM_END,
+};
 
-    case 1:
-        Wait(wk, 4);
-        break;
+static const s16 Passive01_0114[] = {
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 9, 0x700);
-        break;
+static const s16 Passive01_0115[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FA0, 0xB, 0x200, 0, -0x7FA0, -1, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0116[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FA0, 0xB, 0x400, 0, -0x7FA0, -1, 0x20,
+    COM_END,
+};
 
-void Passive01_0157(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
+static const s16 Passive01_0117[] = {
+    COM_JUMP_ATTACK, 8, 0xC, 0x100, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0118[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Passive01_0158(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
+static const s16 Passive01_0119[] = {
+    COM_LEVER_ON, 1, 2,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_CHECK_STORE_LEVER, 0x1F, 1, -1,
+    COM_BRANCH_UNIT_AREA, 6, 0x69, 0x6A, 1, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0120[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x20, 8, 0x400, 1, -1, 0x20, 0x400,
+    COM_END,
+};
 
-void Passive01_0159(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x110);
-        break;
+static const s16 Passive01_0121[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x20, 8, 0x20, 1, -1, 0x20, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0122[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x20, 8, 0x40, 1, -1, 0x20, 0x40,
+    COM_END,
+};
 
-void Passive01_0160(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 2, 0xF);
-        break;
+static const s16 Passive01_0123[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x20, 8, 0x400, 2, -1, 0x20, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x20, 0);
-        break;
+static const s16 Passive01_0124[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x20, 8, 0x20, 2, -1, 0x20, 0x20,
+    COM_END,
+};
 
-    case 2:
-        Wait(wk, 3);
-        break;
+static const s16 Passive01_0125[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x20, 8, 0x40, 2, -1, 0x20, 0x40,
+    COM_END,
+};
 
-    case 3:
-        Walk(wk, 0, 0x30, 0);
-        break;
+static const s16 Passive01_0126[] = {
+    COM_EM_TERM, -1, 0x30, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    case 4:
-        Wait(wk, 9);
-        break;
+static const s16 Passive01_0127[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 5:
-        Walk(wk, 0, 0x20, 0);
-        break;
+static const s16 Passive01_0128[] = {
+    COM_CHECK_EX, 6, 0x36,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, 0x700,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0129[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_END,
+};
 
-void Passive01_0161(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x20, 2, 0x1B);
-        break;
+static const s16 Passive01_0130[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x18, 0);
-        break;
+static const s16 Passive01_0131[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Wait(wk, 8);
-        break;
+static const s16 Passive01_0132[] = {
+    COM_BRANCH_UNIT_AREA, 6, 0x81, 0x82, 0x82, 0x83,
+    COM_END,
+};
 
-    case 3:
-        Search_Back_Term(wk, 0x30, 2, 0x1B);
-        break;
+static const s16 Passive01_0133[] = {
+    COM_CHECK_EX, 6, 0x84,
+    COM_COMMAND_ATTACK, 8, 0x20, 0xA, 0x700,
+    COM_END,
+};
 
-    case 4:
-        Walk(wk, 1, 0x20, 0);
-        break;
+static const s16 Passive01_0134[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, 0x70,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0135[] = {
+    COM_CHECK_EX, 6, 1,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, 0x700,
+    COM_END,
+};
 
-void Passive01_0162(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 0, 0x20, 0);
-        break;
+static const s16 Passive01_0136[] = {
+    COM_CHECK_EX, 6, 0x36,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, 0x700,
+    COM_END,
+};
 
-    case 1:
-        Search_Back_Term(wk, 0x30, 2, 6);
-        break;
+static const s16 Passive01_0137[] = {
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, 0x70,
+    COM_END,
+};
 
-    case 2:
-        Walk(wk, 1, 0x28, 0);
-        break;
+static const s16 Passive01_0138[] = {
+    COM_CHECK_EX, 6, 0x22,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, 0x700,
+    COM_END,
+};
 
-    case 3:
-        Wait(wk, 8);
-        break;
+static const s16 Passive01_0139[] = {
+    COM_JUMP_ATTACK, 0xC, 0xA, 0x42, 2,
+    COM_END,
+};
 
-    case 4:
-        Walk(wk, 0, 0x20, 0);
-        break;
+static const s16 Passive01_0140[] = {
+    COM_WAIT, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0141[] = {
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Passive01_0163(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
+static const s16 Passive01_0142[] = {
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0143[] = {
+    COM_PROVOKE, 1,
+    COM_COM_RANDOM_SELECT, 6, 0x85, 0x86, 0x7F, 0x70, 1,
+    COM_END,
+};
 
-void Passive01_0164(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 0, 1, -1);
-        break;
+static const s16 Passive01_0144[] = {
+    COM_PROVOKE, 1,
+    COM_SA_TERM, 0x2E, 0x2F, 0x30, 0x59,
+    COM_COM_RANDOM_SELECT, 6, 0x85, 0x86, 0x7F, 0x70, 1,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
+static const s16 Passive01_0145[] = {
+    COM_PROVOKE, 1,
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x30, (s16)0xFFFF,
+    COM_COM_RANDOM_SELECT, 6, 0x85, 0x73, 0x92, 0x93, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0146[] = {
+    COM_PROVOKE, 1,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, 0xB, -1,
+    COM_COMMAND_ATTACK, 0xC, 0, 0xB, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Passive01_0165(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 6, 0xA6, 0xA7, 0xA8, 1);
-        break;
+static const s16 Passive01_0147[] = {
+    COM_CHECK_EX, 6, 0x85,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, 0x700,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0148[] = {
+    COM_JUMP, 1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Passive01_0166(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x21, 8, -1);
-        break;
+static const s16 Passive01_0149[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F70, -1, 8, 0x200, 1, -1, 0x20, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0150[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F70, -0x7FB0, 8, 0x20, 2, -1, -0x7FB0, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Passive01_0167(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x21, 9, -1);
-        break;
+static const s16 Passive01_0151[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0152[] = {
+    COM_EM_TERM, -0x7F70, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_END,
+};
 
-void Passive01_0168(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x21, 0xA, -1);
-        break;
+static const s16 Passive01_0153[] = {
+    COM_EM_TERM, -0x7F70, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0154[] = {
+    COM_EM_TERM, -0x7F70, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-void Passive01_0169(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FC0, 6, 1, -1);
-        break;
+static const s16 Passive01_0155[] = {
+    COM_WAIT, 6,
+    COM_BRANCH_UNIT_AREA, 6, 0x59, 0x5A, 0x5B, 1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x21, 8, -1);
-        break;
+static const s16 Passive01_0156[] = {
+    COM_CHECK_EX, 6, 0x9B,
+    COM_WAIT, 4,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, 0x700,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0157[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Passive01_0170(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FC0, 6, 1, -1);
-        break;
+static const s16 Passive01_0158[] = {
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x21, 9, -1);
-        break;
+static const s16 Passive01_0159[] = {
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0160[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 2, 0xF,
+    COM_WALK, 1, 0x20, 0,
+    COM_WAIT, 3,
+    COM_WALK, 0, 0x30, 0,
+    COM_WAIT, 9,
+    COM_WALK, 0, 0x20, 0,
+    COM_END,
+};
 
-void Passive01_0171(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive01_0161[] = {
+    COM_SEARCH_BACK_TERM, 0x20, 2, 0x1B,
+    COM_WALK, 1, 0x18, 0,
+    COM_WAIT, 8,
+    COM_SEARCH_BACK_TERM, 0x30, 2, 0x1B,
+    COM_WALK, 1, 0x20, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0162[] = {
+    COM_WALK, 0, 0x20, 0,
+    COM_SEARCH_BACK_TERM, 0x30, 2, 6,
+    COM_WALK, 1, 0x28, 0,
+    COM_WAIT, 8,
+    COM_WALK, 0, 0x20, 0,
+    COM_END,
+};
 
-void Passive01_0172(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Passive01_0163[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Passive01_0164[] = {
+    COM_EM_TERM, -0x7F80, -1, 0, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0165[] = {
+    COM_BRANCH_UNIT_AREA, 6, 0xA6, 0xA7, 0xA8, 1,
+    COM_END,
+};
 
-void Passive01_0173(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7F60, -0x7FA0, 0xB, 0x100, 0, -0x7FA0, -1, 0x400);
-        break;
+static const s16 Passive01_0166[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x21, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Passive01_0167[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x21, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0168[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x21, 0xA, -1,
+    COM_END,
+};
 
-void Passive01_0174(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7F60, -0x7FA0, 0xB, 0x20, 0, -0x7FA0, -1, 0x20);
-        break;
+static const s16 Passive01_0169[] = {
+    COM_EM_TERM, -1, -0x7FC0, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x21, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
+static const s16 Passive01_0170[] = {
+    COM_EM_TERM, -1, -0x7FC0, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x21, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0171[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive01_0175(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7F60, -0x7FA0, 0xB, 0x20, 0, -0x7FA0, -1, 0x20);
-        break;
+static const s16 Passive01_0172[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0x2E, 0x2F, 0x30, -1);
-        break;
+static const s16 Passive01_0173[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7F60, -0x7FA0, 0xB, 0x100, 0, -0x7FA0, -1, 0x400,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Passive01_0174[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7F60, -0x7FA0, 0xB, 0x20, 0, -0x7FA0, -1, 0x20,
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive01_0175[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7F60, -0x7FA0, 0xB, 0x20, 0, -0x7FA0, -1, 0x20,
+    COM_SA_TERM, 0x2E, 0x2F, 0x30, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-void (*const Passive01_Tbl[176])(PLW*) = {
+const s16* const Passive01_Tbl[176] = {
     Passive01_0000, Passive01_0001, Passive01_0002, Passive01_0003, Passive01_0004, Passive01_0005, Passive01_0006,
     Passive01_0007, Passive01_0008, Passive01_0009, Passive01_0010, Passive01_0011, Passive01_0012, Passive01_0013,
     Passive01_0014, Passive01_0015, Passive01_0016, Passive01_0017, Passive01_0018, Passive01_0019, Passive01_0020,
@@ -2974,3 +1121,7 @@ void (*const Passive01_Tbl[176])(PLW*) = {
     Passive01_0168, Passive01_0169, Passive01_0170, Passive01_0171, Passive01_0172, Passive01_0173, Passive01_0174,
     Passive01_0175
 };
+
+void Passive01(PLW* wk) {
+    Exec_Com_Pattern(wk, Passive01_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
@@ -5,2276 +5,841 @@
 
 #include "sf33rd/Source/Game/com/passive/pass02.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Passive02_Tbl[133])();
-
-void Passive02(PLW* wk) {
-    Passive02_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Passive02_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xD, M_Lv[wk->wu.id]);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F88, -1, 0, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 8, 0x70);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, 0x700);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 0xA, 0x70);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F88, -1, 0, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F88, -1, 0, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F88, -1, 0, 1, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0xFFFF, 0x36, 0xFFFF, 0x47);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -0x7FA8, 0, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x200, 0, -0x7F70, -1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_BOSS(wk, 6, 0x6F);
-        break;
-
-    case 1:
-        Next_Another_Menu(wk, 6, 3);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        VS_Jump_Guard(wk);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        EM_Term(wk, -0x7FB0, -1, 5, 6, 0x1C);
-        break;
-
-    case 3:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7F90, -0x7FC0, 8, 0x400, 0, -0x7F68, -1, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC8, 8, 0x40, 0, -0x7F78, -1, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xBF, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 2:
-        EM_Term(wk, 0x7FFF, -1, 1, 1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, 0x7FFF, -1, 1, 1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF8, 0, 1, -1);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF8, 0, 1, -1);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FD0, 0, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF0, 0, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF0, 0, 6, 0x1F);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 0, 6, 0x1F);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 3, 1, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_BOSS(wk, 6, 0x70);
-        break;
-
-    case 1:
-        Next_Another_Menu(wk, 6, 3);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Status(wk, 2, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -1, 5, 6, 0x1F);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -1, 5, 6, 0x1F);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x40, 8, 0x400, 0, -0x7F68, -1, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC8, 8, 0x100, 0, -0x7F78, -1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Status(wk, 2, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -1, 5, 6, 0x1F);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x200);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0x36, 0xFFFF, 0x47);
-        break;
-
-    case 1:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x19, 0x3C);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x10, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FE8, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x40);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x200);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xBF, 2);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0x36, 0xFFFF, 0x47);
-        break;
-
-    case 2:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x19, 0x3C);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Attack_Complete(wk, 3, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Attack_Complete(wk, 3, 1);
-        break;
-
-    case 1:
-        Next_Be_Passive(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Attack_Complete(wk, 3, 1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0xFFFF, 0x37, 0);
-        break;
-
-    case 2:
-        Wait_Attack_Complete(wk, 3, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x40, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Wait(wk, 10);
-        break;
-
-    case 3:
-        SA_Term(wk, 0x35, 0x36, 0xFFFF, 0x47);
-        break;
-
-    case 4:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x19, 0x3C);
-        break;
-
-    case 5:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 6:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x37, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF0, 0, 1, -1);
-        break;
-
-    case 2:
-        ETC_Term(wk, 8, 6, 7);
-        break;
-
-    case 3:
-        Check_SA(wk, 6, 7);
-        break;
-
-    case 4:
-        Pierce_On(wk);
-        break;
-
-    case 5:
-        Command_Attack(wk, 8, 0x8016, 10, -1);
-        break;
-
-    case 6:
-        Wait(wk, 1);
-        break;
-
-    case 7:
-        Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0xFFFF, 0xFFFF, 0);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0xFFFF, 0x37, 0);
-        break;
-
-    case 1:
-        Adjust_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xA, 0x202);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0x36, 0xFFFF, 0x47);
-        break;
-
-    case 1:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x19, 0x3C);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FC0, -1, 5, 6, 0x1F);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0076(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -1, 5, 6, 0x1C);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0077(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Attack_Complete(wk, 3, 1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0078(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xBF, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Check_EX(wk, 6, 0x70);
-        break;
-
-    case 3:
-        Pierce_On(wk);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1F, 8, 0x700);
-        break;
-
-    case 5:
-        Check_BOSS_EX(wk, 1, 0xFFFF);
-        break;
-
-    case 6:
-        EM_Term(wk, -0x7F58, -1, 0, 1, -1);
-        break;
-
-    case 7:
-        Wait(wk, 2);
-        break;
-
-    case 8:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0079(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0080(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x42);
-        break;
-
-    case 2:
-        Command_Attack(wk, 0xC, 0x1C, 0xA, -1);
-        break;
-
-    case 3:
-        Wait(wk, 5);
-        break;
-
-    case 4:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0081(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x400);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
-
-    case 2:
-        Command_Attack(wk, 0xC, 0x1D, 10, -1);
-        break;
-
-    case 3:
-        Wait(wk, 5);
-        break;
-
-    case 4:
-        SA_Term(wk, 0x35, 0x36, 0xFFFF, 0x47);
-        break;
-
-    case 5:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x19, 0x3C);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0082(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x10, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x202);
-        break;
-
-    case 3:
-        Command_Attack(wk, 0xC, 0x1D, 10, -1);
-        break;
-
-    case 4:
-        Wait(wk, 5);
-        break;
-
-    case 5:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0083(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 4, 6, 0x2A);
-        break;
-
-    case 1:
-        Provoke(wk, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0084(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 9, 0x100, 1, -0x7FB0, -1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0085(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x220);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0086(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 0);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0087(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2E, 8, 0x700, -0x7FA0, 0x48, 0, 0x700, 0x30, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0088(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
-
-    case 5:
-        Com_Random_Select(wk, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0089(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    case 2:
-        Branch_Unit_Area(wk, 6, 0x20, 0x3B, 0x36, 0x5A);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive02_0090(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Passive02_0000[] = {
+    COM_NORMAL_ATTACK_M_LV, 0xD,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0001[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Passive02_0091(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -0x7FF0, 6, 1, -1);
-        break;
+static const s16 Passive02_0002[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 0xC, 0x1D, 0xA, -1);
-        break;
+static const s16 Passive02_0003[] = {
+    COM_EM_TERM, -0x7F88, -1, 0, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, 0x70,
+    COM_END,
+};
 
-    case 2:
-        Wait(wk, 5);
-        break;
+static const s16 Passive02_0004[] = {
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-    case 3:
-        SA_Term(wk, 0x35, 0xFFFF, 0x37, 0);
-        break;
+static const s16 Passive02_0005[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, 0x700,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0006[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, 0x70,
+    COM_END,
+};
 
-void Passive02_0092(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF0, 0, 1, -1);
-        break;
+static const s16 Passive02_0007[] = {
+    COM_EM_TERM, -0x7F88, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 0x60, 0x61, 0x62, 99, 1);
-        break;
+static const s16 Passive02_0008[] = {
+    COM_EM_TERM, -0x7F88, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0009[] = {
+    COM_EM_TERM, -0x7F88, -1, 0, 1, -1,
+    COM_SA_TERM, (s16)0xFFFF, 0x36, (s16)0xFFFF, 0x47,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive02_0093(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x400);
-        break;
+static const s16 Passive02_0010[] = {
+    COM_EM_TERM, -0x7FB0, -0x7FA8, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x202);
-        break;
+static const s16 Passive02_0011[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x200, 0, -0x7F70, -1, 0x20,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 0xC, 0x1D, 0xA, -1);
-        break;
+static const s16 Passive02_0012[] = {
+    COM_CHECK_BOSS, 6, 0x6F,
+    COM_NEXT_ANOTHER_MENU, 6, 3,
+    COM_END,
+};
 
-    case 3:
-        Wait(wk, 5);
-        break;
+static const s16 Passive02_0013[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0014[] = {
+    COM_VS_JUMP_GUARD,
+    COM_END,
+};
 
-void Passive02_0094(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 3, 0x3C);
-        break;
+static const s16 Passive02_0015[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0016[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Passive02_0095(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0xD, 0x3B);
-        break;
+static const s16 Passive02_0017[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0018[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_EM_TERM, -0x7FB0, -1, 5, 6, 0x1C,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-void Passive02_0096(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0xF, 0x3C);
-        break;
+static const s16 Passive02_0019[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0020[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-void Passive02_0097(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0xF, 0);
-        break;
+static const s16 Passive02_0021[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0022[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_JUMP_ATTACK_TERM, -0x7F90, -0x7FC0, 8, 0x400, 0, -0x7F68, -1, 0x400,
+    COM_END,
+};
 
-void Passive02_0098(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 3, 0x3C);
-        break;
+static const s16 Passive02_0023[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC8, 8, 0x40, 0, -0x7F78, -1, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0024[] = {
+    COM_APPROACH_WALK, 0xBF, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-void Passive02_0099(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x11, 0x3C);
-        break;
+static const s16 Passive02_0025[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_EM_TERM, 0x7FFF, -1, 1, 1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0026[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_EM_TERM, 0x7FFF, -1, 1, 1, -1,
+    COM_END,
+};
 
-void Passive02_0100(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FA0, 0, 2, 0);
-        break;
+static const s16 Passive02_0027[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive02_0028[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0029[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-void Passive02_0101(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, 0x30, 0, 1, -1);
-        break;
+static const s16 Passive02_0030[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive02_0031[] = {
+    COM_WALK, 1, 0x20, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0032[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Passive02_0102(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, 0x30, 0, 1, -1);
-        break;
+static const s16 Passive02_0033[] = {
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_END,
+};
 
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x200, 0, -0x7F70, -1, 0x20);
-        break;
+static const s16 Passive02_0034[] = {
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_END,
+};
 
-void Passive02_0103(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F88, -0x7FC0, 0, 1, -1);
-        break;
+static const s16 Passive02_0036[] = {
+    COM_WAIT, 0,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Passive02_0037[] = {
+    COM_EM_TERM, -1, -0x7FF8, 0, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0038[] = {
+    COM_EM_TERM, -1, -0x7FF8, 0, 1, -1,
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_END,
+};
 
-void Passive02_0104(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F88, -0x7FC0, 0, 1, -1);
-        break;
+static const s16 Passive02_0039[] = {
+    COM_EM_TERM, -1, -0x7FD0, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Passive02_0040[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7FF0, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0041[] = {
+    COM_EM_TERM, -1, -0x7FF0, 0, 6, 0x1F,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive02_0105(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F88, -0x7FC0, 0, 1, -1);
-        break;
+static const s16 Passive02_0042[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0xFFFF, 0x36, 0xFFFF, 0x47);
-        break;
+static const s16 Passive02_0043[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_EM_TERM, -1, -0x7FD0, 0, 6, 0x1F,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive02_0044[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_EM_TERM, -1, -0x7FF8, 3, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0045[] = {
+    COM_CHECK_BOSS, 6, 0x70,
+    COM_NEXT_ANOTHER_MENU, 6, 3,
+    COM_END,
+};
 
-void Passive02_0106(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 9);
-        break;
+static const s16 Passive02_0046[] = {
+    COM_KEEP_STATUS, 2, -1,
+    COM_END,
+};
 
-    case 1:
-        Pierce_On(wk);
-        break;
+static const s16 Passive02_0047[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
+static const s16 Passive02_0048[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 3:
-        Com_Random_Select(wk, 6, 0xB, 2, 0xC, 0x5A, 1);
-        break;
+static const s16 Passive02_0049[] = {
+    COM_EM_TERM, -0x7FB0, -1, 5, 6, 0x1F,
+    COM_ADJUST_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0050[] = {
+    COM_EM_TERM, -0x7FB0, -1, 5, 6, 0x1F,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Passive02_0107(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 6, 7, 0x67, 8, 0x68, 1);
-        break;
+static const s16 Passive02_0051[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0052[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Passive02_0108(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 6, 9, 0x69, 9, 0x69, 1);
-        break;
+static const s16 Passive02_0053[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0054[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-void Passive02_0109(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive02_0055[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 0xC, 0, -1, -1);
-        break;
+static const s16 Passive02_0056[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x40, 8, 0x400, 0, -0x7F68, -1, 0x400,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive02_0057[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC8, 8, 0x100, 0, -0x7F78, -1, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0058[] = {
+    COM_KEEP_STATUS, 2, 1,
+    COM_END,
+};
 
-void Passive02_0110(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_BOSS(wk, 6, 0x6A);
-        break;
+static const s16 Passive02_0059[] = {
+    COM_EM_TERM, -0x7FB0, -1, 5, 6, 0x1F,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Next_Another_Menu(wk, 6, 3);
-        break;
+static const s16 Passive02_0060[] = {
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0061[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-void Passive02_0111(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F88, -0x7FD0, 0, 2, 0);
-        break;
+static const s16 Passive02_0062[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x200,
+    COM_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive02_0063[] = {
+    COM_SA_TERM, 0x35, 0x36, (s16)0xFFFF, 0x47,
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x19, 0x3C,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0064[] = {
+    COM_APPROACH_WALK, 0x10, 2,
+    COM_EM_TERM, -1, -0x7FE8, 6, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive02_0112(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF0, 0, 6, 0x1F);
-        break;
+static const s16 Passive02_0065[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_NORMAL_ATTACK, 0xB, 0x200,
+    COM_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
+static const s16 Passive02_0066[] = {
+    COM_APPROACH_WALK, 0xBF, 2,
+    COM_SA_TERM, 0x35, 0x36, (s16)0xFFFF, 0x47,
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x19, 0x3C,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0067[] = {
+    COM_WAIT_ATTACK_COMPLETE, 3, 0,
+    COM_END,
+};
 
-void Passive02_0113(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_BOSS_EX(wk, 6, 0x72);
-        break;
+static const s16 Passive02_0068[] = {
+    COM_WAIT_ATTACK_COMPLETE, 3, 1,
+    COM_NEXT_BE_PASSIVE, 0,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 0x4C, 0x37, 0x37, 0x30, 1);
-        break;
+static const s16 Passive02_0069[] = {
+    COM_WAIT_ATTACK_COMPLETE, 3, 1,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, 0x37, 0,
+    COM_WAIT_ATTACK_COMPLETE, 3, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0070[] = {
+    COM_APPROACH_WALK, 0x40, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_WAIT, 10,
+    COM_SA_TERM, 0x35, 0x36, (s16)0xFFFF, 0x47,
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x19, 0x3C,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Passive02_0114(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FD0, -0x7FF0, 5, 6, 1);
-        break;
+static const s16 Passive02_0071[] = {
+    COM_APPROACH_WALK, 0x37, 2,
+    COM_EM_TERM, -1, -0x7FF0, 0, 1, -1,
+    COM_ETC_TERM, 8, 6, 7,
+    COM_CHECK_SA, 6, 7,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 10, -1,
+    COM_WAIT, 1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x20);
-        break;
+static const s16 Passive02_0072[] = {
+    COM_SA_TERM, 0x35, (s16)0xFFFF, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Wait(wk, 5);
-        break;
+static const s16 Passive02_0073[] = {
+    COM_SA_TERM, 0x35, (s16)0xFFFF, 0x37, 0,
+    COM_ADJUST_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 0xA, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    case 3:
-        SA_Term(wk, 0x35, 0x36, 0xFFFF, 0);
-        break;
+static const s16 Passive02_0074[] = {
+    COM_SA_TERM, 0x35, 0x36, (s16)0xFFFF, 0x47,
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x19, 0x3C,
+    COM_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    case 4:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x19, 0x3C);
-        break;
+static const s16 Passive02_0075[] = {
+    COM_EM_TERM, -0x7FC0, -1, 5, 6, 0x1F,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 5:
-        Command_Attack(wk, 0xC, 0x1C, 10, -1);
-        break;
+static const s16 Passive02_0076[] = {
+    COM_EM_TERM, -0x7FB0, -1, 5, 6, 0x1C,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0077[] = {
+    COM_WAIT_ATTACK_COMPLETE, 3, 1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive02_0115(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
+static const s16 Passive02_0078[] = {
+    COM_APPROACH_WALK, 0xBF, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_CHECK_EX, 6, 0x70,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0x1F, 8, 0x700,
+    COM_CHECK_BOSS_EX, 1, (s16)0xFFFF,
+    COM_EM_TERM, -0x7F58, -1, 0, 1, -1,
+    COM_WAIT, 2,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0079[] = {
+    COM_FORCED_GUARD, 2,
+    COM_END,
+};
 
-void Passive02_0116(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F90, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive02_0080[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x42,
+    COM_COMMAND_ATTACK, 0xC, 0x1C, 0xA, -1,
+    COM_WAIT, 5,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive02_0081[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x400,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_COMMAND_ATTACK, 0xC, 0x1D, 10, -1,
+    COM_WAIT, 5,
+    COM_SA_TERM, 0x35, 0x36, (s16)0xFFFF, 0x47,
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x19, 0x3C,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0082[] = {
+    COM_APPROACH_WALK, 0x10, 2,
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_COMMAND_ATTACK, 0xC, 0x1D, 10, -1,
+    COM_WAIT, 5,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_END,
+};
 
-void Passive02_0117(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive02_0083[] = {
+    COM_ETC_TERM, 4, 6, 0x2A,
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-    case 1:
-        Jump(wk, 0);
-        break;
+static const s16 Passive02_0084[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 9, 0x100, 1, -0x7FB0, -1, 0x20,
+    COM_END,
+};
 
-    case 2:
-        Com_Random_Select(wk, 6, 0x20, 0x21, 0x40, 0x78, 4);
-        break;
+static const s16 Passive02_0085[] = {
+    COM_NORMAL_ATTACK, 8, 0x220,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0086[] = {
+    COM_KEEP_AWAY, 0xBF, 0,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-void Passive02_0118(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
+static const s16 Passive02_0087[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2E, 8, 0x700, -0x7FA0, 0x48, 0, 0x700, 0x30, 0x20,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Passive02_0088[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0089[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_BRANCH_UNIT_AREA, 6, 0x20, 0x3B, 0x36, 0x5A,
+    COM_END,
+};
 
-void Passive02_0119(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
+static const s16 Passive02_0090[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
+static const s16 Passive02_0091[] = {
+    COM_EM_TERM, -0x7FB0, -0x7FF0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 0xC, 0x1D, 0xA, -1,
+    COM_WAIT, 5,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, 0x37, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0092[] = {
+    COM_EM_TERM, -1, -0x7FF0, 0, 1, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x60, 0x61, 0x62, 99, 1,
+    COM_END,
+};
 
-void Passive02_0120(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
+static const s16 Passive02_0093[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x400,
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_COMMAND_ATTACK, 0xC, 0x1D, 0xA, -1,
+    COM_WAIT, 5,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Passive02_0094[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 3, 0x3C,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0095[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0xD, 0x3B,
+    COM_END,
+};
 
-void Passive02_0121(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F90, -0x7FC0, 0xB, 0x400, 0, -0x7FB0, -1, 0x20);
-        break;
+static const s16 Passive02_0096[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0xF, 0x3C,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, -0x8000, 4, 1, -1);
-        break;
+static const s16 Passive02_0097[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0xF, 0,
+    COM_END,
+};
 
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0x7F);
-        break;
+static const s16 Passive02_0098[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 3, 0x3C,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive02_0099[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x11, 0x3C,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0100[] = {
+    COM_EM_TERM, -1, -0x7FA0, 0, 2, 0,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive02_0122(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x1E, 10, -1, -1, 0x30, 0, -1, -1, 0xFFFF);
-        break;
+static const s16 Passive02_0101[] = {
+    COM_EM_TERM, -1, 0x30, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0102[] = {
+    COM_EM_TERM, -1, 0x30, 0, 1, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x200, 0, -0x7F70, -1, 0x20,
+    COM_END,
+};
 
-void Passive02_0123(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive02_0103[] = {
+    COM_EM_TERM, -0x7F88, -0x7FC0, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, 0x700);
-        break;
+static const s16 Passive02_0104[] = {
+    COM_EM_TERM, -0x7F88, -0x7FC0, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive02_0105[] = {
+    COM_EM_TERM, -0x7F88, -0x7FC0, 0, 1, -1,
+    COM_SA_TERM, (s16)0xFFFF, 0x36, (s16)0xFFFF, 0x47,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0106[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 9,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_COM_RANDOM_SELECT, 6, 0xB, 2, 0xC, 0x5A, 1,
+    COM_END,
+};
 
-void Passive02_0124(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 1);
-        break;
+static const s16 Passive02_0107[] = {
+    COM_COM_RANDOM_SELECT, 6, 7, 0x67, 8, 0x68, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0108[] = {
+    COM_COM_RANDOM_SELECT, 6, 9, 0x69, 9, 0x69, 1,
+    COM_END,
+};
 
-void Passive02_0125(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, -1);
-        break;
+static const s16 Passive02_0109[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, -1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 0x36, 0x7E, 0x37, 0x6D, 3);
-        break;
+static const s16 Passive02_0110[] = {
+    COM_CHECK_BOSS, 6, 0x6A,
+    COM_NEXT_ANOTHER_MENU, 6, 3,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0111[] = {
+    COM_EM_TERM, -0x7F88, -0x7FD0, 0, 2, 0,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive02_0126(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
+static const s16 Passive02_0112[] = {
+    COM_EM_TERM, -1, -0x7FF0, 0, 6, 0x1F,
+    COM_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Look(wk, 0);
-        break;
+static const s16 Passive02_0113[] = {
+    COM_CHECK_BOSS_EX, 6, 0x72,
+    COM_COM_RANDOM_SELECT, 6, 0x4C, 0x37, 0x37, 0x30, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0114[] = {
+    COM_EM_TERM, -0x7FD0, -0x7FF0, 5, 6, 1,
+    COM_NORMAL_ATTACK, 9, 0x20,
+    COM_WAIT, 5,
+    COM_SA_TERM, 0x35, 0x36, (s16)0xFFFF, 0,
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x19, 0x3C,
+    COM_COMMAND_ATTACK, 0xC, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive02_0127(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F90, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive02_0115[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
+static const s16 Passive02_0116[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F90, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive02_0117[] = {
+    COM_PIERCE_ON,
+    COM_JUMP, 0,
+    COM_COM_RANDOM_SELECT, 6, 0x20, 0x21, 0x40, 0x78, 4,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0118[] = {
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Passive02_0128(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive02_0119[] = {
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Passive02_0120[] = {
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0121[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F90, -0x7FC0, 0xB, 0x400, 0, -0x7FB0, -1, 0x20,
+    COM_EM_TERM, -1, -0x8000, 4, 1, -1,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0x7F,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive02_0129(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive02_0122[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x1E, 10, -1, -1, 0x30, 0, -1, -1, (s16)0xFFFF,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0123[] = {
+    COM_PIERCE_ON,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, 0x700,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive02_0130(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
+static const s16 Passive02_0124[] = {
+    COM_KEEP_AWAY, 0xBF, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0125[] = {
+    COM_WALK, 1, 0x20, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x36, 0x7E, 0x37, 0x6D, 3,
+    COM_END,
+};
 
-void Passive02_0131(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x40, 0, -1, -1, 0xFFFF);
-        break;
+static const s16 Passive02_0126[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0127[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F90, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive02_0132(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive02_0128[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
+static const s16 Passive02_0129[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
+static const s16 Passive02_0130[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 9, 0x402);
-        break;
+static const s16 Passive02_0131[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x40, 0, -1, -1, (s16)0xFFFF,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive02_0132[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x402,
+    COM_END,
+};
 
-void (*const Passive02_Tbl[133])(PLW*) = {
+const s16* const Passive02_Tbl[133] = {
     Passive02_0000, Passive02_0001, Passive02_0002, Passive02_0003, Passive02_0004, Passive02_0005, Passive02_0006,
     Passive02_0007, Passive02_0008, Passive02_0009, Passive02_0010, Passive02_0011, Passive02_0012, Passive02_0013,
     Passive02_0014, Passive02_0015, Passive02_0016, Passive02_0017, Passive02_0018, Passive02_0019, Passive02_0020,
@@ -2295,3 +860,7 @@ void (*const Passive02_Tbl[133])(PLW*) = {
     Passive02_0119, Passive02_0120, Passive02_0121, Passive02_0122, Passive02_0123, Passive02_0124, Passive02_0125,
     Passive02_0126, Passive02_0127, Passive02_0128, Passive02_0129, Passive02_0130, Passive02_0131, Passive02_0132
 };
+
+void Passive02(PLW* wk) {
+    Exec_Com_Pattern(wk, Passive02_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
@@ -5,2388 +5,875 @@
 
 #include "sf33rd/Source/Game/com/passive/pass03.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Passive03_Tbl[136])();
-
-void Passive03(PLW* wk) {
-    Passive03_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Passive03_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xD, M_Lv[wk->wu.id]);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0, 10, -1);
-        break;
-
-    case 3:
-        EM_Term(wk, 0x7FFF, -1, 1, 1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        VS_Jump_Guard(wk);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 6, 0x53);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x77, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, 0x7FFF, -1, 1, 1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xB7, 2);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, 0xB, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, 0, 0, 2, 0);
-        break;
-
-    case 1:
-        Short_Range_Attack(wk, 8, 0x40, 6, 0x1D);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -1, 8, 0x8400, 2, -0x7FA0, -1, 0x8400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, 0, 0, 2, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x30, 0);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        SA_Term(wk, 0xFFFF, 0x2F, 0xFFFF, 0);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    case 5:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    case 6:
-        Com_Random_Select(wk, 6, 0x37, 0x37, 0x27, 0x27, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -0x7FB0, 0, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x2F, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 5:
-        Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 6, 0x6C);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Keep_Away(wk, 0x81, 0);
-        break;
-
-    case 3:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 0xB, 0x100);
-        break;
-
-    case 5:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    case 6:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 7:
-        Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x39, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 0xB, 0x100, 0, -0x7FA0, -1, 0x40);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA0, -1, 0xB, 0x8100, 0, -0x7FA0, -1, 0x40);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 6, 0x6C);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Keep_Away(wk, 0x81, 0);
-        break;
-
-    case 3:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 6, 0x68);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Keep_Away(wk, 0x81, 0);
-        break;
-
-    case 3:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -1, 8, 0x8400, 2, -0x7FA0, -1, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x2E, 0x2F, 0xFFFF, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x22);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x20);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF8, 6, 1, -1);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 0, 2, 0x42);
-        break;
-
-    case 1:
-        Branch_Unit_Area(wk, 6, 0x59, 0x5A, 0x5A, 0x5B);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FA0, -0x7FF8, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -1, 8, 0x8400, 2, -0x7FA0, -1, -0x7C00);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FD8, 6, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x39, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FE0, 6, 1, -1);
-        break;
-
-    case 1:
-        Branch_Unit_Area(wk, 6, 0x59, 0x5A, 0x5B, 0x5B);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Status(wk, 2, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 1:
-        Branch_Unit_Area(wk, 6, 0x59, 0x5A, 0x5B, 0x5B);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x22);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x220);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -1, 8, 0x8400, 2, -0x7FA0, -1, -0x7C00);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -1, 8, 0x8400, 2, -0x7FA0, -1, 0x8400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x40, 0, -0x7FA0, -1, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x20, 0, -0x7FA0, -1, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Status(wk, 2, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0x2F, 0x30, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x2F, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x20);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x2F, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x100);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 0, 6, 0x40);
-        break;
-
-    case 1:
-        Branch_Unit_Area(wk, 6, 0x59, 0x5A, 0x5A, 0x5B);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x40, 0, -0x7FA0, -1, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xC, 0, 0xB, -1);
-        break;
-
-    case 1:
-        Branch_Unit_Area(wk, 6, 0x59, 0x5A, 0x5B, 0x5B);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x2F, 2);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, 0xB, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xB7, 2);
-        break;
-
-    case 1:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -1, 0xB, 0x8400, 0, -0x7FA0, -1, 0x40);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x2E, 0x2F, 0x30, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 4:
-        Com_Random_Select(wk, 6, 0x37, 0x37, 0x27, 0x27, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x30, 0);
-        break;
-
-    case 1:
-        Approach_Walk(wk, 0x2F, 2);
-        break;
-
-    case 2:
-        SA_Term(wk, 0xFFFF, 0x2F, 0xFFFF, 0);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    case 5:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 6:
-        Com_Random_Select(wk, 6, 0x37, 0x37, 0x27, 0x27, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0076(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x30, 0);
-        break;
-
-    case 1:
-        Approach_Walk(wk, 0xB7, 2);
-        break;
-
-    case 2:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -1, 8, 0x8400, 0, -0x7FA0, -1, 0x40);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    case 5:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 6:
-        Com_Random_Select(wk, 6, 0x37, 0x37, 0x27, 0x27, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0077(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 0xB, 0x20, 0, -0x7FA0, -1, 0x40);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0078(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FB0, -1, 8, 0x8400, 0, -0x7FA0, -1, 0x40);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0079(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 0xB, 0x20, 0, -1, -1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0080(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 0xB, 0x40, 0, -0x7FA0, -1, 0x40);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0081(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -1, 0xB, 0x8200, 0, -0x7FA0, -1, 0x40);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0082(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 0xB, 0x40, 0, -1, -1, 0xFFFF);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0083(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 0xB, 0x40, 0, -0x7FA0, -1, 0x40);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0084(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -1, 8, 0x8400, 0, -0x7FA0, -1, 0x40);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 4:
-        Com_Random_Select(wk, 6, 0x37, 0x37, 0x27, 0x27, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0085(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 10);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0086(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x2F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 6, 1, -1);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x2E, 0x2F, 0xFFFF, 0);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 5:
-        Com_Random_Select(wk, 6, 0x37, 0x37, 0x27, 0x27, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0087(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x2F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 6, 1, -1);
-        break;
-
-    case 2:
-        SA_Term(wk, 0xFFFF, 0x2F, 0xFFFF, 0);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    case 5:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 6:
-        Com_Random_Select(wk, 6, 0x37, 0x37, 0x27, 0x27, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive03_0088(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FD8, 6, 1, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x30, 0);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 5:
-        Com_Random_Select(wk, 6, 0x37, 0x37, 0x27, 0x27, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0000[] = {
+    COM_NORMAL_ATTACK_M_LV, 0xD,
+    COM_END,
+};
 
-void Passive03_0089(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
+static const s16 Passive03_0001[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0002[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, 10, -1,
+    COM_EM_TERM, 0x7FFF, -1, 1, 1, -1,
+    COM_END,
+};
 
-void Passive03_0090(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
+static const s16 Passive03_0003[] = {
+    COM_VS_JUMP_GUARD,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0004[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 6, 0x53,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-void Passive03_0091(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
+static const s16 Passive03_0005[] = {
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0006[] = {
+    COM_APPROACH_WALK, 0x77, 2,
+    COM_EM_TERM, 0x7FFF, -1, 1, 1, -1,
+    COM_END,
+};
 
-void Passive03_0092(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FE0, 6, 1, -1);
-        break;
+static const s16 Passive03_0007[] = {
+    COM_APPROACH_WALK, 0xB7, 2,
+    COM_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Branch_Unit_Area(wk, 6, 0x59, 0x5A, 0x5B, 0x5B);
-        break;
+static const s16 Passive03_0008[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, 0xB, -1,
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0009[] = {
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Passive03_0093(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Passive03_0010[] = {
+    COM_EM_TERM, -0x7F80, 0, 0, 2, 0,
+    COM_SHORT_RANGE_ATTACK, 8, 0x40, 6, 0x1D,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Passive03_0011[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -1, 8, (s16)0x8400, 2, -0x7FA0, -1, (s16)0x8400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0012[] = {
+    COM_EM_TERM, -0x7F90, 0, 0, 2, 0,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-void Passive03_0094(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 6, 0x59, 0x5A, 0x5B, 1);
-        break;
+static const s16 Passive03_0013[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x30, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_SA_TERM, (s16)0xFFFF, 0x2F, (s16)0xFFFF, 0,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_COM_RANDOM_SELECT, 6, 0x37, 0x37, 0x27, 0x27, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0014[] = {
+    COM_EM_TERM, -0x7FB0, -0x7FB0, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Passive03_0095(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x30, 0);
-        break;
+static const s16 Passive03_0015[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    case 1:
-        Branch_Unit_Area(wk, 6, 0x59, 0x5A, 0x5B, 0x5B);
-        break;
+static const s16 Passive03_0016[] = {
+    COM_APPROACH_WALK, 0x2F, 2,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0017[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 6, 0x6C,
+    COM_PIERCE_ON,
+    COM_KEEP_AWAY, 0x81, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-void Passive03_0096(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
+static const s16 Passive03_0018[] = {
+    COM_APPROACH_WALK, 0x39, 2,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive03_0019[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0020[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-void Passive03_0097(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x2F, 2);
-        break;
+static const s16 Passive03_0021[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 6, 1, -1);
-        break;
+static const s16 Passive03_0022[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 0xB, 0x100, 0, -0x7FA0, -1, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
+static const s16 Passive03_0023[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -1, 0xB, (s16)0x8100, 0, -0x7FA0, -1, 0x40,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0024[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 6, 0x6C,
+    COM_PIERCE_ON,
+    COM_KEEP_AWAY, 0x81, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive03_0098(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x2F, 2);
-        break;
+static const s16 Passive03_0025[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 6, 0x68,
+    COM_PIERCE_ON,
+    COM_KEEP_AWAY, 0x81, 0,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
+static const s16 Passive03_0026[] = {
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
+static const s16 Passive03_0027[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 8, 0x20);
-        break;
+static const s16 Passive03_0028[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -1, 8, (s16)0x8400, 2, -0x7FA0, -1, 0x400,
+    COM_END,
+};
 
-    case 4:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
+static const s16 Passive03_0029[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    case 5:
-        Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
+static const s16 Passive03_0030[] = {
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0031[] = {
+    COM_WALK, 1, 0x20, 1,
+    COM_END,
+};
 
-void Passive03_0099(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
+static const s16 Passive03_0032[] = {
+    COM_SA_TERM, 0x2E, 0x2F, (s16)0xFFFF, 0,
+    COM_NORMAL_ATTACK, 0xB, 0x22,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
+static const s16 Passive03_0033[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
+static const s16 Passive03_0034[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x20,
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_END,
+};
 
-    case 3:
-        Com_Random_Select(wk, 6, 0x37, 0x37, 0x27, 0x27, 0);
-        break;
+static const s16 Passive03_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0036[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Passive03_0100(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x30, 0);
-        break;
+static const s16 Passive03_0037[] = {
+    COM_EM_TERM, -1, -0x7FF8, 6, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
+static const s16 Passive03_0038[] = {
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
+static const s16 Passive03_0039[] = {
+    COM_ETC_TERM, 0, 2, 0x42,
+    COM_BRANCH_UNIT_AREA, 6, 0x59, 0x5A, 0x5A, 0x5B,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0040[] = {
+    COM_EM_TERM, -0x7FA0, -0x7FF8, 6, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive03_0101(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
+static const s16 Passive03_0041[] = {
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
+static const s16 Passive03_0042[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -1, 8, (s16)0x8400, 2, -0x7FA0, -1, -0x7C00,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0043[] = {
+    COM_EM_TERM, -1, -0x7FD8, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-void Passive03_0102(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -0x7FB0, 6, 1, -1);
-        break;
+static const s16 Passive03_0044[] = {
+    COM_APPROACH_WALK, 0x39, 2,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
+static const s16 Passive03_0045[] = {
+    COM_EM_TERM, -1, -0x7FE0, 6, 1, -1,
+    COM_BRANCH_UNIT_AREA, 6, 0x59, 0x5A, 0x5B, 0x5B,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x20, 10, -1);
-        break;
+static const s16 Passive03_0046[] = {
+    COM_KEEP_STATUS, 2, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0047[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_BRANCH_UNIT_AREA, 6, 0x59, 0x5A, 0x5B, 0x5B,
+    COM_END,
+};
 
-void Passive03_0103(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 6, 0x68);
-        break;
+static const s16 Passive03_0048[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x20, 0);
-        break;
+static const s16 Passive03_0049[] = {
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    case 2:
-        Wait_Get_Up(wk, 0, -1);
-        break;
+static const s16 Passive03_0050[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0051[] = {
+    COM_NORMAL_ATTACK, 8, 0x220,
+    COM_END,
+};
 
-void Passive03_0104(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump(wk, 3, 0);
-        break;
+static const s16 Passive03_0052[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0053[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -1, 8, (s16)0x8400, 2, -0x7FA0, -1, -0x7C00,
+    COM_END,
+};
 
-void Passive03_0105(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 6, 0x68);
-        break;
+static const s16 Passive03_0054[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -1, 8, (s16)0x8400, 2, -0x7FA0, -1, (s16)0x8400,
+    COM_END,
+};
 
-    case 1:
-        Pierce_On(wk);
-        break;
+static const s16 Passive03_0055[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 1, 10, -1);
-        break;
+static const s16 Passive03_0056[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x40, 0, -0x7FA0, -1, 0x40,
+    COM_END,
+};
 
-    case 3:
-        Wait_Get_Up(wk, 3, -1);
-        break;
+static const s16 Passive03_0057[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x20, 0, -0x7FA0, -1, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0058[] = {
+    COM_KEEP_STATUS, 2, 1,
+    COM_END,
+};
 
-void Passive03_0106(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x70, 6, 0x68);
-        break;
+static const s16 Passive03_0059[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x38, 0);
-        break;
+static const s16 Passive03_0060[] = {
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-    case 2:
-        Wait_Get_Up(wk, 0, -1);
-        break;
+static const s16 Passive03_0061[] = {
+    COM_SA_TERM, (s16)0xFFFF, 0x2F, 0x30, 0,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0062[] = {
+    COM_APPROACH_WALK, 0x2F, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Passive03_0107(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x2E, 0x2F, 0x30, 0);
-        break;
+static const s16 Passive03_0063[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x20,
+    COM_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 0x37, 0x37, 0x27, 0x27, 0);
-        break;
+static const s16 Passive03_0064[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0065[] = {
+    COM_APPROACH_WALK, 0x2F, 2,
+    COM_NORMAL_ATTACK, 0xC, 0x100,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Passive03_0108(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xB7, 2);
-        break;
+static const s16 Passive03_0066[] = {
+    COM_ETC_TERM, 0, 6, 0x40,
+    COM_BRANCH_UNIT_AREA, 6, 0x59, 0x5A, 0x5A, 0x5B,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0067[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 10, -1,
+    COM_END,
+};
 
-void Passive03_0109(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x2E, 0xFFFF, 0x30, 0);
-        break;
+static const s16 Passive03_0068[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x40, 0, -0x7FA0, -1, 0x40,
+    COM_END,
+};
 
-    case 1:
-        Branch_Unit_Area(wk, 6, 0x59, 0x5A, 0x5B, 0x5B);
-        break;
+static const s16 Passive03_0069[] = {
+    COM_COMMAND_ATTACK, 0xC, 0, 0xB, -1,
+    COM_BRANCH_UNIT_AREA, 6, 0x59, 0x5A, 0x5B, 0x5B,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0070[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Passive03_0110(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x20);
-        break;
+static const s16 Passive03_0071[] = {
+    COM_APPROACH_WALK, 0x2F, 2,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0x2E, 0x2F, 0xFFFF, 0);
-        break;
+static const s16 Passive03_0072[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, 0xB, -1,
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        Com_Random_Select(wk, 6, 0x37, 0x37, 0x27, 0x27, 0);
-        break;
+static const s16 Passive03_0073[] = {
+    COM_APPROACH_WALK, 0xB7, 2,
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -1, 0xB, (s16)0x8400, 0, -0x7FA0, -1, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0074[] = {
+    COM_SA_TERM, 0x2E, 0x2F, 0x30, 0,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COM_RANDOM_SELECT, 6, 0x37, 0x37, 0x27, 0x27, 0,
+    COM_END,
+};
 
-void Passive03_0111(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
+static const s16 Passive03_0075[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x30, 0,
+    COM_APPROACH_WALK, 0x2F, 2,
+    COM_SA_TERM, (s16)0xFFFF, 0x2F, (s16)0xFFFF, 0,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COM_RANDOM_SELECT, 6, 0x37, 0x37, 0x27, 0x27, 0,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
+static const s16 Passive03_0076[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x30, 0,
+    COM_APPROACH_WALK, 0xB7, 2,
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -1, 8, (s16)0x8400, 0, -0x7FA0, -1, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COM_RANDOM_SELECT, 6, 0x37, 0x37, 0x27, 0x27, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0077[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 0xB, 0x20, 0, -0x7FA0, -1, 0x40,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive03_0112(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
+static const s16 Passive03_0078[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FB0, -1, 8, (s16)0x8400, 0, -0x7FA0, -1, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
+static const s16 Passive03_0079[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 0xB, 0x20, 0, -1, -1, -1,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
+static const s16 Passive03_0080[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 0xB, 0x40, 0, -0x7FA0, -1, 0x40,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0081[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -1, 0xB, (s16)0x8200, 0, -0x7FA0, -1, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-void Passive03_0113(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, 0x20, 6, 1, -1);
-        break;
+static const s16 Passive03_0082[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 0xB, 0x40, 0, -1, -1, (s16)0xFFFF,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
+static const s16 Passive03_0083[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 0xB, 0x40, 0, -0x7FA0, -1, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0084[] = {
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -1, 8, (s16)0x8400, 0, -0x7FA0, -1, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COM_RANDOM_SELECT, 6, 0x37, 0x37, 0x27, 0x27, 0,
+    COM_END,
+};
 
-void Passive03_0114(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x20, 8, 0x400, 1, -1, 0x20, 0x400);
-        break;
+static const s16 Passive03_0085[] = {
+    COM_WAIT, 10,
+    COM_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0086[] = {
+    COM_APPROACH_WALK, 0x2F, 2,
+    COM_EM_TERM, -1, -0x7FF8, 6, 1, -1,
+    COM_SA_TERM, 0x2E, 0x2F, (s16)0xFFFF, 0,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_COM_RANDOM_SELECT, 6, 0x37, 0x37, 0x27, 0x27, 0,
+    COM_END,
+};
 
-void Passive03_0115(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x220);
-        break;
+static const s16 Passive03_0087[] = {
+    COM_APPROACH_WALK, 0x2F, 2,
+    COM_EM_TERM, -1, -0x7FF8, 6, 1, -1,
+    COM_SA_TERM, (s16)0xFFFF, 0x2F, (s16)0xFFFF, 0,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COM_RANDOM_SELECT, 6, 0x37, 0x37, 0x27, 0x27, 0,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
+static const s16 Passive03_0088[] = {
+    COM_EM_TERM, -1, -0x7FD8, 6, 1, -1,
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x30, 0,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COM_RANDOM_SELECT, 6, 0x37, 0x37, 0x27, 0x27, 0,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
+static const s16 Passive03_0089[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0090[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-void Passive03_0116(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x20, 8, 0x400, 0, -1, 0x20, 0x400);
-        break;
+static const s16 Passive03_0091[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0092[] = {
+    COM_EM_TERM, -1, -0x7FE0, 6, 1, -1,
+    COM_BRANCH_UNIT_AREA, 6, 0x59, 0x5A, 0x5B, 0x5B,
+    COM_END,
+};
 
-void Passive03_0117(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x20, 8, 0x200, 1, -1, 0x20, 0x200);
-        break;
+static const s16 Passive03_0093[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0094[] = {
+    COM_BRANCH_UNIT_AREA, 6, 0x59, 0x5A, 0x5B, 1,
+    COM_END,
+};
 
-void Passive03_0118(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x20, 8, 0x200, 0, -1, 0x20, 0x200);
-        break;
+static const s16 Passive03_0095[] = {
+    COM_WALK, 1, 0x30, 0,
+    COM_BRANCH_UNIT_AREA, 6, 0x59, 0x5A, 0x5B, 0x5B,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0096[] = {
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive03_0119(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive03_0097[] = {
+    COM_APPROACH_WALK, 0x2F, 2,
+    COM_EM_TERM, -1, -0x7FF8, 6, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0098[] = {
+    COM_APPROACH_WALK, 0x2F, 2,
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-void Passive03_0120(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xD, 0x100);
-        break;
+static const s16 Passive03_0099[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COM_RANDOM_SELECT, 6, 0x37, 0x37, 0x27, 0x27, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0100[] = {
+    COM_WALK, 1, 0x30, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_END,
+};
 
-void Passive03_0121(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 6, 0x7A, 0x7B, 0x7C, 0x7D);
-        break;
+static const s16 Passive03_0101[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0102[] = {
+    COM_EM_TERM, -0x7FB0, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_COMMAND_ATTACK, 8, 0x20, 10, -1,
+    COM_END,
+};
 
-void Passive03_0122(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
+static const s16 Passive03_0103[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 6, 0x68,
+    COM_WALK, 1, 0x20, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0104[] = {
+    COM_HI_JUMP, 3, 0,
+    COM_END,
+};
 
-void Passive03_0123(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
+static const s16 Passive03_0105[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 6, 0x68,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 10, -1,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0106[] = {
+    COM_SEARCH_BACK_TERM, 0x70, 6, 0x68,
+    COM_WALK, 1, 0x38, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-void Passive03_0124(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
+static const s16 Passive03_0107[] = {
+    COM_SA_TERM, 0x2E, 0x2F, 0x30, 0,
+    COM_COM_RANDOM_SELECT, 6, 0x37, 0x37, 0x27, 0x27, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0108[] = {
+    COM_APPROACH_WALK, 0xB7, 2,
+    COM_END,
+};
 
-void Passive03_0125(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 0xB, 0x70);
-        break;
+static const s16 Passive03_0109[] = {
+    COM_SA_TERM, 0x2E, (s16)0xFFFF, 0x30, 0,
+    COM_BRANCH_UNIT_AREA, 6, 0x59, 0x5A, 0x5B, 0x5B,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0110[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x20,
+    COM_SA_TERM, 0x2E, 0x2F, (s16)0xFFFF, 0,
+    COM_COM_RANDOM_SELECT, 6, 0x37, 0x37, 0x27, 0x27, 0,
+    COM_END,
+};
 
-void Passive03_0126(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, -1);
-        break;
+static const s16 Passive03_0111[] = {
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0112[] = {
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_END,
+};
 
-void Passive03_0127(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive03_0113[] = {
+    COM_EM_TERM, -1, 0x20, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xD, 0x402);
-        break;
+static const s16 Passive03_0114[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x20, 8, 0x400, 1, -1, 0x20, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0115[] = {
+    COM_NORMAL_ATTACK, 8, 0x220,
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-void Passive03_0128(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 0xB, 0x70);
-        break;
+static const s16 Passive03_0116[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x20, 8, 0x400, 0, -1, 0x20, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0117[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x20, 8, 0x200, 1, -1, 0x20, 0x200,
+    COM_END,
+};
 
-void Passive03_0129(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 0xB, 0x700);
-        break;
+static const s16 Passive03_0118[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x20, 8, 0x200, 0, -1, 0x20, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0119[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive03_0130(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, -1);
-        break;
+static const s16 Passive03_0120[] = {
+    COM_NORMAL_ATTACK, 0xD, 0x100,
+    COM_END,
+};
 
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
+static const s16 Passive03_0121[] = {
+    COM_BRANCH_UNIT_AREA, 6, 0x7A, 0x7B, 0x7C, 0x7D,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0122[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-void Passive03_0131(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
+static const s16 Passive03_0123[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 0xB, 0x70);
-        break;
+static const s16 Passive03_0124[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0125[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xB, 0x70,
+    COM_END,
+};
 
-void Passive03_0132(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
+static const s16 Passive03_0126[] = {
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x20, 0xB, 0x70);
-        break;
+static const s16 Passive03_0127[] = {
+    COM_PIERCE_ON,
+    COM_NORMAL_ATTACK, 0xD, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0128[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 0xB, 0x70,
+    COM_END,
+};
 
-void Passive03_0133(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
+static const s16 Passive03_0129[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xB, 0x700,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 0xB, 0x700);
-        break;
+static const s16 Passive03_0130[] = {
+    COM_PROVOKE, -1,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0131[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 0xB, 0x70,
+    COM_END,
+};
 
-void Passive03_0134(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 1);
-        break;
+static const s16 Passive03_0132[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x20, 0xB, 0x70,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0133[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xB, 0x700,
+    COM_END,
+};
 
-void Passive03_0135(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
+static const s16 Passive03_0134[] = {
+    COM_JUMP, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive03_0135[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-void (*const Passive03_Tbl[136])(PLW*) = {
+const s16* const Passive03_Tbl[136] = {
     Passive03_0000, Passive03_0001, Passive03_0002, Passive03_0003, Passive03_0004, Passive03_0005, Passive03_0006,
     Passive03_0007, Passive03_0008, Passive03_0009, Passive03_0010, Passive03_0011, Passive03_0012, Passive03_0013,
     Passive03_0014, Passive03_0015, Passive03_0016, Passive03_0017, Passive03_0018, Passive03_0019, Passive03_0020,
@@ -2408,3 +895,7 @@ void (*const Passive03_Tbl[136])(PLW*) = {
     Passive03_0126, Passive03_0127, Passive03_0128, Passive03_0129, Passive03_0130, Passive03_0131, Passive03_0132,
     Passive03_0133, Passive03_0134, Passive03_0135
 };
+
+void Passive03(PLW* wk) {
+    Exec_Com_Pattern(wk, Passive03_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
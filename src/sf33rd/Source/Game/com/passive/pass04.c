@@ -5,2348 +5,877 @@
 
 #include "sf33rd/Source/Game/com/passive/pass04.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Passive04_Tbl[142])();
-
-void Passive04(PLW* wk) {
-    Passive04_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Passive04_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xD, M_Lv[wk->wu.id]);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 6, 0x58);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xD, 0x20, 0x30A, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 6, 0x58);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F98, -1, 0, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F98, -1, 0, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F98, -1, 0, 1, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0xFFFF, 0xFFFF, 0);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FD0, -0x7FC0, 0, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FD0, 8, 0x200, 0, -0x7F70, -1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, 0, 0, 2, 0);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xD, 0x20, 0x60A, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 6, 0x58);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        VS_Jump_Guard(wk);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 0xD, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x9F, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7F90, -0x7FC0, 8, 0x400, 0, -0x7F68, -1, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x40, 0, -0x7F78, -1, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xDF, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 3:
-        EM_Term(wk, 0x7FFF, -1, 1, 1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x9F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, 0x7FFF, -1, 1, 1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x22);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x10);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x10);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 0, 1, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 0, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FE0, 0, 1, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF0, 0, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 5:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FE8, 0, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x20);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FD8, 0, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 3, 1, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Status(wk, 2, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x22);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x40, 8, 0x400, 0, -0x7F68, -1, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x100, 0, -0x7F78, -1, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Status(wk, 2, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xD, 0x20, 0x60A, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0x36, 0x37, 0);
-        break;
-
-    case 1:
-        Approach_Walk(wk, 0x9F, 2);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0xFFFF, 0xFFFF, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xD, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Attack_Complete(wk, 3, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xDF, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Attack_Complete(wk, 3, 1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0xFFFF, 0x37, 0);
-        break;
-
-    case 2:
-        Wait_Attack_Complete(wk, 3, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x9F, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -0x7FF0, 0, 1, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0xFFFF, 0x36, 0xFFFF, 0);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0xFFFF, 0x37, 0);
-        break;
-
-    case 1:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0xFFFF, 0x37, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xD, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0x36, 0x37, 0);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0xFFFF, 0xFFFF, 0x9F);
-        break;
-
-    case 2:
-        Command_Attack(wk, 0xD, 0x20, 0x30A, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FC0, -1, 5, 6, 0x1F);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x22);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0076(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -1, 5, 6, 0x1C);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0077(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Attack_Complete(wk, 3, 1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0078(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0079(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0080(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xD, 0x20, 0x30A, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0081(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x20, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0082(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0xFFFF, 0x37, 0);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 0xD, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0083(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, 0, 0, 2, 0);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xD, 0x20, 0x609, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0084(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, 0, 0, 2, 0);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xD, 0x20, 0x608, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0085(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, 0, 0, 2, 0);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xD, 0x20, 0x309, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0086(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, 0, 0, 2, 0);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xD, 0x20, 0x308, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0087(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x37, 0);
-        break;
-
-    case 1:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0088(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0089(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Attack_Complete(wk, 3, 1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0xFFFF, 0x36, 0x37, 0);
-        break;
-
-    case 2:
-        Wait_Attack_Complete(wk, 3, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0090(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xD, 0x20, 0x608, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0091(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xD, 0x20, 0x609, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0092(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xD, 0x20, 0x60A, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0093(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0094(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FC0, -0x7FF0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0095(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -0x7FC0, 0, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0096(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -0x7FC0, 0, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0097(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x47, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive04_0098(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_EX(wk, 6, 8);
-        break;
+static const s16 Passive04_0000[] = {
+    COM_NORMAL_ATTACK_M_LV, 0xD,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -0x7FA0, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0001[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 6, 0x58,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 9, 0x70);
-        break;
+static const s16 Passive04_0002[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0003[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-void Passive04_0099(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FD8, 0, 1, -1);
-        break;
+static const s16 Passive04_0004[] = {
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 10, 0x70);
-        break;
+static const s16 Passive04_0005[] = {
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x30A, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0006[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 6, 0x58,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-void Passive04_0100(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, -1);
-        break;
+static const s16 Passive04_0007[] = {
+    COM_EM_TERM, -0x7F98, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0008[] = {
+    COM_EM_TERM, -0x7F98, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Passive04_0101(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
+static const s16 Passive04_0009[] = {
+    COM_EM_TERM, -0x7F98, -1, 0, 1, -1,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x21, 8, -1);
-        break;
+static const s16 Passive04_0010[] = {
+    COM_EM_TERM, -0x7FD0, -0x7FC0, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0011[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FD0, 8, 0x200, 0, -0x7F70, -1, 0x20,
+    COM_END,
+};
 
-void Passive04_0102(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FA0, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0012[] = {
+    COM_EM_TERM, -0x7F90, 0, 0, 2, 0,
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x60A, -1,
+    COM_END,
+};
 
-    case 1:
-        Search_Back_Term(wk, 0x30, 6, 0x6D);
-        break;
+static const s16 Passive04_0013[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 6, 0x58,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x21, 10, -1);
-        break;
+static const s16 Passive04_0014[] = {
+    COM_VS_JUMP_GUARD,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0015[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-void Passive04_0103(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FA0, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0016[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_LEVER_ATTACK, 0xD, 0, 0x200,
+    COM_END,
+};
 
-    case 1:
-        Search_Back_Term(wk, 0x30, 6, 0x6D);
-        break;
+static const s16 Passive04_0017[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x21, 9, 0x700);
-        break;
+static const s16 Passive04_0018[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0019[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-void Passive04_0104(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
+static const s16 Passive04_0020[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x21, 10, 0x700);
-        break;
+static const s16 Passive04_0021[] = {
+    COM_APPROACH_WALK, 0x9F, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0022[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_JUMP_ATTACK_TERM, -0x7F90, -0x7FC0, 8, 0x400, 0, -0x7F68, -1, 0x400,
+    COM_END,
+};
 
-void Passive04_0105(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
+static const s16 Passive04_0023[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x40, 0, -0x7F78, -1, 0x40,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x21, 10, -1);
-        break;
+static const s16 Passive04_0024[] = {
+    COM_APPROACH_WALK, 0xDF, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0025[] = {
+    COM_PIERCE_ON,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_EM_TERM, 0x7FFF, -1, 1, 1, -1,
+    COM_END,
+};
 
-void Passive04_0106(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
+static const s16 Passive04_0026[] = {
+    COM_APPROACH_WALK, 0x9F, 2,
+    COM_EM_TERM, 0x7FFF, -1, 1, 1, -1,
+    COM_END,
+};
 
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
+static const s16 Passive04_0027[] = {
+    COM_NORMAL_ATTACK, 9, 0x22,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x21, 10, -1);
-        break;
+static const s16 Passive04_0028[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0029[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x10,
+    COM_LEVER_ATTACK, 8, 0, 0x10,
+    COM_LEVER_ATTACK, 8, 0, 0x10,
+    COM_END,
+};
 
-void Passive04_0107(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7F, 2);
-        break;
+static const s16 Passive04_0030[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
+static const s16 Passive04_0031[] = {
+    COM_WALK, 1, 0x20, 1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x21, 10, 0x700);
-        break;
+static const s16 Passive04_0032[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0033[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-void Passive04_0108(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 2);
-        break;
+static const s16 Passive04_0034[] = {
+    COM_ADJUST_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -0x7FA0, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x200);
-        break;
+static const s16 Passive04_0036[] = {
+    COM_WAIT, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0037[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_EM_TERM, -1, -0x7FF8, 0, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Passive04_0109(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 10, -1);
-        break;
+static const s16 Passive04_0038[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_EM_TERM, -1, -0x7FF8, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0039[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_EM_TERM, -1, -0x7FE0, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Passive04_0110(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 2);
-        break;
+static const s16 Passive04_0040[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_EM_TERM, -1, -0x7FF0, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -0x7F98, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0041[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_EM_TERM, -1, -0x7FE8, 0, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x20,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Passive04_0042[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0043[] = {
+    COM_EM_TERM, -1, -0x7FD8, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive04_0111(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 2);
-        break;
+static const s16 Passive04_0044[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_EM_TERM, -1, -0x7FF8, 3, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -0x7F98, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0045[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
+static const s16 Passive04_0046[] = {
+    COM_KEEP_STATUS, 2, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0047[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Passive04_0112(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 2);
-        break;
+static const s16 Passive04_0048[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -0x7F98, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0049[] = {
+    COM_ADJUST_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 2:
-        SA_Term(wk, 0x35, 0xFFFF, 0xFFFF, 0);
-        break;
+static const s16 Passive04_0050[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
+static const s16 Passive04_0051[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0052[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Passive04_0113(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 2);
-        break;
+static const s16 Passive04_0053[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Check_EX(wk, 6, 0x6F);
-        break;
+static const s16 Passive04_0054[] = {
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_END,
+};
 
-    case 2:
-        EM_Term(wk, -0x7F98, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0055[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 9, 0x70);
-        break;
+static const s16 Passive04_0056[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x40, 8, 0x400, 0, -0x7F68, -1, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0057[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x100, 0, -0x7F78, -1, 0x40,
+    COM_END,
+};
 
-void Passive04_0114(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x30, 6, 0x33);
-        break;
+static const s16 Passive04_0058[] = {
+    COM_KEEP_STATUS, 2, 1,
+    COM_END,
+};
 
-    case 1:
-        Pierce_On(wk);
-        break;
+static const s16 Passive04_0059[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
+static const s16 Passive04_0060[] = {
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0061[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-void Passive04_0115(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xDF, 2);
-        break;
+static const s16 Passive04_0062[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x60A, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0063[] = {
+    COM_SA_TERM, (s16)0xFFFF, 0x36, 0x37, 0,
+    COM_APPROACH_WALK, 0x9F, 2,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, (s16)0xFFFF, 0,
+    COM_END,
+};
 
-void Passive04_0116(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -0x7FF0, 5, 1, -1);
-        break;
+static const s16 Passive04_0064[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0xFFFF, 0x36, 0xFFFF, 0);
-        break;
+static const s16 Passive04_0065[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_NORMAL_ATTACK, 0xD, 0x200,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
+static const s16 Passive04_0066[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0067[] = {
+    COM_WAIT_ATTACK_COMPLETE, 3, 0,
+    COM_END,
+};
 
-void Passive04_0117(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 1);
-        break;
+static const s16 Passive04_0068[] = {
+    COM_APPROACH_WALK, 0xDF, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Look(wk, 0);
-        break;
+static const s16 Passive04_0069[] = {
+    COM_WAIT_ATTACK_COMPLETE, 3, 1,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, 0x37, 0,
+    COM_WAIT_ATTACK_COMPLETE, 3, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0070[] = {
+    COM_APPROACH_WALK, 0x9F, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Passive04_0118(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FB0, -1, 8, 0x400, 1, -1, 0x20, 0x400);
-        break;
+static const s16 Passive04_0071[] = {
+    COM_EM_TERM, -0x7FB0, -0x7FF0, 0, 1, -1,
+    COM_SA_TERM, (s16)0xFFFF, 0x36, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0072[] = {
+    COM_SA_TERM, 0x35, (s16)0xFFFF, 0x37, 0,
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-void Passive04_0119(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FB0, -0x7FB0, 8, 0x40, 2, -1, -0x7FB0, 0x40);
-        break;
+static const s16 Passive04_0073[] = {
+    COM_SA_TERM, 0x35, (s16)0xFFFF, 0x37, 0,
+    COM_NORMAL_ATTACK, 0xD, 0x20,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
+static const s16 Passive04_0074[] = {
+    COM_SA_TERM, (s16)0xFFFF, 0x36, 0x37, 0,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, (s16)0xFFFF, 0x9F,
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x30A, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0075[] = {
+    COM_EM_TERM, -0x7FC0, -1, 5, 6, 0x1F,
+    COM_NORMAL_ATTACK, 9, 0x22,
+    COM_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-void Passive04_0120(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FB0, -0x7FB0, 8, 0x40, 2, -1, -0x7FB0, 0x40);
-        break;
+static const s16 Passive04_0076[] = {
+    COM_EM_TERM, -0x7FB0, -1, 5, 6, 0x1C,
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
+static const s16 Passive04_0077[] = {
+    COM_WAIT_ATTACK_COMPLETE, 3, 1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x40);
-        break;
+static const s16 Passive04_0078[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0079[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-void Passive04_0121(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Passive04_0080[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x30A, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Passive04_0081[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x20, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Passive04_0082[] = {
+    COM_SA_TERM, 0x35, (s16)0xFFFF, 0x37, 0,
+    COM_LEVER_ATTACK, 0xD, 0, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0083[] = {
+    COM_EM_TERM, -0x7F90, 0, 0, 2, 0,
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x609, -1,
+    COM_END,
+};
 
-void Passive04_0122(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Passive04_0084[] = {
+    COM_EM_TERM, -0x7FB0, 0, 0, 2, 0,
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x608, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0085[] = {
+    COM_EM_TERM, -0x7F90, 0, 0, 2, 0,
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x309, -1,
+    COM_END,
+};
 
-void Passive04_0123(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xD, 0x20, 0x609, -1);
-        break;
+static const s16 Passive04_0086[] = {
+    COM_EM_TERM, -0x7FB0, 0, 0, 2, 0,
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x308, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0087[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x37, 0,
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-void Passive04_0124(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xD, 0x20, 0x608, -1);
-        break;
+static const s16 Passive04_0088[] = {
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0089[] = {
+    COM_WAIT_ATTACK_COMPLETE, 3, 1,
+    COM_SA_TERM, (s16)0xFFFF, 0x36, 0x37, 0,
+    COM_WAIT_ATTACK_COMPLETE, 3, 0,
+    COM_END,
+};
 
-void Passive04_0125(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xD, 0x20, 0x309, -1);
-        break;
+static const s16 Passive04_0090[] = {
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x608, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0091[] = {
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x609, -1,
+    COM_END,
+};
 
-void Passive04_0126(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xD, 0x20, 0x308, -1);
-        break;
+static const s16 Passive04_0092[] = {
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x60A, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0093[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Passive04_0127(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0094[] = {
+    COM_EM_TERM, -0x7FC0, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
+static const s16 Passive04_0095[] = {
+    COM_EM_TERM, -0x7FB0, -0x7FC0, 0, 1, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0096[] = {
+    COM_EM_TERM, -0x7FB0, -0x7FC0, 0, 1, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Passive04_0128(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0097[] = {
+    COM_APPROACH_WALK, 0x47, 2,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x22);
-        break;
+static const s16 Passive04_0098[] = {
+    COM_CHECK_EX, 6, 8,
+    COM_EM_TERM, -0x7FA0, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, 0x70,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0099[] = {
+    COM_EM_TERM, -1, -0x7FD8, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, 0x70,
+    COM_END,
+};
 
-void Passive04_0129(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0100[] = {
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
+static const s16 Passive04_0101[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_COMMAND_ATTACK, 8, 0x21, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0102[] = {
+    COM_EM_TERM, -0x7FA0, -1, 0, 1, -1,
+    COM_SEARCH_BACK_TERM, 0x30, 6, 0x6D,
+    COM_COMMAND_ATTACK, 8, 0x21, 10, -1,
+    COM_END,
+};
 
-void Passive04_0130(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0103[] = {
+    COM_EM_TERM, -0x7FA0, -1, 0, 1, -1,
+    COM_SEARCH_BACK_TERM, 0x30, 6, 0x6D,
+    COM_COMMAND_ATTACK, 8, 0x21, 9, 0x700,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Passive04_0104[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_COMMAND_ATTACK, 8, 0x21, 10, 0x700,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Passive04_0105[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x21, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0106[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x21, 10, -1,
+    COM_END,
+};
 
-void Passive04_0131(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0107[] = {
+    COM_APPROACH_WALK, 0x7F, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x21, 10, 0x700,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Passive04_0108[] = {
+    COM_WAIT, 2,
+    COM_EM_TERM, -0x7FA0, -1, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Passive04_0109[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0110[] = {
+    COM_WAIT, 2,
+    COM_EM_TERM, -0x7F98, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Passive04_0132(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0111[] = {
+    COM_WAIT, 2,
+    COM_EM_TERM, -0x7F98, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, 0x70);
-        break;
+static const s16 Passive04_0112[] = {
+    COM_WAIT, 2,
+    COM_EM_TERM, -0x7F98, -1, 0, 1, -1,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0113[] = {
+    COM_WAIT, 2,
+    COM_CHECK_EX, 6, 0x6F,
+    COM_EM_TERM, -0x7F98, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, 0x70,
+    COM_END,
+};
 
-void Passive04_0133(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0114[] = {
+    COM_SEARCH_BACK_TERM, 0x30, 6, 0x33,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
+static const s16 Passive04_0115[] = {
+    COM_KEEP_AWAY, 0xDF, 2,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
+static const s16 Passive04_0116[] = {
+    COM_EM_TERM, -0x7FB0, -0x7FF0, 5, 1, -1,
+    COM_SA_TERM, (s16)0xFFFF, 0x36, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0117[] = {
+    COM_JUMP, 1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-void Passive04_0134(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0118[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FB0, -1, 8, 0x400, 1, -1, 0x20, 0x400,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
+static const s16 Passive04_0119[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FB0, -0x7FB0, 8, 0x40, 2, -1, -0x7FB0, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0120[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FB0, -0x7FB0, 8, 0x40, 2, -1, -0x7FB0, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Passive04_0135(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 0, 1, -1);
-        break;
+static const s16 Passive04_0121[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, 0x70);
-        break;
+static const s16 Passive04_0122[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0123[] = {
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x609, -1,
+    COM_END,
+};
 
-void Passive04_0136(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
+static const s16 Passive04_0124[] = {
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x608, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0125[] = {
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x309, -1,
+    COM_END,
+};
 
-void Passive04_0137(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x21, 8, -1);
-        break;
+static const s16 Passive04_0126[] = {
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x308, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0127[] = {
+    COM_EM_TERM, -0x7F90, -1, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-void Passive04_0138(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x21, 10, 0x700);
-        break;
+static const s16 Passive04_0128[] = {
+    COM_EM_TERM, -0x7F90, -1, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0129[] = {
+    COM_EM_TERM, -0x7F90, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Passive04_0139(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xB3, 2);
-        break;
+static const s16 Passive04_0130[] = {
+    COM_EM_TERM, -0x7F80, -1, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    case 1:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -0x7FA0, 8, 0x400, 0, -0x7F78, -1, 0x40);
-        break;
+static const s16 Passive04_0131[] = {
+    COM_EM_TERM, -0x7F80, -1, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0132[] = {
+    COM_EM_TERM, -0x7F90, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, 0x70,
+    COM_END,
+};
 
-void Passive04_0140(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xB3, 2);
-        break;
+static const s16 Passive04_0133[] = {
+    COM_EM_TERM, -0x7F90, -1, 0, 1, -1,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -0x7FA0, 8, 0x400, 0, -0x7F78, -1, 0x40);
-        break;
+static const s16 Passive04_0134[] = {
+    COM_EM_TERM, -0x7F80, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive04_0135[] = {
+    COM_EM_TERM, -0x7F80, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, 0x70,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0136[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-void Passive04_0141(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xB3, 2);
-        break;
+static const s16 Passive04_0137[] = {
+    COM_COMMAND_ATTACK, 8, 0x21, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Hi_Jump_Attack_Term(wk, -0x7FA0, -0x7FA0, 8, 0x400, 0, -0x7F78, -1, 0x40);
-        break;
+static const s16 Passive04_0138[] = {
+    COM_COMMAND_ATTACK, 8, 0x21, 10, 0x700,
+    COM_END,
+};
 
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
+static const s16 Passive04_0139[] = {
+    COM_APPROACH_WALK, 0xB3, 2,
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -0x7FA0, 8, 0x400, 0, -0x7F78, -1, 0x40,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive04_0140[] = {
+    COM_APPROACH_WALK, 0xB3, 2,
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -0x7FA0, 8, 0x400, 0, -0x7F78, -1, 0x40,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive04_0141[] = {
+    COM_APPROACH_WALK, 0xB3, 2,
+    COM_HI_JUMP_ATTACK_TERM, -0x7FA0, -0x7FA0, 8, 0x400, 0, -0x7F78, -1, 0x40,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void (*const Passive04_Tbl[142])(PLW*) = {
+const s16* const Passive04_Tbl[142] = {
     Passive04_0000, Passive04_0001, Passive04_0002, Passive04_0003, Passive04_0004, Passive04_0005, Passive04_0006,
     Passive04_0007, Passive04_0008, Passive04_0009, Passive04_0010, Passive04_0011, Passive04_0012, Passive04_0013,
     Passive04_0014, Passive04_0015, Passive04_0016, Passive04_0017, Passive04_0018, Passive04_0019, Passive04_0020,
@@ -2369,3 +898,7 @@ void (*const Passive04_Tbl[142])(PLW*) = {
     Passive04_0133, Passive04_0134, Passive04_0135, Passive04_0136, Passive04_0137, Passive04_0138, Passive04_0139,
     Passive04_0140, Passive04_0141
 };
+
+void Passive04(PLW* wk) {
+    Exec_Com_Pattern(wk, Passive04_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
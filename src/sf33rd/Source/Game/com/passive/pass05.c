@@ -5,1596 +5,609 @@
 
 #include "sf33rd/Source/Game/com/passive/pass05.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Passive05_Tbl[102])();
-
-void Passive05(PLW* wk) {
-    Passive05_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Passive05_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xD, M_Lv[wk->wu.id]);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, 0x70);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F88, -1, 0, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x41D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F88, -1, 0, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x41D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F88, -1, 0, 1, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0xFFFF, 0xFFFF, 0);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x41D, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FD0, -0x7FC8, 0, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F78, -0x7FB8, 0, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x22);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F90, 0, 0, 2, 0);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 1, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        VS_Jump_Guard(wk);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x67, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x67, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x67, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7F90, 0x40, 8, 0x402, 0, -0x7F68, -1, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7F90, -0x7FA8, 8, 0x40, 0, -0x7F78, -1, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xB7, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
-
-    case 1:
-        EM_Term(wk, 0x7FFF, -1, 1, 1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x67, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, 0x7FFF, -1, 1, 1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 0, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 1, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF8, 0, 1, -1);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF8, 0, 1, -1);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FCB, -0x7FF8, 0, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FC0, 0, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x20, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x41D, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -1, 0, 6, 0x1F);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x41D, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 3, 1, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Status(wk, 2, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 8, 0x70);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, 0x87, 0, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 9, 0x70);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FC0, 0, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x20, 10, 0x700);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x40, 8, 0x402, 2, -0x7F80, -1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Status(wk, 2, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 0xC, 0x1E, 10, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0x60);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0x60);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x67, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x40);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 10, 0x70);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x67, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x200);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xB7, 2);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0x60);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Attack_Complete(wk, 3, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Attack_Complete(wk, 3, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Attack_Complete(wk, 3, 1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0xFFFF, 0x37, 0);
-        break;
-
-    case 2:
-        Wait_Attack_Complete(wk, 3, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive05_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x67, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0x60);
-        break;
+static const s16 Passive05_0000[] = {
+    COM_NORMAL_ATTACK_M_LV, 0xD,
+    COM_END,
+};
 
-    case 3:
-        Wait_Get_Up(wk, 0, -1);
-        break;
+static const s16 Passive05_0001[] = {
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-    case 4:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Passive05_0002[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0003[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Passive05_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FA8, -0x7FF8, 6, 1, -1);
-        break;
+static const s16 Passive05_0004[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, 0x70,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0xFFFF, 0x36, 0xFFFF, 0);
-        break;
+static const s16 Passive05_0005[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
+static const s16 Passive05_0006[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0007[] = {
+    COM_EM_TERM, -0x7F88, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x41D, 9, -1,
+    COM_END,
+};
 
-void Passive05_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -0x7FF8, 5, 1, -1);
-        break;
+static const s16 Passive05_0008[] = {
+    COM_EM_TERM, -0x7F88, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x41D, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0x35, 0xFFFF, 0x37, 0);
-        break;
+static const s16 Passive05_0009[] = {
+    COM_EM_TERM, -0x7F88, -1, 0, 1, -1,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x41D, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        Forced_Guard(wk, 0);
-        break;
+static const s16 Passive05_0010[] = {
+    COM_EM_TERM, -0x7FD0, -0x7FC8, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0011[] = {
+    COM_EM_TERM, -0x7F78, -0x7FB8, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_END,
+};
 
-void Passive05_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 5, 1, -1);
-        break;
+static const s16 Passive05_0012[] = {
+    COM_EM_TERM, -0x7F90, 0, 0, 2, 0,
+    COM_LEVER_ATTACK, 8, 1, 0x400,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0x35, 0xFFFF, 0x37, 0);
-        break;
+static const s16 Passive05_0013[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-    case 2:
-        Adjust_Attack(wk, 0xB, 0x10);
-        break;
+static const s16 Passive05_0014[] = {
+    COM_VS_JUMP_GUARD,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 10, 0x202);
-        break;
+static const s16 Passive05_0015[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    case 4:
-        Normal_Attack(wk, 10, 0x200);
-        break;
+static const s16 Passive05_0016[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0017[] = {
+    COM_APPROACH_WALK, 0x67, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Passive05_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -0x7FF0, 5, 1, -1);
-        break;
+static const s16 Passive05_0018[] = {
+    COM_APPROACH_WALK, 0x67, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0x35, 0xFFFF, 0x37, 0);
-        break;
+static const s16 Passive05_0019[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
+static const s16 Passive05_0020[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0021[] = {
+    COM_APPROACH_WALK, 0x67, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Passive05_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FC0, -1, 5, 6, 0x1F);
-        break;
+static const s16 Passive05_0022[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_JUMP_ATTACK_TERM, -0x7F90, 0x40, 8, 0x402, 0, -0x7F68, -1, 0x10,
+    COM_END,
+};
 
-    case 1:
-        Pierce_On(wk);
-        break;
+static const s16 Passive05_0023[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_JUMP_ATTACK_TERM, -0x7F90, -0x7FA8, 8, 0x40, 0, -0x7F78, -1, 0x10,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
+static const s16 Passive05_0024[] = {
+    COM_APPROACH_WALK, 0xB7, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x41D, 9, -1);
-        break;
+static const s16 Passive05_0025[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_EM_TERM, 0x7FFF, -1, 1, 1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0026[] = {
+    COM_APPROACH_WALK, 0x67, 2,
+    COM_EM_TERM, 0x7FFF, -1, 1, 1, -1,
+    COM_END,
+};
 
-void Passive05_0076(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -1, 5, 6, 0x1C);
-        break;
+static const s16 Passive05_0027[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
+static const s16 Passive05_0028[] = {
+    COM_EM_TERM, -0x7F80, -1, 0, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0029[] = {
+    COM_LEVER_ATTACK, 8, 1, 0x10,
+    COM_END,
+};
 
-void Passive05_0077(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Attack_Complete(wk, 3, 1);
-        break;
+static const s16 Passive05_0030[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive05_0031[] = {
+    COM_WALK, 1, 0x20, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0032[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Passive05_0078(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
+static const s16 Passive05_0033[] = {
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive05_0034[] = {
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0035[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_END,
+};
 
-void Passive05_0079(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 2);
-        break;
+static const s16 Passive05_0036[] = {
+    COM_WAIT, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0037[] = {
+    COM_EM_TERM, -1, -0x7FF8, 0, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Passive05_0080(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0038[] = {
+    COM_EM_TERM, -1, -0x7FF8, 0, 1, -1,
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_END,
+};
 
-void Passive05_0081(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FA8, 9, 0x40, 0, -0x7FB0, -1, 0x400);
-        break;
+static const s16 Passive05_0039[] = {
+    COM_EM_TERM, -0x7FCB, -0x7FF8, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x20);
-        break;
+static const s16 Passive05_0040[] = {
+    COM_EM_TERM, -1, -0x7FC0, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x20, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 9, 0x40);
-        break;
+static const s16 Passive05_0041[] = {
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 8, 0x41D, 10, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 9, 0x1E, 10, -1);
-        break;
+static const s16 Passive05_0042[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 4:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0x60);
-        break;
+static const s16 Passive05_0043[] = {
+    COM_EM_TERM, -0x7FB0, -1, 0, 6, 0x1F,
+    COM_J_COMMAND_ATTACK, 8, 0x41D, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0044[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_EM_TERM, -1, -0x7FF8, 3, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Passive05_0082(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
+static const s16 Passive05_0045[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
+static const s16 Passive05_0046[] = {
+    COM_KEEP_STATUS, 2, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 9, 0x200);
-        break;
+static const s16 Passive05_0047[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, 0x70,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 9, 0x1C, 10, -1);
-        break;
+static const s16 Passive05_0048[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 4:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0x60);
-        break;
+static const s16 Passive05_0049[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0050[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Passive05_0083(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 2);
-        break;
+static const s16 Passive05_0051[] = {
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0052[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Passive05_0084(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, 9, 0x202, 1, -0x7FB0, -1, 0x20);
-        break;
+static const s16 Passive05_0053[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0054[] = {
+    COM_EM_TERM, -1, 0x87, 0, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, 0x70,
+    COM_END,
+};
 
-void Passive05_0085(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FA0, -0x7FF8, 5, 1, -1);
-        break;
+static const s16 Passive05_0055[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xD, 0x100);
-        break;
+static const s16 Passive05_0056[] = {
+    COM_EM_TERM, -1, -0x7FC0, 0, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x20, 10, 0x700,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0057[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x40, 8, 0x402, 2, -0x7F80, -1, 0x20,
+    COM_END,
+};
 
-void Passive05_0086(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_SA(wk, 6, 0x5A);
-        break;
+static const s16 Passive05_0058[] = {
+    COM_KEEP_STATUS, 2, 1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 0xC, 0x1E, 10, -1);
-        break;
+static const s16 Passive05_0059[] = {
+    COM_J_COMMAND_ATTACK, 0xC, 0x1E, 10, -1,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0x60,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        Wait(wk, 5);
-        break;
+static const s16 Passive05_0060[] = {
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-    case 3:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
+static const s16 Passive05_0061[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0062[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x200,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x40,
+    COM_END,
+};
 
-void Passive05_0087(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xB7, 2);
-        break;
+static const s16 Passive05_0063[] = {
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0x60,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0064[] = {
+    COM_APPROACH_WALK, 0x67, 2,
+    COM_NORMAL_ATTACK, 0xB, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 10, 0x70,
+    COM_END,
+};
 
-void Passive05_0088(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
+static const s16 Passive05_0065[] = {
+    COM_APPROACH_WALK, 0x67, 2,
+    COM_NORMAL_ATTACK, 0xB, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
+static const s16 Passive05_0066[] = {
+    COM_APPROACH_WALK, 0xB7, 2,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0x60,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0067[] = {
+    COM_WAIT_ATTACK_COMPLETE, 3, 0,
+    COM_END,
+};
 
-void Passive05_0089(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x220);
-        break;
+static const s16 Passive05_0068[] = {
+    COM_WAIT_ATTACK_COMPLETE, 3, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0069[] = {
+    COM_WAIT_ATTACK_COMPLETE, 3, 1,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, 0x37, 0,
+    COM_WAIT_ATTACK_COMPLETE, 3, 0,
+    COM_END,
+};
 
-void Passive05_0090(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
+static const s16 Passive05_0070[] = {
+    COM_APPROACH_WALK, 0x67, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0x60,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Passive05_0071[] = {
+    COM_EM_TERM, -0x7FA8, -0x7FF8, 6, 1, -1,
+    COM_SA_TERM, (s16)0xFFFF, 0x36, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0072[] = {
+    COM_EM_TERM, -0x7F80, -0x7FF8, 5, 1, -1,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, 0x37, 0,
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-void Passive05_0091(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 5, 1, -1);
-        break;
+static const s16 Passive05_0073[] = {
+    COM_EM_TERM, -0x7F80, -1, 5, 1, -1,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, 0x37, 0,
+    COM_ADJUST_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 10, 0x202,
+    COM_NORMAL_ATTACK, 10, 0x200,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0x35, 0xFFFF, 0xFFFF, 0);
-        break;
+static const s16 Passive05_0074[] = {
+    COM_EM_TERM, -0x7F80, -0x7FF0, 5, 1, -1,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        Forced_Guard(wk, 0);
-        break;
+static const s16 Passive05_0075[] = {
+    COM_EM_TERM, -0x7FC0, -1, 5, 6, 0x1F,
+    COM_PIERCE_ON,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_J_COMMAND_ATTACK, 8, 0x41D, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0076[] = {
+    COM_EM_TERM, -0x7FB0, -1, 5, 6, 0x1C,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-void Passive05_0092(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x50, 8, 0x202, 2, -0x7F80, -1, 0x20);
-        break;
+static const s16 Passive05_0077[] = {
+    COM_WAIT_ATTACK_COMPLETE, 3, 1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0078[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive05_0093(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7F78, 9, 0x400, 0, -0x7FA0, -1, 0x20);
-        break;
+static const s16 Passive05_0079[] = {
+    COM_FORCED_GUARD, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0080[] = {
+    COM_END,
+};
 
-void Passive05_0094(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, 0x30, 0, 1, -1);
-        break;
+static const s16 Passive05_0081[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FA8, 9, 0x40, 0, -0x7FB0, -1, 0x400,
+    COM_NORMAL_ATTACK, 9, 0x20,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_COMMAND_ATTACK, 9, 0x1E, 10, -1,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0x60,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x22);
-        break;
+static const s16 Passive05_0082[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x200,
+    COM_COMMAND_ATTACK, 9, 0x1C, 10, -1,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0x60,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0083[] = {
+    COM_JUMP, 2,
+    COM_END,
+};
 
-void Passive05_0095(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -1, 0, 1, -1);
-        break;
+static const s16 Passive05_0084[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, 9, 0x202, 1, -0x7FB0, -1, 0x20,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x41D, 10, -1);
-        break;
+static const s16 Passive05_0085[] = {
+    COM_EM_TERM, -0x7FA0, -0x7FF8, 5, 1, -1,
+    COM_NORMAL_ATTACK, 0xD, 0x100,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0086[] = {
+    COM_CHECK_SA, 6, 0x5A,
+    COM_COMMAND_ATTACK, 0xC, 0x1E, 10, -1,
+    COM_WAIT, 5,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_END,
+};
 
-void Passive05_0096(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF8, 0, 1, -1);
-        break;
+static const s16 Passive05_0087[] = {
+    COM_APPROACH_WALK, 0xB7, 2,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Passive05_0088[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Passive05_0089[] = {
+    COM_NORMAL_ATTACK, 9, 0x220,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0090[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Passive05_0097(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x67, 2);
-        break;
+static const s16 Passive05_0091[] = {
+    COM_EM_TERM, -0x7F80, -1, 5, 1, -1,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, (s16)0xFFFF, 0,
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0092[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x50, 8, 0x202, 2, -0x7F80, -1, 0x20,
+    COM_END,
+};
 
-void Passive05_0098(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
+static const s16 Passive05_0093[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7F78, 9, 0x400, 0, -0x7FA0, -1, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0094[] = {
+    COM_EM_TERM, -1, 0x30, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_END,
+};
 
-void Passive05_0099(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
+static const s16 Passive05_0095[] = {
+    COM_EM_TERM, -1, -1, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x41D, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0096[] = {
+    COM_EM_TERM, -1, -0x7FF8, 0, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-void Passive05_0100(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0xFFFF, 0xFFFF, 0);
-        break;
+static const s16 Passive05_0097[] = {
+    COM_APPROACH_WALK, 0x67, 2,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x41D, 10, -1);
-        break;
+static const s16 Passive05_0098[] = {
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0099[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-void Passive05_0101(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x22);
-        break;
+static const s16 Passive05_0100[] = {
+    COM_SA_TERM, 0x35, (s16)0xFFFF, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x41D, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive05_0101[] = {
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_END,
+};
 
-void (*const Passive05_Tbl[102])(PLW*) = {
+const s16* const Passive05_Tbl[102] = {
     Passive05_0000, Passive05_0001, Passive05_0002, Passive05_0003, Passive05_0004, Passive05_0005, Passive05_0006,
     Passive05_0007, Passive05_0008, Passive05_0009, Passive05_0010, Passive05_0011, Passive05_0012, Passive05_0013,
     Passive05_0014, Passive05_0015, Passive05_0016, Passive05_0017, Passive05_0018, Passive05_0019, Passive05_0020,
@@ -1611,3 +624,7 @@ void (*const Passive05_Tbl[102])(PLW*) = {
     Passive05_0091, Passive05_0092, Passive05_0093, Passive05_0094, Passive05_0095, Passive05_0096, Passive05_0097,
     Passive05_0098, Passive05_0099, Passive05_0100, Passive05_0101
 };
+
+void Passive05(PLW* wk) {
+    Exec_Com_Pattern(wk, Passive05_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
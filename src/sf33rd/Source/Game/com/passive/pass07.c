@@ -5,3976 +5,1428 @@
 
 #include "sf33rd/Source/Game/com/passive/pass07.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Passive07_Tbl[214])();
-
-void Passive07(PLW* wk) {
-    Passive07_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Passive07_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xD, M_Lv[wk->wu.id]);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, 0x28, 7, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FA0, 0x28, 7, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 1:
-        Jump(wk, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 6, 1, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 6, 1, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FC0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 4:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    case 5:
-        Command_Attack(wk, 8, 0x20, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB8, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x78, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x20);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x100);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2E, 10, -1, -1, 0x40, 0, -1, -1, 0xFFFF);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2E, 10, -1, -1, 0x40, 1, -1, -1, 0xFFFF);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x2E);
-        break;
-
-    case 1:
-        Jump_Command_Attack_Term(wk, 8, 0x2E, 10, -1, -1, 0x40, 1, -1, -1, 0xFFFF);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0x1E, 10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 9, 0, 0x400);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 0xB, 0, 0x200);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0xFFFF, 0xFFFF, 0);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, 0x40, 8, 0x200, 0, -0x7FC0, -1, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 8, 0x400, 0, -0x7FC0, -1, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_EX(wk, 6, 2);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 9, 0x700);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x400);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 1:
-        Wait(wk, 4);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x20);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0xFFFF, 0);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x22);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0xFFFF, 0x37, 0);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2E, 10, 0x70, -1, 0x40, 0, -1, -1, 0xFFFF);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Command_Attack_Term(wk, 8, 0x2E, 10, 0x70, -1, 0x40, 1, -1, -1, 0xFFFF);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Lie(wk, 0);
-        break;
-
-    case 1:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 2:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Turn_Over_On(wk);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 2:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 5:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    case 6:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x400);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x20, 10, 0x700);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 0xB, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Lie(wk, 0);
-        break;
-
-    case 1:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 1:
-        Provoke(wk, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FC0, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -1, 0, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0076(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0077(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0078(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Branch_Unit_Area(wk, 6, 0x55, 0x2F, 0x1B, 0x25);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0079(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    case 2:
-        Branch_Unit_Area(wk, 6, 0x53, 0x2F, 0x24, 0x25);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0080(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x202);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0081(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0082(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    case 5:
-        Com_Random_Select(wk, 6, 0x2D, 0xFF, 0xFF, 0xFF, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0083(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0084(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0085(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 1, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0086(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 199, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0087(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0088(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0089(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, -1, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0090(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0091(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0092(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 0xC, 0, 0x200);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    case 4:
-        J_Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0093(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, 0x28, 7, 1, -1);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 9, 0, 0x200);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0094(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0095(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0096(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0097(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x20, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0098(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0099(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0100(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, -1);
-        break;
-
-    case 1:
-        Wait(wk, 0x10);
-        break;
-
-    case 2:
-        Walk(wk, 0, 0x18, -1);
-        break;
-
-    case 3:
-        Walk(wk, 1, 0x18, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0101(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x202);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0102(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0103(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0104(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x402);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0105(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0106(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0107(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FC0, 6, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0108(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FC8, 6, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0109(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FC8, 0, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0110(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x20);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0111(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x20);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0112(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x78, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0113(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    case 1:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 0xC, 1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0114(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0115(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0116(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0117(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0118(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0119(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0120(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0121(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0122(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0123(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x202);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0124(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0125(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0xFFFF, 0x37, 0);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0126(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0127(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
-
-    case 3:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0128(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0129(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    case 5:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0130(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0131(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0132(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x400);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0133(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x400);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0134(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0135(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0136(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FC0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0137(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x20, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0138(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x100);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 9, 0x20);
-        break;
-
-    case 4:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0139(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0140(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x20, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0141(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0142(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FC0, 6, 1, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 0xC, 0x1E, 8, -1);
-        break;
-
-    case 3:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0143(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0144(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 3:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0145(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 2:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
-
-    case 4:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0146(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, -1, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0147(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 9, 0x202);
-        break;
-
-    case 5:
-        Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0148(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0149(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 9, 0x202);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0150(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0151(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 4:
-        SA_Term(wk, 0x35, 0x36, 0xFFFF, 0);
-        break;
-
-    case 5:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0152(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x400);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x20, 8, -1);
-        break;
-
-    case 3:
-        Com_Random_Select(wk, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0153(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0154(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xC7, 0);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive07_0155(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xC7, 0);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 2, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0000[] = {
+    COM_NORMAL_ATTACK_M_LV, 0xD,
+    COM_END,
+};
 
-void Passive07_0156(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xC7, 0);
-        break;
+static const s16 Passive07_0001[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 1:
-        Wait_Get_Up(wk, 0, 0);
-        break;
+static const s16 Passive07_0002[] = {
+    COM_WAIT, 0,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
+static const s16 Passive07_0003[] = {
+    COM_EM_TERM, -0x7FB0, 0x28, 7, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0004[] = {
+    COM_EM_TERM, -0x7FA0, 0x28, 7, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive07_0157(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive07_0005[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_JUMP, 1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
+static const s16 Passive07_0006[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_EM_TERM, -1, -0x7FF8, 6, 1, -1,
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 2:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40);
-        break;
+static const s16 Passive07_0007[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_EM_TERM, -1, -0x7FF8, 6, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 0xB, 0x400);
-        break;
+static const s16 Passive07_0008[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_EM_TERM, -1, -0x7FC0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 4:
-        SA_Term(wk, 0x35, 0x36, 0xFFFF, 0);
-        break;
+static const s16 Passive07_0009[] = {
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 5:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
+static const s16 Passive07_0010[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_COMMAND_ATTACK, 8, 0x20, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0011[] = {
+    COM_EM_TERM, -1, -0x7FB8, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive07_0158(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive07_0012[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
+static const s16 Passive07_0013[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 2:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1);
-        break;
+static const s16 Passive07_0014[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
+static const s16 Passive07_0015[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_END,
+};
 
-    case 4:
-        SA_Term(wk, 0x35, 0x36, 0xFFFF, 0);
-        break;
+static const s16 Passive07_0016[] = {
+    COM_APPROACH_WALK, 0x78, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-    case 5:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive07_0017[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0018[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 10, -1,
+    COM_END,
+};
 
-void Passive07_0159(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
+static const s16 Passive07_0019[] = {
+    COM_NORMAL_ATTACK, 9, 0x20,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
+static const s16 Passive07_0020[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
+static const s16 Passive07_0021[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Passive07_0022[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x202,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0023[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive07_0160(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
+static const s16 Passive07_0024[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_LEVER_ATTACK, 8, 0, 0x100,
+    COM_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
+static const s16 Passive07_0025[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2E, 10, -1, -1, 0x40, 0, -1, -1, (s16)0xFFFF,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Passive07_0026[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2E, 10, -1, -1, 0x40, 1, -1, -1, (s16)0xFFFF,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0027[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x2E,
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2E, 10, -1, -1, 0x40, 1, -1, -1, (s16)0xFFFF,
+    COM_END,
+};
 
-void Passive07_0161(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40);
-        break;
+static const s16 Passive07_0028[] = {
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
+static const s16 Passive07_0029[] = {
+    COM_PIERCE_ON,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive07_0030[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_LEVER_ATTACK, 8, 0x1E, 10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0031[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_LEVER_ATTACK, 9, 0, 0x400,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive07_0162(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive07_0032[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_LEVER_ATTACK, 0xB, 0, 0x200,
+    COM_LEVER_ATTACK, 8, 0, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
+static const s16 Passive07_0033[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
+static const s16 Passive07_0034[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Passive07_0035[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 4:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive07_0036[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 5:
-        Normal_Attack(wk, 9, 0x402);
-        break;
+static const s16 Passive07_0037[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_END,
+};
 
-    case 6:
-        J_Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
+static const s16 Passive07_0038[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 7:
-        Com_Random_Select(wk, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2);
-        break;
+static const s16 Passive07_0039[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0040[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive07_0163(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive07_0041[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
+static const s16 Passive07_0042[] = {
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
+static const s16 Passive07_0043[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, 0x40, 8, 0x200, 0, -0x7FC0, -1, 0x200,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Passive07_0044[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 8, 0x400, 0, -0x7FC0, -1, 0x200,
+    COM_END,
+};
 
-    case 4:
-        Com_Random_Select(wk, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2);
-        break;
+static const s16 Passive07_0045[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0046[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Passive07_0164(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive07_0047[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive07_0048[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0049[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-void Passive07_0165(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive07_0050[] = {
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_J_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x402);
-        break;
+static const s16 Passive07_0051[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Passive07_0052[] = {
+    COM_CHECK_EX, 6, 2,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, 0x700,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0053[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x400,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Passive07_0166(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive07_0054[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive07_0055[] = {
+    COM_WAIT_GET_UP, 0, 0,
+    COM_WAIT, 4,
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0056[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 0xC, 0x20,
+    COM_SA_TERM, 0x35, 0x36, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive07_0167(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive07_0057[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 0xC, 0x22,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, 0x37, 0,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x402);
-        break;
+static const s16 Passive07_0058[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive07_0059[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2E, 10, 0x70, -1, 0x40, 0, -1, -1, (s16)0xFFFF,
+    COM_END,
+};
 
-    case 3:
-        Search_Back_Term(wk, 0x30, 1, -1);
-        break;
+static const s16 Passive07_0060[] = {
+    COM_JUMP_COMMAND_ATTACK_TERM, 8, 0x2E, 10, 0x70, -1, 0x40, 1, -1, -1, (s16)0xFFFF,
+    COM_END,
+};
 
-    case 4:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
+static const s16 Passive07_0061[] = {
+    COM_WAIT_LIE, 0,
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0062[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive07_0168(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, -1);
-        break;
+static const s16 Passive07_0063[] = {
+    COM_TURN_OVER_ON,
+    COM_WAIT_GET_UP, 0, 0,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0064[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive07_0169(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive07_0065[] = {
+    COM_WAIT_GET_UP, 0, 0,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x400,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0066[] = {
+    COM_WAIT_GET_UP, 0, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Passive07_0170(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xC7, 0);
-        break;
+static const s16 Passive07_0067[] = {
+    COM_WAIT_GET_UP, 0, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Wait_Get_Up(wk, 3, -1);
-        break;
+static const s16 Passive07_0068[] = {
+    COM_COMMAND_ATTACK, 8, 0x20, 10, 0x700,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0069[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-void Passive07_0171(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xC7, 0);
-        break;
+static const s16 Passive07_0070[] = {
+    COM_WAIT_GET_UP, 0, 0,
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 0xB, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Wait_Get_Up(wk, 0, 0);
-        break;
+static const s16 Passive07_0071[] = {
+    COM_WAIT_LIE, 0,
+    COM_JUMP, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0072[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-void Passive07_0172(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xC7, 0);
-        break;
+static const s16 Passive07_0073[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    case 1:
-        Wait_Get_Up(wk, 3, -1);
-        break;
+static const s16 Passive07_0074[] = {
+    COM_EM_TERM, -0x7FC0, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0075[] = {
+    COM_EM_TERM, -0x7FB0, -1, 0, 1, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Passive07_0173(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive07_0076[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_NORMAL_ATTACK, 0xB, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x102);
-        break;
+static const s16 Passive07_0077[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Passive07_0078[] = {
+    COM_PIERCE_ON,
+    COM_BRANCH_UNIT_AREA, 6, 0x55, 0x2F, 0x1B, 0x25,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Passive07_0079[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_BRANCH_UNIT_AREA, 6, 0x53, 0x2F, 0x24, 0x25,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0080[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-void Passive07_0174(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
+static const s16 Passive07_0081[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
+static const s16 Passive07_0082[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 0,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 9, 0x40);
-        break;
+static const s16 Passive07_0083[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 0xC, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive07_0084[] = {
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-    case 4:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
+static const s16 Passive07_0085[] = {
+    COM_LEVER_ATTACK, 8, 1, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0086[] = {
+    COM_APPROACH_WALK, 199, 2,
+    COM_END,
+};
 
-void Passive07_0175(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Passive07_0087[] = {
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
+static const s16 Passive07_0088[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive07_0089[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, -1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0090[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_END,
+};
 
-void Passive07_0176(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Passive07_0091[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Passive07_0092[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_LEVER_ATTACK, 0xC, 0, 0x200,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 0xB, 0x200);
-        break;
+static const s16 Passive07_0093[] = {
+    COM_EM_TERM, -0x7F80, 0x28, 7, 1, -1,
+    COM_LEVER_ATTACK, 9, 0, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Passive07_0094[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 4:
-        Com_Random_Select(wk, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2);
-        break;
+static const s16 Passive07_0095[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0096[] = {
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive07_0177(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x200);
-        break;
+static const s16 Passive07_0097[] = {
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x20, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive07_0098[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    case 2:
-        Com_Random_Select(wk, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2);
-        break;
+static const s16 Passive07_0099[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0100[] = {
+    COM_WALK, 1, 0x20, -1,
+    COM_WAIT, 0x10,
+    COM_WALK, 0, 0x18, -1,
+    COM_WALK, 1, 0x18, -1,
+    COM_END,
+};
 
-void Passive07_0178(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive07_0101[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x202,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xB, 0x40);
-        break;
+static const s16 Passive07_0102[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 0xC, 0x20, 0xA, -1);
-        break;
+static const s16 Passive07_0103[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 3:
-        Wait(wk, 5);
-        break;
+static const s16 Passive07_0104[] = {
+    COM_NORMAL_ATTACK, 9, 0x402,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 4:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
+static const s16 Passive07_0105[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0106[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1,
+    COM_END,
+};
 
-void Passive07_0179(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
+static const s16 Passive07_0107[] = {
+    COM_EM_TERM, -1, -0x7FC0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive07_0108[] = {
+    COM_EM_TERM, -1, -0x7FC8, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0109[] = {
+    COM_EM_TERM, -1, -0x7FC8, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive07_0180(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
+static const s16 Passive07_0110[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_NORMAL_ATTACK, 0xC, 0x20,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
+static const s16 Passive07_0111[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_NORMAL_ATTACK, 0xC, 0x20,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0112[] = {
+    COM_APPROACH_WALK, 0x78, 2,
+    COM_END,
+};
 
-void Passive07_0181(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
+static const s16 Passive07_0113[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 0xC, 1, -1, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive07_0114[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x20, 0xA, -1);
-        break;
+static const s16 Passive07_0115[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0116[] = {
+    COM_FORCED_GUARD, 2,
+    COM_END,
+};
 
-void Passive07_0182(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3B, 2);
-        break;
+static const s16 Passive07_0117[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0118[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-void Passive07_0183(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive07_0119[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
+static const s16 Passive07_0120[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Passive07_0121[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0122[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Passive07_0184(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive07_0123[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
+static const s16 Passive07_0124[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
+static const s16 Passive07_0125[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_SA_TERM, 0x35, (s16)0xFFFF, 0x37, 0,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Passive07_0126[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    case 4:
-        J_Command_Attack(wk, 8, 0x1F, 10, -1);
-        break;
+static const s16 Passive07_0127[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 5:
-        Com_Random_Select(wk, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2);
-        break;
+static const s16 Passive07_0128[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0129[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Passive07_0185(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
+static const s16 Passive07_0130[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0131[] = {
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-void Passive07_0186(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
+static const s16 Passive07_0132[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x400,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0133[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x400,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-void Passive07_0187(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
+static const s16 Passive07_0134[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0135[] = {
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Passive07_0188(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Passive07_0136[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_EM_TERM, -1, -0x7FC0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0137[] = {
+    COM_WAIT_GET_UP, 0, 0,
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_COMMAND_ATTACK, 8, 0x20, 0xA, -1,
+    COM_END,
+};
 
-void Passive07_0189(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, 0x28, 7, 1, -1);
-        break;
+static const s16 Passive07_0138[] = {
+    COM_WAIT_GET_UP, 0, 0,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x100,
+    COM_NORMAL_ATTACK, 9, 0x20,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
+static const s16 Passive07_0139[] = {
+    COM_WAIT_GET_UP, 0, 0,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0140[] = {
+    COM_WAIT_GET_UP, 0, 0,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x20, 0xA, -1,
+    COM_END,
+};
 
-void Passive07_0190(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, 0x28, 7, 1, -1);
-        break;
+static const s16 Passive07_0141[] = {
+    COM_WAIT_GET_UP, 0, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive07_0142[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_EM_TERM, -1, -0x7FC0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 0xC, 0x1E, 8, -1,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0143[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive07_0191(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x60, 2);
-        break;
+static const s16 Passive07_0144[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_EM_TERM, -1, -0x7FF8, 6, 1, -1,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 0x3F, 0x40, 0x41, 0x43, 0);
-        break;
+static const s16 Passive07_0145[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0146[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, -1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive07_0192(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xC7, 1);
-        break;
+static const s16 Passive07_0147[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 0xBA, 1, 0xAF, 0x92, 3);
-        break;
+static const s16 Passive07_0148[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0149[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive07_0193(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, -1);
-        break;
+static const s16 Passive07_0150[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 0xBA, 1, 0xAF, 0x92, 3);
-        break;
+static const s16 Passive07_0151[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_SA_TERM, 0x35, 0x36, (s16)0xFFFF, 0,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0152[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_NORMAL_ATTACK, 0xB, 0x400,
+    COM_COMMAND_ATTACK, 8, 0x20, 8, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2,
+    COM_END,
+};
 
-void Passive07_0194(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
+static const s16 Passive07_0153[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 1, 1, 0xC0, 0xC0, 4);
-        break;
+static const s16 Passive07_0154[] = {
+    COM_KEEP_AWAY, 0xC7, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0155[] = {
+    COM_KEEP_AWAY, 0xC7, 0,
+    COM_WAIT_GET_UP, 2, -1,
+    COM_END,
+};
 
-void Passive07_0195(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive07_0156[] = {
+    COM_KEEP_AWAY, 0xC7, 0,
+    COM_WAIT_GET_UP, 0, 0,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 1, 1, 0xC0, 0xC0, 4);
-        break;
+static const s16 Passive07_0157[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x400,
+    COM_SA_TERM, 0x35, 0x36, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0158[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_SA_TERM, 0x35, 0x36, (s16)0xFFFF, 0,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive07_0196(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, 0x28, 7, 1, -1);
-        break;
+static const s16 Passive07_0159[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Passive07_0160[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0161[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive07_0197(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, 0x28, 7, 1, -1);
-        break;
+static const s16 Passive07_0162[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x402,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
+static const s16 Passive07_0163[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0164[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive07_0198(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, 0x28, 7, 1, -1);
-        break;
+static const s16 Passive07_0165[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x402,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x402);
-        break;
+static const s16 Passive07_0166[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0167[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x402,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_SEARCH_BACK_TERM, 0x30, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_END,
+};
 
-void Passive07_0199(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
+static const s16 Passive07_0168[] = {
+    COM_WALK, 1, 0x20, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive07_0169[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0170[] = {
+    COM_KEEP_AWAY, 0xC7, 0,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-void Passive07_0200(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
+static const s16 Passive07_0171[] = {
+    COM_KEEP_AWAY, 0xC7, 0,
+    COM_WAIT_GET_UP, 0, 0,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x20, 0xA, -1);
-        break;
+static const s16 Passive07_0172[] = {
+    COM_KEEP_AWAY, 0xC7, 0,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0173[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Passive07_0201(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x40);
-        break;
+static const s16 Passive07_0174[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_J_COMMAND_ATTACK, 0xC, 0x1C, 0xA, -1,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 0xC, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive07_0175[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
+static const s16 Passive07_0176[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 0xB, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0177[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2,
+    COM_END,
+};
 
-void Passive07_0202(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
+static const s16 Passive07_0178[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 0xB, 0x40,
+    COM_J_COMMAND_ATTACK, 0xC, 0x20, 0xA, -1,
+    COM_WAIT, 5,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0x35, 0x36, 0x37, 0);
-        break;
+static const s16 Passive07_0179[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Passive07_0180[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0181[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_J_COMMAND_ATTACK, 8, 0x20, 0xA, -1,
+    COM_END,
+};
 
-void Passive07_0203(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xD, 0x100);
-        break;
+static const s16 Passive07_0182[] = {
+    COM_APPROACH_WALK, 0x3B, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0183[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-void Passive07_0204(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F98, 0, 4, 2, 0);
-        break;
+static const s16 Passive07_0184[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 10, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0, 0xA, -1);
-        break;
+static const s16 Passive07_0185[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0186[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-void Passive07_0205(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 1);
-        break;
+static const s16 Passive07_0187[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Look(wk, 0);
-        break;
+static const s16 Passive07_0188[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0189[] = {
+    COM_EM_TERM, -0x7F70, 0x28, 7, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Passive07_0206(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -1, 8, 0x400, 1, -1, 0x20, 0x400);
-        break;
+static const s16 Passive07_0190[] = {
+    COM_EM_TERM, -0x7F70, 0x28, 7, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0191[] = {
+    COM_APPROACH_WALK, 0x60, 2,
+    COM_COM_RANDOM_SELECT, 6, 0x3F, 0x40, 0x41, 0x43, 0,
+    COM_END,
+};
 
-void Passive07_0207(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FB0, 8, 0x40, 2, -1, -0x7FB0, 0x40);
-        break;
+static const s16 Passive07_0192[] = {
+    COM_KEEP_AWAY, 0xC7, 1,
+    COM_COM_RANDOM_SELECT, 6, 0xBA, 1, 0xAF, 0x92, 3,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
+static const s16 Passive07_0193[] = {
+    COM_WALK, 1, 0x20, -1,
+    COM_COM_RANDOM_SELECT, 6, 0xBA, 1, 0xAF, 0x92, 3,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0194[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_COM_RANDOM_SELECT, 6, 1, 1, 0xC0, 0xC0, 4,
+    COM_END,
+};
 
-void Passive07_0208(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FB0, 8, 0x40, 2, -1, -0x7FB0, 0x40);
-        break;
+static const s16 Passive07_0195[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_COM_RANDOM_SELECT, 6, 1, 1, 0xC0, 0xC0, 4,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 0xAF, 0xB0, 0x7C, 0x7B, 1);
-        break;
+static const s16 Passive07_0196[] = {
+    COM_EM_TERM, -0x7F70, 0x28, 7, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0197[] = {
+    COM_EM_TERM, -0x7F70, 0x28, 7, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-void Passive07_0209(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FB0, 8, 0x40, 2, -1, -0x7FB0, 0x40);
-        break;
+static const s16 Passive07_0198[] = {
+    COM_EM_TERM, -0x7F70, 0x28, 7, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x402,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
+static const s16 Passive07_0199[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0200[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x20, 0xA, -1,
+    COM_END,
+};
 
-void Passive07_0210(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 0);
-        break;
+static const s16 Passive07_0201[] = {
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_J_COMMAND_ATTACK, 0xC, 0x1C, 0xA, -1,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0202[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_SA_TERM, 0x35, 0x36, 0x37, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-void Passive07_0211(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Passive07_0203[] = {
+    COM_NORMAL_ATTACK, 0xD, 0x100,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0204[] = {
+    COM_EM_TERM, -0x7F98, 0, 4, 2, 0,
+    COM_COMMAND_ATTACK, 8, 0, 0xA, -1,
+    COM_END,
+};
 
-void Passive07_0212(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Passive07_0205[] = {
+    COM_JUMP, 1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, 0x50, -0x7FB0, 8, 1, -1);
-        break;
+static const s16 Passive07_0206[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -1, 8, 0x400, 1, -1, 0x20, 0x400,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x2E, 8, -1);
-        break;
+static const s16 Passive07_0207[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FB0, 8, 0x40, 2, -1, -0x7FB0, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0208[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FB0, 8, 0x40, 2, -1, -0x7FB0, 0x40,
+    COM_COM_RANDOM_SELECT, 6, 0xAF, 0xB0, 0x7C, 0x7B, 1,
+    COM_END,
+};
 
-void Passive07_0213(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1F, 0xA, -1);
-        break;
+static const s16 Passive07_0209[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FB0, 8, 0x40, 2, -1, -0x7FB0, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, 0x50, -0x7FB0, 8, 1, -1);
-        break;
+static const s16 Passive07_0210[] = {
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-    case 2:
-        SA_Term(wk, 0x48, 0xFFFF, 0xFFFF, 0);
-        break;
+static const s16 Passive07_0211[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x2E, 8, -1);
-        break;
+static const s16 Passive07_0212[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_EM_TERM, 0x50, -0x7FB0, 8, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x2E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive07_0213[] = {
+    COM_COMMAND_ATTACK, 8, 0x1F, 0xA, -1,
+    COM_EM_TERM, 0x50, -0x7FB0, 8, 1, -1,
+    COM_SA_TERM, 0x48, (s16)0xFFFF, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x2E, 8, -1,
+    COM_END,
+};
 
-void (*const Passive07_Tbl[214])(PLW*) = {
+const s16* const Passive07_Tbl[214] = {
     Passive07_0000, Passive07_0001, Passive07_0002, Passive07_0003, Passive07_0004, Passive07_0005, Passive07_0006,
     Passive07_0007, Passive07_0008, Passive07_0009, Passive07_0010, Passive07_0011, Passive07_0012, Passive07_0013,
     Passive07_0014, Passive07_0015, Passive07_0016, Passive07_0017, Passive07_0018, Passive07_0019, Passive07_0020,
@@ -4007,3 +1459,7 @@ void (*const Passive07_Tbl[214])(PLW*) = {
     Passive07_0203, Passive07_0204, Passive07_0205, Passive07_0206, Passive07_0207, Passive07_0208, Passive07_0209,
     Passive07_0210, Passive07_0211, Passive07_0212, Passive07_0213
 };
+
+void Passive07(PLW* wk) {
+    Exec_Com_Pattern(wk, Passive07_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
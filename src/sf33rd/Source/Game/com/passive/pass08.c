@@ -5,4016 +5,1438 @@
 
 #include "sf33rd/Source/Game/com/passive/pass08.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Passive08_Tbl[214])();
-
-void Passive08(PLW* wk) {
-    Passive08_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Passive08_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xD, M_Lv[wk->wu.id]);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x402);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 9, 0x1E, 8, -1);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, 0x28, 7, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, 0x28, 7, 1, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0xFFFF, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x50, 1, -1);
-        break;
-
-    case 1:
-        Jump(wk, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 6, 1, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 6, 1, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x200);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB8, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x20);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x202);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 9, 0, 0x20);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 0xB, 0, 0x20);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x39, 0xFFFF, 0xFFFF, 0);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, 0x40, 8, 0x100, 0, -0x7FC0, -1, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, 0x40, 8, 0x400, 0, -0x7FC0, -1, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x400);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_EX(wk, 6, 0xBC);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 8, 0x700);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
-
-    case 3:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
-
-    case 5:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 6:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x22);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x39, 0xFFFF, 0x3B, 0);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_EX(wk, 6, 0x3A);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 10, 0x70);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Lie(wk, 0);
-        break;
-
-    case 1:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 2:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, 0x28, 7, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 10, 0x700);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x400);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 1:
-        Walk(wk, 0, 0x10, 0);
-        break;
-
-    case 2:
-        Pierce_On(wk);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    case 4:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 5:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
-
-    case 6:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 7:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Lie(wk, 0);
-        break;
-
-    case 1:
-        Approach_Walk(wk, 0x7B, 2);
-        break;
-
-    case 2:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 0);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 0xB, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Lie(wk, 0);
-        break;
-
-    case 1:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Lie(wk, 0);
-        break;
-
-    case 1:
-        Approach_Walk(wk, 0xBF, 2);
-        break;
-
-    case 2:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FC0, -1, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7FB0, -1, 0, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0076(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0077(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0078(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    case 2:
-        Branch_Unit_Area(wk, 6, 0x55, 0x2F, 0x1B, 0x25);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0079(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    case 2:
-        Branch_Unit_Area(wk, 6, 0x53, 0x2F, 0x24, 0x25);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0080(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x202);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0081(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x39, 0x3A, 0x3B, 0);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0082(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    case 5:
-        Com_Random_Select(wk, 6, 0x2D, 0xFF, 0xFF, 0xFF, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0083(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0084(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0085(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0086(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xBF, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0087(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0088(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0089(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, -1, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0090(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0091(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 0xC, 0, 0x20);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0092(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 0xC, 0, 0x20);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    case 4:
-        J_Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0093(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, 0x28, 7, 1, -1);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 9, 0, 0x200);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0094(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0095(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0096(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0097(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0098(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0099(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0100(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0101(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x202);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0102(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0103(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0104(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x402);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0105(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0106(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0107(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FC0, 6, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0108(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FC8, 6, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0109(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FC8, 0, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0110(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x20);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0111(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x20);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x39, 0x3A, 0x3B, 0);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0112(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7B, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0113(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0114(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0115(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
-
-    case 2:
-        Command_Attack(wk, 0xC, 0x1E, 10, -1);
-        break;
-
-    case 3:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0116(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0117(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0118(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0119(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0120(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0121(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0122(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0123(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x202);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0124(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0125(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0126(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0127(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
-
-    case 3:
-        SA_Term(wk, 0x39, 0x3A, 0x3B, 0);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0128(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x39, 0x3A, 0x3B, 0);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0129(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    case 5:
-        J_Command_Attack(wk, 8, 0x1C, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0130(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x100);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0131(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0132(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x400);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0133(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x400);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0134(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0135(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0136(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FC0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0137(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0138(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0139(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0140(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 2:
-        SA_Term(wk, 0x39, 0x3A, 0x3B, 0);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0141(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
-
-    case 2:
-        Pierce_On(wk);
-        break;
-
-    case 3:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 1, 10, -1);
-        break;
-
-    case 5:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 6:
-        Command_Attack(wk, 8, 1, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0142(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FC0, 6, 1, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 0xC, 0x1C, 8, -1);
-        break;
-
-    case 3:
-        SA_Term(wk, 0x39, 0x3A, 0x3B, 0);
-        break;
-
-    case 4:
-        Pierce_On(wk);
-        break;
-
-    case 5:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 6:
-        Command_Attack(wk, 8, 1, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0143(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    case 4:
-        Pierce_On(wk);
-        break;
-
-    case 5:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 6:
-        Command_Attack(wk, 8, 1, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0144(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF8, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
-
-    case 3:
-        SA_Term(wk, 0x39, 0x3A, 0x3B, 0);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0145(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 2:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
-
-    case 4:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0146(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, -1, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0147(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0148(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xE, 0x20, 0xA, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xE, 0x20, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0149(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 0xE, 0x20, 9, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xE, 0x20, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0150(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_EX(wk, 6, 0x95);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xE, 0x20, 0xA, 0x700);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0151(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 4:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 5:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0152(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x400);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 3:
-        Com_Random_Select(wk, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0153(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        SA_Term(wk, 0x39, 0x3A, 0x3B, 0);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0154(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 0);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0155(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 0);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0156(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 0);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0157(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
-
-    case 2:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xB, 0x400);
-        break;
-
-    case 4:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
-
-    case 5:
-        J_Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive08_0158(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive08_0000[] = {
+    COM_NORMAL_ATTACK_M_LV, 0xD,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0, -1, -1);
-        break;
+static const s16 Passive08_0001[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 2:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1);
-        break;
+static const s16 Passive08_0002[] = {
+    COM_PIERCE_ON,
+    COM_NORMAL_ATTACK, 0xB, 0x402,
+    COM_J_COMMAND_ATTACK, 9, 0x1E, 8, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
+static const s16 Passive08_0003[] = {
+    COM_EM_TERM, -0x7FB0, 0x28, 7, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 4:
-        SA_Term(wk, 0x39, 0x3A, 0xFFFF, 0);
-        break;
+static const s16 Passive08_0004[] = {
+    COM_EM_TERM, -0x7F70, 0x28, 7, 1, -1,
+    COM_SA_TERM, (s16)0xFFFF, 0x3A, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 5:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive08_0005[] = {
+    COM_SEARCH_BACK_TERM, 0x50, 1, -1,
+    COM_JUMP, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0006[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_EM_TERM, -1, -0x7FF8, 6, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-void Passive08_0159(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
+static const s16 Passive08_0007[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_EM_TERM, -1, -0x7FF8, 6, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
+static const s16 Passive08_0008[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_END,
+};
 
-    case 2:
-        SA_Term(wk, 0x39, 0x3A, 0x3B, 0);
-        break;
+static const s16 Passive08_0009[] = {
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
+static const s16 Passive08_0010[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_END,
+};
 
-    case 4:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive08_0011[] = {
+    COM_WAIT, 0,
+    COM_END,
+};
 
-    case 5:
-        Pierce_On(wk);
-        break;
+static const s16 Passive08_0012[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-    case 6:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
+static const s16 Passive08_0013[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 7:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
+static const s16 Passive08_0014[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0015[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_NORMAL_ATTACK, 9, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-void Passive08_0160(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
+static const s16 Passive08_0016[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
+static const s16 Passive08_0017[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Passive08_0018[] = {
+    COM_EM_TERM, -1, -0x7FB8, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0019[] = {
+    COM_NORMAL_ATTACK, 9, 0x20,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Passive08_0161(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40);
-        break;
+static const s16 Passive08_0020[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0x39, 0x3A, 0x3B, 0);
-        break;
+static const s16 Passive08_0021[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive08_0022[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0023[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Passive08_0162(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive08_0024[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
+static const s16 Passive08_0025[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Passive08_0026[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 9, 0x402);
-        break;
+static const s16 Passive08_0027[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0028[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_END,
+};
 
-void Passive08_0163(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive08_0029[] = {
+    COM_PIERCE_ON,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
+static const s16 Passive08_0030[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
+static const s16 Passive08_0031[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_LEVER_ATTACK, 9, 0, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Passive08_0032[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_LEVER_ATTACK, 0xB, 0, 0x20,
+    COM_LEVER_ATTACK, 8, 0, 0x402,
+    COM_END,
+};
 
-    case 4:
-        Com_Random_Select(wk, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2);
-        break;
+static const s16 Passive08_0033[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0034[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive08_0164(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive08_0035[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Passive08_0036[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive08_0037[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive08_0038[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0039[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Passive08_0165(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive08_0040[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x402);
-        break;
+static const s16 Passive08_0041[] = {
+    COM_EM_TERM, -0x7F80, -1, 6, 1, -1,
+    COM_SA_TERM, 0x39, (s16)0xFFFF, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Passive08_0042[] = {
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0043[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, 0x40, 8, 0x100, 0, -0x7FC0, -1, 0x200,
+    COM_END,
+};
 
-void Passive08_0166(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive08_0044[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, 0x40, 8, 0x400, 0, -0x7FC0, -1, 0x200,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Passive08_0045[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive08_0046[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0047[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive08_0167(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive08_0048[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x402);
-        break;
+static const s16 Passive08_0049[] = {
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Passive08_0050[] = {
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive08_0051[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0052[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Passive08_0168(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, -1);
-        break;
+static const s16 Passive08_0053[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x400,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0054[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Passive08_0169(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
+static const s16 Passive08_0055[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive08_0056[] = {
+    COM_CHECK_EX, 6, 0xBC,
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, 0x700,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0057[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 0xC, 0x22,
+    COM_SA_TERM, 0x39, (s16)0xFFFF, 0x3B, 0,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-void Passive08_0170(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 0);
-        break;
+static const s16 Passive08_0058[] = {
+    COM_PROVOKE, -1,
+    COM_END,
+};
 
-    case 1:
-        Wait_Get_Up(wk, 3, -1);
-        break;
+static const s16 Passive08_0059[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0060[] = {
+    COM_CHECK_EX, 6, 0x3A,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 10, 0x70,
+    COM_END,
+};
 
-void Passive08_0171(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 0);
-        break;
+static const s16 Passive08_0061[] = {
+    COM_WAIT_LIE, 0,
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
+static const s16 Passive08_0062[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0063[] = {
+    COM_EM_TERM, -0x7FB0, 0x28, 7, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, 0x700,
+    COM_END,
+};
 
-void Passive08_0172(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 0);
-        break;
+static const s16 Passive08_0064[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Wait_Get_Up(wk, 3, -1);
-        break;
+static const s16 Passive08_0065[] = {
+    COM_WAIT_GET_UP, 0, 0,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x400,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0066[] = {
+    COM_WAIT_GET_UP, 0, 0,
+    COM_WALK, 0, 0x10, 0,
+    COM_PIERCE_ON,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_END,
+};
 
-void Passive08_0173(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0xFFFF, 0x3B, 0);
-        break;
+static const s16 Passive08_0067[] = {
+    COM_WAIT_GET_UP, 0, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0068[] = {
+    COM_WAIT_LIE, 0,
+    COM_APPROACH_WALK, 0x7B, 2,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-void Passive08_0174(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
+static const s16 Passive08_0069[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
+static const s16 Passive08_0070[] = {
+    COM_WAIT_GET_UP, 0, 0,
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 0xB, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 9, 0x40);
-        break;
+static const s16 Passive08_0071[] = {
+    COM_WAIT_LIE, 0,
+    COM_JUMP, 0,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 0xC, 0x1E, 9, -1);
-        break;
+static const s16 Passive08_0072[] = {
+    COM_WAIT_LIE, 0,
+    COM_APPROACH_WALK, 0xBF, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    case 4:
-        Wait(wk, 5);
-        break;
+static const s16 Passive08_0073[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    case 5:
-        SA_Term(wk, 0x39, 0x3A, 0x3B, 0);
-        break;
+static const s16 Passive08_0074[] = {
+    COM_EM_TERM, -0x7FC0, -1, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0075[] = {
+    COM_EM_TERM, -0x7FB0, -1, 0, 1, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-void Passive08_0175(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Passive08_0076[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_NORMAL_ATTACK, 0xB, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
+static const s16 Passive08_0077[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive08_0078[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_BRANCH_UNIT_AREA, 6, 0x55, 0x2F, 0x1B, 0x25,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0079[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_BRANCH_UNIT_AREA, 6, 0x53, 0x2F, 0x24, 0x25,
+    COM_END,
+};
 
-void Passive08_0176(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Passive08_0080[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
+static const s16 Passive08_0081[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40,
+    COM_SA_TERM, 0x39, 0x3A, 0x3B, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 0xB, 0x200);
-        break;
+static const s16 Passive08_0082[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 0,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Passive08_0083[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x40,
+    COM_END,
+};
 
-    case 4:
-        Com_Random_Select(wk, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2);
-        break;
+static const s16 Passive08_0084[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0085[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_END,
+};
 
-void Passive08_0177(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xB, 0x200);
-        break;
+static const s16 Passive08_0086[] = {
+    COM_APPROACH_WALK, 0xBF, 2,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive08_0087[] = {
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_END,
+};
 
-    case 2:
-        Com_Random_Select(wk, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2);
-        break;
+static const s16 Passive08_0088[] = {
+    COM_JUMP, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0089[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, -1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Passive08_0178(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive08_0090[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xB, 0x40);
-        break;
+static const s16 Passive08_0091[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_LEVER_ATTACK, 0xC, 0, 0x20,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 0xC, 0x1E, 0xA, -1);
-        break;
+static const s16 Passive08_0092[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_LEVER_ATTACK, 0xC, 0, 0x20,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_END,
+};
 
-    case 3:
-        SA_Term(wk, 0x39, 0x3A, 0x3B, 0);
-        break;
+static const s16 Passive08_0093[] = {
+    COM_EM_TERM, -0x7F80, 0x28, 7, 1, -1,
+    COM_LEVER_ATTACK, 9, 0, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0094[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive08_0179(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
+static const s16 Passive08_0095[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive08_0096[] = {
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0097[] = {
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive08_0180(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
+static const s16 Passive08_0098[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Passive08_0099[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
+static const s16 Passive08_0100[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive08_0101[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x202,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0102[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-void Passive08_0181(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
+static const s16 Passive08_0103[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive08_0104[] = {
+    COM_NORMAL_ATTACK, 9, 0x402,
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1E, 0xA, -1);
-        break;
+static const s16 Passive08_0105[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0106[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_END,
+};
 
-void Passive08_0182(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x3F, 2);
-        break;
+static const s16 Passive08_0107[] = {
+    COM_EM_TERM, -1, -0x7FC0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0108[] = {
+    COM_EM_TERM, -1, -0x7FC8, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-void Passive08_0183(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive08_0109[] = {
+    COM_EM_TERM, -1, -0x7FC8, 0, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x40);
-        break;
+static const s16 Passive08_0110[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_NORMAL_ATTACK, 0xC, 0x20,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Passive08_0111[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_NORMAL_ATTACK, 0xC, 0x20,
+    COM_SA_TERM, 0x39, 0x3A, 0x3B, 0,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0112[] = {
+    COM_APPROACH_WALK, 0x7B, 2,
+    COM_END,
+};
 
-void Passive08_0184(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200);
-        break;
+static const s16 Passive08_0113[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 9, 0x12);
-        break;
+static const s16 Passive08_0114[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 9, 0x102);
-        break;
+static const s16 Passive08_0115[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_COMMAND_ATTACK, 0xC, 0x1E, 10, -1,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_END,
+};
 
-    case 3:
-        Normal_Attack(wk, 8, 0x202);
-        break;
+static const s16 Passive08_0116[] = {
+    COM_FORCED_GUARD, 2,
+    COM_END,
+};
 
-    case 4:
-        J_Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
+static const s16 Passive08_0117[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_END,
+};
 
-    case 5:
-        Com_Random_Select(wk, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2);
-        break;
+static const s16 Passive08_0118[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0119[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-void Passive08_0185(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
+static const s16 Passive08_0120[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0121[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_END,
+};
 
-void Passive08_0186(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive08_0122[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
+static const s16 Passive08_0123[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 9, 0x202,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 2:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
+static const s16 Passive08_0124[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
+static const s16 Passive08_0125[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0126[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive08_0187(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive08_0127[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_SA_TERM, 0x39, 0x3A, 0x3B, 0,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 9, -1);
-        break;
+static const s16 Passive08_0128[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1,
+    COM_SA_TERM, 0x39, 0x3A, 0x3B, 0,
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
+static const s16 Passive08_0129[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 8, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
+static const s16 Passive08_0130[] = {
+    COM_NORMAL_ATTACK, 8, 0x100,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0131[] = {
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Passive08_0188(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive08_0132[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x400,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Passive08_0133[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x400,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 2:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
+static const s16 Passive08_0134[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
+static const s16 Passive08_0135[] = {
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0136[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_EM_TERM, -1, -0x7FC0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive08_0189(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, 0x28, 7, 1, -1);
-        break;
+static const s16 Passive08_0137[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 9, -1);
-        break;
+static const s16 Passive08_0138[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0139[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Passive08_0190(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, 0x28, 7, 1, -1);
-        break;
+static const s16 Passive08_0140[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_SA_TERM, 0x39, 0x3A, 0x3B, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive08_0141[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_PIERCE_ON,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, 10, -1,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0142[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_EM_TERM, -1, -0x7FC0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 0xC, 0x1C, 8, -1,
+    COM_SA_TERM, 0x39, 0x3A, 0x3B, 0,
+    COM_PIERCE_ON,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, 10, -1,
+    COM_END,
+};
 
-void Passive08_0191(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x60, 2);
-        break;
+static const s16 Passive08_0143[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_PIERCE_ON,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 0x3F, 0x40, 0x41, 0x43, 0);
-        break;
+static const s16 Passive08_0144[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_EM_TERM, -1, -0x7FF8, 6, 1, -1,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_SA_TERM, 0x39, 0x3A, 0x3B, 0,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0145[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-void Passive08_0192(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Away(wk, 0xBF, 1);
-        break;
+static const s16 Passive08_0146[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, -1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 0xBA, 1, 0xAF, 0x92, 3);
-        break;
+static const s16 Passive08_0147[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0148[] = {
+    COM_COMMAND_ATTACK, 0xE, 0x20, 0xA, -1,
+    COM_COMMAND_ATTACK, 0xE, 0x20, 0xA, -1,
+    COM_END,
+};
 
-void Passive08_0193(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, -1);
-        break;
+static const s16 Passive08_0149[] = {
+    COM_COMMAND_ATTACK, 0xE, 0x20, 9, -1,
+    COM_COMMAND_ATTACK, 0xE, 0x20, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 0xBA, 1, 0xAF, 0x92, 3);
-        break;
+static const s16 Passive08_0150[] = {
+    COM_CHECK_EX, 6, 0x95,
+    COM_COMMAND_ATTACK, 0xE, 0x20, 0xA, 0x700,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0151[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Passive08_0194(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
+static const s16 Passive08_0152[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_NORMAL_ATTACK, 0xB, 0x400,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 1, 1, 0xC0, 0xC0, 4);
-        break;
+static const s16 Passive08_0153[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_SA_TERM, 0x39, 0x3A, 0x3B, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0154[] = {
+    COM_KEEP_AWAY, 0xBF, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-void Passive08_0195(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive08_0155[] = {
+    COM_KEEP_AWAY, 0xBF, 0,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 1, 1, 0xC0, 0xC0, 4);
-        break;
+static const s16 Passive08_0156[] = {
+    COM_KEEP_AWAY, 0xBF, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0157[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40,
+    COM_NORMAL_ATTACK, 0xB, 0x400,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive08_0196(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, 0x28, 7, 1, -1);
-        break;
+static const s16 Passive08_0158[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, -1, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -1, -1, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_SA_TERM, 0x39, 0x3A, (s16)0xFFFF, 0,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Passive08_0159[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_SA_TERM, 0x39, 0x3A, 0x3B, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_PIERCE_ON,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0160[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-void Passive08_0197(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, 0x28, 7, 1, -1);
-        break;
+static const s16 Passive08_0161[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x40,
+    COM_SA_TERM, 0x39, 0x3A, 0x3B, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
+static const s16 Passive08_0162[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_NORMAL_ATTACK, 9, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0163[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2,
+    COM_END,
+};
 
-void Passive08_0198(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, 0x28, 7, 1, -1);
-        break;
+static const s16 Passive08_0164[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x402);
-        break;
+static const s16 Passive08_0165[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x402,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0166[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive08_0199(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
+static const s16 Passive08_0167[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x400, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x402,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive08_0168[] = {
+    COM_WALK, 1, 0x20, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0169[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive08_0200(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
+static const s16 Passive08_0170[] = {
+    COM_KEEP_AWAY, 0xBF, 0,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive08_0171[] = {
+    COM_KEEP_AWAY, 0xBF, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    case 2:
-        Pierce_On(wk);
-        break;
+static const s16 Passive08_0172[] = {
+    COM_KEEP_AWAY, 0xBF, 0,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    case 3:
-        Search_Back_Term(wk, 0x60, 1, -1);
-        break;
+static const s16 Passive08_0173[] = {
+    COM_SA_TERM, (s16)0xFFFF, (s16)0xFFFF, 0x3B, 0,
+    COM_END,
+};
 
-    case 4:
-        Command_Attack(wk, 8, 1, -1, -1);
-        break;
+static const s16 Passive08_0174[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_J_COMMAND_ATTACK, 0xC, 0x1E, 9, -1,
+    COM_WAIT, 5,
+    COM_SA_TERM, 0x39, 0x3A, 0x3B, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0175[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive08_0201(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x40);
-        break;
+static const s16 Passive08_0176[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 0xB, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 0xC, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive08_0177[] = {
+    COM_NORMAL_ATTACK, 0xB, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2,
+    COM_END,
+};
 
-    case 2:
-        Wait(wk, 5);
-        break;
+static const s16 Passive08_0178[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 0xB, 0x40,
+    COM_J_COMMAND_ATTACK, 0xC, 0x1E, 0xA, -1,
+    COM_SA_TERM, 0x39, 0x3A, 0x3B, 0,
+    COM_END,
+};
 
-    case 3:
-        SA_Term(wk, 0x39, 0x3A, 0x3B, 0);
-        break;
+static const s16 Passive08_0179[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0180[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive08_0202(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xC, 0x40);
-        break;
+static const s16 Passive08_0181[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_J_COMMAND_ATTACK, 8, 0x1E, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        SA_Term(wk, 0x39, 0x3A, 0x3B, 0);
-        break;
+static const s16 Passive08_0182[] = {
+    COM_APPROACH_WALK, 0x3F, 2,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 8, 0x1D, 0xA, -1);
-        break;
+static const s16 Passive08_0183[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FC0, 9, 0x40, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0184[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 9, 0x200, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x2D, 0xFF, 0xFF, 0xFF, 2,
+    COM_END,
+};
 
-void Passive08_0203(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 2);
-        break;
+static const s16 Passive08_0185[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive08_0186[] = {
+    COM_PIERCE_ON,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0187[] = {
+    COM_PIERCE_ON,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 9, -1,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_END,
+};
 
-void Passive08_0204(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 6);
-        break;
+static const s16 Passive08_0188[] = {
+    COM_PIERCE_ON,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive08_0189[] = {
+    COM_EM_TERM, -0x7F70, 0x28, 7, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0190[] = {
+    COM_EM_TERM, -0x7F70, 0x28, 7, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive08_0205(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 1);
-        break;
+static const s16 Passive08_0191[] = {
+    COM_APPROACH_WALK, 0x60, 2,
+    COM_COM_RANDOM_SELECT, 6, 0x3F, 0x40, 0x41, 0x43, 0,
+    COM_END,
+};
 
-    case 1:
-        Look(wk, 0);
-        break;
+static const s16 Passive08_0192[] = {
+    COM_KEEP_AWAY, 0xBF, 1,
+    COM_COM_RANDOM_SELECT, 6, 0xBA, 1, 0xAF, 0x92, 3,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0193[] = {
+    COM_WALK, 1, 0x20, -1,
+    COM_COM_RANDOM_SELECT, 6, 0xBA, 1, 0xAF, 0x92, 3,
+    COM_END,
+};
 
-void Passive08_0206(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -1, 8, 0x400, 1, -1, 0x20, 0x400);
-        break;
+static const s16 Passive08_0194[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_COM_RANDOM_SELECT, 6, 1, 1, 0xC0, 0xC0, 4,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0195[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_COM_RANDOM_SELECT, 6, 1, 1, 0xC0, 0xC0, 4,
+    COM_END,
+};
 
-void Passive08_0207(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FB0, 8, 0x200, 2, -1, -0x7FB0, 0x200);
-        break;
+static const s16 Passive08_0196[] = {
+    COM_EM_TERM, -0x7F70, 0x28, 7, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
+static const s16 Passive08_0197[] = {
+    COM_EM_TERM, -0x7F70, 0x28, 7, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0198[] = {
+    COM_EM_TERM, -0x7F70, 0x28, 7, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x402,
+    COM_END,
+};
 
-void Passive08_0208(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FB0, 8, 0x400, 2, -1, -0x7FB0, 0x400);
-        break;
+static const s16 Passive08_0199[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        Com_Random_Select(wk, 6, 0xAF, 0xB0, 0x78, 0x7B, 1);
-        break;
+static const s16 Passive08_0200[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_PIERCE_ON,
+    COM_SEARCH_BACK_TERM, 0x60, 1, -1,
+    COM_COMMAND_ATTACK, 8, 1, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0201[] = {
+    COM_NORMAL_ATTACK, 9, 0x40,
+    COM_J_COMMAND_ATTACK, 0xC, 0x1C, 0xA, -1,
+    COM_WAIT, 5,
+    COM_SA_TERM, 0x39, 0x3A, 0x3B, 0,
+    COM_END,
+};
 
-void Passive08_0209(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA0, -0x7FB0, 8, 0x40, 2, -1, -0x7FB0, 0x40);
-        break;
+static const s16 Passive08_0202[] = {
+    COM_NORMAL_ATTACK, 0xC, 0x40,
+    COM_SA_TERM, 0x39, 0x3A, 0x3B, 0,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 0xA, -1,
+    COM_END,
+};
 
-    case 1:
-        J_Command_Attack(wk, 8, 0x20, 9, -1);
-        break;
+static const s16 Passive08_0203[] = {
+    COM_WAIT, 2,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0204[] = {
+    COM_WAIT, 6,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive08_0210(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FB0, 8, 0x200, 2, -1, -0x7FB0, 0x200);
-        break;
+static const s16 Passive08_0205[] = {
+    COM_JUMP, 1,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
+static const s16 Passive08_0206[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -1, 8, 0x400, 1, -1, 0x20, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0207[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FB0, 8, 0x200, 2, -1, -0x7FB0, 0x200,
+    COM_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
 
-void Passive08_0211(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive08_0208[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FB0, 8, 0x400, 2, -1, -0x7FB0, 0x400,
+    COM_COM_RANDOM_SELECT, 6, 0xAF, 0xB0, 0x78, 0x7B, 1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0209[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA0, -0x7FB0, 8, 0x40, 2, -1, -0x7FB0, 0x40,
+    COM_J_COMMAND_ATTACK, 8, 0x20, 9, -1,
+    COM_END,
+};
 
-void Passive08_0212(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 9, 0x1F, 8, -1);
-        break;
+static const s16 Passive08_0210[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FB0, 8, 0x200, 2, -1, -0x7FB0, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0211[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive08_0213(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7F00, 0x38, 8, 0x200, 1, -1, -1, -1);
-        break;
+static const s16 Passive08_0212[] = {
+    COM_COMMAND_ATTACK, 9, 0x1F, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive08_0213[] = {
+    COM_JUMP_ATTACK_TERM, -0x7F00, 0x38, 8, 0x200, 1, -1, -1, -1,
+    COM_END,
+};
 
-void (*const Passive08_Tbl[214])(PLW*) = {
+const s16* const Passive08_Tbl[214] = {
     Passive08_0000, Passive08_0001, Passive08_0002, Passive08_0003, Passive08_0004, Passive08_0005, Passive08_0006,
     Passive08_0007, Passive08_0008, Passive08_0009, Passive08_0010, Passive08_0011, Passive08_0012, Passive08_0013,
     Passive08_0014, Passive08_0015, Passive08_0016, Passive08_0017, Passive08_0018, Passive08_0019, Passive08_0020,
@@ -4047,3 +1469,7 @@ void (*const Passive08_Tbl[214])(PLW*) = {
     Passive08_0203, Passive08_0204, Passive08_0205, Passive08_0206, Passive08_0207, Passive08_0208, Passive08_0209,
     Passive08_0210, Passive08_0211, Passive08_0212, Passive08_0213
 };
+
+void Passive08(PLW* wk) {
+    Exec_Com_Pattern(wk, Passive08_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
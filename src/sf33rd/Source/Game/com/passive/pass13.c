@@ -5,2856 +5,1048 @@
 
 #include "sf33rd/Source/Game/com/passive/pass13.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Passive13_Tbl[164])();
-
-void Passive13(PLW* wk) {
-    Passive13_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Passive13_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 0xD, M_Lv[wk->wu.id]);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        Look(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0, 10, -1);
-        break;
-
-    case 3:
-        EM_Term(wk, 0x7FFF, -1, 1, 1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        VS_Jump_Guard(wk);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x53);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 1, 0xB, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, 0x7FFF, -1, 1, 1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 1, 0xB, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 8, 0x700);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_On(wk, 1, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, 0x38, 7, 1, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Short_Range_Attack(wk, 8, 0x40, 6, 0x1D);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0012(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, 0, 0, 2, 0);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0013(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x22);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0014(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0015(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0016(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x71, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0017(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x71, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0018(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x71, 2);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0019(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0020(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0021(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0022(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -1, -0x7FC0, -0x5FF5, 0x40, 0, -0x7F90, -1, 0x20);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0023(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -1, -0x7FC0, -0x5FF5, 0x400, 0, -0x7F90, -1, 0x200);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0024(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0025(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x68);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 10, -1);
-        break;
-
-    case 3:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0026(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0027(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0028(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x220);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0029(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0030(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0031(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x20, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0032(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0033(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0034(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0035(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0036(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FE8, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x102);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x202);
-        break;
-
-    case 3:
-        Next_Another_Menu(wk, 6, 0x8B);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0037(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FFE, 6, 1, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0038(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FFE, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0039(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0040(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        EM_Term(wk, -0x7F80, -0x7FB0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x42);
-        break;
-
-    case 3:
-        Wait(wk, 5);
-        break;
-
-    case 4:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0041(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x100);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0042(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, -0x5FF8, 0x40, 0, -0x7F90, -1, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0043(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -0x7FB0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0044(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FC0, 6, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0045(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7F90, 6, 1, -1);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0046(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Status(wk, 2, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0047(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0048(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -0x7FC0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x12);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0049(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Adjust_Attack(wk, 8, 0x10);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0050(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x12);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x22);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0051(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 0xB, 0xE, 10, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0052(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0053(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0054(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7B, 2);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0055(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7B, 2);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 9, 0x1F, 8, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0056(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, -0x5FF8, 0x40, 0, -0x7F90, -1, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0057(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, -0x5FF8, 0x40, 0, -0x7F90, -1, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0058(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Keep_Status(wk, 2, 1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0059(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 0, 6, 0x34);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0060(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Forced_Guard(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0061(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0062(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -0x7FC0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0063(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0064(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0065(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0066(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 3, 6, 6);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0067(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0068(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 6, 0x59, 0x59, 0x59, 0x5A, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0069(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, 0xB, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0070(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0071(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 0xB, 0xE, 10, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0072(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xC, 0, 0xB, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0073(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FA0, -0x5FF8, 0x400, 0, -0x7F90, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x12);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0074(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0075(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0076(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xB1, 2);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -1, -0x7FC0, -0x5FF8, 0x400, 0, -0x7F90, -1, 0x20);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 4:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0077(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, -0x5FF5, 0x40, 0, -0x7F90, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0078(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, -0x5FF5, 0x400, 0, -0x7F90, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0079(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, -0x7FC0, -0x5FF5, 0x40, 0, -1, -1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0080(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FB0, -0x5FF5, 0x40, 0, -0x7F90, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x200);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0081(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FA0, -0x5FF5, 0x400, 0, -0x7F90, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 0xB, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x200);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0082(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FA0, -0x5FF5, 0x40, 0, -1, -1, 0xFFFF);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0083(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FA0, -0x5FF5, 0x400, 0, -0x7F90, -1, 0x20);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0084(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump_Attack_Term(wk, -1, -0x7FA0, -0x5FF5, 0x400, 0, -0x7F90, -1, 0x200);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0085(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait(wk, 8);
-        break;
-
-    case 1:
-        J_Command_Attack(wk, 8, 0x1D, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0086(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 3:
-        Wait(wk, 5);
-        break;
-
-    case 4:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0087(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 0xB, 0x1F, 9, -1);
-        break;
-
-    case 4:
-        ETC_Term(wk, 2, 6, 1);
-        break;
-
-    case 5:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0088(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        Approach_Walk(wk, 0xB1, 2);
-        break;
-
-    case 2:
-        Jump_Attack_Term(wk, -1, -0x7FC0, -0x5FF5, 0x400, 0, -0x7F90, -1, 0x200);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 4:
-        J_Command_Attack(wk, 0xB, 0x1F, 9, -1);
-        break;
-
-    case 5:
-        ETC_Term(wk, 2, 6, 1);
-        break;
-
-    case 6:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0089(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0090(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0091(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0092(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB8, 6, 1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0093(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x102);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0094(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Com_Random_Select(wk, 6, 0x59, 0x5A, 0x5A, 0x5B, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0095(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Walk(wk, 1, 0x30, 0);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 6, 0x59, 0x59, 0x59, 0x5A, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0096(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x402);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0097(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FFE, 6, 1, -1);
-        break;
-
-    case 2:
-        Lever_Attack(wk, 8, 0, 0x110);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0098(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x33, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FF0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 9, 0x100);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 4:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0099(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 9, 0x10);
-        break;
-
-    case 1:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0100(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0101(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 6, 0x59, 0x5A, 0x5A, 0x5B, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0102(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 1:
-        Com_Random_Select(wk, 6, 0x59, 0x59, 0x59, 0x5A, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0103(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x68);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x20, 0);
-        break;
-
-    case 2:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0104(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Hi_Jump(wk, 0xD, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0105(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x68);
-        break;
-
-    case 1:
-        Pierce_On(wk);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 1, 10, -1);
-        break;
-
-    case 3:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0106(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x60, 6, 0x68);
-        break;
-
-    case 1:
-        Walk(wk, 1, 0x38, 0);
-        break;
-
-    case 2:
-        Wait_Get_Up(wk, 3, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0107(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FD0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 3:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0108(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0xBB, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0109(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7F90, 6, 1, -1);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 0xB, 0x1F, 9, 0x70);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0110(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
-
-    case 1:
-        Wait_Get_Up(wk, 0, -1);
-        break;
-
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0111(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x7B, 2);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FA0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0112(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
-
-    case 1:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1F, 9, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Passive13_0113(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive13_0000[] = {
+    COM_NORMAL_ATTACK_M_LV, 0xD,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, -0x7FA8, 6, 1, -1);
-        break;
+static const s16 Passive13_0001[] = {
+    COM_LEVER_OFF,
+    COM_LOOK, 0,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
+static const s16 Passive13_0002[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 0, 10, -1,
+    COM_EM_TERM, 0x7FFF, -1, 1, 1, -1,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 0xB, 0x1F, 9, -1);
-        break;
+static const s16 Passive13_0003[] = {
+    COM_VS_JUMP_GUARD,
+    COM_END,
+};
 
-    case 4:
-        Lever_On(wk, 1, 2);
-        break;
+static const s16 Passive13_0004[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x53,
+    COM_COMMAND_ATTACK, 8, 1, 0xB, -1,
+    COM_END,
+};
 
-    case 5:
-        Wait(wk, 5);
-        break;
+static const s16 Passive13_0005[] = {
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-    case 6:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
+static const s16 Passive13_0006[] = {
+    COM_APPROACH_WALK, 0x7B, 2,
+    COM_EM_TERM, 0x7FFF, -1, 1, 1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0007[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Passive13_0114(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive13_0008[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 1, 0xB, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, 0x700,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, 0x30, 7, 1, -1);
-        break;
+static const s16 Passive13_0009[] = {
+    COM_LEVER_ON, 1, 2,
+    COM_EM_TERM, -1, 0x38, 7, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        J_Command_Attack(wk, 0xB, 0x1F, 9, -1);
-        break;
+static const s16 Passive13_0010[] = {
+    COM_SHORT_RANGE_ATTACK, 8, 0x40, 6, 0x1D,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
+static const s16 Passive13_0011[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0012[] = {
+    COM_EM_TERM, -0x7F80, 0, 0, 2, 0,
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-void Passive13_0115(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive13_0013[] = {
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 0xB, 0x22,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
+static const s16 Passive13_0014[] = {
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
+static const s16 Passive13_0015[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-    case 3:
-        J_Command_Attack(wk, 0xB, 0x1F, 9, -1);
-        break;
+static const s16 Passive13_0016[] = {
+    COM_APPROACH_WALK, 0x71, 2,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_END,
+};
 
-    case 4:
-        ETC_Term(wk, 2, 6, 1);
-        break;
+static const s16 Passive13_0017[] = {
+    COM_APPROACH_WALK, 0x71, 2,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 5:
-        J_Command_Attack(wk, 8, 0x1F, 8, -1);
-        break;
+static const s16 Passive13_0018[] = {
+    COM_APPROACH_WALK, 0x71, 2,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0019[] = {
+    COM_WAIT_GET_UP, 0, 1,
+    COM_END,
+};
 
-void Passive13_0116(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x10, -0x5FF8, 0x400, 1, -1, 0x10, 0x400);
-        break;
+static const s16 Passive13_0020[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0021[] = {
+    COM_WAIT_GET_UP, 3, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive13_0117(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x10, -0x5FF8, 0x200, 1, -1, 0x10, 0x20);
-        break;
+static const s16 Passive13_0022[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, -0x5FF5, 0x40, 0, -0x7F90, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0023[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, -0x5FF5, 0x400, 0, -0x7F90, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Passive13_0118(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x10, -0x5FF8, 0x20, 1, -1, 0x10, 0x20);
-        break;
+static const s16 Passive13_0024[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0025[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x68,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 10, -1,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-void Passive13_0119(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x10, -0x5FF8, 0x400, 0, -1, 0x10, 0x400);
-        break;
+static const s16 Passive13_0026[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0027[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-void Passive13_0120(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x10, -0x5FF8, 0x200, 0, -1, 0x10, 0x20);
-        break;
+static const s16 Passive13_0028[] = {
+    COM_NORMAL_ATTACK, 8, 0x220,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0029[] = {
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-void Passive13_0121(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -1, 0x10, -0x5FF8, 0x20, 0, -1, 0x10, 0x20);
-        break;
+static const s16 Passive13_0030[] = {
+    COM_EM_TERM, -0x7F80, -0x7FD0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0031[] = {
+    COM_WALK, 1, 0x20, 1,
+    COM_END,
+};
 
-void Passive13_0122(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -1, 0x30, 6, 1, -1);
-        break;
+static const s16 Passive13_0032[] = {
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x42);
-        break;
+static const s16 Passive13_0033[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0034[] = {
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive13_0123(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive13_0035[] = {
+    COM_NORMAL_ATTACK, 9, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, 0x30, 6, 1, -1);
-        break;
+static const s16 Passive13_0036[] = {
+    COM_EM_TERM, -1, -0x7FE8, 6, 1, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x102,
+    COM_NORMAL_ATTACK, 0xB, 0x202,
+    COM_NEXT_ANOTHER_MENU, 6, 0x8B,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 9, 0x42);
-        break;
+static const s16 Passive13_0037[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_EM_TERM, -1, -0x7FFE, 6, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    case 3:
-        Wait(wk, 5);
-        break;
+static const s16 Passive13_0038[] = {
+    COM_EM_TERM, -1, -0x7FFE, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-    case 4:
-        Normal_Attack(wk, 8, 0x40);
-        break;
+static const s16 Passive13_0039[] = {
+    COM_APPROACH_WALK, 0x7B, 2,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0040[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -0x7F80, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x42,
+    COM_WAIT, 5,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive13_0124(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive13_0041[] = {
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 1:
-        EM_Term(wk, -1, 0x30, 6, 1, -1);
-        break;
+static const s16 Passive13_0042[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, -0x5FF8, 0x40, 0, -0x7F90, -1, 0x40,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x42);
-        break;
+static const s16 Passive13_0043[] = {
+    COM_EM_TERM, -0x7F80, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 3:
-        Wait(wk, 5);
-        break;
+static const s16 Passive13_0044[] = {
+    COM_EM_TERM, -1, -0x7FC0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 4:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive13_0045[] = {
+    COM_EM_TERM, -1, -0x7F90, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0046[] = {
+    COM_KEEP_STATUS, 2, -1,
+    COM_END,
+};
 
-void Passive13_0125(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x48, 6, 0x22);
-        break;
+static const s16 Passive13_0047[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x18, 0);
-        break;
+static const s16 Passive13_0048[] = {
+    COM_EM_TERM, -0x7F80, -0x7FC0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive13_0049[] = {
+    COM_ADJUST_ATTACK, 8, 0x10,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0050[] = {
+    COM_NORMAL_ATTACK, 9, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_END,
+};
 
-void Passive13_0126(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x40);
-        break;
+static const s16 Passive13_0051[] = {
+    COM_J_COMMAND_ATTACK, 0xB, 0xE, 10, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0052[] = {
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
 
-void Passive13_0127(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x48, 6, 0x7E);
-        break;
+static const s16 Passive13_0053[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x18, 0);
-        break;
+static const s16 Passive13_0054[] = {
+    COM_APPROACH_WALK, 0x7B, 2,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x40);
-        break;
+static const s16 Passive13_0055[] = {
+    COM_APPROACH_WALK, 0x7B, 2,
+    COM_J_COMMAND_ATTACK, 9, 0x1F, 8, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0056[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, -0x5FF8, 0x40, 0, -0x7F90, -1, 0x400,
+    COM_END,
+};
 
-void Passive13_0128(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F80, -0x7FB0, 6, 1, -1);
-        break;
+static const s16 Passive13_0057[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, -0x5FF8, 0x40, 0, -0x7F90, -1, 0x20,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Passive13_0058[] = {
+    COM_KEEP_STATUS, 2, 1,
+    COM_END,
+};
 
-    case 2:
-        Normal_Attack(wk, 8, 0x12);
-        break;
+static const s16 Passive13_0059[] = {
+    COM_ETC_TERM, 0, 6, 0x34,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0060[] = {
+    COM_FORCED_GUARD, 0,
+    COM_END,
+};
 
-void Passive13_0129(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
+static const s16 Passive13_0061[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0062[] = {
+    COM_EM_TERM, -0x7F80, -0x7FC0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-void Passive13_0130(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Search_Back_Term(wk, 0x50, 6, 0x6E);
-        break;
+static const s16 Passive13_0063[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Walk(wk, 1, 0x18, 0);
-        break;
+static const s16 Passive13_0064[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-    case 2:
-        EM_Term(wk, -1, -0x7FB0, 6, 1, -1);
-        break;
+static const s16 Passive13_0065[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1C, 10, -1);
-        break;
+static const s16 Passive13_0066[] = {
+    COM_ETC_TERM, 3, 6, 6,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0067[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_END,
+};
 
-void Passive13_0131(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Approach_Walk(wk, 0x71, 2);
-        break;
+static const s16 Passive13_0068[] = {
+    COM_COM_RANDOM_SELECT, 6, 0x59, 0x59, 0x59, 0x5A, 0,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 8, 0x400);
-        break;
+static const s16 Passive13_0069[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, 0xB, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0070[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_NORMAL_ATTACK, 8, 0x110,
+    COM_END,
+};
 
-void Passive13_0132(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0xFFFF, 0x3A, 0x3D, 0xFFFF);
-        break;
+static const s16 Passive13_0071[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_J_COMMAND_ATTACK, 0xB, 0xE, 10, -1,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Passive13_0072[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 0xC, 0, 0xB, -1,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0073[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FA0, -0x5FF8, 0x400, 0, -0x7F90, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-void Passive13_0133(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SA_Term(wk, 0x39, 0x3A, 0x3C, 0xFFFF);
-        break;
+static const s16 Passive13_0074[] = {
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Check_Store_Lever(wk, 0x1C, 6, 0x86);
-        break;
+static const s16 Passive13_0075[] = {
+    COM_NORMAL_ATTACK, 9, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 10, 0x700);
-        break;
+static const s16 Passive13_0076[] = {
+    COM_APPROACH_WALK, 0xB1, 2,
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, -0x5FF8, 0x400, 0, -0x7F90, -1, 0x20,
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0077[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, -0x5FF5, 0x40, 0, -0x7F90, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive13_0134(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, 0x70);
-        break;
+static const s16 Passive13_0078[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, -0x5FF5, 0x400, 0, -0x7F90, -1, 0x20,
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0, 0xB, -1);
-        break;
+static const s16 Passive13_0079[] = {
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, -0x5FF5, 0x40, 0, -1, -1, -1,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0080[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FB0, -0x5FF5, 0x40, 0, -0x7F90, -1, 0x200,
+    COM_NORMAL_ATTACK, 0xB, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Passive13_0135(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Provoke(wk, 3);
-        break;
+static const s16 Passive13_0081[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FA0, -0x5FF5, 0x400, 0, -0x7F90, -1, 0x20,
+    COM_NORMAL_ATTACK, 0xB, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0082[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FA0, -0x5FF5, 0x40, 0, -1, -1, (s16)0xFFFF,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-void Passive13_0136(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 7, 6, 0x85);
-        break;
+static const s16 Passive13_0083[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FA0, -0x5FF5, 0x400, 0, -0x7F90, -1, 0x20,
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 1:
-        Check_SA(wk, 2, 0x35);
-        break;
+static const s16 Passive13_0084[] = {
+    COM_HI_JUMP_ATTACK_TERM, -1, -0x7FA0, -0x5FF5, 0x400, 0, -0x7F90, -1, 0x200,
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        Branch_Unit_Area(wk, 6, 0x89, 0x89, 0x8A, 0x8B);
-        break;
+static const s16 Passive13_0085[] = {
+    COM_WAIT, 8,
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0086[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_WAIT, 5,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive13_0137(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 9, -1);
-        break;
+static const s16 Passive13_0087[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 0xB, 0x1F, 9, -1,
+    COM_ETC_TERM, 2, 6, 1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 1:
-        Check_SA(wk, 2, 0x35);
-        break;
+static const s16 Passive13_0088[] = {
+    COM_PIERCE_ON,
+    COM_APPROACH_WALK, 0xB1, 2,
+    COM_JUMP_ATTACK_TERM, -1, -0x7FC0, -0x5FF5, 0x400, 0, -0x7F90, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 0xB, 0x1F, 9, -1,
+    COM_ETC_TERM, 2, 6, 1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x8016, 8, -1);
-        break;
+static const s16 Passive13_0089[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Passive13_0090[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0091[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 10, -1,
+    COM_END,
+};
 
-void Passive13_0138(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 10, -1);
-        break;
+static const s16 Passive13_0092[] = {
+    COM_EM_TERM, -1, -0x7FB8, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 1:
-        Check_SA(wk, 2, 0x35);
-        break;
+static const s16 Passive13_0093[] = {
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_NORMAL_ATTACK, 8, 0x102,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x8016, 8, -1);
-        break;
+static const s16 Passive13_0094[] = {
+    COM_COM_RANDOM_SELECT, 6, 0x59, 0x5A, 0x5A, 0x5B, 0,
+    COM_END,
+};
 
-    case 3:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Passive13_0095[] = {
+    COM_WALK, 1, 0x30, 0,
+    COM_COM_RANDOM_SELECT, 6, 0x59, 0x59, 0x59, 0x5A, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0096[] = {
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-void Passive13_0139(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x8016, 10, -1);
-        break;
+static const s16 Passive13_0097[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_EM_TERM, -1, -0x7FFE, 6, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x110,
+    COM_END,
+};
 
-    case 1:
-        Check_SA(wk, 2, 0x34);
-        break;
+static const s16 Passive13_0098[] = {
+    COM_APPROACH_WALK, 0x33, 2,
+    COM_EM_TERM, -1, -0x7FF0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x100,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
+static const s16 Passive13_0099[] = {
+    COM_NORMAL_ATTACK, 9, 0x10,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    case 3:
-        Com_Random_Select(wk, 2, 0x31, 0x31, 0x32, 0x33, 0);
-        break;
+static const s16 Passive13_0100[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0101[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x59, 0x5A, 0x5A, 0x5B, 0,
+    COM_END,
+};
 
-void Passive13_0140(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 6, 0x8D, 0x8D, 0x8E, 0x8F);
-        break;
+static const s16 Passive13_0102[] = {
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COM_RANDOM_SELECT, 6, 0x59, 0x59, 0x59, 0x5A, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0103[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x68,
+    COM_WALK, 1, 0x20, 0,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_END,
+};
 
-void Passive13_0141(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 8, 0x700);
-        break;
+static const s16 Passive13_0104[] = {
+    COM_HI_JUMP, 0xD, 0,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0105[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x68,
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 10, -1,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-void Passive13_0142(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 9, 0x700);
-        break;
+static const s16 Passive13_0106[] = {
+    COM_SEARCH_BACK_TERM, 0x60, 6, 0x68,
+    COM_WALK, 1, 0x38, 0,
+    COM_WAIT_GET_UP, 3, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0107[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7FD0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Passive13_0143(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1C, 10, 0x700);
-        break;
+static const s16 Passive13_0108[] = {
+    COM_APPROACH_WALK, 0xBB, 2,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0109[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7F90, 6, 1, -1,
+    COM_J_COMMAND_ATTACK, 0xB, 0x1F, 9, 0x70,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-void Passive13_0144(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Branch_Unit_Area(wk, 6, 0x91, 0x91, 0x92, 0x93);
-        break;
+static const s16 Passive13_0110[] = {
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_WAIT_GET_UP, 0, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0111[] = {
+    COM_APPROACH_WALK, 0x7B, 2,
+    COM_EM_TERM, -1, -0x7FA0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-void Passive13_0145(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 8, 0x700);
-        break;
+static const s16 Passive13_0112[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 9, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0113[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7FA8, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 0xB, 0x1F, 9, -1,
+    COM_LEVER_ON, 1, 2,
+    COM_WAIT, 5,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive13_0146(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 9, 0x700);
-        break;
+static const s16 Passive13_0114[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, 0x30, 7, 1, -1,
+    COM_J_COMMAND_ATTACK, 0xB, 0x1F, 9, -1,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0115[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_J_COMMAND_ATTACK, 0xB, 0x1F, 9, -1,
+    COM_ETC_TERM, 2, 6, 1,
+    COM_J_COMMAND_ATTACK, 8, 0x1F, 8, -1,
+    COM_END,
+};
 
-void Passive13_0147(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1D, 10, 0x700);
-        break;
+static const s16 Passive13_0116[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x10, -0x5FF8, 0x400, 1, -1, 0x10, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0117[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x10, -0x5FF8, 0x200, 1, -1, 0x10, 0x20,
+    COM_END,
+};
 
-void Passive13_0148(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump(wk, 1);
-        break;
+static const s16 Passive13_0118[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x10, -0x5FF8, 0x20, 1, -1, 0x10, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0119[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x10, -0x5FF8, 0x400, 0, -1, 0x10, 0x400,
+    COM_END,
+};
 
-void Passive13_0149(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Jump_Attack_Term(wk, -0x7FC0, -1, -0x5FF8, 0x200, 1, -1, -1, -1);
-        break;
+static const s16 Passive13_0120[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x10, -0x5FF8, 0x200, 0, -1, 0x10, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0121[] = {
+    COM_JUMP_ATTACK_TERM, -1, 0x10, -0x5FF8, 0x20, 0, -1, 0x10, 0x20,
+    COM_END,
+};
 
-void Passive13_0150(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
+static const s16 Passive13_0122[] = {
+    COM_EM_TERM, -1, 0x30, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0123[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, 0x30, 6, 1, -1,
+    COM_NORMAL_ATTACK, 9, 0x42,
+    COM_WAIT, 5,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Passive13_0151(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Check_Store_Lever(wk, 0x1F, 6, 0x96);
-        break;
+static const s16 Passive13_0124[] = {
+    COM_PIERCE_ON,
+    COM_EM_TERM, -1, 0x30, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x42,
+    COM_WAIT, 5,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 0x1F, 9, 0x70);
-        break;
+static const s16 Passive13_0125[] = {
+    COM_SEARCH_BACK_TERM, 0x48, 6, 0x22,
+    COM_WALK, 1, 0x18, 0,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0126[] = {
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-void Passive13_0152(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        ETC_Term(wk, 8, 6, 0x22);
-        break;
+static const s16 Passive13_0127[] = {
+    COM_SEARCH_BACK_TERM, 0x48, 6, 0x7E,
+    COM_WALK, 1, 0x18, 0,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
 
-    case 1:
-        Check_SA(wk, 6, 0x22);
-        break;
+static const s16 Passive13_0128[] = {
+    COM_EM_TERM, -0x7F80, -0x7FB0, 6, 1, -1,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_NORMAL_ATTACK, 8, 0x12,
+    COM_END,
+};
 
-    case 2:
-        SA_Term(wk, 0xFFFF, 0x3A, 0xFFFF, 0xFFFF);
-        break;
+static const s16 Passive13_0129[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0130[] = {
+    COM_SEARCH_BACK_TERM, 0x50, 6, 0x6E,
+    COM_WALK, 1, 0x18, 0,
+    COM_EM_TERM, -1, -0x7FB0, 6, 1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, -1,
+    COM_END,
+};
 
-void Passive13_0153(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive13_0131[] = {
+    COM_APPROACH_WALK, 0x71, 2,
+    COM_NORMAL_ATTACK, 8, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Jump_Attack_Term(wk, -0x7FC0, -1, -0x5FF8, 0x400, 2, -1, -1, -1);
-        break;
+static const s16 Passive13_0132[] = {
+    COM_SA_TERM, (s16)0xFFFF, 0x3A, 0x3D, (s16)0xFFFF,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 8, 0x1C, 10, 0x700);
-        break;
+static const s16 Passive13_0133[] = {
+    COM_SA_TERM, 0x39, 0x3A, 0x3C, (s16)0xFFFF,
+    COM_CHECK_STORE_LEVER, 0x1C, 6, 0x86,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, 0x700,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0134[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, 0x70,
+    COM_COMMAND_ATTACK, 8, 0, 0xB, -1,
+    COM_END,
+};
 
-void Passive13_0154(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Pierce_On(wk);
-        break;
+static const s16 Passive13_0135[] = {
+    COM_PROVOKE, 3,
+    COM_END,
+};
 
-    case 1:
-        Command_Attack(wk, 8, 1, 10, -1);
-        break;
+static const s16 Passive13_0136[] = {
+    COM_ETC_TERM, 7, 6, 0x85,
+    COM_CHECK_SA, 2, 0x35,
+    COM_BRANCH_UNIT_AREA, 6, 0x89, 0x89, 0x8A, 0x8B,
+    COM_END,
+};
 
-    case 2:
-        Command_Attack(wk, 0xC, 0x1E, 9, -1);
-        break;
+static const s16 Passive13_0137[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 9, -1,
+    COM_CHECK_SA, 2, 0x35,
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 8, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 3:
-        Check_SA(wk, 6, 0x22);
-        break;
+static const s16 Passive13_0138[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 10, -1,
+    COM_CHECK_SA, 2, 0x35,
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 8, -1,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
 
-    case 4:
-        SA_Term(wk, 0x39, 0x3A, 0x3D, 0xFFFF);
-        break;
+static const s16 Passive13_0139[] = {
+    COM_COMMAND_ATTACK, 8, (s16)0x8016, 10, -1,
+    COM_CHECK_SA, 2, 0x34,
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_COM_RANDOM_SELECT, 2, 0x31, 0x31, 0x32, 0x33, 0,
+    COM_END,
+};
 
-    case 5:
-        Command_Attack(wk, 0xC, 0x1E, 8, -1);
-        break;
+static const s16 Passive13_0140[] = {
+    COM_BRANCH_UNIT_AREA, 6, 0x8D, 0x8D, 0x8E, 0x8F,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0141[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 8, 0x700,
+    COM_END,
+};
 
-void Passive13_0155(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        EM_Term(wk, -0x7F70, 0x28, 7, 1, -1);
-        break;
+static const s16 Passive13_0142[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 9, 0x700,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
+static const s16 Passive13_0143[] = {
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, 0x700,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0144[] = {
+    COM_BRANCH_UNIT_AREA, 6, 0x91, 0x91, 0x92, 0x93,
+    COM_END,
+};
 
-void Passive13_0156(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_On(wk, 1, 0);
-        break;
+static const s16 Passive13_0145[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 8, 0x700,
+    COM_END,
+};
 
-    case 1:
-        Normal_Attack(wk, 0xD, 0x10);
-        break;
+static const s16 Passive13_0146[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 9, 0x700,
+    COM_END,
+};
 
-    case 2:
-        Com_Random_Select(wk, 6, 0x9D, 0x59, 0x8C, 0x9E, 0);
-        break;
+static const s16 Passive13_0147[] = {
+    COM_COMMAND_ATTACK, 8, 0x1D, 10, 0x700,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0148[] = {
+    COM_JUMP, 1,
+    COM_END,
+};
 
-void Passive13_0157(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x200);
-        break;
+static const s16 Passive13_0149[] = {
+    COM_JUMP_ATTACK_TERM, -0x7FC0, -1, -0x5FF8, 0x200, 1, -1, -1, -1,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0150[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-void Passive13_0158(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x22);
-        break;
+static const s16 Passive13_0151[] = {
+    COM_CHECK_STORE_LEVER, 0x1F, 6, 0x96,
+    COM_COMMAND_ATTACK, 8, 0x1F, 9, 0x70,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0152[] = {
+    COM_ETC_TERM, 8, 6, 0x22,
+    COM_CHECK_SA, 6, 0x22,
+    COM_SA_TERM, (s16)0xFFFF, 0x3A, (s16)0xFFFF, (s16)0xFFFF,
+    COM_END,
+};
 
-void Passive13_0159(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x402);
-        break;
+static const s16 Passive13_0153[] = {
+    COM_PIERCE_ON,
+    COM_JUMP_ATTACK_TERM, -0x7FC0, -1, -0x5FF8, 0x400, 2, -1, -1, -1,
+    COM_COMMAND_ATTACK, 8, 0x1C, 10, 0x700,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0154[] = {
+    COM_PIERCE_ON,
+    COM_COMMAND_ATTACK, 8, 1, 10, -1,
+    COM_COMMAND_ATTACK, 0xC, 0x1E, 9, -1,
+    COM_CHECK_SA, 6, 0x22,
+    COM_SA_TERM, 0x39, 0x3A, 0x3D, (s16)0xFFFF,
+    COM_COMMAND_ATTACK, 0xC, 0x1E, 8, -1,
+    COM_END,
+};
 
-void Passive13_0160(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
+static const s16 Passive13_0155[] = {
+    COM_EM_TERM, -0x7F70, 0x28, 7, 1, -1,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0156[] = {
+    COM_LEVER_ON, 1, 0,
+    COM_NORMAL_ATTACK, 0xD, 0x10,
+    COM_COM_RANDOM_SELECT, 6, 0x9D, 0x59, 0x8C, 0x9E, 0,
+    COM_END,
+};
 
-void Passive13_0161(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 8, 0, 0x400);
-        break;
+static const s16 Passive13_0157[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x200,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0158[] = {
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_END,
+};
 
-void Passive13_0162(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Attack(wk, 0xD, 0, 0x20);
-        break;
+static const s16 Passive13_0159[] = {
+    COM_NORMAL_ATTACK, 8, 0x402,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0160[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-void Passive13_0163(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Normal_Attack(wk, 8, 0x20);
-        break;
+static const s16 Passive13_0161[] = {
+    COM_LEVER_ATTACK, 8, 0, 0x400,
+    COM_END,
+};
 
-    case 1:
-        Lever_Attack(wk, 8, 0, 0x20);
-        break;
+static const s16 Passive13_0162[] = {
+    COM_LEVER_ATTACK, 0xD, 0, 0x20,
+    COM_END,
+};
 
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
+static const s16 Passive13_0163[] = {
+    COM_NORMAL_ATTACK, 8, 0x20,
+    COM_LEVER_ATTACK, 8, 0, 0x20,
+    COM_END,
+};
 
-void (*const Passive13_Tbl[164])(PLW*) = {
+const s16* const Passive13_Tbl[164] = {
     Passive13_0000, Passive13_0001, Passive13_0002, Passive13_0003, Passive13_0004, Passive13_0005, Passive13_0006,
     Passive13_0007, Passive13_0008, Passive13_0009, Passive13_0010, Passive13_0011, Passive13_0012, Passive13_0013,
     Passive13_0014, Passive13_0015, Passive13_0016, Passive13_0017, Passive13_0018, Passive13_0019, Passive13_0020,
@@ -2880,3 +1072,7 @@ void (*const Passive13_Tbl[164])(PLW*) = {
     Passive13_0154, Passive13_0155, Passive13_0156, Passive13_0157, Passive13_0158, Passive13_0159, Passive13_0160,
     Passive13_0161, Passive13_0162, Passive13_0163
 };
+
+void Passive13(PLW* wk) {
+    Exec_Com_Pattern(wk, Passive13_Tbl[(s16)Pattern_Index[wk->wu.id]]);
+}
@@ -5,181 +5,77 @@
 
 #include "sf33rd/Source/Game/com/shell/shell00.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Shell00_Tbl[11])(PLW*);
+static const s16 Shell00_0000[] = {
+    COM_END,
+};
+
+static const s16 Shell00_0001[] = {
+    COM_SHELL_TERM, 1, 2, 1, -1, -1,
+    COM_JUMP, 2,
+    COM_END,
+};
+
+static const s16 Shell00_0002[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP, 0,
+    COM_END,
+};
+
+static const s16 Shell00_0003[] = {
+    COM_J_COMMAND_ATTACK, 8, 0x1D, 8, -1,
+    COM_END,
+};
+
+static const s16 Shell00_0004[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -0x7F78, -0x7FD0, 0xB, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
+
+static const s16 Shell00_0005[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -0x7F78, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x400,
+    COM_NORMAL_ATTACK, 8, 0x40,
+    COM_END,
+};
+
+static const s16 Shell00_0006[] = {
+    COM_SHELL_TERM, 1, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -1, 0x30, 8, 0x400, 2, -1, -1, -1,
+    COM_END,
+};
+
+static const s16 Shell00_0007[] = {
+    COM_COMMAND_ATTACK, 8, 0x1E, 8, -1,
+    COM_END,
+};
+
+static const s16 Shell00_0008[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -0x7F78, -0x7FD0, 0xB, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
+
+static const s16 Shell00_0009[] = {
+    COM_LEVER_OFF,
+    COM_SHELL_TERM, 2, 2, 1, -1, -1,
+    COM_NEXT_BE_FLIP, 8,
+    COM_END,
+};
+
+static const s16 Shell00_0010[] = {
+    COM_END,
+};
+
+const s16* const Shell00_Tbl[11] = { Shell00_0000, Shell00_0001, Shell00_0002, Shell00_0003,
+                                        Shell00_0004, Shell00_0005, Shell00_0006, Shell00_0007,
+                                        Shell00_0008, Shell00_0009, Shell00_0010 };
 
 void Shell00(PLW* wk) {
-    Shell00_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Shell00_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    default:
-        End_Pattern(wk);
-    }
-}
-
-void Shell00_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 1, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump(wk, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell00_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
+    Exec_Com_Pattern(wk, Shell00_Tbl[(s16)Pattern_Index[wk->wu.id]]);
 }
-
-void Shell00_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        J_Command_Attack(wk, 8, 0x1D, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell00_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7F78, -0x7FD0, 0xB, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell00_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7F78, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x400);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x40);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell00_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 1, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -1, 0x30, 8, 0x400, 2, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell00_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Command_Attack(wk, 8, 0x1E, 8, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell00_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7F78, -0x7FD0, 0xB, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell00_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        SHELL_Term(wk, 2, 2, 1, -1, -1);
-        break;
-
-    case 2:
-        Next_Be_Flip(wk, 8);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell00_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    default:
-        End_Pattern(wk);
-    }
-}
-
-void (*const Shell00_Tbl[11])(PLW*) = { Shell00_0000, Shell00_0001, Shell00_0002, Shell00_0003,
-                                        Shell00_0004, Shell00_0005, Shell00_0006, Shell00_0007,
-                                        Shell00_0008, Shell00_0009, Shell00_0010 };
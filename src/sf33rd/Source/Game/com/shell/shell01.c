@@ -5,182 +5,74 @@
 
 #include "sf33rd/Source/Game/com/shell/shell01.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Shell01_Tbl[10])(PLW*);
+static const s16 Shell01_0000[] = {
+    COM_END,
+};
+
+static const s16 Shell01_0001[] = {
+    COM_SHELL_TERM, 1, 2, 1, -1, -1,
+    COM_JUMP, 2,
+    COM_END,
+};
+
+static const s16 Shell01_0002[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP, 0,
+    COM_END,
+};
+
+static const s16 Shell01_0003[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA0, 0x30, 8, 0x400, 0, -1, -1, -1,
+    COM_END,
+};
+
+static const s16 Shell01_0004[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -1, 0x30, 8, 0x40, 0, -1, -1, -1,
+    COM_END,
+};
+
+static const s16 Shell01_0005[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -1, 0x30, 8, 0x400, 2, -1, -1, -1,
+    COM_END,
+};
+
+static const s16 Shell01_0006[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA0, 0x30, 8, 0x200, 0, -1, -1, -1,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
+
+static const s16 Shell01_0007[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -1, 0x30, 8, 0x40, 0, -1, -1, -1,
+    COM_NORMAL_ATTACK, 8, 0x22,
+    COM_END,
+};
+
+static const s16 Shell01_0008[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -1, 0x30, 0xB, 0x200, 0, -1, -1, -1,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
+
+static const s16 Shell01_0009[] = {
+    COM_LEVER_OFF,
+    COM_SHELL_TERM, 2, 2, 1, -1, -1,
+    COM_NEXT_BE_FLIP, 8,
+    COM_END,
+};
+
+const s16* const Shell01_Tbl[10] = { Shell01_0000, Shell01_0001, Shell01_0002, Shell01_0003, Shell01_0004,
+                                        Shell01_0005, Shell01_0006, Shell01_0007, Shell01_0008, Shell01_0009 };
 
 void Shell01(PLW* wk) {
-    Shell01_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Shell01_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell01_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 1, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump(wk, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell01_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell01_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA0, 0x30, 8, 0x400, 0, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell01_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -1, 0x30, 8, 0x40, 0, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell01_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -1, 0x30, 8, 0x400, 2, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
+    Exec_Com_Pattern(wk, Shell01_Tbl[(s16)Pattern_Index[wk->wu.id]]);
 }
-
-void Shell01_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA0, 0x30, 8, 0x200, 0, -1, -1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell01_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -1, 0x30, 8, 0x40, 0, -1, -1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x22);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell01_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -1, 0x30, 0xB, 0x200, 0, -1, -1, -1);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell01_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        SHELL_Term(wk, 2, 2, 1, -1, -1);
-        break;
-
-    case 2:
-        Next_Be_Flip(wk, 8);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void (*const Shell01_Tbl[10])(PLW*) = { Shell01_0000, Shell01_0001, Shell01_0002, Shell01_0003, Shell01_0004,
-                                        Shell01_0005, Shell01_0006, Shell01_0007, Shell01_0008, Shell01_0009 };
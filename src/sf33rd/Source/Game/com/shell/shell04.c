@@ -5,215 +5,87 @@
 
 #include "sf33rd/Source/Game/com/shell/shell04.h"
 #include "common.h"
-#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/com/com_pattern.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
 
-void (*const Shell04_Tbl[12])(PLW*);
+static const s16 Shell04_0000[] = {
+    COM_END,
+};
+
+static const s16 Shell04_0001[] = {
+    COM_SHELL_TERM, 1, 2, 1, -1, -1,
+    COM_JUMP, 2,
+    COM_END,
+};
+
+static const s16 Shell04_0002[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP, 0,
+    COM_END,
+};
+
+static const s16 Shell04_0003[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FD0, 9, 0x200, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 0xB, 0x20,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
+
+static const s16 Shell04_0004[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FD0, 0xB, 0x200, 0, -0x7FB0, -1, 0x20,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
+
+static const s16 Shell04_0005[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x400,
+    COM_J_COMMAND_ATTACK, 8, 0x1C, 0xA, -1,
+    COM_END,
+};
+
+static const s16 Shell04_0006[] = {
+    COM_SHELL_TERM, 1, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -1, 0x30, 8, 0x400, 2, -1, -1, -1,
+    COM_END,
+};
+
+static const s16 Shell04_0007[] = {
+    COM_SHELL_TERM, 3, 2, 1, -1, -1,
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x30A, -1,
+    COM_END,
+};
+
+static const s16 Shell04_0008[] = {
+    COM_SHELL_TERM, 0, 2, 1, -1, -1,
+    COM_JUMP_ATTACK_TERM, -0x7FA8, -0x7FD0, 0xB, 0x20, 0, -0x7FB0, -1, 0x200,
+    COM_NORMAL_ATTACK, 8, 0x202,
+    COM_END,
+};
+
+static const s16 Shell04_0009[] = {
+    COM_LEVER_OFF,
+    COM_SHELL_TERM, 2, 2, 1, -1, -1,
+    COM_NEXT_BE_FLIP, 8,
+    COM_END,
+};
+
+static const s16 Shell04_0010[] = {
+    COM_END,
+};
+
+static const s16 Shell04_0011[] = {
+    COM_SHELL_TERM, 3, 2, 1, -1, -1,
+    COM_COMMAND_ATTACK, 0xD, 0x20, 0x60A, -1,
+    COM_END,
+};
+
+const s16* const Shell04_Tbl[12] = { Shell04_0000, Shell04_0001, Shell04_0002, Shell04_0003,
+                                        Shell04_0004, Shell04_0005, Shell04_0006, Shell04_0007,
+                                        Shell04_0008, Shell04_0009, Shell04_0010, Shell04_0011 };
 
 void Shell04(PLW* wk) {
-    Shell04_Tbl[(s16)Pattern_Index[wk->wu.id]](wk);
-}
-
-void Shell04_0000(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell04_0001(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 1, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump(wk, 2);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell04_0002(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump(wk, 0);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell04_0003(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FD0, 9, 0x200, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 0xB, 0x20);
-        break;
-
-    case 3:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell04_0004(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FD0, 0xB, 0x200, 0, -0x7FB0, -1, 0x20);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell04_0005(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FC0, 0xB, 0x200, 0, -0x7FB0, -1, 0x400);
-        break;
-
-    case 2:
-        J_Command_Attack(wk, 8, 0x1C, 0xA, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
+    Exec_Com_Pattern(wk, Shell04_Tbl[(s16)Pattern_Index[wk->wu.id]]);
 }
-
-void Shell04_0006(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 1, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -1, 0x30, 8, 0x400, 2, -1, -1, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell04_0007(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 3, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xD, 0x20, 0x30A, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell04_0008(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 0, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Jump_Attack_Term(wk, -0x7FA8, -0x7FD0, 0xB, 0x20, 0, -0x7FB0, -1, 0x200);
-        break;
-
-    case 2:
-        Normal_Attack(wk, 8, 0x202);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell04_0009(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        Lever_Off(wk);
-        break;
-
-    case 1:
-        SHELL_Term(wk, 2, 2, 1, -1, -1);
-        break;
-
-    case 2:
-        Next_Be_Flip(wk, 8);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell04_0010(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void Shell04_0011(PLW* wk) {
-    switch (CP_Index[wk->wu.id][0]) {
-    case 0:
-        SHELL_Term(wk, 3, 2, 1, -1, -1);
-        break;
-
-    case 1:
-        Command_Attack(wk, 0xD, 0x20, 0x60A, -1);
-        break;
-
-    default:
-        End_Pattern(wk);
-        break;
-    }
-}
-
-void (*const Shell04_Tbl[12])(PLW*) = { Shell04_0000, Shell04_0001, Shell04_0002, Shell04_0003,
-                                        Shell04_0004, Shell04_0005, Shell04_0006, Shell04_0007,
-                                        Shell04_0008, Shell04_0009, Shell04_0010, Shell04_0011 };
@@ -23,8 +23,8 @@ const s16 fight_col_move_tbl[18] = { 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 1
 
 // sbss
 
-s16 b2_curr_no = 0;
-s16 rf_b2_flag = 0;
+SIM_STATE s16 b2_curr_no = 0;
+SIM_STATE s16 rf_b2_flag = 0;
 
 // Forward decls
 
@@ -17,13 +17,13 @@ u16 effb8_normal_or_senyou();
 u16 effb8_sel_1_by_8();
 void wk_set(WORK_Other_CONN* ewk);
 
-s16 test_pl_no;
-s16 test_mes_no;
-s16 test_in;
-s16 old_mes_no2;
-s16 old_mes_no3;
-s16 old_mes_no_pl;
-s16 mes_timer;
+SIM_STATE s16 test_pl_no;
+SIM_STATE s16 test_mes_no;
+SIM_STATE s16 test_in;
+SIM_STATE s16 old_mes_no2;
+SIM_STATE s16 old_mes_no3;
+SIM_STATE s16 old_mes_no_pl;
+SIM_STATE s16 mes_timer;
 
 void effect_B8_move(WORK_Other_CONN* ewk) {
     switch (ewk->wu.routine_no[0]) {
@@ -5,6 +5,7 @@
 
 #include "sf33rd/Source/Game/effect/effect.h"
 #include "common.h"
+#include "port/effect_profiler.h"
 #include "sf33rd/AcrSDK/ps2/flps2debug.h"
 #include "sf33rd/Source/Game/debug/Debug.h"
 #include "sf33rd/Source/Game/effect/effxx.h"
@@ -23,6 +24,59 @@ s16 exec_tm[8];
 uintptr_t frw[EFFECT_MAX][448];
 s16 frwque[EFFECT_MAX];
 
+static void call_effect_move(WORK* c_addr) {
+    if (!EffectProfiler_IsEnabled()) {
+        effmovejptbl[c_addr->id](c_addr);
+        return;
+    }
+
+    // The handler may free the effect, which clears its id
+    const s16 id = c_addr->id;
+    const Uint64 start = SDL_GetPerformanceCounter();
+    effmovejptbl[id](c_addr);
+    EffectProfiler_Record(id, SDL_GetPerformanceCounter() - start);
+}
+
+static s32 compare_cluster_keys(const void* a, const void* b) {
+    const u32 key_a = *(const u32*)a;
+    const u32 key_b = *(const u32*)b;
+    return (key_a > key_b) - (key_a < key_b);
+}
+
+/// Update the effects of a list grouped by id, so that the same handler runs back-to-back. Effects with the same id
+/// keep their list order. Effects that get freed or created during the update are handled like in the regular update.
+static void move_effect_work_clustered(s16 index) {
+    s16 list[EFFECT_MAX];
+    u32 keys[EFFECT_MAX];
+    s16 count = 0;
+    WORK* c_addr;
+    s16 curr_ix;
+
+    for (curr_ix = head_ix[index]; curr_ix != -1; curr_ix = c_addr->behind) {
+        c_addr = (WORK*)frw[curr_ix];
+        list[count] = curr_ix;
+        keys[count] = ((u32)(u16)c_addr->id << 16) | count;
+        count += 1;
+    }
+
+    SDL_qsort(keys, count, sizeof(u32), compare_cluster_keys);
+
+    for (s16 i = 0; i < count; i++) {
+        curr_ix = list[keys[i] & 0xFFFF];
+        c_addr = (WORK*)frw[curr_ix];
+
+        // Skip effects that were freed by an earlier handler
+        if ((c_addr->listix != index) || ((head_ix[index] != curr_ix) && (c_addr->before == -1))) {
+            continue;
+        }
+
+        if (c_addr->timing != exec_tm[index]) {
+            c_addr->timing = exec_tm[index];
+            call_effect_move(c_addr);
+        }
+    }
+}
+
 void move_effect_work(s16 index) {
     WORK* c_addr;
     s16 curr_ix;
@@ -34,13 +88,18 @@ void move_effect_work(s16 index) {
 
     exec_tm[index] += 1;
 
+    if (EffectProfiler_IsClusteringEnabled()) {
+        move_effect_work_clustered(index);
+        return;
+    }
+
     for (curr_ix = head_ix[index]; curr_ix != -1; curr_ix = next_ix) {
         c_addr = (WORK*)frw[curr_ix];
         next_ix = c_addr->behind;
 
         if (c_addr->timing != exec_tm[index]) {
             c_addr->timing = exec_tm[index];
-            effmovejptbl[c_addr->id](c_addr);
+            call_effect_move(c_addr);
         }
     }
 }
@@ -24,7 +24,7 @@
 #define HI_2_BYTES(_val) (((s16*)&_val)[1])
 #define WK_AS_PLW ((PLW*)wk)
 
-u16 att_req = 0;
+SIM_STATE u16 att_req = 0;
 
 extern s32 (*const decode_chcmd[125])();
 extern s32 (*const decode_if_lever[16])();
@@ -19,26 +19,26 @@
 #include <string.h>
 
 // bss
-CMST_BUFF cmst_buff[2][5];
+SIM_STATE CMST_BUFF cmst_buff[2][5];
 
 // sbss
-s16 old_cmb_flag[2];
-s8 cmb_stock[2];
-s8 first_attack;
-s8 rever_attack[2];
-s8 paring_attack[2];
-s8 bonus_pts[2];
-s16 hit_num;
-u8 sa_kind;
-u8 end_flag[2];
-s16 calc_hit[2][10];
-s16 score_calc[2][12];
-s8 cmb_all_stock[1];
-s8 sarts_finish_flag[2];
-s8 last_hit_time;
-s8 cmb_calc_now[2];
-u8 cst_read[2];
-u8 cst_write[2];
+SIM_STATE s16 old_cmb_flag[2];
+SIM_STATE s8 cmb_stock[2];
+SIM_STATE s8 first_attack;
+SIM_STATE s8 rever_attack[2];
+SIM_STATE s8 paring_attack[2];
+SIM_STATE s8 bonus_pts[2];
+SIM_STATE s16 hit_num;
+SIM_STATE u8 sa_kind;
+SIM_STATE u8 end_flag[2];
+SIM_STATE s16 calc_hit[2][10];
+SIM_STATE s16 score_calc[2][12];
+SIM_STATE s8 cmb_all_stock[1];
+SIM_STATE s8 sarts_finish_flag[2];
+SIM_STATE s8 last_hit_time;
+SIM_STATE s8 cmb_calc_now[2];
+SIM_STATE u8 cst_read[2];
+SIM_STATE u8 cst_write[2];
 
 const u8 cmb_pos_tbl[2][21] = { { 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27 },
                                 { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 } };
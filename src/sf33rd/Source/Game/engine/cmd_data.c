@@ -4,14 +4,15 @@
  */
 
 #include "sf33rd/Source/Game/engine/cmd_data.h"
+#include "common.h"
 #include "structs.h"
 #include "types.h"
 
 // bss
 
-WORK_CP wcp[2];
-T_PL_LVR t_pl_lvr[2];
-WAZA_WORK waza_work[2][56];
+SIM_STATE WORK_CP wcp[2];
+SIM_STATE T_PL_LVR t_pl_lvr[2];
+SIM_STATE WAZA_WORK waza_work[2][56];
 
 // sbss
 
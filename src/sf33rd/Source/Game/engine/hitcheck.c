@@ -1565,6 +1565,175 @@ void catch_hit_check() {
     }
 }
 
+// World-space boxes of the objects in the hit queue, stored as one array per coordinate so that an attack box can be
+// tested against every damage box of an object in a single loop. Values are truncated to s16 exactly like
+// `hit_check_subroutine` does, so the results are identical.
+
+#define HIT_ATT_BOXES 4
+#define HIT_DM_BOXES 11
+#define HIT_BOUNDS_LIMIT 0x2000 // Boxes further out than this could overflow the s16 math, see `set_bounds`
+
+typedef struct HitBounds {
+    bool valid; // Whether the broad phase may reject pairs based on this object
+    s32 count;
+    s32 left;
+    s32 right;
+    s32 bottom;
+    s32 top;
+} HitBounds;
+
+typedef struct HitBoxTable {
+    s16 att_x[32][HIT_ATT_BOXES];
+    s16 att_w[32][HIT_ATT_BOXES];
+    s16 att_y[32][HIT_ATT_BOXES];
+    s16 att_h[32][HIT_ATT_BOXES];
+    s16 dm_x[32][HIT_DM_BOXES];
+    s16 dm_w[32][HIT_DM_BOXES];
+    s16 dm_y[32][HIT_DM_BOXES];
+    s16 dm_h[32][HIT_DM_BOXES];
+    HitBounds att_bounds[32];
+    HitBounds dm_bounds[32];
+    bool att_ready[32];
+} HitBoxTable;
+
+static HitBoxTable hit_boxes;
+
+static void to_world_box(const WORK* wk, const s16* hd, s16* x, s16* w, s16* y, s16* h) {
+    s16 d0 = hd[0];
+
+    if (wk->rl_flag) {
+        d0 = -d0;
+        d0 -= hd[1];
+    }
+
+    *x = d0 + wk->xyz[0].disp.pos;
+    *w = hd[1];
+    *y = wk->xyz[1].disp.pos + hd[2];
+    *h = hd[3];
+}
+
+static void init_bounds(HitBounds* bounds) {
+    bounds->valid = true;
+    bounds->count = 0;
+    bounds->left = HIT_BOUNDS_LIMIT;
+    bounds->right = -HIT_BOUNDS_LIMIT;
+    bounds->bottom = HIT_BOUNDS_LIMIT;
+    bounds->top = -HIT_BOUNDS_LIMIT;
+}
+
+/// Grow `bounds` to include a box. Boxes with a width of 0 are never tested, so they are left out.
+static void add_to_bounds(HitBounds* bounds, s16 x, s16 w, s16 y, s16 h) {
+    if (w == 0) {
+        return;
+    }
+
+    // Only boxes that are close enough to the origin can be compared without accounting for the wrap-around of the
+    // s16 math in `hit_check_subroutine`. Anything else disables the broad phase for this object.
+    if ((w < 0) || (h < 0) || (x < -HIT_BOUNDS_LIMIT) || (x + w >= HIT_BOUNDS_LIMIT) || (y < -HIT_BOUNDS_LIMIT) ||
+        (y + h >= HIT_BOUNDS_LIMIT)) {
+        bounds->valid = false;
+    }
+
+    bounds->count += 1;
+    bounds->left = SDL_min(bounds->left, x);
+    bounds->right = SDL_max(bounds->right, x + w);
+    bounds->bottom = SDL_min(bounds->bottom, y);
+    bounds->top = SDL_max(bounds->top, y + h);
+}
+
+static void set_dm_boxes(s16 ix, const WORK* wk) {
+    HitBounds* bounds = &hit_boxes.dm_bounds[ix];
+    init_bounds(bounds);
+
+    for (s16 i = 0; i < HIT_DM_BOXES; i++) {
+        to_world_box(wk,
+                     dmdat_adrs[i],
+                     &hit_boxes.dm_x[ix][i],
+                     &hit_boxes.dm_w[ix][i],
+                     &hit_boxes.dm_y[ix][i],
+                     &hit_boxes.dm_h[ix][i]);
+        add_to_bounds(
+            bounds, hit_boxes.dm_x[ix][i], hit_boxes.dm_w[ix][i], hit_boxes.dm_y[ix][i], hit_boxes.dm_h[ix][i]);
+    }
+}
+
+static void set_att_boxes(s16 ix, const WORK* wk) {
+    HitBounds* bounds = &hit_boxes.att_bounds[ix];
+    init_bounds(bounds);
+
+    for (s16 i = 0; i < HIT_ATT_BOXES; i++) {
+        to_world_box(wk,
+                     wk->h_att->att_box[i],
+                     &hit_boxes.att_x[ix][i],
+                     &hit_boxes.att_w[ix][i],
+                     &hit_boxes.att_y[ix][i],
+                     &hit_boxes.att_h[ix][i]);
+        add_to_bounds(
+            bounds, hit_boxes.att_x[ix][i], hit_boxes.att_w[ix][i], hit_boxes.att_y[ix][i], hit_boxes.att_h[ix][i]);
+    }
+
+    hit_boxes.att_ready[ix] = true;
+}
+
+/// Broad phase. Within the limits checked by `add_to_bounds` two boxes can only hit when their ranges overlap, so
+/// objects whose bounds don't overlap can't hit each other with any pair of boxes.
+/// @return Whether no box of attacker `mi` can hit a box of defender `si`.
+static bool can_skip_pair(s16 mi, s16 si) {
+    const HitBounds* att = &hit_boxes.att_bounds[mi];
+    const HitBounds* dm = &hit_boxes.dm_bounds[si];
+
+    if ((att->count == 0) || (dm->count == 0)) {
+        return true;
+    }
+
+    if (!att->valid || !dm->valid) {
+        return false;
+    }
+
+    return (att->left > dm->right) || (dm->left >= att->right) || (dm->bottom > att->top) || (att->bottom >= dm->top);
+}
+
+/// Narrow phase. Test attack box `lp` of object `mi` against every damage box of object `si`. This is the math of
+/// `hit_check_subroutine` without branches, so that the loop can be vectorized.
+static void check_att_box(s16 mi, s16 lp, s16 si, s16* results) {
+    const s16 ax = hit_boxes.att_x[mi][lp];
+    const s16 aw = hit_boxes.att_w[mi][lp];
+    const s16 ay = hit_boxes.att_y[mi][lp];
+    const s16 ah = hit_boxes.att_h[mi][lp];
+    const s16* dx = hit_boxes.dm_x[si];
+    const s16* dw = hit_boxes.dm_w[si];
+    const s16* dy = hit_boxes.dm_y[si];
+    const s16* dh = hit_boxes.dm_h[si];
+
+    for (s32 i = 0; i < HIT_DM_BOXES; i++) {
+        const s16 x = dx[i] + dw[i] - ax;
+        const s16 w = dw[i] + aw;
+        const s16 y = ay - dy[i] + ah;
+        const s16 h = ah + dh[i];
+        const s16 depth = (x > w - x) ? (s16)(w - x) : x;
+        const bool hit = ((u32)x < (u32)w) & ((u32)y < (u32)h);
+        results[i] = hit ? depth : 0;
+    }
+}
+
+#if defined(DEBUG)
+static void verify_skipped_pair(WORK* mad, WORK* sad) {
+    const s16* mh = &mad->h_att->att_box[0][0];
+
+    for (s16 lp = 0; lp < HIT_ATT_BOXES; lp++, mh += 4) {
+        if (mh[1] == 0) {
+            continue;
+        }
+
+        for (s16 lp2 = 0; lp2 < HIT_DM_BOXES; lp2++) {
+            if ((dmdat_adrs[lp2][1] != 0) && (hit_check_subroutine(mad, sad, mh, dmdat_adrs[lp2]) != 0)) {
+                fatal_error("Hit broad phase skipped a pair that hits (att box %d, dm box %d)", lp, lp2);
+            }
+        }
+    }
+}
+#endif
+
 void attack_hit_check() {
     WORK* mad;
     WORK* sad;
@@ -1575,10 +1744,13 @@ void attack_hit_check() {
     s16 lp;
     s16 lp2;
     s16 mw;
+    s16 results[HIT_DM_BOXES];
 
     s16* assign1;
     s16* assign2;
 
+    SDL_zeroa(hit_boxes.att_ready);
+
     for (si = 0; si < hpq_in; si++) {
         if (hs[si].flag.results & 0x1101) {
             continue;
@@ -1596,6 +1768,7 @@ void attack_hit_check() {
         dmdat_adrs[8] = &sad->h_att->att_box[2][0];
         dmdat_adrs[9] = &sad->h_att->att_box[3][0];
         dmdat_adrs[10] = &sad->h_hos->hos_box[0];
+        set_dm_boxes(si, sad);
 
         for (mi = 0; mi < hpq_in; mi++) {
             if (mi == si) {
@@ -1635,6 +1808,17 @@ void attack_hit_check() {
                 continue;
             }
 
+            if (!hit_boxes.att_ready[mi]) {
+                set_att_boxes(mi, mad);
+            }
+
+            if (can_skip_pair(mi, si)) {
+#if defined(DEBUG)
+                verify_skipped_pair(mad, sad);
+#endif
+                continue;
+            }
+
             mh = &mad->h_att->att_box[0][0];
 
             for (lp = 0; lp < 4; lp++, assign2 = mh += 4) {
@@ -1642,6 +1826,8 @@ void attack_hit_check() {
                     continue;
                 }
 
+                check_att_box(mi, lp, si, results);
+
                 for (lp2 = 0; lp2 < 11; lp2++) {
                     if (lp2 > 3 && mad->att_hit_ok == 0) {
                         goto end;
@@ -1677,7 +1863,15 @@ void attack_hit_check() {
                         }
                     }
 
-                    mw = hit_check_subroutine(mad, sad, mh, dmdat_adrs[lp2]);
+                    mw = results[lp2];
+
+#if defined(DEBUG)
+                    if (mw != hit_check_subroutine(mad, sad, mh, dmdat_adrs[lp2])) {
+                        fatal_error("Hit narrow phase disagrees with hit_check_subroutine (att box %d, dm box %d)",
+                                    lp,
+                                    lp2);
+                    }
+#endif
 
                     if (mw > mkm_wk[si]) {
                         hs[mi].flag.results |= 0x10;
@@ -76,26 +76,26 @@ s16 remake_sa_gauge_len(s16 ix, s16 gauge_len);
 void clear_super_arts_point(PLW* wk);
 void set_scrrrl();
 
-PLW plw[2];
-ZanzouTableEntry zanzou_table[2][48];
-SA_WORK super_arts[2];
-PiyoriType piyori_type[2];
-AppearanceType appear_type;
-s16 pcon_rno[4];
-bool round_slow_flag;
-bool pcon_dp_flag;
-u8 win_sp_flag;
-bool dead_voice_flag;
-
-UNK_1 rambod[2];
-UNK_2 ramhan[2];
+SIM_STATE PLW plw[2];
+SIM_STATE ZanzouTableEntry zanzou_table[2][48];
+SIM_STATE SA_WORK super_arts[2];
+SIM_STATE PiyoriType piyori_type[2];
+SIM_STATE AppearanceType appear_type;
+SIM_STATE s16 pcon_rno[4];
+SIM_STATE bool round_slow_flag;
+SIM_STATE bool pcon_dp_flag;
+SIM_STATE u8 win_sp_flag;
+SIM_STATE bool dead_voice_flag;
+
+SIM_STATE UNK_1 rambod[2];
+SIM_STATE UNK_2 ramhan[2];
 u32 omop_spmv_ng_table[2];  // FIXME: might not be necessary to put in GameState
 u32 omop_spmv_ng_table2[2]; // FIXME: might not be necessary to put in GameState
-u16 vital_inc_timer;
-u16 vital_dec_timer;
+SIM_STATE u16 vital_inc_timer;
+SIM_STATE u16 vital_dec_timer;
 char cmd_sel[2];
 s8 vib_sel[2];
-s16 sag_inc_timer[2];
+SIM_STATE s16 sag_inc_timer[2];
 char no_sa[2];
 
 void plcnt_init();
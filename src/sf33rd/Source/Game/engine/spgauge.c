@@ -13,21 +13,21 @@
 #include "sf33rd/Source/Game/system/sysdir.h"
 #include "sf33rd/Source/Game/ui/sc_sub.h"
 
-s8 Old_Stop_SG;
-s8 Exec_Wipe_F;
-s8 time_clear[2];
-s16 spg_number;
-s16 spg_work;
-s16 spg_offset;
-s8 time_num;
-s8 time_timer;
-s8 time_flag[2];
-s16 col;
-s8 time_operate[2];
-s8 sast_now[2];
-s8 max2[2];
-s8 max_rno2[2];
-SPG_DAT spg_dat[2];
+SIM_STATE s8 Old_Stop_SG;
+SIM_STATE s8 Exec_Wipe_F;
+SIM_STATE s8 time_clear[2];
+SIM_STATE s16 spg_number;
+SIM_STATE s16 spg_work;
+SIM_STATE s16 spg_offset;
+SIM_STATE s8 time_num;
+SIM_STATE s8 time_timer;
+SIM_STATE s8 time_flag[2];
+SIM_STATE s16 col;
+SIM_STATE s8 time_operate[2];
+SIM_STATE s8 sast_now[2];
+SIM_STATE s8 max2[2];
+SIM_STATE s8 max_rno2[2];
+SIM_STATE SPG_DAT spg_dat[2];
 
 const u16 spgauge_tbl[9] = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
 
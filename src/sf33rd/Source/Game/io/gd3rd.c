@@ -18,6 +18,10 @@
 
 #include "port/io/afs.h"
 
+#include <SDL3/SDL.h>
+
+#include <stdio.h>
+
 typedef struct {
     u8 type;
     u8 ix;
@@ -38,6 +42,14 @@ u8 ldreq_result[294];
 
 static AFSHandle afs_handle = AFS_NONE;
 
+// Time it takes to work through a burst of load requests, e.g. the ones for the next match
+static Uint64 load_start_ns = 0;
+static s32 load_frames = 0;
+static s32 load_count = 0;
+
+// Bumped whenever files get queued for loading, which can move data that the game keeps pointers to
+static u32 load_generation = 0;
+
 // forward decls
 s32 Push_LDREQ_Queue(REQ* ldreq);
 void Push_LDREQ_Queue_Metamor();
@@ -62,6 +74,9 @@ s32 fsOpen(REQ* req) {
 
     afs_handle = AFS_Open(req->fnum);
 
+    // Files are read in several chunks over multiple frames. Let the remaining chunks load in the background
+    AFS_Prefetch(req->fnum);
+
     req->info.number = 1;
     return 1;
 }
@@ -220,6 +235,8 @@ void Init_Load_Request_Queue_1st() {
     }
 
     ldreq_break = 0;
+    load_start_ns = 0;
+    AFS_DiscardPreloads();
 }
 
 void Request_LDREQ_Break() {
@@ -319,6 +336,41 @@ void Push_LDREQ_Queue_Direct(s16 ix, s16 id) {
     Push_LDREQ_Queue(&ldreq);
 }
 
+/// Start reading the file of a queued request in the background, so that the files of all queued requests load
+/// concurrently instead of one after the other
+static void preload_ldreq_file(const REQ* ldreq) {
+    s32 fnum;
+
+    switch (ldreq->type) {
+    case 1:
+        fnum = get_texture_group_file(ldreq->ix);
+        break;
+
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+        fnum = get_color_data_file(ldreq->ix, ldreq->id);
+        break;
+
+    default:
+        fnum = -1;
+        break;
+    }
+
+    if (fnum >= 0) {
+        AFS_Preload(fnum);
+    }
+}
+
+static void finish_load_timing() {
+    const Uint64 elapsed_ns = SDL_GetTicksNS() - load_start_ns;
+
+    printf("📂 loaded %d requests in %.1f ms (%d frames)\n", load_count, elapsed_ns / 1000000.0, load_frames);
+    load_start_ns = 0;
+    AFS_DiscardPreloads();
+}
+
 s32 Push_LDREQ_Queue(REQ* ldreq) {
     s16 i;
     u8 masknum;
@@ -350,6 +402,16 @@ s32 Push_LDREQ_Queue(REQ* ldreq) {
         }
 
         *q_ldreq[i].result &= ~masknum;
+
+        if (load_start_ns == 0) {
+            load_start_ns = SDL_GetTicksNS();
+            load_frames = 0;
+            load_count = 0;
+        }
+
+        load_count += 1;
+        load_generation += 1;
+        preload_ldreq_file(&q_ldreq[i]);
         return 1;
     }
 
@@ -365,6 +427,7 @@ void Check_LDREQ_Queue() {
     if (!ldreq_break) {
         if (q_ldreq->be != 0) {
             ldreq_process[q_ldreq->type](q_ldreq);
+            load_frames += 1;
 
             if (q_ldreq->be == 0) {
                 for (i = 0; i < 15; i++) {
@@ -373,6 +436,10 @@ void Check_LDREQ_Queue() {
 
                 q_ldreq[i].be = 0;
                 q_ldreq[i].type = 0;
+
+                if ((q_ldreq->be == 0) && (load_start_ns != 0)) {
+                    finish_load_timing();
+                }
             }
 
             return;
@@ -459,6 +526,10 @@ s32 Check_LDREQ_Queue_Direct(s16 ix) {
     return 1;
 }
 
+u32 Get_LDREQ_Generation() {
+    return load_generation;
+}
+
 void q_ldreq_error(REQ* curr) {
     curr->be = 0;
     flLogOut("Q_LDREQ_ERROR : ロード処理の指定に誤りがあります。\n");
@@ -33,4 +33,8 @@ void Push_LDREQ_Queue_BG(s16 ix);
 s32 Check_LDREQ_Queue_BG(s16 ix);
 s32 Check_LDREQ_Queue_Direct(s16 ix);
 
+/// @return A number that changes every time files get queued for loading. Pointers into loaded data that were taken
+/// under one number may be stale under another.
+u32 Get_LDREQ_Generation();
+
 #endif
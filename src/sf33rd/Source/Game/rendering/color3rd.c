@@ -65,6 +65,22 @@ void palConvRowTim2CI8Clut(u16* src, u16* dst, s32 size);
 const u16 hitmark_color[128];
 const col_file_data color_file[161];
 
+/// @return Number of the file that `q_ldreq_color_data` is going to read for color data `ix`, or -1 if nothing needs
+/// to be read.
+s32 get_color_data_file(s16 ix, s16 id) {
+    const col_file_data* cfn = &color_file[ix];
+
+    if (cfn->apfn == 0xFFFF) {
+        return -1;
+    }
+
+    if ((cfn->type == 10) && (cfn->data + 1 == cseGetIdStoredBd(id + 1))) {
+        return -1;
+    }
+
+    return cfn->apfn;
+}
+
 void q_ldreq_color_data(REQ* curr) {
     col_file_data* cfn;
     s32 err;
@@ -132,6 +132,29 @@ const TexGroupData texgrpdat[100] = { { 0, -1, 0, 0, 0, 0, 0 },
 // forward decls
 s32 load_any_texture_grpnum(u8 grp, u8 kokey);
 
+/// @return Number of the file that `q_ldreq_texture_group` is going to read for texture group `ix`, or -1 if nothing
+/// needs to be read.
+s32 get_texture_group_file(s16 ix) {
+    const TexGroupData* bsd = &texgrpdat[ix];
+    u8 group;
+
+    if (bsd->apfn == -1) {
+        return -1;
+    }
+
+    if (bsd->num_of_1st == 0) {
+        group = obj_group_table[bsd->num_of_1st + 1];
+    } else {
+        group = obj_group_table[bsd->num_of_1st];
+    }
+
+    if (texgrplds[group].ok) {
+        return -1;
+    }
+
+    return bsd->apfn;
+}
+
 void q_ldreq_texture_group(REQ* curr) {
     const TexGroupData* bsd;
     CharInitData* cit;
@@ -7,6 +7,7 @@
 extern TEX_GRP_LD texgrplds[100];
 extern const TexGroupData texgrpdat[100];
 
+s32 get_texture_group_file(s16 ix);
 void q_ldreq_texture_group(REQ* curr);
 void Init_texgrplds_work();
 void checkSelObjFileLoaded();
@@ -1,4 +1,5 @@
 #include "sf33rd/Source/Game/select_timer.h"
+#include "common.h"
 #include "constants.h"
 #include "sf33rd/Source/Game/debug/Debug.h"
 #include "sf33rd/Source/Game/engine/workuser.h"
@@ -8,7 +9,7 @@
 
 #include <stdbool.h>
 
-SelectTimerState select_timer_state = { 0 };
+SIM_STATE SelectTimerState select_timer_state = { 0 };
 static s16 bcdext = 0;
 
 static u8 sbcd(u8 a, u8 b) {
@@ -6,6 +6,7 @@
 #include "sf33rd/Source/Game/sound/sound3rd.h"
 #include "common.h"
 #include "main.h"
+#include "port/io/afs.h"
 #include "port/sound/adx.h"
 #include "sf33rd/AcrSDK/MiddleWare/PS2/CapSndEng/cse.h"
 #include "sf33rd/AcrSDK/MiddleWare/PS2/CapSndEng/emlMemMap.h"
@@ -157,11 +158,16 @@ s32 sndCheckVTransStatus(s32 type) {
     return 1;
 }
 
+/// Start reading the SE bank in the background, so that `sndInitialLoad` doesn't have to wait for the disc
+void sndPreloadInitialData() {
+    AFS_Preload(get_color_data_file(SE_BANK_COLOR_FILE, 0));
+}
+
 void sndInitialLoad() {
     cseMemMapInit(&SpuMap);
     cseMemMapSetPhdAddr(0, *csePHDDataTable);
     cseTsbSetBankAddr(0, *cseTSBDataTable);
-    load_any_color(109, 20); // This loads SE.bd (index 7)
+    load_any_color(SE_BANK_COLOR_FILE, 20);
 }
 
 s32 cseMemMapInit(void* pSpuMemMap) {
@@ -4,6 +4,8 @@
 #include "structs.h"
 #include "types.h"
 
+#define SE_BANK_COLOR_FILE 109 // SE.bd (index 7)
+
 extern s16 bgm_level;
 extern s16 se_level;
 extern s8* sdbd[3];
@@ -12,6 +14,7 @@ extern s8* csePHDDataTable[];
 
 void Init_sound_system();
 s32 sndCheckVTransStatus(s32 type);
+void sndPreloadInitialData();
 void sndInitialLoad();
 void checkAdxFileLoaded();
 void Exit_sound_system();
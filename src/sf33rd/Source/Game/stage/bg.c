@@ -46,7 +46,7 @@ u8 bg_disp_off;
 s32 bgPalCodeOffset[8];
 
 // bss
-BG bg_w;
+SIM_STATE BG bg_w;
 RW_DATA rw_dat[20];
 
 static void bgRWWorkUpdate();
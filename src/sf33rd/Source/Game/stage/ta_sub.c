@@ -18,7 +18,7 @@
 
 s16 eff_hit_data[4][4] = { { -67, 59, 13, 29 }, { 31, 95, 24, 15 }, { 4, 123, 28, 15 }, { 20, 15, 67, 37 } };
 
-s16 eff_hit_flag[11];
+SIM_STATE s16 eff_hit_flag[11];
 
 s32 eff_hit_check_sub(WORK_Other* ewk, PLW* pl);
 s32 eff_hit_check_sub2(WORK_Other* ewk, PLW* pl, s16 where_type);
@@ -5,6 +5,8 @@
 
 #include "sf33rd/Source/Game/system/ramcnt.h"
 #include "common.h"
+#include "port/mem_stats.h"
+#include "sf33rd/AcrSDK/common/memfound.h"
 #include "sf33rd/AcrSDK/ps2/flps2debug.h"
 #include "sf33rd/AcrSDK/ps2/foundaps2.h"
 #include "sf33rd/Source/Common/MemMan.h"
@@ -20,6 +22,13 @@ s16 rckeyque[RCKEY_WORK_MAX];
 s16 rckeyctr;
 s16 rckeymin;
 
+typedef struct RCKeySite {
+    int site;
+    size_t size;
+} RCKeySite;
+
+static RCKeySite rckey_site[RCKEY_WORK_MAX];
+
 void disp_ramcnt_free_area() {
     if (Debug_w[0xA]) {
         flPrintColor(0xFFFFFF8F);
@@ -27,6 +36,13 @@ void disp_ramcnt_free_area() {
         flPrintL(4, 9, "Now %07X", mmGetRemainder(&rckey_mmobj));
         flPrintL(4, 0xA, "Min %07X", mmGetRemainderMin(&rckey_mmobj));
         flPrintL(4, 0xB, "Key %2d / %2d", rckeymin, rckeyctr);
+
+        const MemStatsHeap* system_heap = MemStats_GetHeap(&sysmemmgr);
+
+        if (system_heap != NULL) {
+            flPrintL(4, 0xC, "Sys %07X", (unsigned int)(system_heap->capacity - system_heap->peak_used));
+            flPrintL(4, 0xD, "Cmp %d", system_heap->compactions);
+        }
     }
 }
 
@@ -86,6 +102,7 @@ void Push_ramcnt_key_original_2(s16 key) {
     RCKeyWork* rwk = &rckey_work[key];
 
     if (rwk->use != 0) {
+        MemStats_NoteSiteFree(rckey_site[key].site, rckey_site[key].size);
         mmFree(&rckey_mmobj, (u8*)rwk->adr);
         rwk->type = 0;
         rwk->use = 0;
@@ -170,13 +187,14 @@ s32 Test_ramcnt_key(s16 key) {
     return 1;
 }
 
-s16 Pull_ramcnt_key(size_t memreq, u8 kokey, u8 group, u8 frre) {
+s16 Pull_ramcnt_key_at(size_t memreq, u8 kokey, u8 group, u8 frre, const char* site) {
     RCKeyWork* rwk;
     s16 key;
 
     if (rckeyctr <= 0) {
         // There are not enough memory keys.\n
         flLogOut("メモリキーの個数が足りなくなりました。\n");
+        MemStats_Dump("out of ramcnt keys");
         ERR_STOP;
     }
 
@@ -204,11 +222,14 @@ s16 Pull_ramcnt_key(size_t memreq, u8 kokey, u8 group, u8 frre) {
         rckeyque[rckeyctr++] = key;
         // Failed to allocate memory.\n
         flLogOut("メモリの確保に失敗しました。\n");
+        MemStats_Dump("ramcnt heap exhausted");
         ERR_STOP;
     }
 
     rwk->use = 1;
     rwk->type = kokey;
     rwk->group_num = group;
+    rckey_site[key].site = MemStats_NoteSiteAlloc(&rckey_mmobj, site, kokey, memreq);
+    rckey_site[key].size = memreq;
     return key;
 }
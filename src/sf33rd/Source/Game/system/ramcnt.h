@@ -20,9 +20,12 @@ void Purge_memory_of_kind_of_key(u8 kokey);
 void Set_size_data_ramcnt_key(s16 key, u32 size);
 uintptr_t Get_ramcnt_address(s16 key);
 s16 Search_ramcnt_type(u8 kokey);
-s16 Pull_ramcnt_key(size_t memreq, u8 kokey, u8 group, u8 frre);
+s16 Pull_ramcnt_key_at(size_t memreq, u8 kokey, u8 group, u8 frre, const char* site);
 size_t Get_size_data_ramcnt_key(s16 key);
 s32 Test_ramcnt_key(s16 key);
 void Push_ramcnt_key_original(s16 key);
 
+/// Allocations are attributed to the calling function and `kokey` in memory stats
+#define Pull_ramcnt_key(memreq, kokey, group, frre) Pull_ramcnt_key_at(memreq, kokey, group, frre, __func__)
+
 #endif
@@ -35,14 +35,14 @@ u16 p3sw_buff;
 u16 p4sw_buff;
 u32 Interrupt_Timer;
 s8 Gill_Appear_Flag;
-u16 PLsw[2][2];
+SIM_STATE u16 PLsw[2][2];
 BG_POS bg_pos[8];
 FM_POS fm_pos[8];
 BackgroundParameters bg_prm[8];
 f32 scr_sc;
 
 MTX BgMATRIX[9];
-struct _TASK task[11];
+SIM_STATE struct _TASK task[11];
 struct _REP_GAME_INFOR Rep_Game_Infor[11];
 _REPLAY_W Replay_w;
 SystemDir system_dir[6];
@@ -14,15 +14,15 @@
 #include "sf33rd/Source/Game/ui/sc_data.h"
 #include "sf33rd/Source/Game/ui/sc_sub.h"
 
-s8 round_timer;
-s8 flash_timer;
-s8 flash_r_num;
-s8 flash_col;
-s8 math_counter_hi;
-s8 math_counter_low;
-u8 counter_color;
-bool mugen_flag;
-s8 hoji_counter;
+SIM_STATE s8 round_timer;
+SIM_STATE s8 flash_timer;
+SIM_STATE s8 flash_r_num;
+SIM_STATE s8 flash_col;
+SIM_STATE s8 math_counter_hi;
+SIM_STATE s8 math_counter_low;
+SIM_STATE u8 counter_color;
+SIM_STATE bool mugen_flag;
+SIM_STATE s8 hoji_counter;
 
 void count_cont_init(u8 type) {
     Counter_hi = save_w[Present_Mode].Time_Limit; // FIXME: use a consistent value in netplay
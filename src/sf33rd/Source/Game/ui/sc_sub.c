@@ -160,8 +160,8 @@ const u8 ascProData[128] = {
 
 SAFrame sa_frame[3][48];
 Polygon scrscrntex[4];
-u8 WipeLimit;
-u8 FadeLimit;
+SIM_STATE u8 WipeLimit;
+SIM_STATE u8 FadeLimit;
 s16 Hnc_Num;
 FadeData fd_dat;
 
@@ -0,0 +1,159 @@
+import argparse
+import re
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+# Links the CPU pattern files of several revisions against com_sub stubs and runs every pattern of every dispatcher.
+# The stubs either log each call with its arguments, so that the revisions can be compared call by call, or do nothing,
+# so that the time it takes to reach and run a step can be compared.
+
+ROOT = Path(__file__).resolve().parent.parent
+COM_DIR = Path("src/sf33rd/Source/Game/com")
+PATTERN_FILES = ["passive/pass??.c", "active/active??.c", "shell/shell??.c", "follow/follow02.c"]
+
+# Index past the longest pattern, so that every step and the end of every pattern runs
+STEPS_PER_PATTERN = 12
+
+FORMATS = {"s16": "%d", "u16": "%u", "s32": "%d", "u32": "%u"}
+
+def find_dispatchers() -> list[tuple[str, int]]:
+    """Names of the dispatchers of the working tree and the sizes of their pattern tables"""
+    dispatchers = []
+
+    for path in sorted((ROOT / COM_DIR).glob("*/*.c")):
+        text = path.read_text()
+        match = re.search(r"^void (\w+)\(PLW\* wk\) \{\n    Exec_Com_Pattern\(wk, \w+\[", text, re.M)
+
+        if match:
+            size = re.search(r"^const s16\* const \w+\[(\d+)\]", text, re.M).group(1)
+            dispatchers.append((match.group(1), int(size)))
+
+    return dispatchers
+
+def make_driver(dispatchers: list[tuple[str, int]], bench: bool, repeats: int) -> str:
+    text = re.sub(r"\n[ \t]+", " ", (ROOT / COM_DIR / "com_sub.h").read_text())
+    out = ['#include "sf33rd/Source/Game/com/com_sub.h"\n\n#include <stdio.h>\n#include <time.h>\n\n',
+           "u8 CP_Index[2][8];\nu16 Pattern_Index[2];\nu16 M_Lv[2];\nstatic volatile s32 sink;\n\n"]
+
+    for type, name, params in re.findall(r"^(\w+) (\w+)\(PLW\* wk((?:, [^)]*)?)\);", text, re.M):
+        types = [p.split()[0] for p in params.split(", ") if p]
+
+        if any(t not in FORMATS for t in types):
+            continue
+
+        declaration = "".join(f", {t} a{i}" for i, t in enumerate(types))
+        args = "".join(f", a{i}" for i in range(len(types)))
+
+        if bench:
+            body = "sink++;"
+        else:
+            body = f'printf("{name}{"".join(" " + FORMATS[t] for t in types)}\\n"{args});'
+
+        if type != "void":
+            body += " return 0;"
+
+        out.append(f"{type} {name}(PLW* wk{declaration}) {{ {body} }}\n")
+
+    out += [f"void {name}(PLW* wk);\n" for name, _ in dispatchers]
+    out.append("\nint main() {\n    static PLW wk;\n    struct timespec start, end;\n\n")
+    out.append("    M_Lv[0] = 0x1234;\n    M_Lv[1] = 0x8765;\n    clock_gettime(CLOCK_MONOTONIC, &start);\n\n")
+    out.append(f"    for (int r = 0; r < {repeats if bench else 1}; r++) {{\n")
+
+    for name, size in dispatchers:
+        # Without --bench every index runs in order and then in a scrambled order, which jumps back and forth
+        out.append(f"        for (int order = 0; order < {1 if bench else 2}; order++)\n")
+        out.append(f"        for (int id = 0; id < 2; id++) for (int p = 0; p < {size}; p++)\n")
+        out.append(f"        for (int k = 0; k < {STEPS_PER_PATTERN if bench else 256}; k++) {{\n")
+        out.append("            int c = order ? (k * 167) & 0xFF : k;\n\n")
+        out.append("            wk.wu.id = id;\n            Pattern_Index[id] = p;\n            CP_Index[id][0] = c;\n")
+
+        if not bench:
+            out.append(f'            printf("{name} %d %d %d: ", id, p, c);\n')
+
+        out.append(f"            {name}(&wk);\n        }}\n")
+
+    out.append("    }\n\n    clock_gettime(CLOCK_MONOTONIC, &end);\n")
+
+    if bench:
+        calls = repeats * STEPS_PER_PATTERN * 2 * sum(size for _, size in dispatchers)
+        out.append("    double ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);\n")
+        out.append(f'    printf("%.2f\\n", ns / {calls});\n')
+
+    out.append("    return 0;\n}\n")
+    return "".join(out)
+
+def build(revision: str, work_dir: Path, driver: Path, cc: str, flags: list[str]) -> Path:
+    """Build the pattern files of a revision, or of the working tree for `.`, against the driver"""
+    if revision == ".":
+        source_dir = ROOT
+    else:
+        source_dir = work_dir / revision.replace("/", "_")
+        source_dir.mkdir()
+        archive = subprocess.run(["git", "-C", ROOT, "archive", revision, COM_DIR], check=True, capture_output=True)
+        subprocess.run(["tar", "-x", "-C", source_dir], input=archive.stdout, check=True)
+
+    com_dir = source_dir / COM_DIR
+    sources = [path for pattern in PATTERN_FILES for path in sorted(com_dir.glob(pattern))]
+
+    if (com_dir / "com_pattern.c").exists():
+        sources.append(com_dir / "com_pattern.c")
+
+    binary = work_dir / f"{revision.replace('/', '_')}.bin"
+    includes = [f"-I{source_dir / 'src'}", f"-I{ROOT / 'src'}", f"-I{ROOT / 'include'}", f"-I{ROOT / 'include/sdk'}"]
+    subprocess.run([cc, "-std=gnu11", "-DTARGET_SDL3", "-w", *flags, *includes, "-o", binary, driver, *sources],
+                   check=True)
+    return binary
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare the CPU pattern interpreters of several revisions")
+    parser.add_argument("revisions", nargs="+", help="git revisions to compare, . for the working tree")
+    parser.add_argument("--bench", action="store_true", help="time the revisions instead of comparing their calls")
+    parser.add_argument("--repeats", type=int, default=200, help="times to run every pattern with --bench")
+    parser.add_argument("--runs", type=int, default=5, help="runs of each revision with --bench, the best one counts")
+    parser.add_argument("--cc", default="cc")
+    parser.add_argument("--flags", default="-O2", help="compiler flags")
+    args = parser.parse_args()
+
+    dispatchers = find_dispatchers()
+
+    with tempfile.TemporaryDirectory() as work_dir:
+        work_dir = Path(work_dir)
+        driver = work_dir / "driver.c"
+        driver.write_text(make_driver(dispatchers, args.bench, args.repeats))
+        binaries = [build(r, work_dir, driver, args.cc, args.flags.split()) for r in args.revisions]
+
+        if args.bench:
+            calls = STEPS_PER_PATTERN * 2 * sum(size for _, size in dispatchers)
+            print(f"{calls} calls per run through every pattern, {args.repeats} runs")
+
+            for revision, binary in zip(args.revisions, binaries):
+                times = [float(subprocess.run([binary], check=True, capture_output=True, text=True).stdout)
+                         for _ in range(args.runs)]
+                print(f"{revision}: {min(times):.2f} ns per call")
+
+            return
+
+        reference = subprocess.run([binaries[0]], check=True, capture_output=True).stdout
+        reference_lines = reference.splitlines()
+        print(f"{args.revisions[0]}: {len(reference_lines)} calls")
+        failed = False
+
+        for revision, binary in zip(args.revisions[1:], binaries[1:]):
+            output = subprocess.run([binary], check=True, capture_output=True).stdout
+
+            if output == reference:
+                print(f"{revision}: same calls")
+                continue
+
+            failed = True
+            lines = output.splitlines()
+            line = next((i for i, (a, b) in enumerate(zip(reference_lines, lines)) if a != b),
+                        min(len(reference_lines), len(lines)))
+            print(f"{revision}: first different call on line {line + 1}")
+
+        sys.exit(1 if failed else 0)
+
+if __name__ == "__main__":
+    main()
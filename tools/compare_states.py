@@ -12,6 +12,12 @@ class Member:
     typename: str
     location: int
 
+@dataclass
+class Variable:
+    name: str
+    offset: int
+    size: int
+
 @dataclass
 class Struct:
     name: str
@@ -19,6 +25,9 @@ class Struct:
     size: int
     members: list[Member]
 
+# Only written while rendering, which is skipped while resimulating. Left out of checksums by netplay.c
+RENDER_ONLY_FIELDS = {"current_colcd", "colcd", "extra_col", "extra_col_2"}
+
 class DWARFParser:
     class TypedefParserState(Enum):
         TYPEDEF = 0
@@ -39,11 +48,31 @@ class DWARFParser:
         self.typedefs: dict[int, str] = {}
         self.structs: list[Struct] = []
         self.struct_name_to_struct: dict[str, Struct] = {}
+        self.variable_typenames: dict[str, str] = {}
 
     def parse_object(self, path: Path):
         lines = self.__run_dwarfdump(path).splitlines()
         self.__parse_typedefs(lines)
         self.__parse_structs(lines)
+        self.__parse_variables(lines)
+
+    def find_variable_member(self, variable_name: str, offset: int) -> list[str]:
+        typename = self.variable_typenames.get(variable_name, "")
+        name, array_dimensions = self.__split_typename(typename)
+        struct = self.struct_name_to_struct.get(name)
+        path_component = variable_name
+
+        if not struct:
+            return [path_component]
+
+        if array_dimensions:
+            for index in self.__offset_to_indices(offset, struct.size, array_dimensions):
+                path_component += f"[{index}]"
+
+            offset %= struct.size
+
+        path, _ = self.find_member(name, offset)
+        return [path_component] + path
 
     def find_member(self, struct_name: str, offset: int) -> tuple[list[str], dict]:
         path: list[str] = []
@@ -246,18 +275,81 @@ class DWARFParser:
         for struct in self.structs:
             self.struct_name_to_struct[struct.name] = struct
 
-def find_state_pairs() -> list[tuple[Path, Path, int]]:
+    def __parse_variables(self, lines: list[str]):
+        current_name: str | None = None
+        in_variable = False
+
+        name_re = re.compile(r"DW_AT_name\t\(\"(\w+)\"\)")
+        type_re = re.compile(r"DW_AT_type\s+\((\w+) \"(.+)\"\)")
+
+        for line in lines:
+            if line.endswith("DW_TAG_variable"):
+                current_name = None
+                in_variable = True
+                continue
+
+            if not in_variable:
+                continue
+
+            if match := re.search(name_re, line):
+                current_name = match.group(1)
+            elif (match := re.search(type_re, line)) and current_name:
+                self.variable_typenames.setdefault(current_name, match.group(2))
+                in_variable = False
+            elif line.strip() == "":
+                in_variable = False
+
+class StateLayout:
+    """Where each global is stored in dumped states, as written by netplay.c to states/layout"""
+
+    def __init__(self, path: Path):
+        self.game_state_offset = 0
+        self.variables: list[Variable] = []
+
+        for line in path.read_text().splitlines():
+            fields = line.split()
+
+            if fields[0] == "game_state":
+                self.game_state_offset = int(fields[1])
+            else:
+                self.variables.append(Variable(fields[0], int(fields[1]), int(fields[2])))
+
+        self.variables.sort(key=lambda x: x.offset)
+
+    def find_variable(self, offset: int) -> Variable | None:
+        for variable in self.variables:
+            if variable.offset <= offset < variable.offset + variable.size:
+                return variable
+
+        return None
+
+def describe_offset(parser: DWARFParser, layout: StateLayout, offset: int) -> tuple[list[str], dict]:
+    if offset < layout.game_state_offset:
+        return parser.find_member("State", offset)
+
+    offset -= layout.game_state_offset
+    variable = layout.find_variable(offset)
+
+    if not variable:
+        return (["gs", f"<padding at 0x{offset:X}>"], {})
+
+    return (["gs"] + parser.find_variable_member(variable.name, offset - variable.offset), {})
+
+def find_state_pairs(states_dir: Path = Path("states")) -> list[tuple[Path, Path, int]]:
     pairs: list[tuple[Path, Path]] = []
-    files = sorted(Path("states").iterdir(), key=lambda x: x.name)
+    files = sorted(states_dir.iterdir(), key=lambda x: x.name)
 
     for file in files:
+        if file.name == "layout":
+            continue
+
         plnum, frame = file.name.split("_")
 
         if plnum == "1":
             continue
 
-        file1 = Path(f"states/0_{frame}")
-        file2 = Path(f"states/1_{frame}")
+        file1 = states_dir / f"0_{frame}"
+        file2 = states_dir / f"1_{frame}"
 
         if not file2.exists():
             continue
@@ -283,6 +375,7 @@ def effect_offset(parser: DWARFParser, index: int) -> int:
 
 def compare_states(parser: DWARFParser):
     pairs = find_state_pairs()
+    layout = StateLayout(Path("states") / "layout")
 
     for pl1_state_path, pl2_state_path, frame in pairs:
         pl1_state = pl1_state_path.read_bytes()
@@ -295,7 +388,11 @@ def compare_states(parser: DWARFParser):
             byte2 = pl2_state[i]
 
             if byte1 != byte2:
-                path_components, metadata = parser.find_member("State", i)
+                path_components, metadata = describe_offset(parser, layout, i)
+
+                if path_components and path_components[-1] in RENDER_ONLY_FIELDS:
+                    continue
+
                 path = ".".join(path_components)
 
                 effect_id = None
@@ -314,7 +411,7 @@ def compare_states(parser: DWARFParser):
 
 def main():
     if len(sys.argv) != 2:
-        print("Usage: python3 compare_states.py <path_to_obj_file>")
+        print("Usage: python3 compare_states.py <path_to_executable>")
         return
 
     parser = DWARFParser()
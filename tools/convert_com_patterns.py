@@ -0,0 +1,248 @@
+import argparse
+import re
+import sys
+from pathlib import Path
+
+# Converts the CPU pattern files from one switch function per pattern to step arrays that com/com_pattern.c interprets.
+# The conversion has already been applied, so this only runs on trees from before it (the parent of the commit that
+# added com/com_pattern.c). It's kept to show how the arrays were made and to redo the conversion on older branches.
+
+COM_DIR = Path(__file__).resolve().parent.parent / "src" / "sf33rd" / "Source" / "Game" / "com"
+
+FUNCTION = re.compile(r"^void (\w+)\(PLW\* wk\)\s*\{\n(.*?)\n\}\n", re.S | re.M)
+PATTERN_BODY = re.compile(r"    switch \(CP_Index\[wk->wu\.id\]\[0\]\) \{\n"
+                          r"((?:    case \d+:\n        \w+\(wk(?:, [^;]+)*\);\n        break;\n\n?)*)"
+                          r"    default:\n        End_Pattern\(wk\);\n(?:        break;\n)?    \}")
+CASE = re.compile(r"    case (\d+):\n        (\w+)\(wk((?:, [^;]+)*)\);")
+TABLE = re.compile(r"^void \(\*const (\w+)\[(\d+)\]\)\((?:PLW\*)?\)(?: = \{(.*?)\};)?", re.S | re.M)
+M_LV = "M_Lv[wk->wu.id]"
+
+HEADER_START = """#ifndef COM_PATTERN_H
+#define COM_PATTERN_H
+
+#include "structs.h"
+#include "types.h"
+
+/// Steps of a CPU pattern. A pattern is an array of steps, each followed by the arguments of its subroutine, and
+/// ends with `COM_END`.
+typedef enum ComStep {
+    COM_END,
+"""
+
+HEADER_END = """    COM_STEP_COUNT,
+} ComStep;
+
+/// Run the step of `pattern` that `CP_Index` points to, or end the pattern when it has run out of steps
+void Exec_Com_Pattern(PLW* wk, const s16* pattern);
+
+#endif
+"""
+
+SOURCE_START = """/**
+ * @file com_pattern.c
+ * COM Pattern Interpreter
+ */
+
+#include "sf33rd/Source/Game/com/com_pattern.h"
+#include "common.h"
+#include "sf33rd/Source/Game/com/com_sub.h"
+#include "sf33rd/Source/Game/engine/workuser.h"
+
+static const u8 Com_Step_Arg_Count[COM_STEP_COUNT] = {
+    [COM_END] = 0,
+"""
+
+SOURCE_INTERPRETER = """};
+
+/// Step that the last call of each player ran. Patterns advance by one step at a time, so the next call only has to
+/// move past that step instead of walking the pattern from its start.
+typedef struct StepCursor {
+    const s16* pattern;
+    const s16* step;
+    s16 index;
+} StepCursor;
+
+/// Only ever points at constant pattern data and is checked against `CP_Index` on every call, so it doesn't need to be
+/// part of saved states
+static StepCursor step_cursors[2];
+
+void Exec_Com_Pattern(PLW* wk, const s16* pattern) {
+    StepCursor* cursor = &step_cursors[wk->wu.id];
+    const s16 index = CP_Index[wk->wu.id][0];
+    const s16* arg;
+
+    if ((cursor->pattern != pattern) || (cursor->index > index)) {
+        cursor->pattern = pattern;
+        cursor->step = pattern;
+        cursor->index = 0;
+    }
+
+    while ((cursor->index < index) && (*cursor->step != COM_END)) {
+        cursor->step += Com_Step_Arg_Count[*cursor->step] + 1;
+        cursor->index++;
+    }
+
+    arg = cursor->step + 1;
+
+    switch (*cursor->step) {
+    case COM_END:
+        End_Pattern(wk);
+        break;
+"""
+
+def read_signatures(com_dir: Path) -> dict[str, list[str]]:
+    """Parameter types of every com_sub routine after `wk`, in the order com_sub.h declares them"""
+    text = re.sub(r"\n\s+", " ", (com_dir / "com_sub.h").read_text())
+    signatures = {}
+
+    for name, params in re.findall(r"^\w+ (\w+)\(PLW\* wk((?:, [^)]*)?)\);", text, re.M):
+        signatures[name] = [p.split()[0] for p in params.split(", ") if p]
+
+    return signatures
+
+def format_argument(text: str, type: str) -> str:
+    """Make sure that an argument survives s16 storage and conversion back to `type`, and format it for an array"""
+    if " - " in text:
+        left, right = text.split(" - ")
+        value = int(left, 0) - int(right, 0)
+        assert -0x8000 <= value <= 0x7FFF, text
+        return text
+
+    value = int(text, 0)
+
+    if type in ("s32", "u32"):
+        assert -0x8000 <= value <= 0x7FFF, (text, type)
+    else:
+        assert -0x8000 <= value <= 0xFFFF, (text, type)
+
+    if text.lower().lstrip("-").startswith("0x"):
+        sign = "-" if text.startswith("-") else ""
+        text = sign + "0x" + text.lstrip("-")[2:].upper()
+
+    return text if value <= 0x7FFF else f"(s16){text}"
+
+class Converter:
+    def __init__(self, com_dir: Path):
+        self.signatures = read_signatures(com_dir)
+        self.steps: dict[str, tuple[str, list[str]]] = {}
+
+    def convert_pattern(self, path: Path, name: str, body: str) -> list[list[str]]:
+        match = PATTERN_BODY.fullmatch(body)
+        steps = []
+
+        for i, (index, function, args) in enumerate(CASE.findall(match.group(1))):
+            assert int(index) == i, (path, name)
+            args = [a for a in args.split(", ") if a]
+            types = self.signatures[function]
+            assert len(args) == len(types), (path, function, args)
+            step = "COM_" + function.upper()
+
+            if M_LV in args:
+                assert function == "Normal_Attack" and args[1] == M_LV, (path, name)
+                step = "COM_NORMAL_ATTACK_M_LV"
+                args = args[:1]
+                types = types[:1]
+
+            self.steps[step] = (function, types)
+            steps.append([step] + [format_argument(a, t) for a, t in zip(args, types)])
+
+        return steps
+
+    def convert_file(self, path: Path) -> str:
+        text = path.read_text()
+        functions = FUNCTION.findall(text)
+        assert len(functions) == len(re.findall(r"^void \w+\(PLW", text, re.M)), path
+        tables = TABLE.findall(text)
+        assert len(tables) == 2, path
+        table_name, table_size, table_body = tables[1]
+        entries = [e.strip() for e in table_body.replace("\n", " ").split(",") if e.strip()]
+        assert len(entries) == int(table_size), path
+        dispatchers = [name for name, body in functions if not PATTERN_BODY.fullmatch(body)]
+        assert len(dispatchers) == 1, (path, dispatchers)
+        patterns = {name: self.convert_pattern(path, name, body) for name, body in functions if name != dispatchers[0]}
+        assert set(entries) == set(patterns), path
+
+        head = text[:text.index("void (*const")]
+        head = head.replace('#include "sf33rd/Source/Game/com/com_sub.h"\n',
+                            '#include "sf33rd/Source/Game/com/com_pattern.h"\n')
+        out = [head]
+
+        for name, steps in patterns.items():
+            out.append(f"static const s16 {name}[] = {{\n")
+            out += ["    " + ", ".join(step) + ",\n" for step in steps]
+            out.append("    COM_END,\n};\n\n")
+
+        out.append(f"const s16* const {table_name}[{table_size}] = {{")
+        out.append(table_body.rstrip())
+        out.append("\n};\n\n" if table_body.endswith("\n") else " };\n\n")
+        out.append(f"void {dispatchers[0]}(PLW* wk) {{\n")
+        out.append(f"    Exec_Com_Pattern(wk, {table_name}[(s16)Pattern_Index[wk->wu.id]]);\n}}\n")
+        return "".join(out)
+
+    def ordered_steps(self) -> list[str]:
+        """Steps in the order com_sub.h declares their routines"""
+        order = list(self.signatures)
+        return sorted(self.steps, key=lambda step: (order.index(self.steps[step][0]), step))
+
+    def make_header(self) -> str:
+        out = [HEADER_START]
+
+        for step in self.ordered_steps():
+            comment = " // Normal_Attack with M_Lv as the lever data" if step == "COM_NORMAL_ATTACK_M_LV" else ""
+            out.append(f"    {step},{comment}\n")
+
+        out.append(HEADER_END)
+        return "".join(out)
+
+    def make_source(self) -> str:
+        out = [SOURCE_START]
+        out += [f"    [{step}] = {len(self.steps[step][1])},\n" for step in self.ordered_steps()]
+        out.append(SOURCE_INTERPRETER)
+
+        for step in self.ordered_steps():
+            function, types = self.steps[step]
+            args = "".join(f", arg[{i}]" for i in range(len(types)))
+
+            if step == "COM_NORMAL_ATTACK_M_LV":
+                args += f", {M_LV}"
+
+            call = f"        {function}(wk{args});"
+
+            if len(call) > 120:
+                # One argument per line, as clang-format wraps it
+                call = f",\n{' ' * (len(function) + 9)}".join(call.split(", "))
+
+            out.append(f"\n    case {step}:\n{call}\n        break;\n")
+
+        out.append("    }\n}\n")
+        return "".join(out)
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert the switch based CPU patterns to step arrays")
+    parser.add_argument("com_dir", type=Path, nargs="?", default=COM_DIR, help="the com directory to convert")
+    parser.add_argument("--write", action="store_true", help="overwrite the files instead of only checking them")
+    args = parser.parse_args()
+
+    com_dir = args.com_dir
+
+    if (com_dir / "com_pattern.c").exists():
+        print(f"{com_dir} has already been converted")
+        sys.exit(1)
+
+    paths = sorted([*com_dir.glob("passive/pass??.c"), *com_dir.glob("active/active??.c"),
+                    *com_dir.glob("shell/shell??.c"), com_dir / "follow" / "follow02.c"])
+    converter = Converter(com_dir)
+    results = {path: converter.convert_file(path) for path in paths}
+    results[com_dir / "com_pattern.h"] = converter.make_header()
+    results[com_dir / "com_pattern.c"] = converter.make_source()
+
+    print(f"converted {len(paths)} files with {len(converter.steps) + 1} kinds of steps")
+
+    if args.write:
+        for path, text in results.items():
+            path.write_text(text)
+
+        print(f"wrote {len(results)} files")
+
+if __name__ == "__main__":
+    main()
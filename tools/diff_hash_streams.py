@@ -0,0 +1,138 @@
+import argparse
+import struct
+import sys
+from pathlib import Path
+
+MAGIC = b"3SXH"
+VERSION = 1
+
+HEADER = struct.Struct("<4sIII")
+FRAME_HEADER = struct.Struct("<IIH")
+REGION_HASH = struct.Struct("<HI")
+
+class HashStream:
+    def __init__(self, path: Path):
+        data = path.read_bytes()
+
+        if len(data) < HEADER.size:
+            raise ValueError("file is too short")
+
+        magic, version, region_count, self.replay_frames = HEADER.unpack_from(data)
+
+        if magic != MAGIC:
+            raise ValueError("not a hash stream")
+
+        if version != VERSION:
+            raise ValueError(f"unsupported version {version}")
+
+        offset = HEADER.size
+        self.regions: list[str] = []
+
+        for _ in range(region_count):
+            end = data.index(b"\0", offset)
+            self.regions.append(data[offset:end].decode())
+            offset = end + 1
+
+        self.data = data
+        self.frames_offset = offset
+        self.is_truncated = False
+
+    def frames(self):
+        """Yield the frame number, the hash of the whole state and the hashes of every region after each frame"""
+        hashes = [0] * len(self.regions)
+        offset = self.frames_offset
+
+        while offset < len(self.data):
+            if offset + FRAME_HEADER.size > len(self.data):
+                self.is_truncated = True
+                return
+
+            frame, state_hash, changed_count = FRAME_HEADER.unpack_from(self.data, offset)
+            offset += FRAME_HEADER.size
+
+            if offset + changed_count * REGION_HASH.size > len(self.data):
+                self.is_truncated = True
+                return
+
+            for region, region_hash in REGION_HASH.iter_unpack(
+                    self.data[offset:offset + changed_count * REGION_HASH.size]):
+                hashes[region] = region_hash
+
+            offset += changed_count * REGION_HASH.size
+            yield frame, state_hash, hashes
+
+def describe(stream: HashStream, path: Path):
+    print(f"{path}: {len(stream.regions)} regions, replay of {stream.replay_frames} frames")
+
+def main():
+    parser = argparse.ArgumentParser(description="Find the first frame and regions where two hash streams differ")
+    parser.add_argument("a", type=Path, help="hash stream written by --hash-stream")
+    parser.add_argument("b", type=Path, help="hash stream of the same replay from another build")
+    parser.add_argument("--frames", type=int, default=1, help="divergent frames to list")
+    parser.add_argument("--regions", type=int, default=20, help="divergent regions to list per frame")
+    args = parser.parse_args()
+
+    a = HashStream(args.a)
+    b = HashStream(args.b)
+    describe(a, args.a)
+    describe(b, args.b)
+
+    if a.replay_frames != b.replay_frames:
+        print("⚠️ the streams were written for different replays")
+
+    # Builds can differ in which globals they have. Only compare the ones both have
+    same_layout = a.regions == b.regions
+    b_indices = {name: i for i, name in enumerate(b.regions)}
+    common = [(name, i, b_indices[name]) for i, name in enumerate(a.regions) if name in b_indices]
+
+    if not same_layout:
+        only_a = [name for name in a.regions if name not in b_indices]
+        only_b = [name for name in b.regions if name not in set(a.regions)]
+        print(f"⚠️ regions differ, comparing the {len(common)} that both streams have")
+
+        if only_a:
+            print(f"   only in {args.a}: {', '.join(only_a)}")
+
+        if only_b:
+            print(f"   only in {args.b}: {', '.join(only_b)}")
+
+    compared_frames = 0
+    divergent_frames = 0
+
+    for (frame_a, state_hash_a, hashes_a), (frame_b, state_hash_b, hashes_b) in zip(a.frames(), b.frames()):
+        if frame_a != frame_b:
+            print(f"⚠️ frame numbers went out of step at {frame_a} and {frame_b}")
+            break
+
+        compared_frames += 1
+
+        if same_layout and (state_hash_a == state_hash_b):
+            continue
+
+        diverged = [name for name, i, j in common if hashes_a[i] != hashes_b[j]]
+
+        if not diverged:
+            continue
+
+        divergent_frames += 1
+        shown = ", ".join(diverged[:args.regions])
+        more = f" and {len(diverged) - args.regions} more" if len(diverged) > args.regions else ""
+        print(f"frame {frame_a}: {len(diverged)} regions differ: {shown}{more}")
+
+        if divergent_frames >= args.frames:
+            break
+
+    for stream, path in [(a, args.a), (b, args.b)]:
+        if stream.is_truncated:
+            print(f"⚠️ {path} is cut off")
+
+    if divergent_frames == 0:
+        print(f"✅ {compared_frames} frames match")
+
+        if compared_frames < max(a.replay_frames, b.replay_frames):
+            print("⚠️ a stream ended before the end of the replay")
+
+    sys.exit(1 if divergent_frames > 0 else 0)
+
+if __name__ == "__main__":
+    main()
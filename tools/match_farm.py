@@ -0,0 +1,194 @@
+import argparse
+import csv
+import itertools
+import json
+import os
+import subprocess
+import sys
+from concurrent.futures import ThreadPoolExecutor, as_completed
+from dataclasses import dataclass, field
+from pathlib import Path
+
+CHARACTERS = [
+    "gill", "alex", "ryu", "yun", "dudley", "necro", "hugo", "ibuki", "elena", "oro",
+    "yang", "ken", "sean", "urien", "akuma", "chunli", "makoto", "q", "twelve", "remy",
+]
+
+@dataclass
+class Job:
+    characters: tuple[int, int]
+    seed: int
+    matches: int
+    workdir: Path
+
+@dataclass
+class MatchupStats:
+    matches: int = 0
+    wins: list[int] = field(default_factory=lambda: [0, 0])
+    draws: int = 0
+    frames: int = 0
+    rounds: int = 0
+    round_frames: int = 0
+    damage: list[int] = field(default_factory=lambda: [0, 0])
+    hashes: set[str] = field(default_factory=set)
+
+def parse_character(name: str) -> int:
+    if name.isdigit():
+        return int(name)
+
+    return CHARACTERS.index(name.lower())
+
+def parse_matchups(args) -> list[tuple[int, int]]:
+    if args.all:
+        ids = range(1, len(CHARACTERS)) if not args.include_gill else range(len(CHARACTERS))
+        return list(itertools.combinations_with_replacement(ids, 2))
+
+    matchups = []
+
+    for matchup in args.matchups:
+        p1, p2 = matchup.split(":")
+        matchups.append((parse_character(p1), parse_character(p2)))
+
+    return matchups
+
+def make_jobs(args, matchups: list[tuple[int, int]]) -> list[Job]:
+    jobs = []
+
+    for p1, p2 in matchups:
+        for first in range(0, args.matches, args.matches_per_process):
+            count = min(args.matches_per_process, args.matches - first)
+            workdir = args.out / f"{CHARACTERS[p1]}_{CHARACTERS[p2]}_{first}"
+            jobs.append(Job((p1, p2), args.seed + first, count, workdir))
+
+    return jobs
+
+def run_job(args, job: Job) -> tuple[Job, list[dict], bool]:
+    job.workdir.mkdir(parents=True, exist_ok=True)
+    report = job.workdir / "report.jsonl"
+
+    command = [
+        str(Path(args.executable).resolve()),
+        "--headless",
+        "--farm", str(job.matches),
+        "--farm-chars", f"{job.characters[0]},{job.characters[1]}",
+        "--farm-arts", args.arts,
+        "--farm-difficulty", str(args.difficulty),
+        "--seed", str(job.seed),
+        "--report", str(report.resolve()),
+    ]
+
+    if args.inputs:
+        command += ["--inputs", str(Path(args.inputs).resolve())]
+
+    with open(job.workdir / "log.txt", "w") as log:
+        try:
+            process = subprocess.run(command, cwd=job.workdir, stdout=log, stderr=subprocess.STDOUT,
+                                     timeout=args.timeout)
+            exited = process.returncode == 0
+        except subprocess.TimeoutExpired:
+            exited = False
+
+    results = []
+
+    if report.exists():
+        with open(report) as f:
+            results = [json.loads(line) for line in f if line.strip()]
+
+    return job, results, exited and (len(results) == job.matches)
+
+def aggregate(results: list[dict]) -> dict[tuple[int, int], MatchupStats]:
+    stats: dict[tuple[int, int], MatchupStats] = {}
+
+    for result in results:
+        matchup = tuple(result["characters"])
+        entry = stats.setdefault(matchup, MatchupStats())
+        entry.matches += 1
+        entry.frames += result["frames"]
+        entry.rounds += len(result["rounds"])
+        entry.round_frames += sum(r["frames"] for r in result["rounds"])
+        entry.damage[0] += result["damage"][0]
+        entry.damage[1] += result["damage"][1]
+        entry.hashes.add(result["state_hash"])
+
+        if result["winner"] < 0:
+            entry.draws += 1
+        else:
+            entry.wins[result["winner"]] += 1
+
+    return stats
+
+def write_summary(path: Path, stats: dict[tuple[int, int], MatchupStats]):
+    with open(path, "w", newline="") as f:
+        writer = csv.writer(f)
+        writer.writerow(["p1", "p2", "matches", "p1_win_rate", "p2_win_rate", "draws", "avg_match_frames",
+                         "avg_round_frames", "avg_p1_damage", "avg_p2_damage", "distinct_hashes"])
+
+        for (p1, p2), entry in sorted(stats.items()):
+            n = max(entry.matches, 1)
+            writer.writerow([
+                CHARACTERS[p1], CHARACTERS[p2], entry.matches,
+                f"{entry.wins[0] / n:.3f}", f"{entry.wins[1] / n:.3f}", entry.draws,
+                f"{entry.frames / n:.1f}", f"{entry.round_frames / max(entry.rounds, 1):.1f}",
+                f"{entry.damage[0] / n:.1f}", f"{entry.damage[1] / n:.1f}", len(entry.hashes),
+            ])
+
+def main():
+    parser = argparse.ArgumentParser(description="Play CPU vs CPU matches on every core and aggregate the results")
+    parser.add_argument("executable", help="path to the 3sx executable")
+    parser.add_argument("matchups", nargs="*", help="matchups like ryu:ken or 2:11")
+    parser.add_argument("--all", action="store_true", help="play every matchup")
+    parser.add_argument("--include-gill", action="store_true", help="include Gill in --all")
+    parser.add_argument("--matches", type=int, default=10, help="matches per matchup")
+    parser.add_argument("--matches-per-process", type=int, default=10,
+                        help="matches a single process plays before exiting")
+    parser.add_argument("--arts", default="0,0", help="super arts of both players, 0-2")
+    parser.add_argument("--difficulty", type=int, default=-1, help="CPU difficulty 0-7, -1 keeps the saved setting")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--inputs", help="file with one hex input per line that player 1 plays instead of the CPU")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count(), help="processes to run at once")
+    parser.add_argument("--timeout", type=float, default=3600, help="seconds before a process is killed")
+    parser.add_argument("--out", type=Path, default=Path("match_farm"))
+    args = parser.parse_args()
+
+    matchups = parse_matchups(args)
+
+    if not matchups:
+        parser.error("pass matchups or --all")
+
+    jobs = make_jobs(args, matchups)
+    results = []
+    failed_jobs = []
+
+    print(f"running {len(jobs)} processes for {len(matchups)} matchups on {args.jobs} cores")
+
+    with ThreadPoolExecutor(max_workers=args.jobs) as executor:
+        futures = [executor.submit(run_job, args, job) for job in jobs]
+
+        for done, future in enumerate(as_completed(futures), start=1):
+            job, job_results, ok = future.result()
+            results += job_results
+
+            if not ok:
+                failed_jobs.append(job)
+
+            print(f"\r{done}/{len(jobs)} processes finished, {len(results)} matches", end="", flush=True)
+
+    print()
+
+    stats = aggregate(results)
+    args.out.mkdir(parents=True, exist_ok=True)
+    write_summary(args.out / "summary.csv", stats)
+
+    with open(args.out / "results.jsonl", "w") as f:
+        for result in results:
+            f.write(json.dumps(result) + "\n")
+
+    print(f"wrote {args.out / 'summary.csv'} and {args.out / 'results.jsonl'}")
+
+    for job in failed_jobs:
+        print(f"⚠️ {job.workdir} didn't finish, see log.txt there")
+
+    sys.exit(1 if failed_jobs else 0)
+
+if __name__ == "__main__":
+    main()
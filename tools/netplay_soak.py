@@ -0,0 +1,180 @@
+import argparse
+import csv
+import json
+import subprocess
+import sys
+from pathlib import Path
+
+from compare_states import RENDER_ONLY_FIELDS, DWARFParser, StateLayout, describe_offset, find_state_pairs
+
+PLAYER_COUNT = 2
+
+def launch_instances(args, workdir: Path) -> list[subprocess.Popen]:
+    processes: list[subprocess.Popen] = []
+
+    for player in range(1, PLAYER_COUNT + 1):
+        command = [
+            str(Path(args.executable).resolve()),
+            str(player),
+            "127.0.0.1",
+            "--headless",
+            "--soak", str(args.frames),
+            "--seed", str(args.seed + player),
+            "--report", f"report_{player}.json",
+            "--timings", f"timings_{player}.csv",
+        ]
+
+        if args.inputs:
+            command += ["--inputs", str(Path(args.inputs).resolve())]
+
+        log = open(workdir / f"log_{player}.txt", "w")
+        processes.append(subprocess.Popen(command, cwd=workdir, stdout=log, stderr=subprocess.STDOUT))
+
+    return processes
+
+def wait_for_instances(processes: list[subprocess.Popen], timeout: float) -> bool:
+    try:
+        for process in processes:
+            process.wait(timeout=timeout)
+    except subprocess.TimeoutExpired:
+        for process in processes:
+            process.kill()
+
+        return False
+
+    return True
+
+def percentile(values: list[int], fraction: float) -> int:
+    if not values:
+        return 0
+
+    values = sorted(values)
+    return values[min(int(len(values) * fraction), len(values) - 1)]
+
+def print_timings(path: Path):
+    columns: dict[str, list[int]] = { "save_ns": [], "load_ns": [], "advance_ns": [], "resimulate_ns": [] }
+
+    with open(path) as f:
+        for row in csv.DictReader(f):
+            for name, values in columns.items():
+                value = int(row[name])
+
+                if value > 0:
+                    values.append(value)
+
+    for name, values in columns.items():
+        p50 = percentile(values, 0.5) / 1000
+        p99 = percentile(values, 0.99) / 1000
+        worst = max(values, default=0) / 1000
+        print(f"    {name[:-3]:<11} p50 {p50:8.1f} us   p99 {p99:8.1f} us   max {worst:8.1f} us")
+
+def print_rollback_histogram(depths: list[int]):
+    total = max(sum(depths), 1)
+    widest = max(depths, default=1) or 1
+
+    for depth, count in enumerate(depths):
+        if depth == 0 or count == 0:
+            continue
+
+        label = f"{depth}+" if depth == len(depths) - 1 else f"{depth}"
+        bar = "#" * max(1, count * 40 // widest)
+        print(f"    {label:>3} frames {count:7} ({count * 100 / total:5.1f}%) {bar}")
+
+def print_report(player: int, report: dict, workdir: Path):
+    status = "✅" if report["completed"] else "❌"
+    print(f"{status} player {player}: {report['frames']} frames in {report['wall_time_s']} s")
+    print(f"    desyncs {report['desyncs']}, rollbacks {report['rollbacks']} "
+          f"({report['rolled_back_frames']} frames), catch-up frames {report['catch_up_frames']}")
+
+    for name in ["save", "load", "advance", "resimulate"]:
+        timing = report[name]
+        print(f"    {name:<11} avg {timing['avg_us']:8.1f} us   max {timing['max_us']:8.1f} us   ({timing['count']} calls)")
+
+    print("  rollback depths:")
+    print_rollback_histogram(report["rollback_depths"])
+
+    timings_path = workdir / f"timings_{player}.csv"
+
+    if timings_path.exists():
+        print("  per-frame timings:")
+        print_timings(timings_path)
+
+def region_of(path_components: list[str]) -> str:
+    # Group mismatches by the first two levels, e.g. gs.plw[0] or es.frw[12]
+    return ".".join(path_components[:2])
+
+def print_desync_regions(obj_path: Path, workdir: Path):
+    parser = DWARFParser()
+    parser.parse_object(obj_path)
+    layout = StateLayout(workdir / "states" / "layout")
+
+    for pl1_state_path, pl2_state_path, frame in find_state_pairs(workdir / "states"):
+        pl1_state = pl1_state_path.read_bytes()
+        pl2_state = pl2_state_path.read_bytes()
+        regions: dict[str, int] = {}
+
+        for i in range(min(len(pl1_state), len(pl2_state))):
+            if pl1_state[i] != pl2_state[i]:
+                path_components, _ = describe_offset(parser, layout, i)
+
+                if path_components and path_components[-1] in RENDER_ONLY_FIELDS:
+                    continue
+
+                region = region_of(path_components)
+                regions[region] = regions.get(region, 0) + 1
+
+        print(f"  frame {frame}:")
+
+        for region, count in sorted(regions.items(), key=lambda x: -x[1]):
+            print(f"    {region:<40} {count} bytes differ")
+
+def main():
+    parser = argparse.ArgumentParser(description="Run two headless instances against each other over loopback")
+    parser.add_argument("executable", help="path to a 3sx build, preferably Debug so that desyncs are detected")
+    parser.add_argument("--frames", type=int, default=10000, help="netplay frames to run")
+    parser.add_argument("--seed", type=int, default=1, help="seed for random inputs")
+    parser.add_argument("--inputs", help="file with one hex input per line to use instead of random inputs")
+    parser.add_argument("--workdir", default="soak", help="where to put reports, logs and desynced states")
+    parser.add_argument("--obj", help="executable with DWARF info, usually the one being tested, to explain desyncs")
+    parser.add_argument("--timeout", type=float, default=None, help="seconds to wait for the instances")
+    parser.add_argument("--max-resimulate-us", type=float, help="fail if average resimulation cost exceeds this")
+    args = parser.parse_args()
+
+    workdir = Path(args.workdir)
+    (workdir / "states").mkdir(parents=True, exist_ok=True)
+    timeout = args.timeout or (args.frames / 60 * 2 + 120)
+
+    processes = launch_instances(args, workdir)
+    finished = wait_for_instances(processes, timeout)
+
+    if not finished:
+        print(f"❌ instances didn't finish within {timeout:.0f} s, see logs in {workdir}")
+        sys.exit(1)
+
+    failed = False
+
+    for player in range(1, PLAYER_COUNT + 1):
+        report_path = workdir / f"report_{player}.json"
+
+        if not report_path.exists():
+            print(f"❌ player {player} didn't write a report, see {workdir}/log_{player}.txt")
+            failed = True
+            continue
+
+        report = json.loads(report_path.read_text())
+        print_report(player, report, workdir)
+
+        failed |= not report["completed"] or report["desyncs"] > 0
+
+        if args.max_resimulate_us and report["resimulate"]["avg_us"] > args.max_resimulate_us:
+            print(f"❌ resimulation is slower than {args.max_resimulate_us} us per frame")
+            failed = True
+
+    if args.obj and any((workdir / "states").iterdir()):
+        print("desynced regions:")
+        print_desync_regions(Path(args.obj), workdir)
+
+    sys.exit(1 if failed else 0)
+
+if __name__ == "__main__":
+    main()
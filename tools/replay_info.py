@@ -0,0 +1,139 @@
+import argparse
+import csv
+import struct
+import sys
+import zlib
+from dataclasses import dataclass
+from pathlib import Path
+
+MAGIC = b"3SXR"
+VERSION = 2
+
+HEADER = struct.Struct("<4sIIII8B")
+CHUNK_HEADER = struct.Struct("<III")
+INPUT_RUN = struct.Struct("<HHH")
+LATCH = struct.Struct("<4H")
+
+CHUNK_INPUTS = 1
+CHUNK_KEYFRAME = 2
+
+MODES = ["arcade", "versus", "network", "normal training", "parry training", "replay"]
+
+@dataclass
+class Keyframe:
+    frame: int
+    offset: int
+    size: int
+
+class Replay:
+    def __init__(self, path: Path):
+        data = path.read_bytes()
+
+        if len(data) < HEADER.size:
+            raise ValueError("file is too short")
+
+        header = HEADER.unpack_from(data)
+
+        if header[0] != MAGIC:
+            raise ValueError("not a replay file")
+
+        if header[1] != VERSION:
+            raise ValueError(f"unsupported version {header[1]}")
+
+        self.data = data
+        self.keyframe_interval = header[2]
+        self.state_size = header[3]
+        self.layout_fingerprint = header[4]
+        self.mode = header[5]
+        self.characters = header[6:8]
+        self.super_arts = header[8:10]
+        self.colors = header[10:12]
+        self.stage = header[12]
+        self.inputs: list[tuple[int, int]] = []
+        self.keyframes: list[Keyframe] = []
+        self.is_truncated = False
+        self.__parse_chunks(HEADER.size)
+
+    def __parse_chunks(self, offset: int):
+        while offset < len(self.data):
+            if offset + CHUNK_HEADER.size > len(self.data):
+                self.is_truncated = True
+                return
+
+            type, frame, size = CHUNK_HEADER.unpack_from(self.data, offset)
+            offset += CHUNK_HEADER.size
+
+            if offset + size > len(self.data):
+                self.is_truncated = True
+                return
+
+            if type == CHUNK_INPUTS:
+                if frame != len(self.inputs):
+                    raise ValueError(f"inputs chunk starts at frame {frame}, expected {len(self.inputs)}")
+
+                for p1, p2, frames in INPUT_RUN.iter_unpack(self.data[offset:offset + size]):
+                    self.inputs += [(p1, p2)] * frames
+            elif type == CHUNK_KEYFRAME:
+                self.keyframes.append(Keyframe(frame, offset, size))
+
+            offset += size
+
+    def read_keyframe(self, keyframe: Keyframe) -> bytes:
+        payload = self.data[keyframe.offset:keyframe.offset + keyframe.size]
+        return zlib.decompress(payload[LATCH.size:])
+
+def format_time(frame: int) -> str:
+    seconds = frame // 60
+    return f"{seconds // 60}:{seconds % 60:02}"
+
+def main():
+    parser = argparse.ArgumentParser(description="Print the contents of a 3SX replay file")
+    parser.add_argument("replay", type=Path)
+    parser.add_argument("--inputs", type=Path, help="write the inputs of every frame to a CSV file")
+    parser.add_argument("--verify", action="store_true", help="decompress every keyframe")
+    args = parser.parse_args()
+
+    try:
+        replay = Replay(args.replay)
+    except ValueError as e:
+        print(f"{args.replay}: {e}")
+        sys.exit(1)
+
+    mode = MODES[replay.mode] if replay.mode < len(MODES) else str(replay.mode)
+    print(f"mode: {mode}")
+    print(f"characters: {replay.characters[0]} vs {replay.characters[1]}")
+    print(f"super arts: {replay.super_arts[0]} vs {replay.super_arts[1]}")
+    print(f"stage: {replay.stage}")
+    print(f"frames: {len(replay.inputs)} ({format_time(len(replay.inputs))})")
+    print(f"keyframes: {len(replay.keyframes)}, every {replay.keyframe_interval} frames")
+    print(f"state size: {replay.state_size} bytes, layout {replay.layout_fingerprint:08x}")
+
+    if replay.keyframes:
+        average = sum(k.size for k in replay.keyframes) / len(replay.keyframes)
+        print(f"average keyframe size: {average:.0f} bytes ({100 * average / replay.state_size:.1f}% of the state)")
+
+    if replay.is_truncated:
+        print("⚠️ the last chunk is incomplete")
+
+    failed = False
+
+    if args.verify:
+        for keyframe in replay.keyframes:
+            state = replay.read_keyframe(keyframe)
+
+            if len(state) != replay.state_size:
+                print(f"⚠️ keyframe at frame {keyframe.frame} has {len(state)} bytes")
+                failed = True
+
+    if args.inputs:
+        with open(args.inputs, "w", newline="") as f:
+            writer = csv.writer(f)
+            writer.writerow(["frame", "p1", "p2"])
+
+            for frame, (p1, p2) in enumerate(replay.inputs):
+                writer.writerow([frame, f"{p1:04x}", f"{p2:04x}"])
+
+    sys.exit(1 if failed else 0)
+
+if __name__ == "__main__":
+    main()